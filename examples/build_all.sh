@@ -14,3 +14,4 @@
 ../nesfab sound_effects/sound_effects.cfg
 ../nesfab trig/trig.cfg
 ../nesfab pbz/pbz.cfg
+../nesfab specialize/specialize.cfg
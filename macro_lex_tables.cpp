@@ -0,0 +1,68 @@
+#include "macro_lex_tables.hpp"
+namespace macro_lex
+{
+extern unsigned const lexer_ec_table[256] = {
+    0, 49, 49, 49, 49, 49, 49, 49, 49, 49, 98, 49, 49, 147, 49, 49,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 196, 245, 49, 49, 49, 294, 49, 49, 343, 49, 49, 49, 49, 392,
+    441, 441, 441, 441, 441, 441, 441, 441, 441, 441, 490, 49, 49, 49, 49, 49,
+    49, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539,
+    539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 49, 49, 49, 49, 441,
+    588, 637, 637, 637, 637, 637, 637, 637, 637, 637, 637, 637, 637, 637, 637, 637,
+    637, 637, 637, 637, 637, 637, 637, 637, 637, 637, 637, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+};
+extern token_type_t const lexer_transition_table[686] = {
+
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25, 0, 4,
+    0, 0, 0, 0, 2, 21, 0, 7, 0, 1, 3, 0, 0, 0, 11, 0,
+    0, 0, 10, 0, 0, 0, 9, 44, 0, 0, 0, 8, 5, 5, 5, 21,
+    6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 0, 0, 0, 0, 2, 21, 0, 7, 0, 1, 3, 0, 0, 0, 11,
+    0, 0, 0, 10, 0, 0, 0, 9, 39, 0, 0, 0, 8, 5, 5, 5,
+    21, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4, 0, 0, 0, 0, 2, 21, 0, 7, 0, 1, 3, 0, 0, 0,
+    11, 0, 0, 0, 10, 0, 0, 0, 9, 45, 0, 0, 0, 8, 5, 5,
+    44, 21, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 4, 0, 0, 0, 0, 2, 21, 0, 7, 0, 1, 3, 0, 0,
+    0, 11, 0, 0, 0, 10, 0, 0, 0, 9, 46, 0, 0, 0, 8, 5,
+    44, 5, 21, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 26, 0, 4, 0, 0, 0, 0, 2, 21, 0, 7, 0, 1, 3, 17,
+    0, 0, 11, 0, 0, 0, 10, 0, 0, 0, 9, 39, 42, 42, 0, 8,
+    5, 5, 5, 21, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 23, 27, 23, 4, 0, 0, 0, 0, 2, 21, 0, 7, 0, 1, 3,
+    0, 0, 30, 11, 0, 0, 34, 10, 0, 0, 38, 9, 39, 0, 0, 43,
+    8, 5, 5, 5, 21, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 15, 0, 4, 0, 0, 0, 0, 2, 21, 0, 7, 0, 1,
+    3, 18, 0, 0, 11, 0, 0, 0, 10, 37, 37, 0, 9, 39, 0, 0,
+    0, 8, 5, 5, 5, 21, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 4, 21, 0, 0, 0, 2, 47, 0, 7, 0,
+    1, 3, 0, 0, 0, 11, 0, 0, 0, 10, 0, 0, 0, 9, 39, 0,
+    0, 0, 8, 5, 5, 5, 21, 6, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 16, 0, 4, 39, 0, 0, 0, 2, 21, 0, 7,
+    0, 1, 3, 0, 0, 0, 11, 0, 0, 0, 10, 0, 0, 0, 9, 39,
+    0, 0, 0, 8, 5, 5, 5, 48, 6, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 12, 0, 14, 4, 0, 0, 0, 0, 2, 21, 0,
+    7, 24, 1, 3, 0, 28, 0, 11, 31, 32, 0, 10, 35, 36, 0, 9,
+    39, 40, 41, 0, 8, 5, 5, 5, 21, 6, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 2, 21,
+    0, 7, 29, 1, 3, 22, 29, 0, 11, 0, 0, 0, 10, 0, 0, 0,
+    9, 39, 0, 0, 0, 8, 5, 5, 5, 21, 6, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 12, 0, 0, 4, 0, 40, 35, 31, 2,
+    21, 24, 7, 24, 1, 3, 12, 0, 0, 11, 31, 0, 0, 10, 35, 0,
+    0, 9, 39, 40, 0, 0, 8, 5, 5, 5, 21, 6, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 4, 0, 0, 0, 0,
+    2, 21, 0, 7, 0, 1, 3, 19, 0, 0, 11, 33, 33, 0, 10, 0,
+    0, 0, 9, 39, 0, 0, 0, 8, 5, 5, 5, 21, 6, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 4, 0, 41, 36,
+    32, 2, 21, 28, 7, 0, 1, 3, 14, 28, 0, 11, 0, 32, 0, 10,
+    0, 36, 0, 9, 39, 0, 41, 0, 8, 5, 5, 5, 21, 6,
+};
+} // namespace macro_lex
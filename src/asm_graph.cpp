@@ -1356,7 +1356,7 @@ void do_inst_rw(fn_t const& fn, rh::batman_set<locator_t> const& map, asm_inst_t
             unsigned const i = &loc - map.begin();
 
             if(has_fn(loc.lclass()) && loc.fn() == call_h)
-                rw(i, loc.lclass() == LOC_ARG, loc.lclass() == LOC_RETURN);
+                rw(i, loc.lclass() == LOC_ARG && call.arg_reg(loc) < 0, loc.lclass() == LOC_RETURN);
 
             if(loc.lclass() == LOC_GMEMBER)
             {
@@ -1377,9 +1377,9 @@ void do_inst_rw(fn_t const& fn, rh::batman_set<locator_t> const& map, asm_inst_t
         {
             unsigned const i = &loc - map.begin();
 
-            // Every return will be "read" by the rts:
+            // Every return will be "read" by the rts, unless it's passed in a register:
             if(loc.lclass() == LOC_RETURN)
-                rw(i, true, false);
+                rw(i, fn.arg_reg(loc) < 0, false);
 
             // Some gmembers will be written:
             if(loc.lclass() == LOC_GMEMBER)
@@ -1560,14 +1560,18 @@ lvars_manager_t asm_graph_t::build_lvars(fn_t const& fn)
         }
     }
 
-    // All referenced params will interfere with each other:
+    // All referenced params will interfere with each other,
+    // as will the pinned ones, as callers store every one of them:
     bitset_clear_all(bs_size, live);
-    fn.for_each_referenced_param_locator([&](locator_t loc)
+    auto const set_live = [&](locator_t loc)
     { 
         int const i = lvars.index(loc);
         if(i >= 0)
             bitset_set(live, i);
-    });
+    };
+    fn.for_each_referenced_param_locator(set_live);
+    for(locator_t loc : fn.pinned_args())
+        set_live(loc);
     lvars.add_lvar_interferences(live);
 
     return lvars;
@@ -6,6 +6,7 @@
 #include "globals.hpp"
 #include "runtime.hpp"
 #include "compiler_error.hpp"
+#include "superopt.hpp"
 
 bool is_return(asm_inst_t const& inst)
 {
@@ -278,6 +279,135 @@ bool o_peephole(asm_inst_t* begin, asm_inst_t* end)
         }
     });
 
+    changed |= o_superopt(begin, end);
+
+    return changed;
+}
+
+// Applies the rules found by 'superopt_gen.cpp' to windows of straight-line code.
+bool o_superopt(asm_inst_t* begin, asm_inst_t* end)
+{
+    constexpr unsigned MAX_WINDOW = 3;
+    constexpr unsigned MAX_REPLACEMENT = 2;
+
+    auto const key_of = [](superopt_op_t const* ops, unsigned size) -> std::uint32_t
+    {
+        std::uint32_t key = 0;
+        for(unsigned i = 0; i < size; ++i)
+            key |= ((ops[i].name << 1) | ops[i].mem) << (i * 9);
+        return key;
+    };
+
+    static rh::batman_map<std::uint32_t, superopt_rule_t const*> const rule_map = [&]()
+    {
+        rh::batman_map<std::uint32_t, superopt_rule_t const*> map;
+        for(unsigned i = 0; i < num_superopt_rules; ++i)
+            map.insert({ key_of(superopt_rules[i].window, MAX_WINDOW), &superopt_rules[i] });
+        return map;
+    }();
+
+    bool changed = false;
+
+    for(asm_inst_t* start = begin; start < end; ++start)
+    {
+    retry:
+        if(start->op == ASM_PRUNED)
+            continue;
+
+        asm_inst_t* window[MAX_WINDOW];
+        superopt_op_t ops[MAX_WINDOW] = {};
+        locator_t arg = {}, alt = {};
+        addr_mode_t mem_mode = MODE_BAD;
+        unsigned size = 0;
+
+        // Build the largest window starting at 'start'.
+        // Inline assembly is left alone, as it may be timed.
+        for(asm_inst_t* it = start; it && size < MAX_WINDOW; it = next_inst(begin, end, it))
+        {
+            if(it->iasm_child >= 0)
+                break;
+
+            addr_mode_t const mode = op_addr_mode(it->op);
+
+            if(mode == MODE_ZERO_PAGE || mode == MODE_ABSOLUTE)
+            {
+                // Memory ops must share a single location, which mustn't be hardware:
+                if(!it->arg || !is_var_like(it->arg.lclass()) || (it->alt && !is_var_like(it->alt.lclass())))
+                    break;
+
+                if(mem_mode && (arg != it->arg || alt != it->alt || mem_mode != mode))
+                    break;
+
+                arg = it->arg;
+                alt = it->alt;
+                mem_mode = mode;
+                ops[size] = { op_name(it->op), true };
+            }
+            else if(mode == MODE_IMPLIED)
+                ops[size] = { op_name(it->op), false };
+            else
+                break;
+
+            window[size++] = it;
+        }
+
+        // Try the largest window first:
+        for(; size >= 2; --size)
+        {
+            superopt_rule_t const* const* rule = rule_map.mapped(key_of(ops, size));
+            if(!rule)
+                continue;
+
+            bool window_mem = false;
+            unsigned old_size = 0, old_cycles = 0;
+            for(unsigned i = 0; i < size; ++i)
+            {
+                window_mem |= ops[i].mem;
+                old_size += op_size(window[i]->op);
+                old_cycles += op_cycles(window[i]->op);
+            }
+
+            op_t replacement[MAX_REPLACEMENT] = {};
+            unsigned new_size = 0, new_cycles = 0;
+            for(unsigned i = 0; i < MAX_REPLACEMENT && (*rule)->replacement[i].name; ++i)
+            {
+                superopt_op_t const& r = (*rule)->replacement[i];
+                if(r.mem && !window_mem)
+                    goto next_size;
+                if(!(replacement[i] = get_op(r.name, r.mem ? mem_mode : MODE_IMPLIED)))
+                    goto next_size;
+                new_size += op_size(replacement[i]);
+                new_cycles += op_cycles(replacement[i]);
+            }
+
+            // The rules assume zero page, so check the actual cost:
+            if(new_size > old_size || (new_size == old_size && new_cycles >= old_cycles))
+                continue;
+
+            for(unsigned i = 0; i < size; ++i)
+            {
+                asm_inst_t& inst = *window[i];
+
+                if(i < MAX_REPLACEMENT && replacement[i])
+                {
+                    inst.op = replacement[i];
+                    inst.arg = inst.alt = {};
+                    if(op_addr_mode(inst.op) != MODE_IMPLIED)
+                    {
+                        inst.arg = arg;
+                        inst.alt = alt;
+                    }
+                }
+                else
+                    inst.prune();
+            }
+
+            changed = true;
+            goto retry;
+        next_size:;
+        }
+    }
+
     return changed;
 }
 
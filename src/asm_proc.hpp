@@ -110,6 +110,7 @@ void for_each_peephole(asm_inst_t* begin, asm_inst_t* end, Fn const& fn)
 
 bool o_redundant_loads(asm_inst_t* begin, asm_inst_t* end);
 bool o_peephole(asm_inst_t* begin, asm_inst_t* end);
+bool o_superopt(asm_inst_t* begin, asm_inst_t* end);
 
 // A relocatable sequence of assembly instructions, 
 // used after code generation but still amenable to code optimizations.
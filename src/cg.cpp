@@ -136,7 +136,7 @@ private:
 };
 }// end anon namespace
 
-std::size_t code_gen(log_t* log, ir_t& ir, fn_t& fn)
+std::size_t code_gen(log_t* log, ir_t& ir, fn_t& fn, schedule_weights_t const& weights)
 {
     ////////////////////////
     // CFG EDGE SPLITTING //
@@ -321,10 +321,12 @@ std::size_t code_gen(log_t* log, ir_t& ir, fn_t& fn)
             {
                 locator_t const called_loc = called_pair.first;
 
+                // A fn's return can share memory with its args,
+                // so only locators of the same class in the same fn are skipped.
                 if(!called_pair.second.cset
                    || !is_arg_ret(called_loc.lclass()) 
                    || called_loc.fn() == fn.handle() 
-                   || called_loc.fn() == loc.fn())
+                   || (called_loc.fn() == loc.fn() && called_loc.lclass() == loc.lclass()))
                 {
                     continue;
                 }
@@ -410,6 +412,10 @@ std::size_t code_gen(log_t* log, ir_t& ir, fn_t& fn)
                 locator_t const loc = ssa_it->input(i + 1).locator().mem_head();
                 ssa_fwd_edge_t ie = ssa_it->input_edge(i);
 
+                // Values passed in registers never get stored to 'loc'.
+                if(has_fn(loc.lclass()) && loc.fn()->arg_reg(loc) >= 0)
+                    continue;
+
                 if(ie.holds_ref())
                 {
                     // Create a new SSA_early_store node here.
@@ -505,7 +511,7 @@ std::size_t code_gen(log_t* log, ir_t& ir, fn_t& fn)
     }
     
     ir.assert_valid(true);
-    schedule_ir(ir);
+    schedule_ir(ir, weights);
     o_schedule(ir);
 
     for(cfg_ht cfg_it = ir.cfg_begin(); cfg_it; ++cfg_it)
@@ -12,6 +12,7 @@
 #include "bitset.hpp"
 #include "ir.hpp"
 #include "debug_print.hpp"
+#include "cg_schedule.hpp"
 
 //////////
 // data //
@@ -48,10 +49,14 @@ struct cfg_banks_d
 struct ssa_schedule_d
 {
     bitset_uint_t* deps = nullptr;
+    bitset_uint_t* dependents = nullptr; // The nodes which have this in 'deps'.
+    unsigned waiting = 0; // How many 'deps' haven't been scheduled yet.
     ssa_ht carry_user = {};
     int exit_distance = 0;
 
     unsigned index = 0;
+    unsigned order = 0; // Position in the CFG node, used to break ties.
+    int ready_pos = -1; // Position in the ready list, or -1.
 };
 
 struct ssa_isel_d
@@ -102,6 +107,6 @@ inline void cg_data_resize()
 }
 
 // Returns size in bytes of proc:
-std::size_t code_gen(log_t* log, ir_t& ir, fn_t& fn);
+std::size_t code_gen(log_t* log, ir_t& ir, fn_t& fn, schedule_weights_t const& weights = {});
 
 #endif
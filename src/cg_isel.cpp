@@ -1057,6 +1057,61 @@ namespace isel
         }
     };
 
+    // Like the other loads, but does nothing when 'Param' holds no value.
+    template<typename Opt, regs_t Reg, typename Param> [[gnu::noinline]]
+    void load_reg_arg(cpu_t const& cpu, sel_pair_t prev, cons_t const* cont)
+    {
+        if(!Param::value())
+            cont->call(cpu, prev);
+        else if constexpr(Reg == REG_A)
+            load_A<Opt, Param>(cpu, prev, cont);
+        else if constexpr(Reg == REG_X)
+            load_X<Opt, Param>(cpu, prev, cont);
+        else
+            load_Y<Opt, Param>(cpu, prev, cont);
+    }
+
+    // Used to pass arguments in registers. Params holding no value are skipped.
+    template<typename Opt, typename A, typename X, typename Y> [[gnu::noinline]]
+    void load_AXY(cpu_t const& cpu, sel_pair_t prev, cons_t const* cont)
+    {
+        chain
+        < load_reg_arg<Opt, REG_A, A>
+        , load_reg_arg<typename Opt::restrict_to<~REGF_A>, REG_X, X>
+        , load_reg_arg<typename Opt::restrict_to<~REGF_AX>, REG_Y, Y>
+        >(cpu, prev, cont);
+
+        chain
+        < load_reg_arg<Opt, REG_A, A>
+        , load_reg_arg<typename Opt::restrict_to<~REGF_A>, REG_Y, Y>
+        , load_reg_arg<typename Opt::restrict_to<~REGF_AY>, REG_X, X>
+        >(cpu, prev, cont);
+
+        chain
+        < load_reg_arg<Opt, REG_X, X>
+        , load_reg_arg<typename Opt::restrict_to<~REGF_X>, REG_A, A>
+        , load_reg_arg<typename Opt::restrict_to<~REGF_AX>, REG_Y, Y>
+        >(cpu, prev, cont);
+
+        chain
+        < load_reg_arg<Opt, REG_X, X>
+        , load_reg_arg<typename Opt::restrict_to<~REGF_X>, REG_Y, Y>
+        , load_reg_arg<typename Opt::restrict_to<~(REGF_X | REGF_Y)>, REG_A, A>
+        >(cpu, prev, cont);
+
+        chain
+        < load_reg_arg<Opt, REG_Y, Y>
+        , load_reg_arg<typename Opt::restrict_to<~REGF_Y>, REG_A, A>
+        , load_reg_arg<typename Opt::restrict_to<~REGF_AY>, REG_X, X>
+        >(cpu, prev, cont);
+
+        chain
+        < load_reg_arg<Opt, REG_Y, Y>
+        , load_reg_arg<typename Opt::restrict_to<~REGF_Y>, REG_X, X>
+        , load_reg_arg<typename Opt::restrict_to<~(REGF_X | REGF_Y)>, REG_A, A>
+        >(cpu, prev, cont);
+    }
+
     template<typename Opt, typename A, typename C> [[gnu::noinline]]
     void load_AC(cpu_t const& cpu, sel_pair_t prev, cons_t const* cont)
     {
@@ -2337,6 +2392,76 @@ namespace isel
             fill_array<Opt>(def, ssa_value_t(0, TYPE_U), len, resize_to - len);
     }
 
+    // Returns the values 'h' passes in A, X, and Y, when using 'fn_t::reg_args'.
+    std::array<ssa_value_t, 3> reg_arg_values(ssa_ht h)
+    {
+        std::array<ssa_value_t, 3> values = {};
+        for_each_written_global(h, [&](ssa_value_t def, locator_t loc)
+        {
+            if(has_fn(loc.lclass()))
+                if(int const reg = loc.fn()->arg_reg(loc); reg >= 0)
+                    values[reg] = def;
+        });
+        return values;
+    }
+
+    // Stores an argument passed in a register, if it ends up being needed.
+    template<typename Opt, op_name_t StoreOp, typename Param>
+    void store_reg_arg(cpu_t const& cpu, sel_pair_t prev, cons_t const* cont)
+    {
+        if(!Param::value())
+            cont->call(cpu, prev);
+        else
+            store<Opt, StoreOp, Param, Param>(cpu, prev, cont);
+    }
+
+    // If a register holds 'Loc', tracks it as holding 'Def' instead.
+    template<typename Def, typename Loc>
+    void rename_reg_def(cpu_t const& cpu, sel_pair_t prev, cons_t const* cont)
+    {
+        cpu_t cpu_copy = cpu;
+        for(regs_t reg : { REG_A, REG_X, REG_Y })
+            if(cpu_copy.def_eq(reg, Loc::value()))
+                cpu_copy.defs[reg] = Def::value();
+        cont->call(cpu_copy, prev);
+    }
+
+    template<typename Opt, regs_t ArgRegs>
+    void read_arg_regs(cpu_t const& cpu, sel_pair_t prev, cons_t const* cont)
+    {
+        if constexpr(ArgRegs != 0)
+            simple_op<Opt, read_reg_op(ArgRegs)>(cpu, prev, cont);
+        else
+            cont->call(cpu, prev);
+    }
+
+    // Calls a fn using 'fn_t::reg_args'.
+    // p_arg<0> holds the fn, p_arg<2..4> hold the values for A, X, and Y,
+    // and p_arg<5> holds the return locator.
+    template<typename Opt, regs_t ArgRegs>
+    void reg_arg_call(cpu_t const& cpu, sel_pair_t prev, cons_t const* cont, bool returns)
+    {
+        if(returns)
+        {
+            chain
+            < load_AXY<Opt, p_arg<2>, p_arg<3>, p_arg<4>>
+            , read_arg_regs<Opt, ArgRegs>
+            , exact_op<Opt, JSR_ABSOLUTE, null_, p_arg<0>>
+            , simple_op<Opt, write_reg_op(REGF_ISEL)> // Clobbers most everything
+            , store<Opt, STA, p_arg<5>, p_arg<5>>
+            >(cpu, prev, cont);
+        }
+        else
+        {
+            chain
+            < load_AXY<Opt, p_arg<2>, p_arg<3>, p_arg<4>>
+            , read_arg_regs<Opt, ArgRegs>
+            , exact_op<Opt, JSR_ABSOLUTE, null_, p_arg<0>>
+            , simple_op<Opt, write_reg_op(REGF_ISEL)> // Clobbers most everything
+            >(cpu, prev, cont);
+        }
+    }
+
     template<typename Opt>
     void write_globals(ssa_ht h)
     {
@@ -2346,6 +2471,10 @@ namespace isel
             if(def.is_handle() && cset_locator(def.handle()) == loc)
                 return;
 
+            // These get loaded into registers instead:
+            if(has_fn(loc.lclass()) && loc.fn()->arg_reg(loc) >= 0)
+                return;
+
             if(is_tea(def.type().name()))
                 copy_array<Opt>(def, loc);
             else
@@ -3886,6 +4015,26 @@ namespace isel
                         >(cpu, prev, cont);
                     }
                 }
+                else if(call->reg_args())
+                {
+                    auto const values = reg_arg_values(h);
+                    p_arg<2>::set(values[REG_A]);
+                    p_arg<3>::set(values[REG_X]);
+                    p_arg<4>::set(values[REG_Y]);
+
+                    // The return value is stored after the call, if needed.
+                    bool const returns = call->type().return_type().name() != TYPE_VOID;
+                    if(returns)
+                        p_arg<5>::set(locator_t::ret(call, 0, 0).with_byteified(true));
+
+                    switch(call->type().num_params())
+                    {
+                    case 0: reg_arg_call<Opt, 0>(cpu, prev, cont, returns); break;
+                    case 1: reg_arg_call<Opt, REGF_A>(cpu, prev, cont, returns); break;
+                    case 2: reg_arg_call<Opt, REGF_AX>(cpu, prev, cont, returns); break;
+                    default: reg_arg_call<Opt, REGF_AX | REGF_Y>(cpu, prev, cont, returns); break;
+                    }
+                }
                 else
                 {
                     chain
@@ -3912,7 +4061,17 @@ namespace isel
                 exact_op<Opt, JMP_ABSOLUTE, null_, p_label<0>>(cpu, prev, cont);
                 break;
             default:
-                simple_op<Opt, RTS_IMPLIED>(cpu, prev, cont);
+                p_arg<0>::set(state.fn->reg_args() ? reg_arg_values(h)[REG_A] : ssa_value_t());
+                if(p_arg<0>::value())
+                {
+                    chain
+                    < load_A<Opt, p_arg<0>>
+                    , simple_op<Opt, read_reg_op(REGF_A)>
+                    , simple_op<Opt, RTS_IMPLIED>
+                    >(cpu, prev, cont);
+                }
+                else
+                    simple_op<Opt, RTS_IMPLIED>(cpu, prev, cont);
                 break;
             }
             break;
@@ -4427,6 +4586,12 @@ namespace isel
                     select_step<true>(load_then_store<Opt, p_def, p_arg<0>, p_def>);
                 }
             }
+            else if(locator_t const loc = h->input(1).locator(); has_fn(loc.lclass()) && loc.fn()->arg_reg(loc) >= 0)
+            {
+                // Keep using the register the value was passed in.
+                p_arg<0>::set(h->input(1));
+                select_step<true>(chain<rename_reg_def<p_def, p_arg<0>>, ignore_req_store<p_def>>);
+            }
             else
                 select_step<true>(ignore_req_store<p_def>);
             break;
@@ -4519,6 +4684,28 @@ namespace isel
             break;
 
         case SSA_entry:
+            if(state.fn->reg_args())
+            {
+                // Arguments passed in registers get stored to RAM, if needed.
+                unsigned const num_params = state.fn->type().num_params();
+                auto const arg = [&](unsigned i) -> ssa_value_t
+                {
+                    if(i < num_params)
+                        return locator_t::arg(state.fn, i, 0, 0).with_byteified(true);
+                    return {};
+                };
+
+                p_arg<0>::set(arg(0));
+                p_arg<1>::set(arg(1));
+                p_arg<2>::set(arg(2));
+
+                select_step<true>(
+                    chain
+                    < store_reg_arg<Opt, STA, p_arg<0>>
+                    , store_reg_arg<Opt, STX, p_arg<1>>
+                    , store_reg_arg<Opt, STY, p_arg<2>>
+                    >);
+            }
             break;
 
         default: 
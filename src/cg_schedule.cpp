@@ -1,5 +1,6 @@
 #include "cg_schedule.hpp"
 
+#include <algorithm>
 #include <vector>
 
 #include "flat/small_set.hpp"
@@ -19,13 +20,14 @@ class scheduler_t
 public:
     std::vector<ssa_ht> schedule;
 
-    scheduler_t(ir_t& ir, cfg_ht cfg_node);
+    scheduler_t(ir_t& ir, cfg_ht cfg_node, schedule_weights_t const& weights);
 private:
 
     static inline TLS array_pool_t<bitset_uint_t> bitset_pool;
 
     ir_t& ir;
     cfg_ht const cfg_node;
+    schedule_weights_t const weights;
     unsigned set_size = 0;
 
     ssa_ht carry_input_waiting;
@@ -47,10 +49,30 @@ private:
     // The SSA nodes after topological sorting:
     std::vector<ssa_ht> toposorted;
 
+    // The unscheduled SSA nodes which have had all their deps scheduled:
+    std::vector<ssa_ht> ready_list;
+
+    // Large CFG nodes use a heap instead of 'ready_list'.
+    // Its scores are cached, and get updated lazily as they're popped.
+    struct heap_entry_t
+    {
+        int score;
+        unsigned order;
+        ssa_ht h;
+
+        bool operator<(heap_entry_t const& o) const
+            { return score != o.score ? score < o.score : order > o.order; }
+    };
+    bool use_heap = false;
+    std::vector<heap_entry_t> ready_heap;
+    std::vector<heap_entry_t> deferred;
+
     ssa_schedule_d& data(ssa_ht h) const { return cg_data(h).schedule; }
     unsigned& index(ssa_ht h) const { return data(h).index; }
 
     void append_schedule(ssa_ht h);
+    void init_ready();
+    void make_ready(ssa_ht h);
     template<bool Fast>
     void run();
     
@@ -62,7 +84,9 @@ private:
 
     ssa_ht successor_search(ssa_ht last_scheduled);
 
+    int search_score(unsigned relax, ssa_ht h) const;
     ssa_ht full_search(unsigned relax);
+    ssa_ht heap_search();
 
     void calc_exit_distance(ssa_ht ssa, int exit_distance=0) const;
 
@@ -96,9 +120,10 @@ void scheduler_t::calc_exit_distance(ssa_ht ssa, int exit_distance) const
         for_each_node_input(ssa, [&](ssa_ht input){ calc_exit_distance(input, exit_distance); });
 }
 
-scheduler_t::scheduler_t(ir_t& ir, cfg_ht cfg_node_)
+scheduler_t::scheduler_t(ir_t& ir, cfg_ht cfg_node_, schedule_weights_t const& weights)
 : ir(ir)
 , cfg_node(cfg_node_)
+, weights(weights)
 {
     bitset_pool.clear();
     set_size = bitset_size<>(cfg_node->ssa_size());
@@ -778,6 +803,24 @@ void scheduler_t::append_schedule(ssa_ht h)
     bitset_set(scheduled, index(h));
     schedule.push_back(h);
 
+    // Remove from the ready list:
+    if(int const pos = data(h).ready_pos; pos >= 0)
+    {
+        data(ready_list.back()).ready_pos = pos;
+        std::swap(ready_list[pos], ready_list.back());
+        ready_list.pop_back();
+        data(h).ready_pos = -1;
+    }
+
+    // Nodes waiting on this might now be ready:
+    bitset_for_each(set_size, data(h).dependents, [&](unsigned i)
+    {
+        ssa_ht const dependent = toposorted[i];
+        assert(data(dependent).waiting > 0);
+        if(--data(dependent).waiting == 0)
+            make_ready(dependent);
+    });
+
     // Handle array indexes
     if(ssa_indexes8(h->op()))
         add_array_index(h->input(ssa_index8_input(h->op())));
@@ -815,20 +858,67 @@ void scheduler_t::append_schedule(ssa_ht h)
     });
 }
 
+void scheduler_t::init_ready()
+{
+    for(ssa_ht h : toposorted)
+        data(h).dependents = bitset_pool.alloc(set_size);
+
+    for(ssa_ht h : toposorted)
+    {
+        auto& d = data(h);
+        d.waiting = bitset_popcount(set_size, d.deps);
+        d.ready_pos = -1;
+        bitset_for_each(set_size, d.deps, [&](unsigned i)
+        {
+            bitset_set(data(toposorted[i]).dependents, index(h));
+        });
+    }
+
+    unsigned order = 0;
+    for(ssa_ht h = cfg_node->ssa_begin(); h; ++h)
+        data(h).order = order++;
+
+    for(ssa_ht h : toposorted)
+        if(data(h).waiting == 0)
+            make_ready(h);
+}
+
+void scheduler_t::make_ready(ssa_ht h)
+{
+    auto& d = data(h);
+    assert(d.waiting == 0);
+
+    // Linked nodes can get scheduled before their deps are.
+    if(bitset_test(scheduled, index(h)))
+        return;
+
+    if(use_heap)
+    {
+        ready_heap.push_back({ search_score(0, h), d.order, h });
+        std::push_heap(ready_heap.begin(), ready_heap.end());
+    }
+    else
+    {
+        assert(d.ready_pos < 0);
+        d.ready_pos = ready_list.size();
+        ready_list.push_back(h);
+    }
+}
+
 template<bool Fast>
 void scheduler_t::run()
 {
     assert(bitset_all_clear(set_size, scheduled));
     assert(unused_global_reads.empty());
 
-    if(Fast)
-        std::reverse(toposorted.begin(), toposorted.end());
-
+    use_heap = Fast;
     carry_input_waiting = {};
     ssa_ht candidate = {};
 
     assert(schedule.empty());
 
+    init_ready();
+
     // Always schedule the entry first:
     if(ssa_ht h = cfg_node->first_daisy())
         if(h->op() == SSA_entry)
@@ -845,30 +935,19 @@ void scheduler_t::run()
 
         // Second priority: try to find *any* node that's ready,
         // expanding the search until we succeed.
-        if(Fast)
+        if(!candidate)
         {
-            for(auto it = std::prev(toposorted.end());;--it)
+            if(Fast)
+                candidate = heap_search();
+            else
             {
-                ssa_ht const h = *it;
-
-                if(bitset_test(scheduled, index(h)))
-                    it = toposorted.erase(it);
-                else if(ready(~0, h, scheduled))
+                for(unsigned relax = 0; !candidate; ++relax)
                 {
-                    candidate = h;
-                    toposorted.erase(it);
-                    break;
+                    candidate = full_search(relax);
+                    assert(relax < 100);
                 }
             }
         }
-        else
-        {
-            for(unsigned relax = 0; !candidate; ++relax)
-            {
-                candidate = full_search(relax);
-                assert(relax < 100);
-            }
-        }
 
         // OK, we should definitely have a candidate_h now.
         assert(candidate);
@@ -895,6 +974,7 @@ void scheduler_t::run()
     {
         index(schedule[i]) = i;
         data(schedule[i]).deps = nullptr;
+        data(schedule[i]).dependents = nullptr;
     }
 }
 
@@ -908,9 +988,17 @@ bool scheduler_t::ready(unsigned relax, ssa_ht h, bitset_uint_t const* scheduled
         return false;
 
     // A node is ready when all of its inputs are scheduled.
-    for(unsigned i = 0; i < set_size; ++i)
-        if(d.deps[i] & ~scheduled[i])
+    if(scheduled == this->scheduled)
+    {
+        if(d.waiting)
             return false;
+    }
+    else
+    {
+        for(unsigned i = 0; i < set_size; ++i)
+            if(d.deps[i] & ~scheduled[i])
+                return false;
+    }
 
     if(relax >= 2)
         return true;
@@ -1036,9 +1124,9 @@ ssa_ht scheduler_t::successor_search(ssa_ht last_scheduled)
             }
 
             // Otherwise find the best successor node by comparing path lengths:
-            int score = path_length(0, succ, this->scheduled);
-            score += indexer_score(succ);
-            score += banker_score(succ);
+            int score = path_length(0, succ, this->scheduled) * weights.path_length;
+            score += indexer_score(succ) * weights.indexer;
+            score += banker_score(succ) * weights.banker;
 
             if(score > best_score)
             {
@@ -1066,35 +1154,42 @@ ssa_ht scheduler_t::successor_search(ssa_ht last_scheduled)
     return best;
 }
 
+int scheduler_t::search_score(unsigned relax, ssa_ht h) const
+{
+    int score;
+
+    if(ssa_flags(h->op()) & SSAF_PRIO_SCHEDULE)
+        score = 1 << 16;
+    else
+    {
+        // Fairly arbitrary formula.
+        score = path_length(relax, h, scheduled) * weights.path_length;
+        score += indexer_score(h) * weights.indexer;
+        score += banker_score(h) * weights.banker;
+    }
+
+    // Full searches also care about exit distance:
+    return (score * 8) + data(h).exit_distance;
+}
+
 ssa_ht scheduler_t::full_search(unsigned relax)
 {
     int best_score = INT_MIN;
     ssa_ht best = {};
 
-    for(ssa_ht ssa_it = cfg_node->ssa_begin(); ssa_it; ++ssa_it)
+    // Only nodes in 'ready_list' can be ready.
+    for(ssa_ht h : ready_list)
     {
-        if(!ready(relax, ssa_it, scheduled))
+        if(!ready(relax, h, scheduled))
             continue;
 
-        int score;
+        int const score = search_score(relax, h);
 
-        if(ssa_flags(ssa_it->op()) & SSAF_PRIO_SCHEDULE)
-            score = 1 << 16;
-        else
-        {
-            // Fairly arbitrary formula.
-            score = path_length(relax, ssa_it, scheduled);
-            score += indexer_score(ssa_it);
-            score += banker_score(ssa_it);
-        }
-
-        // Full searches also care about exit distance:
-        score = (score * 8) + data(ssa_it).exit_distance;
-
-        if(score > best_score)
+        // Ties go to the node earliest in the CFG node:
+        if(score > best_score || (score == best_score && data(h).order < data(best).order))
         {
             best_score = score;
-            best = ssa_it;
+            best = h;
         }
     }
 
@@ -1108,14 +1203,90 @@ ssa_ht scheduler_t::full_search(unsigned relax)
     return best;
 }
 
+// Like 'full_search', but pops from 'ready_heap' instead of scoring every ready node.
+// Scores in the heap may be stale, so they're recalculated as they're popped.
+ssa_ht scheduler_t::heap_search()
+{
+    ssa_ht best = {};
+    deferred.clear();
+
+    while(!ready_heap.empty())
+    {
+        std::pop_heap(ready_heap.begin(), ready_heap.end());
+        heap_entry_t entry = ready_heap.back();
+        ready_heap.pop_back();
+
+        if(bitset_test(scheduled, index(entry.h)))
+            continue;
+
+        if(!ready(0, entry.h, scheduled))
+        {
+            deferred.push_back(entry);
+            continue;
+        }
+
+        int const score = search_score(0, entry.h);
+        if(score < entry.score && !ready_heap.empty())
+        {
+            // Requeue it if the score dropped below some other's:
+            heap_entry_t const updated = { score, entry.order, entry.h };
+            if(updated < ready_heap.front())
+            {
+                ready_heap.push_back(updated);
+                std::push_heap(ready_heap.begin(), ready_heap.end());
+                continue;
+            }
+        }
+
+        best = entry.h;
+        break;
+    }
+
+    // If nothing was ready, relax the requirements:
+    for(unsigned relax = 1; !best; ++relax)
+    {
+        int best_score = INT_MIN;
+        unsigned best_order = 0;
+
+        for(heap_entry_t const& entry : deferred)
+        {
+            if(!ready(relax, entry.h, scheduled))
+                continue;
+
+            int const score = search_score(relax, entry.h);
+            if(score > best_score || (score == best_score && entry.order < best_order))
+            {
+                best_score = score;
+                best_order = entry.order;
+                best = entry.h;
+            }
+        }
+
+        assert(relax < 100);
+    }
+
+    for(heap_entry_t const& entry : deferred)
+    {
+        if(entry.h != best)
+        {
+            ready_heap.push_back(entry);
+            std::push_heap(ready_heap.begin(), ready_heap.end());
+        }
+    }
+
+    assert(best);
+    retry_from = {};
+    return best;
+}
+
 } // end anon namespace
 
-void schedule_ir(ir_t& ir)
+void schedule_ir(ir_t& ir, schedule_weights_t const& weights)
 {
     cg_data_resize();
     for(cfg_ht h = ir.cfg_begin(); h; ++h)
     {
-        scheduler_t s(ir, h);
+        scheduler_t s(ir, h, weights);
         cg_data(h).schedule = std::move(s.schedule);
         assert(cg_data(h).schedule.size() == h->ssa_size());
     }
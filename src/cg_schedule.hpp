@@ -1,9 +1,20 @@
-#ifndef Ca_SCHEDULE_HPP
+#ifndef CG_SCHEDULE_HPP
 #define CG_SCHEDULE_HPP
 
 #include "ir_decl.hpp"
 
-void schedule_ir(ir_t& ir);
+// Scales the heuristics the scheduler uses to rank ready nodes.
+// The defaults reproduce the usual schedule.
+struct schedule_weights_t
+{
+    int path_length = 1;
+    int indexer = 1;
+    int banker = 1;
+
+    constexpr bool operator==(schedule_weights_t const&) const = default;
+};
+
+void schedule_ir(ir_t& ir, schedule_weights_t const& weights = {});
 
 // Optimize the IR after scheduling:
 void o_schedule(ir_t& ir);
@@ -165,9 +165,14 @@ void compiler_error(pstring_t pstring, std::string const& what,
     throw compiler_error_t(fmt_error(pstring, what, file));
 }
 
+TLS bool mute_warnings = false;
+
 void compiler_warning(pstring_t pstring, std::string const& what, 
                       file_contents_t const* file)
 {
+    if(mute_warnings)
+        return;
+
     std::string msg = fmt_warning(pstring, what, file);
 
     if(compiler_options().werror)
@@ -184,6 +189,9 @@ void compiler_warning(pstring_t pstring, std::string const& what,
 
 void compiler_warning(std::string const& what, bool formatted)
 {
+    if(mute_warnings)
+        return;
+
     std::string msg = formatted ? what : fmt(CONSOLE_YEL CONSOLE_BOLD "warning: " CONSOLE_RESET "%\n", what);
 
     if(compiler_options().werror)
@@ -7,6 +7,7 @@
 #include "format.hpp"
 #include "pstring.hpp"
 #include "console.hpp"
+#include "thread.hpp"
 
 class compiler_error_t : public std::runtime_error
 {
@@ -48,4 +49,8 @@ void compiler_warning(pstring_t pstring, std::string const& what,
 
 void compiler_warning(std::string const& what, bool formatted = false);
 
+// While set, warnings on this thread are dropped.
+// Used when recompiling code that already had its chance to warn.
+extern TLS bool mute_warnings;
+
 #endif
@@ -1,9 +1,14 @@
 #include "convert.hpp"
 
+#include <condition_variable>
+#include <deque>
 #include <filesystem>
+#include <mutex>
 
 #include "compiler_error.hpp"
 #include "format.hpp"
+#include "options.hpp"
+#include "thread.hpp"
 
 #include "convert_compress.hpp"
 #include "convert_png.hpp"
@@ -88,7 +93,7 @@ static std::vector<std::uint8_t> convert_pal25(std::vector<std::uint8_t> const&
     return ret;
 }
 
-conversion_t convert_file(char const* source, pstring_t script, fs::path preferred_dir, 
+conversion_t convert_file(std::string_view script_name, pstring_t script, fs::path preferred_dir, 
                           string_literal_t const& filename, mods_t const* mods,
                           convert_arg_t* args, std::size_t argn)
 {
@@ -100,7 +105,7 @@ conversion_t convert_file(char const* source, pstring_t script, fs::path preferr
         if(!resource_path(preferred_dir, fs::path(filename.string), path))
             compiler_error(filename.pstring, fmt("Missing file: %", filename.string));
 
-        std::string_view const view = script.view(source);
+        std::string_view const view = script_name;
         conversion_t ret;
 
         auto const read_as_vec = [&]{ return read_binary_file(path.string(), filename.pstring); };
@@ -215,3 +220,148 @@ conversion_t convert_file(char const* source, pstring_t script, fs::path preferr
         throw;
     }
 }
+
+bool convert_async(std::string_view script_name)
+{
+    using namespace std::literals;
+    return script_name == "raw"sv || script_name == "fmt"sv;
+}
+
+namespace
+{
+
+// Runs conversions on a small set of worker threads.
+// Threads are only launched when the compiler is using multiple threads.
+class conversion_service_t
+{
+public:
+    ~conversion_service_t() { stop(); }
+
+    std::shared_future<std::vector<std::uint8_t>> push(std::packaged_task<std::vector<std::uint8_t>()>&& task);
+    void finish();
+private:
+    void run();
+    void stop();
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::deque<std::packaged_task<std::vector<std::uint8_t>()>> m_queue;
+    std::vector<std::shared_future<std::vector<std::uint8_t>>> m_futures;
+#ifndef NO_THREAD
+    std::vector<std::thread> m_threads;
+#endif
+    bool m_stop = false;
+};
+
+conversion_service_t conversion_service;
+
+std::shared_future<std::vector<std::uint8_t>> conversion_service_t::push(std::packaged_task<std::vector<std::uint8_t>()>&& task)
+{
+    std::shared_future<std::vector<std::uint8_t>> future = task.get_future().share();
+
+#ifndef NO_THREAD
+    if(compiler_options().num_threads > 1)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if(!m_stop)
+        {
+            m_futures.push_back(future);
+            m_queue.push_back(std::move(task));
+
+            if(m_threads.empty())
+                for(int i = 0; i < compiler_options().num_threads; ++i)
+                    m_threads.emplace_back([this]{ run(); });
+
+            lock.unlock();
+            m_cv.notify_one();
+            return future;
+        }
+    }
+#endif
+
+    // Single-threaded builds convert immediately:
+    task();
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_futures.push_back(future);
+    return future;
+}
+
+void conversion_service_t::run()
+{
+    while(true)
+    {
+        std::packaged_task<std::vector<std::uint8_t>()> task;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cv.wait(lock, [this]{ return m_stop || !m_queue.empty(); });
+            if(m_stop)
+                return;
+            task = std::move(m_queue.front());
+            m_queue.pop_front();
+        }
+        task();
+    }
+}
+
+void conversion_service_t::finish()
+{
+    std::vector<std::shared_future<std::vector<std::uint8_t>>> futures;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        futures.swap(m_futures);
+    }
+
+    // Rethrow errors in submission order.
+    // (This keeps error messages deterministic.)
+    for(auto const& future : futures)
+        future.get();
+
+    stop();
+}
+
+void conversion_service_t::stop()
+{
+#ifndef NO_THREAD
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_cv.notify_all();
+
+    for(std::thread& thread : m_threads)
+        thread.join();
+
+    m_threads.clear();
+#endif
+}
+
+} // end anonymous namespace
+
+std::vector<std::uint8_t> const& pending_conversion_t::bytes() const
+{
+    return future.get();
+}
+
+pending_conversion_t convert_file_async(std::string_view script_name, pstring_t script, fs::path preferred_dir, 
+                                        string_literal_t const& filename, std::unique_ptr<mods_t> mods,
+                                        std::vector<convert_arg_t> args)
+{
+    assert(convert_async(script_name));
+
+    std::packaged_task<std::vector<std::uint8_t>()> task(
+    [script_name = std::string(script_name), script, preferred_dir = std::move(preferred_dir), filename, 
+     mods = std::move(mods), args = std::move(args)]() mutable
+    {
+        // Only the bytes are kept, as async scripts don't produce anything else:
+        conversion_t conversion = convert_file(script_name, script, preferred_dir, filename, mods.get(), 
+                                               args.data() + 1, args.size() - 1);
+        return std::get<std::vector<std::uint8_t>>(std::move(conversion.data));
+    });
+
+    return { conversion_service.push(std::move(task)) };
+}
+
+void finish_conversions()
+{
+    conversion_service.finish();
+}
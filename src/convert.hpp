@@ -2,7 +2,10 @@
 #define CONVERT_HPP
 
 #include <exception>
+#include <future>
+#include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <variant>
 
@@ -43,10 +46,32 @@ struct conversion_t
     bc::small_vector<conversion_named_values_t, 2> named_values;
 };
 
-conversion_t convert_file(char const* source, pstring_t script, fs::path preferred_dir, 
+conversion_t convert_file(std::string_view script_name, pstring_t script, fs::path preferred_dir, 
                           string_literal_t const& filename, mods_t const* mods,
                           convert_arg_t* args, std::size_t argn);
 
+// Scripts which always convert to a byte vector, without named values, 
+// can be converted asynchronously on worker threads.
+// This overlaps file I/O and decoding with parsing and resolving.
+bool convert_async(std::string_view script_name);
+
+// The result of 'convert_file_async', held by 'TOK_byte_block_pending_array'.
+struct pending_conversion_t
+{
+    std::shared_future<std::vector<std::uint8_t>> future;
+
+    // Waits for the conversion to finish, rethrowing its errors.
+    std::vector<std::uint8_t> const& bytes() const;
+};
+
+pending_conversion_t convert_file_async(std::string_view script_name, pstring_t script, fs::path preferred_dir, 
+                                        string_literal_t const& filename, std::unique_ptr<mods_t> mods,
+                                        std::vector<convert_arg_t> args);
+
+// Waits for every pending conversion, rethrowing the first error.
+// Call from a single thread only, once parsing is done.
+void finish_conversions();
+
 template<typename T>
 struct convert_u8_impl_t 
 { static T call(std::uint8_t u) { return T(u); } };
@@ -25,6 +25,8 @@ constexpr unsigned MAX_CFG_OUTPUT = 256;
 constexpr unsigned INLINE_SIZE_GOAL  = 32;
 constexpr unsigned INLINE_SIZE_LIMIT = 64;
 constexpr unsigned INLINE_SIZE_ONCE  = 128;
+constexpr unsigned INLINE_CALL_PENALTY = 3;
+constexpr unsigned SPECIALIZE_LIMIT = 4; // Per caller
 
 struct group_t;
 class global_t;
@@ -2,6 +2,7 @@
 
 #include <cassert>
 #include <chrono>
+#include <mutex>
 
 #include <boost/container/small_vector.hpp>
 
@@ -14,6 +15,7 @@
 #include "options.hpp"
 #include "ir.hpp"
 #include "ir_util.hpp"
+#include "inline_ir.hpp"
 #include "stmt.hpp"
 #include "eternal_new.hpp"
 #include "lt.hpp"
@@ -27,6 +29,7 @@
 #include "rom_decl.hpp"
 #include "runtime.hpp"
 #include "thread.hpp"
+#include "convert.hpp"
 
 namespace sc = std::chrono;
 namespace bc = boost::container;
@@ -71,6 +74,107 @@ struct block_d
 #endif
 };
 
+namespace // anonymous namespace
+{
+
+// Compile-time fns tend to be called repeatedly with the same arguments,
+// so their results are memoized.
+// When the memo grows past this size, it gets cleared.
+constexpr std::size_t CT_MEMO_MAX_SIZE = 1 << 14;
+
+struct ct_memo_key_t
+{
+    fn_t const* fn = nullptr;
+    std::vector<ssa_value_t> args; // Arrays are flattened into this.
+
+    bool operator==(ct_memo_key_t const&) const = default;
+};
+
+struct ct_memo_hash_t
+{
+    std::size_t operator()(ct_memo_key_t const& key) const noexcept
+    {
+        std::size_t h = std::hash<fn_t const*>{}(key.fn);
+        for(ssa_value_t const& v : key.args)
+            h = rh::hash_combine(h, v.target());
+        return rh::hash_finalize(h);
+    }
+};
+
+class ct_memo_t
+{
+public:
+    // Returns false if the arguments can't be memoized.
+    static bool make_key(ct_memo_key_t& key, fn_t const& fn, 
+                         rval_t const* rvals, type_t const* types, unsigned num_args)
+    {
+        key.fn = &fn;
+        key.args.clear();
+
+        for(unsigned i = 0; i < num_args; ++i)
+        {
+            if(rvals[i].size() != ::num_members(types[i]))
+                return false;
+
+            for(unsigned m = 0; m < rvals[i].size(); ++m)
+            {
+                type_t const mt = ::member_type(types[i], m);
+
+                if(mt.name() == TYPE_TEA)
+                {
+                    ssa_value_t const* array = ct_array(rvals[i][m]);
+                    if(!array)
+                        return false;
+                    key.args.insert(key.args.end(), array, array + mt.array_length());
+                }
+                else if(ssa_value_t const* v = std::get_if<ssa_value_t>(&rvals[i][m]))
+                    key.args.push_back(*v);
+                else
+                    return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool lookup(ct_memo_key_t const& key, rval_t& result)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if(rval_t const* found = m_map.mapped(key))
+        {
+            // Arrays are copy-on-write, so sharing them with the memo is safe.
+            result = *found;
+            ct_memo_stats.hits += 1;
+            return true;
+        }
+
+        ct_memo_stats.misses += 1;
+        return false;
+    }
+
+    void insert(ct_memo_key_t&& key, rval_t const& result)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if(m_map.size() >= CT_MEMO_MAX_SIZE)
+        {
+            m_map.clear();
+            ct_memo_stats.clears += 1;
+        }
+
+        m_map.insert({ std::move(key), result });
+    }
+
+private:
+    std::mutex m_mutex;
+    rh::batman_map<ct_memo_key_t, rval_t, ct_memo_hash_t> m_map;
+};
+
+ct_memo_t ct_memo;
+
+} // end anonymous namespace
+
 class eval_t
 {
 private:
@@ -126,6 +230,9 @@ private:
 
         rh::robin_map<stmt_t const*, label_t> label_map;
 
+        // Counts the calls spliced in by 'fn_t::specialize', per fn.
+        rh::robin_map<fn_ht, unsigned> specializations;
+
         void clear()
         {
             cfg = {};
@@ -142,6 +249,8 @@ private:
             return_jumps.clear();
 
             label_map.clear();
+
+            specializations.clear();
         }
     };
     
@@ -2743,11 +2852,24 @@ expr_value_t eval_t::do_expr(ast_node_t const& ast)
                     rval_args[i] = args[i].rval();
                 }
 
-                try
+                // Only pure fns can be memoized.
+                // When compiling, the only fns interpreted are pure.
+                ct_memo_key_t memo_key;
+                bool const memoize = (call->fclass == FN_CT || is_compile(D))
+                                     && ct_memo_t::make_key(memo_key, *call, rval_args.data(), params, num_args);
+
+                rval_t memo_result;
+                if(memoize && ct_memo.lookup(memo_key, memo_result))
+                    result.val = std::move(memo_result);
+                else try
                 {
                     // NOTE: call as INTERPRET, not D.
                     eval_t sub(do_wrapper_t<INTERPRET>{}, call_pstring, *call, nullptr, rval_args.data(), rval_args.size(),
                                call->def().local_consts.data());
+
+                    if(memoize)
+                        ct_memo.insert(std::move(memo_key), sub.final_result.value);
+
                     result.val = std::move(sub.final_result.value);
                 }
                 catch(out_of_time_t& e)
@@ -2773,20 +2895,52 @@ expr_value_t eval_t::do_expr(ast_node_t const& ast)
 
             compile_fn:
 
-                if(call->fclass == FN_FN && call->always_inline())
+                // Calls passing constants can splice in a copy of the fn specialized to them, like inlining:
+                bool specialize = false;
+                if(call->fclass == FN_FN && !call->always_inline())
+                {
+                    unsigned& copies = builder.specializations[call->handle()];
+                    if((specialize = call->specialize(copies, [&](unsigned i) { return args[i].is_ct(); })))
+                        ++copies;
+                }
+
+                if(call->fclass == FN_FN && (call->always_inline() || specialize))
                 {
                     cfg_exits_with_jump();
                     cfg_ht const pre_entry = builder.cfg;
                     cfg_ht const post_exit = insert_cfg(true);
 
                     cfg_ht exit = {};
-
-                    ir_builder_t call_builder;
                     rval_t return_rval;
 
-                    eval_t inline_eval(
-                        *this, *ir, *call, call_builder, 
-                        pre_entry, exit, args, return_rval);
+                    // Prefer splicing in the fn's already optimized IR, if it has one:
+                    if(inline_ir_t const* inline_ir = call->inline_ir())
+                    {
+                        type_t const return_type = fn_expr.type.return_type();
+                        bc::small_vector<ssa_value_t, 8> return_values;
+                        if(return_type != TYPE_VOID)
+                            return_values.resize(::num_members(return_type));
+
+                        exit = inline_ir->splice(
+                            pre_entry,
+                            [&]{ return insert_cfg(true); },
+                            [&](unsigned i, unsigned m)
+                            {
+                                return from_variant<COMPILE>(args[i].rval()[m], member_type(params[i], m));
+                            },
+                            return_values.data());
+
+                        for(ssa_value_t v : return_values)
+                            return_rval.push_back(v);
+                    }
+                    else
+                    {
+                        ir_builder_t call_builder;
+
+                        eval_t inline_eval(
+                            *this, *ir, *call, call_builder, 
+                            pre_entry, exit, args, return_rval);
+                    }
                     assert(exit);
 
                     builder.cfg = post_exit;
@@ -3079,6 +3233,15 @@ expr_value_t eval_t::do_expr(ast_node_t const& ast)
                     }
                     break;
 
+                case TOK_byte_block_pending_array:
+                    {
+                        auto const& data = sub.token.ptr<pending_conversion_t>()->bytes();
+                        paa.reserve(paa.size() + data.size());
+                        for(std::uint8_t i : data)
+                            paa.push_back(locator_t::const_byte(i));
+                    }
+                    break;
+
                 default:
                     {
                         expr_value_t arg = to_rval<D>(do_expr<D>(sub));
@@ -3198,7 +3361,10 @@ expr_value_t eval_t::do_expr(ast_node_t const& ast)
                             compiler_error(sub.token.pstring, fmt("% is not a callable function.", g.name));
 
                         if(precheck_tracked)
+                        {
                             precheck_tracked->calls.emplace(g.handle<fn_ht>(), sub.token.pstring);
+                            precheck_tracked->byte_block_calls.emplace(g.handle<fn_ht>(), sub.token.pstring);
+                        }
 
                         if(!is_check(D))
                         {
@@ -3307,6 +3473,16 @@ expr_value_t eval_t::do_expr(ast_node_t const& ast)
                     }
                     break;
 
+                case TOK_byte_block_pending_array:
+                    if(!is_check(D))
+                    {
+                        auto const& data = sub.token.ptr<pending_conversion_t>()->bytes();
+                        proc.code.reserve(proc.code.size() + data.size());
+                        for(std::uint8_t i : data)
+                            proc.push_inst({ .op = ASM_DATA, .iasm_child = proc.add_pstring(pstring), .arg = locator_t::const_byte(i) });
+                    }
+                    break;
+
                 default:
                     if(!is_check(D))
                     {
@@ -1,6 +1,7 @@
 #ifndef INTERPRET_HPP
 #define INTERPRET_HPP
 
+#include <atomic>
 #include <string>
 #include <exception>
 #include <vector>
@@ -49,6 +50,16 @@ struct fn_not_rt_t : public std::exception
     pstring_t pstring;
 };
 
+// Counters for profiling compile-time call memoization, summed across every thread.
+struct ct_memo_stats_t
+{
+    std::atomic<std::uint64_t> hits = 0;
+    std::atomic<std::uint64_t> misses = 0;
+    std::atomic<std::uint64_t> clears = 0;
+};
+
+inline ct_memo_stats_t ct_memo_stats;
+
 void check_local_const(pstring_t pstring, fn_t* fn, ast_node_t const& expr,
                        local_const_t const* local_consts);
 
@@ -11,6 +11,8 @@
 #include "options.hpp"
 #include "byteify.hpp"
 #include "cg.hpp"
+#include "cg_schedule.hpp"
+#include "constraints.hpp"
 #include "graphviz.hpp"
 #include "thread.hpp"
 #include "guard.hpp"
@@ -20,6 +22,7 @@
 #include "rom.hpp"
 #include "ir_util.hpp"
 #include "ir_algo.hpp"
+#include "inline_ir.hpp"
 #include "debug_print.hpp"
 #include "text.hpp"
 #include "switch.hpp"
@@ -316,6 +319,8 @@ void global_t::precheck_all()
 
     do_all([&](global_t& g){ return g.precheck(nullptr); });
 
+    mark_reachable();
+
     for(fn_t const* fn : modes())
         fn->precheck_finish_mode();
     for(fn_t const* fn : nmis())
@@ -418,7 +423,7 @@ void global_t::precheck_all()
             fn.m_rom_proc.safe().mark_rule(ROMR_STATIC);
 
         // Determine each 'm_precheck_called':
-        if(fn.m_precheck_calls)
+        if(fn.m_precheck_calls && fn.global.reachable())
         {
             fn.m_precheck_calls.for_each([&](fn_ht call)
             {
@@ -445,13 +450,13 @@ global_t* global_t::detect_cycle(global_t& global, idep_class_t pass, idep_class
     for(auto const& pair : global.m_ideps)
     {
         assert(pair.second.calc);
-        assert(pair.second.depends_on);
 
         // If we can calculate:
         if(pair.second.calc > calc)
             continue;
 
-        // If the the idep was computed in a previous pass:
+        // If the the idep was computed in a previous pass,
+        // or is a weak reference:
         if(pair.second.calc < pass || pair.second.depends_on < pass)
             continue;
 
@@ -478,6 +483,45 @@ global_t* global_t::detect_cycle(global_t& global, idep_class_t pass, idep_class
     return nullptr;
 }
 
+// This function isn't thread-safe.
+// Call from a single thread only.
+void global_t::mark_reachable()
+{
+    std::vector<global_t*> stack;
+
+    auto const mark = [&](global_t& global)
+    {
+        if(!global.m_reachable)
+        {
+            global.m_reachable = true;
+            stack.push_back(&global);
+        }
+    };
+
+    // Everything besides fns, vars, and consts is kept, as they're cheap.
+    for(global_t& global : global_ht::values())
+        if(global.gclass() != GLOBAL_FN && global.gclass() != GLOBAL_VAR && global.gclass() != GLOBAL_CONST)
+            mark(global);
+
+    for(fn_t* fn : modes())
+        mark(fn->global);
+    for(fn_t* fn : nmis())
+        mark(fn->global);
+    for(fn_t* fn : irqs())
+        mark(fn->global);
+
+    // 'm_ideps' holds every global named in a definition,
+    // which covers calls, addresses taken, and data used.
+    while(!stack.empty())
+    {
+        global_t& global = *stack.back();
+        stack.pop_back();
+
+        for(auto const& pair : global.m_ideps)
+            mark(*pair.first);
+    }
+}
+
 // This function isn't thread-safe.
 // Call from a single thread only.
 void global_t::count_members()
@@ -504,6 +548,21 @@ void global_t::count_members()
     }
 }
 
+void global_t::reset_order()
+{
+    for(global_t& global : global_ht::values())
+        global.m_ideps_left.store(0);
+
+    for(global_t& global : global_ht::values())
+        for(global_t* iuse : global.m_iuses)
+            ++iuse->m_ideps_left;
+
+    ready.clear();
+    for(global_t& global : global_ht::values())
+        if(global.m_ideps_left == 0)
+            ready.push_back(&global);
+}
+
 // This function isn't thread-safe.
 // Call from a single thread only.
 void global_t::build_order()
@@ -674,6 +733,12 @@ void global_t::compile_all()
     assert(compiler_phase() == PHASE_COMPILE);
 
     do_all([&](global_t& g){ return g.compile(nullptr); });
+
+    // Every fn has now recorded the args of its calls,
+    // so fns can be compiled again, knowing what they're passed:
+    fn_t::m_args_sealed = true;
+    reset_order();
+    do_all([&](global_t& g){ return g.recompile_for_args(); });
 }
 
 global_datum_t* global_t::datum() const
@@ -700,6 +765,20 @@ std::vector<local_const_t> const* global_t::local_consts() const
 // fn_t //
 ///////////
 
+struct fn_t::arg_record_t
+{
+    struct arg_t
+    {
+        constraints_mask_t cm;
+        constraints_t c = constraints_t::top();
+    };
+
+    std::mutex mutex;
+    fc::vector_map<locator_t, arg_t> args;
+    bool unknown = false; // If some caller's args can't be tracked.
+    bool active = false; // Set while recompiling for the args.
+};
+
 fn_t::fn_t(global_t& global, type_t type, fn_def_t&& fn_def, std::unique_ptr<mods_t> mods, 
            fn_class_t fclass, bool iasm) 
 : modded_t(std::move(mods))
@@ -723,6 +802,9 @@ fn_t::fn_t(global_t& global, type_t type, fn_def_t&& fn_def, std::unique_ptr<mod
 
     m_sloppy = compiler_options().sloppy || mod_test(this->mods(), MOD_sloppy);
     m_sloppy &= !mod_test(this->mods(), MOD_sloppy, false);
+
+    if(fclass == FN_FN && !iasm)
+        m_arg_record = std::make_shared<arg_record_t>();
 }
 
 fn_ht fn_t::mode_nmi() const
@@ -864,9 +946,8 @@ void fn_t::calc_ir_bitsets(ir_t const* ir_ptr)
             calls.set(pair.first.id);
         }
     }
-    else
+    else if(ir_ptr) // Unreachable fns have no IR.
     {
-        assert(ir_ptr);
         ir_t const& ir = *ir_ptr;
 
         // Iterate the IR looking for reads and writes
@@ -1136,6 +1217,9 @@ void fn_t::compile_iasm()
 
     calc_ir_bitsets(nullptr);
 
+    // The args assembly passes can't be tracked:
+    precheck_calls().for_each([](fn_ht call){ call->record_unknown_args(); });
+
     assert(def().stmts.size() == 2);
     assert(def().stmts[0].name == STMT_EXPR);
     assert(def().stmts[0].expr[0].token.type == lex::TOK_byte_block_proc);
@@ -1158,10 +1242,141 @@ void fn_t::compile()
     if(fclass == FN_CT)
         return; // Nothing to do!
 
+    if(!global.reachable())
+        return calc_ir_bitsets(nullptr); // Never called, so don't bother.
+
     if(iasm)
         return compile_iasm();
 
-    // Compile the FN.
+    // Info is only kept for the latest compile:
+    auto const compile_for = [&](schedule_weights_t const& weights) -> std::size_t
+    {
+        if(m_info_stream)
+            m_info_stream->str({});
+        return compile_ir(log, weights);
+    };
+
+    std::size_t proc_size = compile_for({});
+
+    // Try a few alternate schedules, keeping whichever generates the smallest code.
+    // Candidates are ranked by the size of the whole proc, not by the scheduler's own costs,
+    // so one set of weights gets picked per fn, rather than per block.
+    // Each attempt rebuilds the IR from scratch, as 'code_gen' consumes it.
+    if(compiler_options().explore_schedules && !sloppy())
+    {
+        // The first compile already warned about anything worth warning about:
+        mute_warnings = true;
+        auto unmute = make_scope_guard([]{ mute_warnings = false; });
+
+        constexpr schedule_weights_t candidates[] =
+        {
+            { .path_length = 1, .indexer = 4, .banker = 1 },
+            { .path_length = 4, .indexer = 1, .banker = 1 },
+            { .path_length = 1, .indexer = 0, .banker = 4 },
+            { .path_length = 1, .indexer = 0, .banker = 0 },
+        };
+
+        schedule_weights_t best = {};
+        schedule_weights_t last = {};
+        std::size_t best_size = proc_size;
+
+        for(schedule_weights_t const& weights : candidates)
+        {
+            std::size_t const size = compile_for(weights);
+            last = weights;
+
+            if(size < best_size)
+            {
+                best = weights;
+                best_size = size;
+            }
+        }
+
+        if(last != best)
+            proc_size = compile_for(best);
+        passert(proc_size == best_size, proc_size, best_size);
+
+        m_schedule_weights = std::make_shared<schedule_weights_t const>(best);
+    }
+
+    m_proc_size = proc_size;
+    m_specialize_size = proc_size;
+
+    // Calculate inline-ability
+    assert(m_always_inline == false);
+    if(fclass == FN_FN && !mod_test(mods(), MOD_inline, false))
+    {
+        // Args and returns not passed in registers make calls more expensive:
+        m_call_cost = 0;
+        m_lvars.for_each_lvar(true, [&](locator_t loc, unsigned)
+        {
+            if((loc.lclass() == LOC_ARG || loc.lclass() == LOC_RETURN) && arg_reg(loc) < 0)
+            {
+                assert(loc.fn() == handle());
+                ++m_call_cost;
+            }
+        });
+
+        // Inlining code that uses banked data would add bank switches to the caller.
+        m_uses_banked_data = !ir_deref_groups().for_each_test([&](group_ht group) -> bool
+        {
+            return !group->using_data();
+        });
+
+        if(referenced())
+        {
+            m_always_inline = false;
+            if(mod_test(mods(), MOD_inline, true))
+                compiler_warning(global.pstring(), fmt("Unable to inline % as its being addressed.", global.name));
+        }
+        else if(mod_test(mods(), MOD_inline, true))
+            m_always_inline = true;
+        else if(precheck_called() == 1)
+        {
+            if(proc_size < INLINE_SIZE_ONCE)
+                m_always_inline = true;
+        }
+        else if(proc_size < INLINE_SIZE_LIMIT)
+        {
+            if(!m_uses_banked_data && proc_size < INLINE_SIZE_GOAL + (m_call_cost * INLINE_CALL_PENALTY))
+                m_always_inline = true;
+        }
+    }
+
+    // Small fns keep their IR around for 'specialize':
+    if(!m_always_inline && proc_size >= INLINE_SIZE_ONCE)
+        m_inline_ir.reset();
+}
+
+bool fn_t::specialize(unsigned copies, std::function<bool(unsigned)> const& const_arg) const
+{
+    assert(global.compiled());
+
+    if(fclass != FN_FN || m_always_inline || !m_inline_ir || m_uses_banked_data)
+        return false;
+
+    // Copies are counted per caller, as callers compile in parallel.
+    // This only uses state that's fixed before 'recompile_for_args',
+    // as recompiled callers have to make the same choices.
+    // Otherwise, a call that was spliced could become a call whose args were never recorded.
+    if(copies >= SPECIALIZE_LIMIT || m_specialize_size >= INLINE_SIZE_ONCE)
+        return false;
+
+    bool any_const = false;
+    for(unsigned i = 0; i < type().num_params(); ++i)
+        any_const |= const_arg(i);
+
+    if(!any_const)
+        return false;
+
+    // Specialize when the copy would be small enough to inline:
+    double const folds = m_inline_ir->estimate_folds([&](unsigned arg, unsigned) { return const_arg(arg); });
+    return double(m_specialize_size) * (1.0 - folds) < INLINE_SIZE_GOAL + (m_call_cost * INLINE_CALL_PENALTY);
+}
+
+// Builds, optimizes, and generates code for the fn, returning the proc's size.
+std::size_t fn_t::compile_ir(log_t* log, schedule_weights_t const& weights)
+{
     ssa_pool::clear();
     cfg_pool::clear();
     ir_t ir;
@@ -1193,6 +1408,11 @@ void fn_t::compile()
 
         unsigned iter = 0;
         unsigned const MAX_ITER = sloppy() ? 10 : 100;
+
+        // If both are set, they cancel out:
+        bool const speed = mod_test(mods(), MOD_speed);
+        bool const size = mod_test(mods(), MOD_size);
+        loop_goal_t const loop_goal = (speed == size) ? LOOP_BALANCED : (speed ? LOOP_SPEED : LOOP_SIZE);
         bool changed;
 
         // Do this first, to reduce the size of the IR:
@@ -1224,7 +1444,7 @@ void fn_t::compile()
             // Thus, they must occur sequentially.
             reset_ai_prep();
             save_graph(ir, fmt("pre_loop_%_%", post_byteified, iter).c_str());
-            RUN_O(o_loop, log, ir, post_byteified);
+            RUN_O(o_loop, log, ir, post_byteified, loop_goal);
             save_graph(ir, fmt("pre_ai_%_%", post_byteified, iter).c_str());
             RUN_O(o_abstract_interpret, log, ir, post_byteified);
             save_graph(ir, fmt("post_ai_%_%", post_byteified, iter).c_str());
@@ -1258,13 +1478,30 @@ void fn_t::compile()
     optimize_suite(false);
     save_graph(ir, "2_o1");
 
+    if(!m_args_sealed)
+    {
+        // Inlined calls splice in this IR, as it's already been optimized once:
+        if(fclass == FN_FN && !referenced() && !mod_test(mods(), MOD_inline, false))
+            m_inline_ir = inline_ir_t::make(ir, *this);
+
+        // Let callees know what they're being passed.
+        // Calls made from byte blocks don't appear as 'SSA_fn_call', so their args can't be tracked:
+        for(auto const& pair : precheck_tracked().byte_block_calls)
+            pair.first->record_unknown_args();
+
+        for(cfg_node_t const& cfg : ir)
+        for(ssa_ht ssa_it = cfg.ssa_begin(); ssa_it; ++ssa_it)
+            if(ssa_it->op() == SSA_fn_call)
+                get_fn(*ssa_it)->record_call_args(*ssa_it);
+    }
+
     // Set the global's 'read' and 'write' bitsets:
     calc_ir_bitsets(&ir);
     assert(ir_reads());
 
     // Convert shifts and switches:
     // NOTE: Do NOT use operator || here.
-    if(o_shl_tables(log, ir) | switch_partial_to_full(ir))
+    if(o_shl_tables(log, ir) | lower_switches(ir))
         optimize_suite(false);
     save_graph(ir, "3_transform");
 
@@ -1275,53 +1512,189 @@ void fn_t::compile()
     optimize_suite(true);
     save_graph(ir, "5_o2");
 
-    std::size_t const proc_size = code_gen(log, ir, *this);
+    // Callers are compiled after this, so they'll see this when generating code.
+    // (When recompiling, callers have already been compiled against the old value.)
+    if(!m_args_sealed)
+        m_reg_args = calc_reg_args();
+
+    std::size_t const proc_size = code_gen(log, ir, *this, weights);
     save_graph(ir, "6_cg");
 
-    // Calculate inline-ability
-    assert(m_always_inline == false);
-    if(fclass == FN_FN && !mod_test(mods(), MOD_inline, false))
+    return proc_size;
+}
+
+void fn_t::record_call_args(ssa_node_t const& fn_call)
+{
+    assert(compiler_phase() == PHASE_COMPILE);
+    assert(fn_call.op() == SSA_fn_call);
+
+    if(!m_arg_record || m_args_sealed)
+        return;
+
+    std::lock_guard<std::mutex> lock(m_arg_record->mutex);
+
+    // Args not passed are unused by this fn, so they can be skipped.
+    for(unsigned i = write_globals_begin(SSA_fn_call); i < fn_call.input_size(); i += 2)
     {
-        if(referenced())
-        {
-            m_always_inline = false;
-            if(mod_test(mods(), MOD_inline, true))
-                compiler_warning(global.pstring(), fmt("Unable to inline % as its being addressed.", global.name));
-        }
-        else if(mod_test(mods(), MOD_inline, true))
-            m_always_inline = true;
-        else if(precheck_called() == 1)
-        {
-            if(proc_size < INLINE_SIZE_ONCE)
-                m_always_inline = true;
-        }
-        else if(proc_size < INLINE_SIZE_LIMIT)
-        {
-            bool const no_banks = ir_deref_groups().for_each_test([&](group_ht group) -> bool
-            {
-                return !group->using_data();
-            });
+        locator_t const loc = fn_call.input(i+1).locator();
+        if(loc.lclass() != LOC_ARG || loc.fn() != handle())
+            continue;
 
-            if(no_banks)
-            {
-                unsigned call_cost = 0;
+        type_t const member_type = ::member_type(type().type(loc.arg()), loc.member());
+        if(!is_arithmetic(member_type.name()))
+            continue;
 
-                m_lvars.for_each_lvar(true, [&](locator_t loc, unsigned)
-                {
-                    if(loc.lclass() == LOC_ARG || loc.lclass() == LOC_RETURN)
-                    {
-                        assert(loc.fn() == handle());
-                        ++call_cost;
-                    }
-                });
+        constraints_mask_t const cm = type_constraints_mask(member_type.name());
+        ssa_value_t const value = fn_call.input(i);
 
-                constexpr unsigned CALL_PENALTY = 3;
+        constraints_t c = constraints_t::bottom(cm);
+        if(value.is_num() && value.num_type_name() == member_type.name())
+            c = constraints_t::const_(value.signed_fixed(), cm);
 
-                if(proc_size < INLINE_SIZE_GOAL + (call_cost * CALL_PENALTY))
-                    m_always_inline = true;
-            }
-        }
+        auto& arg = m_arg_record->args[loc];
+        arg.cm = cm;
+        arg.c = union_(arg.c, c);
+    }
+}
+
+void fn_t::record_unknown_args()
+{
+    if(!m_arg_record)
+        return;
+
+    std::lock_guard<std::mutex> lock(m_arg_record->mutex);
+    m_arg_record->unknown = true;
+}
+
+constraints_t const* fn_t::arg_constraints(locator_t loc, constraints_mask_t const& cm) const
+{
+    if(!m_arg_record || !m_arg_record->active)
+        return nullptr;
+
+    if(auto const* arg = m_arg_record->args.has(loc))
+        if(arg->cm == cm)
+            return &arg->c;
+
+    return nullptr;
+}
+
+// Runs after every fn has compiled, and thus recorded the args of its calls.
+// Like 'compile', callees finish before their callers start, as callers read their state.
+global_t* global_t::recompile_for_args()
+{
+    assert(compiler_phase() == PHASE_COMPILE);
+
+    if(gclass() == GLOBAL_FN)
+        impl<fn_t>().recompile_for_args();
+
+    return completed();
+}
+
+void fn_t::recompile_for_args()
+{
+    assert(m_args_sealed);
+
+    if(!m_arg_record || m_arg_record->unknown || sloppy()
+       || !global.reachable() || referenced() || m_always_inline)
+    {
+        return;
     }
+
+    // Only bother when some arg is narrower than its type:
+    bool narrowed = false;
+    for(auto const& pair : m_arg_record->args)
+        if(!pair.second.c.normal_eq(constraints_t::bottom(pair.second.cm), pair.second.cm))
+            narrowed = true;
+
+    if(!narrowed)
+        return;
+
+    // Callers store into these, so they have to stay allocated:
+    m_lvars.for_each_lvar(true, [&](locator_t loc, unsigned)
+    {
+        if(loc.lclass() == LOC_ARG)
+            m_pinned_args.push_back(loc);
+    });
+
+    // Keep everything 'compile_ir' assigns, in case recompiling doesn't pay off:
+    asm_proc_t original_proc = rom_proc().safe().asm_proc();
+    lvars_manager_t original_lvars = m_lvars;
+    locator_t const original_bank_switch = m_first_bank_switch;
+    auto original_bitsets = std::make_tuple(
+        m_ir_reads, m_ir_writes, m_ir_group_vars, m_ir_deref_groups, m_ir_calls,
+        m_ir_tests_ready, m_ir_io_pure, m_ir_fences, m_returns_in_different_bank);
+    std::string const original_info = m_info_stream ? m_info_stream->str() : std::string();
+
+    if(m_info_stream)
+        m_info_stream->str({});
+
+    schedule_weights_t const weights = m_schedule_weights ? *m_schedule_weights : schedule_weights_t{};
+
+    // 'compile' already warned about anything worth warning about:
+    mute_warnings = true;
+    m_arg_record->active = true;
+    std::size_t const proc_size = compile_ir(nullptr, weights);
+    m_arg_record->active = false;
+    mute_warnings = false;
+
+    // Callers were compiled expecting the same bank switch.
+    if(proc_size < m_proc_size && m_first_bank_switch == original_bank_switch)
+    {
+        m_proc_size = proc_size;
+        return;
+    }
+
+    // It didn't pay off, so go back to the original code:
+    rom_proc().safe().assign(std::move(original_proc));
+    assign_lvars(std::move(original_lvars));
+    m_first_bank_switch = original_bank_switch;
+    std::tie(m_ir_reads, m_ir_writes, m_ir_group_vars, m_ir_deref_groups, m_ir_calls,
+             m_ir_tests_ready, m_ir_io_pure, m_ir_fences, m_returns_in_different_bank) = std::move(original_bitsets);
+
+    if(m_info_stream)
+        m_info_stream->str(original_info);
+}
+
+bool fn_t::calc_reg_args() const
+{
+    if(!compiler_options().reg_args || fclass != FN_FN || referenced())
+        return false;
+
+    // Only leaf functions qualify:
+    if(!ir_calls().all_clear())
+        return false;
+
+    // Banked calls use registers to switch banks.
+    if(mapper().bankswitches() && !mod_test(mods(), MOD_static))
+        return false;
+
+    auto const byte_sized = [](type_t type) { return is_arithmetic(type.name()) && total_bytes(type.name()) == 1; };
+
+    if(type().num_params() > 3)
+        return false;
+
+    for(unsigned i = 0; i < type().num_params(); ++i)
+        if(!byte_sized(type().types()[i]))
+            return false;
+
+    return type().return_type().name() == TYPE_VOID || byte_sized(type().return_type());
+}
+
+int fn_t::arg_reg(locator_t loc) const
+{
+    if(!m_reg_args || !has_fn(loc.lclass()) || loc.fn() != handle())
+        return -1;
+
+    if(loc.lclass() == LOC_ARG)
+    {
+        assert(loc.arg() < 3);
+        return REG_A + loc.arg();
+    }
+
+    if(loc.lclass() == LOC_RETURN)
+        return REG_A;
+
+    return -1;
 }
 
 void fn_t::precheck_finish_mode() const
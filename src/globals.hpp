@@ -2,6 +2,7 @@
 #define GLOBALS_HPP
 
 #include <cassert>
+#include <functional>
 #include <ostream>
 #include <sstream>
 
@@ -34,6 +35,10 @@
 
 struct rom_array_t;
 struct precheck_tracked_t;
+struct schedule_weights_t;
+struct constraints_t;
+struct constraints_mask_t;
+class inline_ir_t;
 
 namespace bc = boost::container;
 
@@ -71,6 +76,8 @@ private:
 
     // 'ideps' means "immediate dependencies".
     // AKA any global name that appears in the definition of this global.
+    // Names that only have their address taken are included as BAD_IDEP,
+    // which don't affect ordering.
     // This is set by 'define'
     ideps_map_t m_ideps;
 
@@ -79,6 +86,10 @@ private:
     fc::vector_set<global_t*> m_iuses;
     std::atomic<int> m_ideps_left = 0;
 
+    // Set by 'mark_reachable', after precheck.
+    // Unreachable globals won't be compiled or allocated.
+    bool m_reachable = false;
+
     // These are for debugging:
 #ifndef NDEBUG
     std::atomic<bool> m_resolved = false;
@@ -100,6 +111,7 @@ public:
     ideps_map_t const& ideps() const { assert(compiler_phase() > PHASE_PARSE); return m_ideps; }
     pstring_t pstring() const { return m_pstring; }
     unsigned impl_id() const { assert(compiler_phase() > PHASE_PARSE); return m_impl_id; }
+    bool reachable() const { assert(compiler_phase() >= PHASE_PRECHECK); return m_reachable; }
 
 #ifndef NDEBUG
     bool resolved() const { return m_resolved; }
@@ -170,6 +182,10 @@ public:
     static global_t* detect_cycle(global_t& global, idep_class_t pass, idep_class_t calc);
     inline static std::vector<std::string> detect_cycle_error_msgs;
 
+    // Implementation detail used in 'precheck_all'.
+    // Marks every global reachable from a mode, nmi, or irq through 'm_ideps'.
+    static void mark_reachable();
+
     // This allocates 'gmember_t's.
     static void count_members(); 
 
@@ -179,6 +195,10 @@ public:
     // Call from a single thread only.
     static void build_order();
 
+    // Lets 'do_all' run through the order built by 'build_order' again.
+    // This function isn't thread-safe.
+    static void reset_order();
+
     // Call after 'build_order'. Dethunkifies types.
     static void resolve_all();
 
@@ -211,6 +231,7 @@ private:
     global_t* resolve(log_t* log);
     global_t* precheck(log_t* log);
     global_t* compile(log_t* log);
+    global_t* recompile_for_args();
 
     // Call on completion of compile or precheck.
     // Updates the ready list.
@@ -370,6 +391,7 @@ struct precheck_tracked_t
     std::vector<pstring_mods_t> fences;
     std::vector<std::pair<fn_ht, pstring_mods_t>> goto_modes;
     fc::vector_map<fn_ht, pstring_t> calls;
+    fc::vector_map<fn_ht, pstring_t> byte_block_calls; // Subset of 'calls' made from assembly.
     fc::vector_map<gvar_ht, pstring_t> gvars_used;
 };
 
@@ -429,6 +451,30 @@ public:
 
     bool always_inline() const { assert(global.compiled()); return m_always_inline; }
 
+    // If non-null, inlining can splice in this instead of re-evaluating the fn.
+    inline_ir_t const* inline_ir() const { assert(global.compiled()); return m_inline_ir.get(); }
+
+    // Returns true if a call passing constants for the args 'const_arg' selects should splice in 'inline_ir',
+    // as a copy specialized to those constants. 'copies' counts the caller's previous specializations of this fn.
+    bool specialize(unsigned copies, std::function<bool(unsigned)> const& const_arg) const;
+
+    // Callers record the values they pass as arguments, unioned across every call site.
+    // Once all fns are compiled, 'recompile_for_args' recompiles fns whose args turned out narrower than their types.
+    void record_call_args(ssa_node_t const& fn_call);
+    void record_unknown_args(); // For callers that can't be tracked.
+
+    // Returns what every caller passes to 'loc', but only when recompiling for it.
+    constraints_t const* arg_constraints(locator_t loc, constraints_mask_t const& cm) const;
+
+    // Args which callers were compiled against, that keep their storage after recompiling.
+    std::vector<locator_t> const& pinned_args() const { return m_pinned_args; }
+
+    // With '--reg-args', small leaf fns take their byte-sized arguments in A, X, and Y,
+    // and return their byte-sized result in A. 
+    // Returns the register used to pass 'loc', or -1 if it's passed through RAM.
+    bool reg_args() const { return m_reg_args; }
+    int arg_reg(locator_t loc) const;
+
     locator_t first_bank_switch() const { assert(global.compiled()); return m_first_bank_switch; }
     void assign_first_bank_switch(locator_t loc) { assert(compiler_phase() == PHASE_COMPILE); m_first_bank_switch = loc; }
 
@@ -500,6 +546,9 @@ private:
 
     void calc_precheck_bitsets();
     void calc_ir_bitsets(ir_t const* ir);
+    bool calc_reg_args() const;
+    std::size_t compile_ir(log_t* log, schedule_weights_t const& weights);
+    void recompile_for_args();
 
     template<typename P>
     P& pimpl() const { assert(P::fclass == fclass); return *static_cast<P*>(m_pimpl.get()); }
@@ -547,6 +596,27 @@ private:
     // If the function should be inlined:
     bool m_always_inline = false;
 
+    // A copy of the IR after its first optimizations, used when inlining.
+    std::shared_ptr<inline_ir_t const> m_inline_ir;
+
+    // If the function passes arguments in registers:
+    bool m_reg_args = false;
+
+    // The size of the proc generated, and the schedule that produced it.
+    std::size_t m_proc_size = 0;
+    std::size_t m_specialize_size = 0; // 'm_proc_size' before 'recompile_for_args' changes it.
+    unsigned m_call_cost = 0; // The number of args and returns not passed in registers.
+    bool m_uses_banked_data = false; // If 'ir_deref_groups' uses data groups.
+    std::shared_ptr<schedule_weights_t const> m_schedule_weights;
+
+    // Tracks the args passed by callers, for 'recompile_for_args':
+    struct arg_record_t;
+    std::shared_ptr<arg_record_t> m_arg_record;
+    std::vector<locator_t> m_pinned_args;
+
+    // Set once callers stop recording args:
+    inline static bool m_args_sealed = false;
+
     // The first, dominating bank switch in this function.
     // (This is the bank the fn should be called from.)
     locator_t m_first_bank_switch = {};
@@ -0,0 +1,346 @@
+#include "inline_ir.hpp"
+
+#include <algorithm>
+
+#include "globals.hpp"
+#include "ir.hpp"
+#include "locator.hpp"
+
+namespace // anonymous
+{
+
+bool snapshot_op(ssa_op_t op)
+{
+    switch(op)
+    {
+    case SSA_gen_load:
+    case SSA_ready:
+    case SSA_nmi_counter:
+    case SSA_trace:
+    case SSA_fn_call:
+    case SSA_goto_mode:
+    case SSA_read_mapper_state:
+    case SSA_write_mapper_state:
+    case SSA_phi_copy:
+    case SSA_early_store:
+    case SSA_aliased_store:
+        return false;
+    default:
+        break;
+    }
+
+    return !(ssa_flags(op) & (SSAF_WRITE_GLOBALS | SSAF_IO_IMPURE | SSAF_INDEXES_PTR | SSAF_FENCE | SSAF_BANK_INPUT));
+}
+
+// Only locators which mean the same thing in any fn can be copied.
+bool snapshot_locator(locator_t loc)
+{
+    switch(loc.lclass())
+    {
+    case LOC_FN:
+    case LOC_GCONST:
+    case LOC_DPCM:
+    case LOC_CONST_BYTE:
+    case LOC_ADDR:
+    case LOC_ROM_ARRAY:
+    case LOC_LT_EXPR:
+        return true;
+    default:
+        return false;
+    }
+}
+
+} // end anonymous namespace
+
+std::unique_ptr<inline_ir_t> inline_ir_t::make(ir_t const& ir, fn_t const& fn)
+{
+    if(ir.root->input_size() != 0)
+        return nullptr;
+
+    auto snapshot = std::make_unique<inline_ir_t>();
+
+    // Number the CFG nodes, with the root first:
+    std::vector<cfg_ht> cfgs = { ir.root };
+    std::vector<unsigned> cfg_index(cfg_pool::array_size(), 0);
+    for(cfg_ht cfg_it = ir.cfg_begin(); cfg_it; ++cfg_it)
+    {
+        if(cfg_it == ir.root)
+            continue;
+        cfg_index[cfg_it.id] = cfgs.size();
+        cfgs.push_back(cfg_it);
+    }
+
+    // Number the SSA nodes.
+    // The entry and return nodes aren't copied, and are left as -1.
+    std::vector<int> ssa_index(ssa_pool::array_size(), -1);
+    ssa_ht ret = {};
+
+    for(unsigned c = 0; c < cfgs.size(); ++c)
+    {
+        for(ssa_ht ssa_it = cfgs[c]->ssa_begin(); ssa_it; ++ssa_it)
+        {
+            ssa_node_t const& ssa = *ssa_it;
+
+            if(ssa.op() == SSA_entry)
+                continue;
+
+            if(ssa.op() == SSA_return)
+            {
+                if(ret)
+                    return nullptr;
+                ret = ssa_it;
+                continue;
+            }
+
+            ssa_t copy = { ssa.op(), ssa.type(), c };
+
+            if(ssa.op() == SSA_read_global)
+            {
+                // Only the fn's own arguments can be read, as they get substituted.
+                locator_t const loc = ssa.input(1).locator();
+                if(loc.lclass() != LOC_ARG || loc.fn() != fn.handle() || loc.atom() != 0)
+                    return nullptr;
+
+                copy.arg = loc.arg();
+                copy.member = loc.member();
+            }
+            else if(!snapshot_op(ssa.op()))
+                return nullptr;
+
+            ssa_index[ssa_it.id] = snapshot->ssas.size();
+            snapshot->ssas.push_back(copy);
+        }
+    }
+
+    if(!ret)
+        return nullptr;
+
+    auto const to_input = [&](ssa_value_t v, input_t& input) -> bool
+    {
+        if(v.holds_ref())
+        {
+            input.ssa = ssa_index[v.handle().id];
+            return input.ssa >= 0;
+        }
+
+        if(v.is_locator() && !snapshot_locator(v.locator()))
+            return false;
+
+        input.value = v;
+        return true;
+    };
+
+    for(unsigned c = 0; c < cfgs.size(); ++c)
+    {
+        cfg_node_t const& cfg = *cfgs[c];
+
+        // The return's CFG node has to be the only one without outputs.
+        if((cfg.output_size() == 0) != (cfgs[c] == ret->cfg_node()))
+            return nullptr;
+
+        cfg_t copy = { cfg.output_size() };
+        for(unsigned i = 0; i < cfg.input_size(); ++i)
+        {
+            cfg_fwd_edge_t const edge = cfg.input_edge(i);
+            copy.inputs.push_back({ cfg_index[edge.handle.id], edge.index });
+        }
+        snapshot->cfgs.push_back(std::move(copy));
+
+        for(ssa_ht ssa_it = cfg.ssa_begin(); ssa_it; ++ssa_it)
+        {
+            int const index = ssa_index[ssa_it.id];
+            if(index < 0 || snapshot->ssas[index].arg >= 0)
+                continue;
+
+            ssa_t& copy = snapshot->ssas[index];
+            copy.inputs_begin = snapshot->inputs.size();
+            for(unsigned i = 0; i < ssa_it->input_size(); ++i)
+                if(!to_input(ssa_it->input(i), snapshot->inputs.emplace_back()))
+                    return nullptr;
+            copy.inputs_end = snapshot->inputs.size();
+        }
+
+        for(ssa_ht ssa_it = cfg.first_daisy(); ssa_it; ssa_it = ssa_it->next_daisy())
+            if(int const index = ssa_index[ssa_it.id]; index >= 0 && snapshot->ssas[index].arg < 0)
+                snapshot->daisy.push_back(index);
+    }
+
+    snapshot->exit = cfg_index[ret->cfg_node().id];
+
+    // The return only passes the return value; it can't write globals.
+    type_t const return_type = fn.type().return_type();
+    if(return_type != TYPE_VOID)
+        snapshot->returns.resize(::num_members(return_type));
+
+    std::vector<bool> returned(snapshot->returns.size(), false);
+    for(unsigned i = 0; i < ret->input_size(); i += 2)
+    {
+        locator_t const loc = ret->input(i + 1).locator();
+        if(loc.lclass() != LOC_RETURN || loc.fn() != fn.handle() || loc.atom() != 0)
+            return nullptr;
+        if(loc.member() >= returned.size() || returned[loc.member()])
+            return nullptr;
+        if(!to_input(ret->input(i), snapshot->returns[loc.member()]))
+            return nullptr;
+        returned[loc.member()] = true;
+    }
+
+    for(bool b : returned)
+        if(!b)
+            return nullptr;
+
+    return snapshot;
+}
+
+cfg_ht inline_ir_t::splice(cfg_ht pre_entry,
+                           std::function<cfg_ht()> const& make_cfg,
+                           std::function<ssa_value_t(unsigned, unsigned)> const& arg,
+                           ssa_value_t* return_values) const
+{
+    std::vector<cfg_ht> new_cfgs(cfgs.size());
+    for(cfg_ht& cfg : new_cfgs)
+        cfg = make_cfg();
+
+    std::vector<ssa_value_t> new_ssas(ssas.size());
+    for(unsigned i = 0; i < ssas.size(); ++i)
+    {
+        ssa_t const& ssa = ssas[i];
+        if(ssa.arg >= 0)
+            new_ssas[i] = arg(ssa.arg, ssa.member);
+        else
+            new_ssas[i] = new_cfgs[ssa.cfg]->emplace_ssa(ssa.op, ssa.type);
+    }
+
+    auto const from_input = [&](input_t const& input) -> ssa_value_t
+    {
+        return input.ssa >= 0 ? new_ssas[input.ssa] : input.value;
+    };
+
+    for(unsigned i = 0; i < ssas.size(); ++i)
+    {
+        ssa_t const& ssa = ssas[i];
+        if(ssa.arg >= 0)
+            continue;
+
+        ssa_node_t& node = *new_ssas[i].handle();
+        node.alloc_input(ssa.inputs_end - ssa.inputs_begin);
+        for(unsigned j = ssa.inputs_begin; j < ssa.inputs_end; ++j)
+            node.build_set_input(j - ssa.inputs_begin, from_input(inputs[j]));
+    }
+
+    for(unsigned i : daisy)
+        new_ssas[i].handle()->append_daisy();
+
+    // Outputs get set in the order of their inputs,
+    // keeping phi inputs aligned.
+    for(unsigned c = 0; c < cfgs.size(); ++c)
+        if(c != exit)
+            new_cfgs[c]->alloc_output(cfgs[c].output_size);
+
+    for(unsigned c = 0; c < cfgs.size(); ++c)
+        for(edge_t const& edge : cfgs[c].inputs)
+            new_cfgs[edge.cfg]->build_set_output(edge.output, new_cfgs[c]);
+
+    pre_entry->build_set_output(0, new_cfgs[0]);
+
+    for(unsigned i = 0; i < returns.size(); ++i)
+        return_values[i] = from_input(returns[i]);
+
+    return new_cfgs[exit];
+}
+
+double inline_ir_t::estimate_folds(std::function<bool(unsigned, unsigned)> const& const_arg) const
+{
+    // Ops are weighted by roughly how much code they generate:
+    constexpr unsigned OP_WEIGHT = 1;
+    constexpr unsigned BRANCH_WEIGHT = 2; // The comparison and the branch.
+
+    auto const weight = [](ssa_t const& ssa) -> unsigned
+    {
+        if(ssa.arg >= 0 || ssa.op == SSA_phi || (ssa_flags(ssa.op) & (SSAF_FREE | SSAF_COPY)))
+            return 0;
+        if(ssa_flags(ssa.op) & SSAF_CONDITIONAL)
+            return BRANCH_WEIGHT;
+        return OP_WEIGHT;
+    };
+
+    std::vector<bool> folds(ssas.size(), false);
+    for(unsigned i = 0; i < ssas.size(); ++i)
+        if(ssas[i].arg >= 0)
+            folds[i] = const_arg(ssas[i].arg, ssas[i].member);
+
+    auto const folds_input = [&](input_t const& input) -> bool
+    {
+        return input.ssa >= 0 ? bool(folds[input.ssa]) : input.value.is_num();
+    };
+
+    // A node folds when all its inputs do.
+    // The nodes aren't in dependency order, so this iterates until nothing changes.
+    unsigned folded = 0;
+    bool changed;
+    do
+    {
+        changed = false;
+
+        for(unsigned i = 0; i < ssas.size(); ++i)
+        {
+            ssa_t const& ssa = ssas[i];
+
+            if(folds[i] || ssa.arg >= 0 || ssa.op == SSA_phi || ssa.inputs_begin == ssa.inputs_end)
+                continue;
+
+            // Branches are NO_GVN, but still fold.
+            if((ssa_flags(ssa.op) & (SSAF_NO_GVN | SSAF_CONDITIONAL)) == SSAF_NO_GVN
+               || (ssa_flags(ssa.op) & SSAF_WRITE_ARRAY))
+            {
+                continue;
+            }
+
+            bool all_fold = true;
+            for(unsigned j = ssa.inputs_begin; j < ssa.inputs_end; ++j)
+                all_fold &= folds_input(inputs[j]);
+
+            if(all_fold)
+            {
+                folds[i] = true;
+                changed = true;
+                folded += weight(ssa);
+            }
+        }
+    }
+    while(changed);
+
+    unsigned total = 0;
+    std::vector<unsigned> cfg_weights(cfgs.size(), 0);
+    for(ssa_t const& ssa : ssas)
+    {
+        cfg_weights[ssa.cfg] += weight(ssa);
+        total += weight(ssa);
+    }
+
+    if(total == 0)
+        return 0.0;
+
+    // Folded branches take a single path, removing the others.
+    // Which one is unknown, so this counts the average of the paths not taken,
+    // looking only at the CFG nodes directly after the branch.
+    for(unsigned i = 0; i < ssas.size(); ++i)
+    {
+        if(!folds[i] || !(ssa_flags(ssas[i].op) & SSAF_CONDITIONAL))
+            continue;
+
+        unsigned const branch = ssas[i].cfg;
+        unsigned const num_paths = cfgs[branch].output_size;
+        if(num_paths < 2)
+            continue;
+
+        unsigned paths_weight = 0;
+        for(unsigned c = 0; c < cfgs.size(); ++c)
+            if(cfgs[c].inputs.size() == 1 && cfgs[c].inputs[0].cfg == branch)
+                paths_weight += cfg_weights[c];
+
+        folded += paths_weight * (num_paths - 1) / num_paths;
+    }
+
+    return std::min(1.0, double(folded) / double(total));
+}
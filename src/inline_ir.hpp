@@ -0,0 +1,74 @@
+#ifndef INLINE_IR_HPP
+#define INLINE_IR_HPP
+
+// Fns that get inlined keep a copy of their IR, taken after their first round of optimizations.
+// Inlining splices this copy into the caller, instead of re-evaluating the fn's AST.
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "ir_decl.hpp"
+#include "ir_edge.hpp"
+#include "ssa_op.hpp"
+#include "type.hpp"
+
+class fn_t;
+
+class inline_ir_t
+{
+public:
+    // Returns nullptr if 'ir' can't be snapshot.
+    // Only leaf fns which don't touch globals, pointers, or I/O can be,
+    // as everything else depends on the caller's state.
+    static std::unique_ptr<inline_ir_t> make(ir_t const& ir, fn_t const& fn);
+
+    // Copies the snapshot into the current IR, with 'pre_entry' jumping into it.
+    // 'arg' provides the value of each argument member.
+    // Returns the exit CFG node, whose outputs are left unallocated.
+    cfg_ht splice(cfg_ht pre_entry,
+                  std::function<cfg_ht()> const& make_cfg,
+                  std::function<ssa_value_t(unsigned, unsigned)> const& arg,
+                  ssa_value_t* return_values) const;
+
+    // Estimates the fraction of code that would fold away when splicing with constants for the args 'const_arg' selects.
+    double estimate_folds(std::function<bool(unsigned, unsigned)> const& const_arg) const;
+private:
+    struct edge_t
+    {
+        unsigned cfg; // Into 'cfgs'.
+        unsigned output;
+    };
+
+    struct cfg_t
+    {
+        unsigned output_size;
+        std::vector<edge_t> inputs;
+    };
+
+    struct input_t
+    {
+        ssa_value_t value;
+        int ssa = -1; // If non-negative, replaces 'value' with an index into 'ssas'.
+    };
+
+    struct ssa_t
+    {
+        ssa_op_t op;
+        type_t type;
+        unsigned cfg;
+        unsigned inputs_begin; // Into 'inputs'.
+        unsigned inputs_end;
+        int arg = -1;    // If this is an argument read, which one.
+        unsigned member = 0;
+    };
+
+    std::vector<cfg_t> cfgs; // The root is at [0].
+    std::vector<ssa_t> ssas;
+    std::vector<input_t> inputs;
+    std::vector<unsigned> daisy; // Indexes into 'ssas', in order.
+    std::vector<input_t> returns; // One per member of the return type.
+    unsigned exit = 0;
+};
+
+#endif
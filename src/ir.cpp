@@ -438,6 +438,7 @@ ssa_ht ssa_node_t::prune()
 
 void cfg_node_t::create()
 {
+    ir_t::bump_cfg_epoch();
     assert(m_io.empty());
     m_first_phi = {};
     m_last_daisy = {};
@@ -446,14 +447,15 @@ void cfg_node_t::create()
 
 void cfg_node_t::destroy()
 {
+    ir_t::bump_cfg_epoch();
     assert(!ssa_begin());
     assert(!m_first_phi);
     assert(!m_last_daisy);
     m_io.reset();
 }
 
-void cfg_node_t::alloc_input(unsigned size) { m_io.alloc_input(size); }
-void cfg_node_t::alloc_output(unsigned size) { m_io.alloc_output(size); }
+void cfg_node_t::alloc_input(unsigned size) { ir_t::bump_cfg_epoch(); m_io.alloc_input(size); }
+void cfg_node_t::alloc_output(unsigned size) { ir_t::bump_cfg_epoch(); m_io.alloc_output(size); }
 
 // Returns the input index.
 unsigned cfg_node_t::build_set_output(unsigned i, cfg_ht new_node_h)
@@ -475,6 +477,7 @@ unsigned cfg_node_t::build_append_output(cfg_ht new_node_h)
 
 unsigned cfg_node_t::append_input(cfg_fwd_edge_t edge)
 {
+    ir_t::bump_cfg_epoch();
     unsigned const i = input_size();
     m_io.resize_input(i + 1);
     m_io.input(i) = edge;
@@ -641,6 +644,7 @@ ssa_ht cfg_node_t::prune_ssa(ssa_ht ssa_h)
 void cfg_node_t::steal_outputs(cfg_node_t& cfg)
 {
     assert(output_size() == 0);
+    ir_t::bump_cfg_epoch();
 
     cfg_ht const this_handle = handle();
     unsigned const output_size = cfg.output_size();
@@ -757,6 +761,8 @@ void cfg_node_t::link_swap_inputs(unsigned ai, unsigned bi)
     if(ai == bi)
         return;
 
+    ir_t::bump_cfg_epoch();
+
     cfg_fwd_edge_t& ae = m_io.input(ai);
     cfg_fwd_edge_t& be = m_io.input(bi);
 
@@ -772,6 +778,8 @@ void cfg_node_t::link_swap_outputs(unsigned ai, unsigned bi)
     if(ai == bi)
         return;
 
+    ir_t::bump_cfg_epoch();
+
     cfg_bck_edge_t& ae = m_io.output(ai);
     cfg_bck_edge_t& be = m_io.output(bi);
 
@@ -783,6 +791,7 @@ void cfg_node_t::remove_inputs_output(unsigned i)
 {
     assert(i < input_size());
     assert(m_io.input(i).handle);
+    ir_t::bump_cfg_epoch();
 
     // We'll be removing this node eventually:
     cfg_fwd_edge_t edge = m_io.input(i);
@@ -809,6 +818,7 @@ void cfg_node_t::remove_outputs_input(unsigned i)
 {
     assert(i < output_size());
     assert(m_io.output(i).handle);
+    ir_t::bump_cfg_epoch();
 
     // We'll be removing this node eventually:
     cfg_bck_edge_t edge = m_io.output(i);
@@ -332,6 +332,10 @@ class ir_t
 private:
     cfg_ht m_cfg_begin = {};
     unsigned m_size = 0;
+
+    // Like the node pools, this is thread-local.
+    inline static TLS std::uint64_t m_cfg_epoch = 0;
+    static void bump_cfg_epoch() { ++m_cfg_epoch; }
 public:
     ir_t();
     ir_t(ir_t const&) = delete;
@@ -363,6 +367,10 @@ public:
     // (Clear the node's SSA first!)
     cfg_ht merge_edge(cfg_ht cfg_h);
 
+    // Changes every time a CFG node is created, destroyed, or has its edges modified.
+    // Analyses built from the CFG (see 'ir_algo.hpp') use this to know when they're stale.
+    static std::uint64_t cfg_epoch() { return m_cfg_epoch; }
+
     // Used for debug asserts.
 #ifdef NDEBUG
     [[gnu::always_inline]]
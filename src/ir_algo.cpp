@@ -7,6 +7,42 @@ TLS std::vector<cfg_ht> postorder;
 TLS std::vector<cfg_ht> preorder;
 TLS std::vector<cfg_ht> loop_headers;
 
+////////////////////////////////////////
+// cache
+////////////////////////////////////////
+
+// Passes rebuild these analyses often, usually without having changed the CFG.
+// Tracking which ones are up to date lets redundant rebuilds be skipped.
+namespace // anonymous
+{
+    struct algo_cache_t
+    {
+        ir_t const* ir = nullptr;
+        cfg_ht root = {};
+        std::uint64_t cfg_epoch = 0;
+        bool order = false;
+        bool loops = false;
+        bool dominators = false;
+    };
+
+    TLS algo_cache_t algo_cache;
+
+    bool algo_cache_valid(ir_t const& ir)
+    {
+        return (algo_cache.ir == &ir 
+                && algo_cache.root == ir.root 
+                && algo_cache.cfg_epoch == ir_t::cfg_epoch());
+    }
+
+    // Returns the cache for 'ir', clearing it if the CFG has changed.
+    algo_cache_t& algo_cache_for(ir_t const& ir)
+    {
+        if(!algo_cache_valid(ir))
+            algo_cache = { .ir = &ir, .root = ir.root, .cfg_epoch = ir_t::cfg_epoch() };
+        return algo_cache;
+    }
+}
+
 ////////////////////////////////////////
 // order
 ////////////////////////////////////////
@@ -33,6 +69,10 @@ static void _visit_order(cfg_ht h)
 // This does a basic depth-first traversal of the graph.
 void build_order(ir_t const& ir)
 {
+    algo_cache_t& cache = algo_cache_for(ir);
+    if(cache.order)
+        return;
+
     cfg_algo_pool.resize(cfg_pool::array_size());
 
     for(auto& algo : cfg_algo_pool)
@@ -51,6 +91,8 @@ void build_order(ir_t const& ir)
 
     assert(preorder.empty() || preorder.front() == ir.root);
     assert(postorder.empty() || postorder.back() == ir.root);
+
+    cache.order = true;
 }
 
 ////////////////////////////////////////
@@ -182,6 +224,10 @@ static cfg_ht _visit_loops(cfg_ht node, unsigned dfsp = 1)
 
 void build_loops_and_order(ir_t& ir)
 {
+    algo_cache_t& cache = algo_cache_for(ir);
+    if(cache.loops)
+        return;
+
     cfg_algo_pool.resize(cfg_pool::array_size());
 
     for(auto& u : cfg_algo_pool)
@@ -208,6 +254,10 @@ void build_loops_and_order(ir_t& ir)
 
     assert(preorder.empty() || preorder.front() == ir.root);
     assert(postorder.empty() || postorder.back() == ir.root);
+
+    // The order gets rebuilt identically, so the dominators remain valid.
+    cache.order = true;
+    cache.loops = true;
 }
 
 cfg_ht this_loop_header(cfg_ht h)
@@ -319,6 +369,11 @@ cfg_ht dom_intersect(cfg_ht a, cfg_ht b)
 // By Keith D. Cooper, Timothy J. Harvey, and Ken Kennedy
 void build_dominators_from_order(ir_t& ir)
 {
+    // Only cache the result when the order it was built from is current.
+    bool const cacheable = algo_cache_valid(ir) && algo_cache.order;
+    if(cacheable && algo_cache.dominators)
+        return;
+
     for(auto& algo : cfg_algo_pool)
         algo.idom = {};
 
@@ -351,6 +406,8 @@ void build_dominators_from_order(ir_t& ir)
         }
     }
     while(changed);
+
+    algo_cache.dominators = cacheable;
 }
 
 ////////////////////////////////////////
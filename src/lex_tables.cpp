@@ -2,24 +2,24 @@
 namespace lex
 {
 extern unsigned const lexer_ec_table[256] = {
-    0, 612, 612, 612, 612, 612, 612, 612, 612, 612, 1224, 612, 612, 1836, 612, 612,
-    612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612,
-    2448, 3060, 3672, 4284, 4896, 5508, 6120, 6732, 7344, 7956, 8568, 9180, 9792, 10404, 11016, 11628,
-    12240, 12240, 12852, 12852, 12852, 12852, 12852, 12852, 12852, 12852, 13464, 14076, 14688, 15300, 15912, 612,
-    16524, 17136, 17748, 18360, 18972, 19584, 20196, 20808, 20808, 21420, 20808, 22032, 22644, 23256, 23868, 24480,
-    25092, 20808, 25704, 26316, 26928, 27540, 28152, 28764, 20808, 29376, 20808, 29988, 612, 30600, 31212, 31824,
-    32436, 33048, 33660, 34272, 34884, 35496, 36108, 36720, 37332, 37944, 38556, 39168, 39780, 40392, 41004, 41616,
-    42228, 42840, 43452, 44064, 44676, 45288, 45900, 46512, 47124, 47736, 48348, 48960, 49572, 50184, 50796, 612,
-    612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612,
-    612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612,
-    612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612,
-    612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612,
-    612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612,
-    612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612,
-    612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612,
-    612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612,
+    0, 613, 613, 613, 613, 613, 613, 613, 613, 613, 1226, 613, 613, 1839, 613, 613,
+    613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613,
+    2452, 3065, 3678, 4291, 4904, 5517, 6130, 6743, 7356, 7969, 8582, 9195, 9808, 10421, 11034, 11647,
+    12260, 12260, 12873, 12873, 12873, 12873, 12873, 12873, 12873, 12873, 13486, 14099, 14712, 15325, 15938, 613,
+    16551, 17164, 17777, 18390, 19003, 19616, 20229, 20842, 20842, 21455, 20842, 22068, 22681, 23294, 23907, 24520,
+    25133, 20842, 25746, 26359, 26972, 27585, 28198, 28811, 20842, 29424, 20842, 30037, 613, 30650, 31263, 31876,
+    32489, 33102, 33715, 34328, 34941, 35554, 36167, 36780, 37393, 38006, 38619, 39232, 39845, 40458, 41071, 41684,
+    42297, 42910, 43523, 44136, 44749, 45362, 45975, 46588, 47201, 47814, 48427, 49040, 49653, 50266, 50879, 613,
+    613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613,
+    613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613,
+    613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613,
+    613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613,
+    613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613,
+    613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613,
+    613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613,
+    613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613,
 };
-extern token_type_t const lexer_transition_table[51408] = {
+extern token_type_t const lexer_transition_table[51492] = {
 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -34,32 +34,32 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    171, 116, 211, 1, 4, 4, 5, 79, 68, 127, 66, 124, 174, 122, 3, 222,
-    3, 3, 0, 0, 105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65,
-    70, 108, 121, 110, 81, 171, 171, 171, 171, 133, 171, 171, 171, 171, 171, 148,
-    136, 171, 91, 92, 106, 0, 67, 171, 171, 171, 171, 171, 171, 171, 171, 171,
-    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 89, 107, 90, 78, 2, 605,
-    130, 171, 171, 171, 171, 49, 171, 171, 9, 171, 171, 23, 171, 171, 171, 171,
-    0, 80, 171, 171, 50, 171, 171, 171, 171, 171, 171, 171, 38, 171, 171, 171,
-    171, 29, 43, 171, 171, 171, 171, 171, 22, 171, 36, 171, 39, 171, 171, 171,
-    72, 171, 171, 171, 171, 171, 13, 48, 27, 171, 171, 171, 171, 171, 171, 171,
-    35, 171, 171, 25, 171, 17, 171, 171, 171, 171, 171, 171, 171, 47, 171, 171,
-    171, 171, 16, 41, 171, 42, 171, 44, 171, 171, 74, 171, 171, 20, 6, 171,
-    18, 171, 171, 19, 171, 171, 171, 14, 171, 8, 171, 21, 171, 171, 28, 171,
-    171, 51, 171, 171, 171, 171, 171, 171, 34, 171, 7, 171, 171, 10, 171, 171,
-    171, 171, 31, 171, 24, 171, 171, 171, 15, 171, 171, 171, 171, 171, 12, 171,
-    171, 171, 171, 33, 171, 171, 171, 32, 171, 30, 171, 171, 171, 11, 171, 171,
-    171, 171, 171, 37, 26, 40, 0, 0, 172, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 119, 101, 172, 172, 132,
-    139, 137, 140, 138, 141, 144, 147, 143, 146, 157, 153, 155, 142, 145, 171, 152,
-    150, 151, 149, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
-    171, 171, 64, 171, 62, 171, 171, 61, 171, 63, 158, 172, 172, 169, 162, 163,
-    171, 171, 171, 171, 171, 171, 171, 56, 171, 52, 171, 171, 171, 171, 55, 54,
-    171, 171, 171, 171, 171, 58, 134, 135, 164, 165, 172, 172, 170, 160, 161, 0,
-    111, 104, 112, 154, 0, 103, 109, 118, 129, 171, 156, 159, 100, 0, 171, 171,
-    171, 171, 171, 171, 173, 125, 53, 171, 171, 57, 0, 114, 175, 171, 171, 171,
-    171, 171, 171, 60, 59, 166, 167, 126, 175, 172, 168, 94, 0, 2, 95, 123,
-    2, 174, 113, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 171, 116, 212, 1, 4, 4, 5, 79, 127, 68, 66, 174, 3, 221, 3,
+    3, 0, 0, 105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65, 70,
+    108, 121, 110, 81, 171, 171, 171, 171, 133, 171, 171, 171, 171, 171, 148, 136,
+    171, 91, 92, 106, 0, 67, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 89, 107, 90, 78, 2, 285, 2,
+    171, 171, 171, 171, 49, 171, 171, 9, 171, 171, 23, 171, 171, 171, 171, 0,
+    80, 171, 171, 50, 171, 171, 171, 171, 171, 171, 171, 38, 171, 171, 171, 171,
+    29, 43, 171, 171, 171, 171, 171, 22, 171, 36, 171, 39, 171, 171, 171, 72,
+    171, 171, 171, 171, 171, 13, 48, 27, 171, 171, 171, 171, 171, 171, 171, 35,
+    171, 171, 25, 171, 17, 171, 171, 171, 171, 171, 171, 171, 47, 171, 171, 171,
+    171, 16, 41, 171, 42, 171, 44, 171, 171, 74, 171, 171, 20, 6, 171, 18,
+    171, 171, 19, 171, 171, 171, 14, 171, 8, 171, 21, 171, 171, 28, 171, 171,
+    51, 171, 171, 171, 171, 171, 171, 34, 171, 7, 171, 171, 10, 171, 171, 171,
+    171, 31, 171, 24, 171, 171, 171, 15, 171, 171, 171, 171, 171, 12, 171, 171,
+    171, 171, 33, 171, 171, 171, 32, 171, 30, 171, 171, 171, 11, 171, 171, 171,
+    171, 171, 37, 26, 40, 0, 0, 172, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 0, 103, 109, 130, 101, 119,
+    172, 172, 132, 139, 137, 140, 138, 141, 144, 147, 143, 146, 157, 153, 155, 142,
+    145, 171, 152, 150, 151, 149, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 64, 171, 62, 171, 171, 61, 171, 63, 158, 172, 172,
+    169, 162, 163, 171, 171, 171, 171, 171, 171, 171, 56, 171, 52, 171, 171, 171,
+    171, 55, 54, 171, 171, 171, 171, 171, 58, 134, 135, 164, 165, 172, 172, 170,
+    160, 161, 0, 111, 104, 112, 154, 118, 129, 100, 171, 156, 159, 0, 175, 171,
+    171, 171, 171, 171, 171, 94, 173, 125, 0, 53, 171, 171, 57, 124, 175, 171,
+    171, 171, 114, 126, 171, 171, 171, 60, 59, 166, 167, 122, 172, 168, 2, 95,
+    123, 0, 174, 4, 113, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -72,12 +72,12 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 171, 116, 0, 1, 4, 4, 5, 79, 68, 127, 66, 124,
-    174, 122, 3, 223, 3, 3, 0, 0, 105, 69, 93, 131, 96, 98, 71, 99,
+    0, 0, 0, 0, 0, 0, 171, 116, 0, 1, 4, 4, 5, 79, 127, 68,
+    66, 174, 3, 222, 3, 3, 0, 0, 105, 69, 93, 131, 96, 98, 71, 99,
     82, 97, 173, 65, 70, 108, 121, 110, 81, 171, 171, 171, 171, 133, 171, 171,
     171, 171, 171, 148, 136, 171, 91, 92, 106, 0, 67, 171, 171, 171, 171, 171,
     171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 89, 107,
-    90, 78, 2, 287, 130, 171, 171, 171, 171, 49, 171, 171, 9, 171, 171, 23,
+    90, 78, 2, 286, 2, 171, 171, 171, 171, 49, 171, 171, 9, 171, 171, 23,
     171, 171, 171, 171, 0, 80, 171, 171, 50, 171, 171, 171, 171, 171, 171, 171,
     38, 171, 171, 171, 171, 29, 43, 171, 171, 171, 171, 171, 22, 171, 36, 171,
     39, 171, 171, 171, 72, 171, 171, 171, 171, 171, 13, 48, 27, 171, 171, 171,
@@ -88,16 +88,93 @@ extern token_type_t const lexer_transition_table[51408] = {
     171, 10, 171, 171, 171, 171, 31, 171, 24, 171, 171, 171, 15, 171, 171, 171,
     171, 171, 12, 171, 171, 171, 171, 33, 171, 171, 171, 32, 171, 30, 171, 171,
     171, 11, 171, 171, 171, 171, 171, 37, 26, 40, 0, 0, 172, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 119,
-    101, 172, 172, 132, 139, 137, 140, 138, 141, 144, 147, 143, 146, 157, 153, 155,
-    142, 145, 171, 152, 150, 151, 149, 171, 171, 171, 171, 171, 171, 171, 171, 171,
-    171, 171, 171, 171, 171, 171, 64, 171, 62, 171, 171, 61, 171, 63, 158, 172,
-    172, 169, 162, 163, 171, 171, 171, 171, 171, 171, 171, 56, 171, 52, 171, 171,
-    171, 171, 55, 54, 171, 171, 171, 171, 171, 58, 134, 135, 164, 165, 172, 172,
-    170, 160, 161, 0, 111, 104, 112, 154, 0, 103, 109, 118, 129, 171, 156, 159,
-    100, 0, 171, 171, 171, 171, 171, 171, 173, 125, 53, 171, 171, 57, 0, 114,
-    175, 171, 171, 171, 171, 171, 171, 60, 59, 166, 167, 126, 175, 172, 168, 94,
-    0, 2, 95, 123, 2, 174, 113, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 0,
+    103, 109, 130, 101, 119, 172, 172, 132, 139, 137, 140, 138, 141, 144, 147, 143,
+    146, 157, 153, 155, 142, 145, 171, 152, 150, 151, 149, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 64, 171, 62, 171, 171, 61,
+    171, 63, 158, 172, 172, 169, 162, 163, 171, 171, 171, 171, 171, 171, 171, 56,
+    171, 52, 171, 171, 171, 171, 55, 54, 171, 171, 171, 171, 171, 58, 134, 135,
+    164, 165, 172, 172, 170, 160, 161, 0, 111, 104, 112, 154, 118, 129, 100, 171,
+    156, 159, 0, 175, 171, 171, 171, 171, 171, 171, 94, 173, 125, 0, 53, 171,
+    171, 57, 124, 175, 171, 171, 171, 114, 126, 171, 171, 171, 60, 59, 166, 167,
+    122, 172, 168, 2, 95, 123, 0, 174, 4, 113, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 171, 116, 213, 1, 4,
+    611, 5, 79, 127, 68, 66, 174, 3, 223, 3, 221, 0, 0, 105, 69, 93,
+    131, 96, 98, 71, 99, 82, 97, 173, 65, 70, 108, 121, 110, 81, 171, 171,
+    171, 171, 133, 171, 171, 171, 171, 171, 148, 136, 171, 91, 92, 106, 0, 67,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 89, 107, 90, 78, 2, 287, 2, 171, 171, 171, 171, 49, 171,
+    171, 9, 171, 171, 23, 171, 171, 171, 171, 0, 80, 171, 171, 50, 171, 171,
+    171, 171, 171, 171, 171, 38, 171, 171, 171, 171, 29, 43, 171, 171, 171, 171,
+    171, 22, 171, 36, 171, 39, 171, 171, 171, 72, 171, 171, 171, 171, 171, 13,
+    48, 27, 171, 171, 171, 171, 171, 171, 171, 35, 171, 171, 25, 171, 17, 171,
+    171, 171, 171, 171, 171, 171, 47, 171, 171, 171, 171, 16, 41, 171, 42, 171,
+    44, 171, 171, 74, 171, 171, 20, 6, 171, 18, 171, 171, 19, 171, 171, 171,
+    14, 171, 8, 171, 21, 171, 171, 28, 171, 171, 51, 171, 171, 171, 171, 171,
+    171, 34, 171, 7, 171, 171, 10, 171, 171, 171, 171, 31, 171, 24, 171, 171,
+    171, 15, 171, 171, 171, 171, 171, 12, 171, 171, 171, 171, 33, 171, 171, 171,
+    32, 171, 30, 171, 171, 171, 11, 171, 171, 171, 171, 171, 37, 26, 40, 0,
+    0, 172, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0,
+    0, 0, 45, 128, 0, 103, 109, 130, 101, 119, 172, 172, 132, 139, 137, 140,
+    138, 141, 144, 147, 143, 146, 157, 153, 155, 142, 145, 171, 152, 150, 151, 149,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 64,
+    171, 62, 171, 171, 61, 171, 63, 158, 172, 172, 169, 162, 163, 171, 171, 171,
+    171, 171, 171, 171, 56, 171, 52, 171, 171, 171, 171, 55, 54, 171, 171, 171,
+    171, 171, 58, 134, 135, 164, 165, 172, 172, 170, 160, 161, 0, 111, 104, 112,
+    154, 118, 129, 100, 171, 156, 159, 0, 175, 171, 171, 171, 171, 171, 171, 94,
+    173, 125, 0, 53, 171, 171, 57, 124, 175, 171, 171, 171, 114, 126, 171, 171,
+    171, 60, 59, 166, 167, 122, 172, 168, 285, 95, 123, 0, 174, 4, 113, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    171, 116, 214, 1, 611, 4, 5, 79, 127, 68, 66, 174, 3, 224, 221, 3,
+    0, 0, 105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65, 70, 108,
+    121, 110, 81, 171, 171, 171, 171, 133, 171, 171, 171, 171, 171, 148, 136, 171,
+    91, 92, 106, 0, 67, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 89, 107, 90, 78, 2, 606, 285, 171,
+    171, 171, 171, 49, 171, 171, 9, 171, 171, 23, 171, 171, 171, 171, 0, 80,
+    171, 171, 50, 171, 171, 171, 171, 171, 171, 171, 38, 171, 171, 171, 171, 29,
+    43, 171, 171, 171, 171, 171, 22, 171, 36, 171, 39, 171, 171, 171, 72, 171,
+    171, 171, 171, 171, 13, 48, 27, 171, 171, 171, 171, 171, 171, 171, 35, 171,
+    171, 25, 171, 17, 171, 171, 171, 171, 171, 171, 171, 47, 171, 171, 171, 171,
+    16, 41, 171, 42, 171, 44, 171, 171, 74, 171, 171, 20, 6, 171, 18, 171,
+    171, 19, 171, 171, 171, 14, 171, 8, 171, 21, 171, 171, 28, 171, 171, 51,
+    171, 171, 171, 171, 171, 171, 34, 171, 7, 171, 171, 10, 171, 171, 171, 171,
+    31, 171, 24, 171, 171, 171, 15, 171, 171, 171, 171, 171, 12, 171, 171, 171,
+    171, 33, 171, 171, 171, 32, 171, 30, 171, 171, 171, 11, 171, 171, 171, 171,
+    171, 37, 26, 40, 0, 0, 172, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 46, 0, 0, 0, 0, 45, 128, 0, 103, 109, 130, 101, 119, 172,
+    172, 132, 139, 137, 140, 138, 141, 144, 147, 143, 146, 157, 153, 155, 142, 145,
+    171, 152, 150, 151, 149, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 64, 171, 62, 171, 171, 61, 171, 63, 158, 172, 172, 169,
+    162, 163, 171, 171, 171, 171, 171, 171, 171, 56, 171, 52, 171, 171, 171, 171,
+    55, 54, 171, 171, 171, 171, 171, 58, 134, 135, 164, 165, 172, 172, 170, 160,
+    161, 0, 111, 104, 112, 154, 118, 129, 100, 171, 156, 159, 0, 175, 171, 171,
+    171, 171, 171, 171, 94, 173, 125, 0, 53, 171, 171, 57, 124, 175, 171, 171,
+    171, 114, 126, 171, 171, 171, 60, 59, 166, 167, 122, 172, 168, 2, 95, 123,
+    0, 174, 4, 113, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -110,12 +187,50 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 171, 116, 212, 1, 4, 611, 5, 79,
-    68, 127, 66, 124, 174, 122, 3, 224, 3, 222, 0, 0, 105, 69, 93, 131,
+    0, 0, 0, 0, 0, 171, 116, 215, 1, 4, 4, 215, 79, 127, 68, 66,
+    174, 3, 222, 3, 3, 0, 0, 105, 69, 93, 131, 96, 98, 71, 99, 82,
+    97, 173, 65, 70, 108, 121, 110, 81, 171, 171, 171, 171, 133, 171, 171, 171,
+    171, 171, 148, 136, 171, 91, 92, 106, 0, 67, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 89, 107, 90,
+    78, 2, 286, 2, 171, 171, 171, 171, 49, 171, 171, 9, 171, 171, 23, 171,
+    171, 171, 303, 0, 80, 171, 171, 50, 171, 171, 171, 171, 171, 171, 171, 38,
+    171, 171, 171, 171, 29, 43, 171, 171, 171, 171, 171, 22, 171, 36, 171, 39,
+    171, 171, 171, 72, 171, 171, 171, 171, 171, 13, 48, 27, 171, 171, 171, 171,
+    171, 171, 171, 35, 171, 171, 25, 171, 17, 171, 171, 171, 171, 171, 171, 171,
+    47, 171, 171, 171, 171, 16, 41, 171, 42, 171, 44, 171, 171, 74, 171, 171,
+    20, 6, 171, 18, 171, 171, 19, 171, 171, 171, 14, 171, 8, 171, 21, 171,
+    171, 28, 171, 171, 51, 171, 171, 171, 171, 171, 171, 34, 171, 7, 171, 171,
+    10, 171, 171, 171, 171, 31, 171, 24, 171, 171, 171, 15, 171, 171, 171, 171,
+    171, 12, 171, 171, 171, 171, 33, 171, 171, 171, 32, 171, 30, 171, 171, 171,
+    11, 171, 171, 171, 171, 171, 37, 26, 40, 0, 0, 172, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 0, 103,
+    109, 130, 101, 119, 172, 172, 132, 139, 137, 140, 138, 141, 144, 147, 143, 146,
+    157, 153, 155, 142, 145, 171, 152, 150, 151, 149, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 64, 171, 62, 171, 171, 61, 171,
+    63, 158, 172, 172, 169, 162, 163, 171, 171, 171, 171, 171, 171, 171, 56, 171,
+    52, 171, 171, 171, 171, 55, 54, 171, 171, 171, 171, 171, 58, 134, 135, 164,
+    165, 172, 172, 170, 160, 161, 0, 111, 104, 112, 154, 118, 129, 100, 171, 156,
+    159, 0, 175, 171, 171, 171, 171, 171, 171, 94, 173, 125, 0, 53, 171, 171,
+    57, 124, 175, 171, 171, 171, 114, 126, 171, 171, 171, 60, 59, 166, 167, 122,
+    172, 168, 2, 95, 123, 0, 174, 4, 113, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 171, 116, 216, 1, 4, 4,
+    5, 79, 127, 68, 66, 174, 3, 222, 3, 3, 0, 0, 105, 69, 93, 131,
     96, 98, 71, 99, 82, 97, 173, 65, 70, 108, 121, 110, 81, 171, 171, 171,
     171, 133, 171, 171, 171, 171, 171, 148, 136, 171, 91, 92, 106, 0, 67, 171,
     171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
-    171, 171, 89, 107, 90, 78, 2, 286, 130, 171, 171, 171, 171, 49, 171, 171,
+    171, 171, 89, 107, 90, 78, 2, 286, 2, 171, 171, 171, 171, 49, 171, 171,
     9, 171, 171, 23, 171, 171, 171, 171, 0, 80, 171, 171, 50, 171, 171, 171,
     171, 171, 171, 171, 38, 171, 171, 171, 171, 29, 43, 171, 171, 171, 171, 171,
     22, 171, 36, 171, 39, 171, 171, 171, 72, 171, 171, 171, 171, 171, 13, 48,
@@ -127,53 +242,15 @@ extern token_type_t const lexer_transition_table[51408] = {
     15, 171, 171, 171, 171, 171, 12, 171, 171, 171, 171, 33, 171, 171, 171, 32,
     171, 30, 171, 171, 171, 11, 171, 171, 171, 171, 171, 37, 26, 40, 0, 0,
     172, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0,
-    0, 45, 128, 119, 101, 172, 172, 132, 139, 137, 140, 138, 141, 144, 147, 143,
-    146, 157, 153, 155, 142, 145, 171, 152, 150, 151, 149, 171, 171, 171, 171, 171,
-    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 64, 171, 62, 171, 171, 61,
-    171, 63, 158, 172, 172, 169, 162, 163, 171, 171, 171, 171, 171, 171, 171, 56,
-    171, 52, 171, 171, 171, 171, 55, 54, 171, 171, 171, 171, 171, 58, 134, 135,
-    164, 165, 172, 172, 170, 160, 161, 0, 111, 104, 112, 154, 0, 103, 109, 118,
-    129, 171, 156, 159, 100, 0, 171, 171, 171, 171, 171, 171, 173, 125, 53, 171,
-    171, 57, 0, 114, 175, 171, 171, 171, 171, 171, 171, 60, 59, 166, 167, 126,
-    175, 172, 168, 94, 0, 2, 95, 123, 605, 174, 113, 4, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 171, 116, 213, 1,
-    611, 4, 5, 79, 68, 127, 66, 124, 174, 122, 3, 225, 222, 3, 0, 0,
-    105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65, 70, 108, 121, 110,
-    81, 171, 171, 171, 171, 133, 171, 171, 171, 171, 171, 148, 136, 171, 91, 92,
-    106, 0, 67, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
-    171, 171, 171, 171, 171, 171, 89, 107, 90, 78, 605, 608, 130, 171, 171, 171,
-    171, 49, 171, 171, 9, 171, 171, 23, 171, 171, 171, 171, 0, 80, 171, 171,
-    50, 171, 171, 171, 171, 171, 171, 171, 38, 171, 171, 171, 171, 29, 43, 171,
-    171, 171, 171, 171, 22, 171, 36, 171, 39, 171, 171, 171, 72, 171, 171, 171,
-    171, 171, 13, 48, 27, 171, 171, 171, 171, 171, 171, 171, 35, 171, 171, 25,
-    171, 17, 171, 171, 171, 171, 171, 171, 171, 47, 171, 171, 171, 171, 16, 41,
-    171, 42, 171, 44, 171, 171, 74, 171, 171, 20, 6, 171, 18, 171, 171, 19,
-    171, 171, 171, 14, 171, 8, 171, 21, 171, 171, 28, 171, 171, 51, 171, 171,
-    171, 171, 171, 171, 34, 171, 7, 171, 171, 10, 171, 171, 171, 171, 31, 171,
-    24, 171, 171, 171, 15, 171, 171, 171, 171, 171, 12, 171, 171, 171, 171, 33,
-    171, 171, 171, 32, 171, 30, 171, 171, 171, 11, 171, 171, 171, 171, 171, 37,
-    26, 40, 0, 0, 172, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    46, 0, 0, 0, 0, 45, 128, 119, 101, 172, 172, 132, 139, 137, 140, 138,
+    0, 45, 128, 0, 103, 109, 130, 101, 119, 172, 172, 132, 139, 137, 140, 138,
     141, 144, 147, 143, 146, 157, 153, 155, 142, 145, 171, 152, 150, 151, 149, 171,
     171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 64, 171,
     62, 171, 171, 61, 171, 63, 158, 172, 172, 169, 162, 163, 171, 171, 171, 171,
     171, 171, 171, 56, 171, 52, 171, 171, 171, 171, 55, 54, 171, 171, 171, 171,
     171, 58, 134, 135, 164, 165, 172, 172, 170, 160, 161, 0, 111, 104, 112, 154,
-    0, 103, 109, 118, 129, 171, 156, 159, 100, 0, 171, 171, 171, 171, 171, 171,
-    173, 125, 53, 171, 171, 57, 0, 114, 175, 171, 171, 171, 171, 171, 171, 60,
-    59, 166, 167, 126, 175, 172, 168, 94, 0, 2, 95, 123, 2, 174, 113, 4,
+    118, 129, 100, 171, 156, 159, 0, 175, 171, 171, 171, 171, 171, 171, 94, 173,
+    125, 0, 53, 171, 171, 57, 124, 175, 171, 171, 171, 114, 126, 171, 171, 171,
+    60, 59, 166, 167, 122, 172, 168, 2, 95, 123, 0, 174, 4, 113, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -186,33 +263,33 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    171, 116, 214, 1, 4, 4, 214, 79, 68, 127, 66, 124, 174, 122, 3, 223,
-    3, 3, 0, 0, 105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65,
-    70, 108, 121, 110, 81, 171, 171, 171, 171, 133, 171, 171, 171, 171, 171, 148,
-    136, 171, 91, 92, 106, 0, 67, 171, 171, 171, 171, 171, 171, 171, 171, 171,
-    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 89, 107, 90, 78, 2, 287,
-    130, 171, 171, 171, 171, 49, 171, 171, 9, 171, 171, 23, 171, 171, 171, 304,
-    0, 80, 171, 171, 50, 171, 171, 171, 171, 171, 171, 171, 38, 171, 171, 171,
-    171, 29, 43, 171, 171, 171, 171, 171, 22, 171, 36, 171, 39, 171, 171, 171,
-    72, 171, 171, 171, 171, 171, 13, 48, 27, 171, 171, 171, 171, 171, 171, 171,
-    35, 171, 171, 25, 171, 17, 171, 171, 171, 171, 171, 171, 171, 47, 171, 171,
-    171, 171, 16, 41, 171, 42, 171, 44, 171, 171, 74, 171, 171, 20, 6, 171,
-    18, 171, 171, 19, 171, 171, 171, 14, 171, 8, 171, 21, 171, 171, 28, 171,
-    171, 51, 171, 171, 171, 171, 171, 171, 34, 171, 7, 171, 171, 10, 171, 171,
-    171, 171, 31, 171, 24, 171, 171, 171, 15, 171, 171, 171, 171, 171, 12, 171,
-    171, 171, 171, 33, 171, 171, 171, 32, 171, 30, 171, 171, 171, 11, 171, 171,
-    171, 171, 171, 37, 26, 40, 0, 0, 172, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 119, 101, 172, 172, 132,
-    139, 137, 140, 138, 141, 144, 147, 143, 146, 157, 153, 155, 142, 145, 171, 152,
-    150, 151, 149, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
-    171, 171, 64, 171, 62, 171, 171, 61, 171, 63, 158, 172, 172, 169, 162, 163,
-    171, 171, 171, 171, 171, 171, 171, 56, 171, 52, 171, 171, 171, 171, 55, 54,
-    171, 171, 171, 171, 171, 58, 134, 135, 164, 165, 172, 172, 170, 160, 161, 0,
-    111, 104, 112, 154, 0, 103, 109, 118, 129, 171, 156, 159, 100, 0, 171, 171,
-    171, 171, 171, 171, 173, 125, 53, 171, 171, 57, 0, 114, 175, 171, 171, 171,
-    171, 171, 171, 60, 59, 166, 167, 126, 175, 172, 168, 94, 0, 2, 95, 123,
-    2, 174, 113, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 171,
+    116, 218, 1, 4, 4, 5, 79, 127, 68, 66, 174, 3, 222, 3, 3, 0,
+    0, 105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65, 70, 108, 121,
+    110, 81, 171, 171, 171, 171, 133, 171, 171, 171, 171, 171, 148, 136, 171, 91,
+    92, 106, 0, 67, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 89, 107, 90, 78, 2, 286, 2, 171, 171,
+    171, 171, 49, 171, 171, 9, 171, 171, 23, 171, 171, 171, 171, 0, 80, 171,
+    171, 50, 171, 171, 171, 171, 171, 171, 171, 38, 171, 171, 171, 171, 29, 43,
+    171, 171, 171, 171, 171, 22, 171, 36, 171, 39, 171, 171, 171, 72, 171, 171,
+    171, 171, 171, 13, 48, 27, 171, 171, 171, 171, 171, 171, 171, 35, 171, 171,
+    25, 171, 17, 171, 171, 171, 171, 171, 171, 171, 47, 171, 171, 171, 171, 16,
+    41, 171, 42, 171, 44, 171, 171, 74, 171, 171, 20, 6, 171, 18, 171, 171,
+    19, 171, 171, 171, 14, 171, 8, 171, 21, 171, 171, 28, 171, 171, 51, 171,
+    171, 171, 171, 171, 171, 34, 171, 7, 171, 171, 10, 171, 171, 171, 171, 31,
+    171, 24, 171, 171, 171, 15, 171, 171, 171, 171, 171, 12, 171, 171, 171, 171,
+    33, 171, 171, 171, 32, 171, 30, 171, 171, 171, 11, 171, 171, 171, 171, 171,
+    37, 26, 40, 0, 0, 172, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 46, 0, 0, 0, 0, 45, 128, 0, 103, 109, 130, 101, 119, 172, 172,
+    132, 139, 137, 140, 138, 141, 144, 147, 143, 146, 157, 153, 155, 142, 145, 171,
+    152, 150, 151, 149, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 64, 171, 62, 171, 171, 61, 171, 63, 158, 172, 172, 169, 162,
+    163, 171, 171, 171, 171, 171, 171, 171, 56, 171, 52, 171, 171, 171, 171, 55,
+    54, 171, 171, 171, 171, 171, 58, 134, 135, 164, 165, 172, 172, 170, 160, 161,
+    0, 111, 104, 112, 154, 118, 129, 100, 171, 156, 159, 0, 175, 171, 171, 171,
+    171, 171, 171, 94, 173, 125, 0, 53, 171, 171, 57, 124, 175, 171, 171, 171,
+    114, 126, 171, 171, 171, 60, 59, 166, 167, 122, 172, 168, 2, 95, 123, 0,
+    174, 4, 113, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -225,32 +302,32 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 171, 116, 215, 1, 4, 4, 5, 79, 68, 127, 66, 124,
-    174, 122, 3, 223, 3, 3, 0, 0, 105, 69, 93, 131, 96, 98, 71, 99,
-    82, 97, 173, 65, 70, 108, 121, 110, 81, 171, 171, 171, 171, 133, 171, 171,
-    171, 171, 171, 148, 136, 171, 91, 92, 106, 0, 67, 171, 171, 171, 171, 171,
-    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 89, 107,
-    90, 78, 2, 287, 130, 171, 171, 171, 171, 49, 171, 171, 9, 171, 171, 23,
-    171, 171, 171, 171, 0, 80, 171, 171, 50, 171, 171, 171, 171, 171, 171, 171,
-    38, 171, 171, 171, 171, 29, 43, 171, 171, 171, 171, 171, 22, 171, 36, 171,
-    39, 171, 171, 171, 72, 171, 171, 171, 171, 171, 13, 48, 27, 171, 171, 171,
-    171, 171, 171, 171, 35, 171, 171, 25, 171, 17, 171, 171, 171, 171, 171, 171,
-    171, 47, 171, 171, 171, 171, 16, 41, 171, 42, 171, 44, 171, 171, 74, 171,
-    171, 20, 6, 171, 18, 171, 171, 19, 171, 171, 171, 14, 171, 8, 171, 21,
-    171, 171, 28, 171, 171, 51, 171, 171, 171, 171, 171, 171, 34, 171, 7, 171,
-    171, 10, 171, 171, 171, 171, 31, 171, 24, 171, 171, 171, 15, 171, 171, 171,
-    171, 171, 12, 171, 171, 171, 171, 33, 171, 171, 171, 32, 171, 30, 171, 171,
-    171, 11, 171, 171, 171, 171, 171, 37, 26, 40, 0, 0, 172, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 119,
-    101, 172, 172, 132, 139, 137, 140, 138, 141, 144, 147, 143, 146, 157, 153, 155,
-    142, 145, 171, 152, 150, 151, 149, 171, 171, 171, 171, 171, 171, 171, 171, 171,
-    171, 171, 171, 171, 171, 171, 64, 171, 62, 171, 171, 61, 171, 63, 158, 172,
-    172, 169, 162, 163, 171, 171, 171, 171, 171, 171, 171, 56, 171, 52, 171, 171,
-    171, 171, 55, 54, 171, 171, 171, 171, 171, 58, 134, 135, 164, 165, 172, 172,
-    170, 160, 161, 0, 111, 104, 112, 154, 0, 103, 109, 118, 129, 171, 156, 159,
-    100, 0, 171, 171, 171, 171, 171, 171, 173, 125, 53, 171, 171, 57, 0, 114,
-    175, 171, 171, 171, 171, 171, 171, 60, 59, 166, 167, 126, 175, 172, 168, 94,
-    0, 2, 95, 123, 2, 174, 113, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 171, 116, 219, 1, 4, 4, 5, 79, 127, 68, 66, 174,
+    3, 222, 3, 3, 0, 0, 105, 69, 93, 131, 96, 98, 71, 99, 82, 97,
+    173, 65, 70, 108, 121, 110, 81, 171, 171, 171, 171, 133, 171, 171, 171, 171,
+    171, 148, 136, 171, 91, 92, 106, 0, 67, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 89, 107, 90, 78,
+    2, 286, 2, 171, 171, 171, 171, 49, 171, 171, 9, 171, 171, 23, 171, 171,
+    171, 171, 0, 80, 171, 171, 50, 171, 171, 171, 171, 171, 171, 171, 38, 171,
+    171, 171, 171, 29, 43, 171, 171, 171, 171, 171, 22, 171, 36, 171, 39, 171,
+    171, 171, 72, 171, 171, 171, 171, 171, 13, 48, 27, 171, 171, 171, 171, 171,
+    171, 171, 35, 171, 171, 25, 171, 17, 171, 171, 171, 171, 171, 171, 171, 47,
+    171, 171, 171, 171, 16, 41, 171, 42, 171, 44, 171, 171, 74, 171, 171, 20,
+    6, 171, 18, 171, 171, 19, 171, 171, 171, 14, 171, 8, 171, 21, 171, 171,
+    28, 171, 171, 51, 171, 171, 171, 171, 171, 171, 34, 171, 7, 171, 171, 10,
+    171, 171, 171, 171, 31, 171, 24, 171, 171, 171, 15, 171, 171, 171, 171, 171,
+    12, 171, 171, 171, 171, 33, 171, 171, 171, 32, 171, 30, 171, 171, 171, 11,
+    171, 171, 171, 171, 171, 37, 26, 40, 0, 0, 172, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 0, 103, 109,
+    130, 101, 119, 172, 172, 132, 139, 137, 140, 138, 141, 144, 147, 143, 146, 157,
+    153, 155, 142, 145, 171, 152, 150, 151, 149, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 64, 171, 62, 171, 171, 61, 171, 63,
+    158, 172, 172, 169, 162, 163, 171, 171, 171, 171, 171, 171, 171, 56, 171, 52,
+    171, 171, 171, 171, 55, 54, 171, 171, 171, 171, 171, 58, 134, 135, 164, 165,
+    172, 172, 170, 160, 161, 0, 111, 104, 112, 154, 118, 129, 100, 171, 156, 159,
+    0, 175, 171, 171, 171, 171, 171, 171, 94, 173, 125, 0, 53, 171, 171, 57,
+    124, 175, 171, 171, 171, 114, 126, 171, 171, 171, 60, 59, 166, 167, 122, 172,
+    168, 2, 95, 123, 0, 174, 4, 113, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -263,32 +340,32 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 171, 116, 216, 1, 4, 4, 5, 79,
-    68, 127, 66, 124, 174, 122, 3, 223, 3, 3, 0, 0, 105, 69, 93, 131,
-    96, 98, 71, 99, 82, 97, 173, 65, 70, 108, 121, 110, 81, 171, 171, 171,
-    171, 133, 171, 171, 171, 171, 171, 148, 136, 171, 91, 92, 106, 0, 67, 171,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 171, 116, 225, 1, 4, 4, 5,
+    79, 127, 68, 66, 174, 3, 222, 3, 3, 0, 0, 105, 69, 93, 131, 96,
+    98, 71, 99, 82, 97, 173, 65, 70, 108, 121, 110, 81, 171, 171, 171, 171,
+    133, 171, 171, 171, 171, 171, 148, 136, 171, 91, 92, 106, 0, 67, 171, 171,
     171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
-    171, 171, 89, 107, 90, 78, 2, 287, 130, 171, 171, 171, 171, 49, 171, 171,
-    9, 171, 171, 23, 171, 171, 171, 171, 0, 80, 171, 171, 50, 171, 171, 171,
-    171, 171, 171, 171, 38, 171, 171, 171, 171, 29, 43, 171, 171, 171, 171, 171,
-    22, 171, 36, 171, 39, 171, 171, 171, 72, 171, 171, 171, 171, 171, 13, 48,
-    27, 171, 171, 171, 171, 171, 171, 171, 35, 171, 171, 25, 171, 17, 171, 171,
-    171, 171, 171, 171, 171, 47, 171, 171, 171, 171, 16, 41, 171, 42, 171, 44,
-    171, 171, 74, 171, 171, 20, 6, 171, 18, 171, 171, 19, 171, 171, 171, 14,
-    171, 8, 171, 21, 171, 171, 28, 171, 171, 51, 171, 171, 171, 171, 171, 171,
-    34, 171, 7, 171, 171, 10, 171, 171, 171, 171, 31, 171, 24, 171, 171, 171,
-    15, 171, 171, 171, 171, 171, 12, 171, 171, 171, 171, 33, 171, 171, 171, 32,
-    171, 30, 171, 171, 171, 11, 171, 171, 171, 171, 171, 37, 26, 40, 0, 0,
-    172, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0,
-    0, 45, 128, 119, 101, 172, 172, 132, 139, 137, 140, 138, 141, 144, 147, 143,
-    146, 157, 153, 155, 142, 145, 171, 152, 150, 151, 149, 171, 171, 171, 171, 171,
-    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 64, 171, 62, 171, 171, 61,
-    171, 63, 158, 172, 172, 169, 162, 163, 171, 171, 171, 171, 171, 171, 171, 56,
-    171, 52, 171, 171, 171, 171, 55, 54, 171, 171, 171, 171, 171, 58, 134, 135,
-    164, 165, 172, 172, 170, 160, 161, 0, 111, 104, 112, 154, 0, 103, 109, 118,
-    129, 171, 156, 159, 100, 0, 171, 171, 171, 171, 171, 171, 173, 125, 53, 171,
-    171, 57, 0, 114, 175, 171, 171, 171, 171, 171, 171, 60, 59, 166, 167, 126,
-    175, 172, 168, 94, 0, 2, 95, 123, 2, 174, 113, 4, 0, 0, 0, 0,
+    171, 89, 107, 90, 78, 2, 286, 2, 171, 171, 171, 171, 49, 171, 171, 9,
+    171, 171, 23, 171, 171, 171, 171, 0, 80, 171, 171, 50, 171, 171, 171, 171,
+    171, 171, 171, 38, 171, 171, 171, 171, 29, 43, 171, 171, 171, 171, 171, 22,
+    171, 36, 171, 39, 171, 171, 171, 72, 171, 171, 171, 171, 171, 13, 48, 27,
+    171, 171, 171, 171, 171, 171, 171, 35, 171, 171, 25, 171, 17, 171, 171, 171,
+    171, 171, 171, 171, 47, 171, 171, 171, 171, 16, 41, 171, 42, 171, 44, 171,
+    171, 74, 171, 171, 20, 6, 171, 18, 171, 171, 19, 171, 171, 171, 14, 171,
+    8, 171, 21, 171, 171, 28, 171, 171, 51, 171, 171, 171, 171, 171, 171, 34,
+    171, 7, 171, 171, 10, 171, 171, 171, 171, 31, 171, 24, 171, 171, 171, 15,
+    171, 171, 171, 171, 171, 12, 171, 171, 171, 171, 33, 171, 171, 171, 32, 171,
+    30, 171, 171, 171, 11, 171, 171, 171, 171, 171, 37, 26, 40, 0, 0, 172,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0,
+    45, 128, 0, 103, 109, 130, 101, 119, 172, 172, 132, 139, 137, 140, 138, 141,
+    144, 147, 143, 146, 157, 153, 155, 142, 145, 171, 152, 150, 151, 149, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 64, 171, 62,
+    171, 171, 61, 171, 63, 158, 172, 172, 169, 162, 163, 171, 171, 171, 171, 171,
+    171, 171, 56, 171, 52, 171, 171, 171, 171, 55, 54, 171, 171, 171, 171, 171,
+    58, 134, 135, 164, 165, 172, 172, 170, 160, 161, 0, 111, 104, 112, 154, 118,
+    129, 100, 171, 156, 159, 0, 175, 171, 171, 171, 171, 171, 171, 94, 173, 125,
+    0, 53, 171, 171, 57, 124, 175, 171, 171, 171, 114, 126, 171, 171, 171, 60,
+    59, 166, 167, 122, 172, 168, 2, 95, 123, 0, 174, 4, 113, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -301,12 +378,12 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 171, 116, 218, 1,
-    4, 4, 5, 79, 68, 127, 66, 124, 174, 122, 3, 223, 3, 3, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 171, 116,
+    226, 1, 4, 4, 5, 79, 127, 68, 66, 174, 3, 222, 3, 3, 0, 0,
     105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65, 70, 108, 121, 110,
     81, 171, 171, 171, 171, 133, 171, 171, 171, 171, 171, 148, 136, 171, 91, 92,
     106, 0, 67, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
-    171, 171, 171, 171, 171, 171, 89, 107, 90, 78, 2, 287, 130, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 89, 107, 90, 78, 2, 286, 2, 171, 171, 171,
     171, 49, 171, 171, 9, 171, 171, 23, 171, 171, 171, 171, 0, 80, 171, 171,
     50, 171, 171, 171, 171, 171, 171, 171, 38, 171, 171, 171, 171, 29, 43, 171,
     171, 171, 171, 171, 22, 171, 36, 171, 39, 171, 171, 171, 72, 171, 171, 171,
@@ -318,54 +395,16 @@ extern token_type_t const lexer_transition_table[51408] = {
     24, 171, 171, 171, 15, 171, 171, 171, 171, 171, 12, 171, 171, 171, 171, 33,
     171, 171, 171, 32, 171, 30, 171, 171, 171, 11, 171, 171, 171, 171, 171, 37,
     26, 40, 0, 0, 172, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    46, 0, 0, 0, 0, 45, 128, 119, 101, 172, 172, 132, 139, 137, 140, 138,
-    141, 144, 147, 143, 146, 157, 153, 155, 142, 145, 171, 152, 150, 151, 149, 171,
-    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 64, 171,
-    62, 171, 171, 61, 171, 63, 158, 172, 172, 169, 162, 163, 171, 171, 171, 171,
-    171, 171, 171, 56, 171, 52, 171, 171, 171, 171, 55, 54, 171, 171, 171, 171,
-    171, 58, 134, 135, 164, 165, 172, 172, 170, 160, 161, 0, 111, 104, 112, 154,
-    0, 103, 109, 118, 129, 171, 156, 159, 100, 0, 171, 171, 171, 171, 171, 171,
-    173, 125, 53, 171, 171, 57, 0, 114, 175, 171, 171, 171, 171, 171, 171, 60,
-    59, 166, 167, 126, 175, 172, 168, 94, 0, 2, 95, 123, 2, 174, 113, 4,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    171, 116, 226, 1, 4, 4, 5, 79, 68, 127, 66, 124, 174, 122, 3, 223,
-    3, 3, 0, 0, 105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65,
-    70, 108, 121, 110, 81, 171, 171, 171, 171, 133, 171, 171, 171, 171, 171, 148,
-    136, 171, 91, 92, 106, 0, 67, 171, 171, 171, 171, 171, 171, 171, 171, 171,
-    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 89, 107, 90, 78, 2, 287,
-    130, 171, 171, 171, 171, 49, 171, 171, 9, 171, 171, 23, 171, 171, 171, 171,
-    0, 80, 171, 171, 50, 171, 171, 171, 171, 171, 171, 171, 38, 171, 171, 171,
-    171, 29, 43, 171, 171, 171, 171, 171, 22, 171, 36, 171, 39, 171, 171, 171,
-    72, 171, 171, 171, 171, 171, 13, 48, 27, 171, 171, 171, 171, 171, 171, 171,
-    35, 171, 171, 25, 171, 17, 171, 171, 171, 171, 171, 171, 171, 47, 171, 171,
-    171, 171, 16, 41, 171, 42, 171, 44, 171, 171, 74, 171, 171, 20, 6, 171,
-    18, 171, 171, 19, 171, 171, 171, 14, 171, 8, 171, 21, 171, 171, 28, 171,
-    171, 51, 171, 171, 171, 171, 171, 171, 34, 171, 7, 171, 171, 10, 171, 171,
-    171, 171, 31, 171, 24, 171, 171, 171, 15, 171, 171, 171, 171, 171, 12, 171,
-    171, 171, 171, 33, 171, 171, 171, 32, 171, 30, 171, 171, 171, 11, 171, 171,
-    171, 171, 171, 37, 26, 40, 0, 0, 172, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 119, 101, 172, 172, 132,
+    46, 0, 0, 0, 0, 45, 128, 0, 103, 109, 130, 101, 119, 172, 172, 132,
     139, 137, 140, 138, 141, 144, 147, 143, 146, 157, 153, 155, 142, 145, 171, 152,
     150, 151, 149, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
     171, 171, 64, 171, 62, 171, 171, 61, 171, 63, 158, 172, 172, 169, 162, 163,
     171, 171, 171, 171, 171, 171, 171, 56, 171, 52, 171, 171, 171, 171, 55, 54,
     171, 171, 171, 171, 171, 58, 134, 135, 164, 165, 172, 172, 170, 160, 161, 0,
-    111, 104, 112, 154, 0, 103, 109, 118, 129, 171, 156, 159, 100, 0, 171, 171,
-    171, 171, 171, 171, 173, 125, 53, 171, 171, 57, 0, 114, 175, 171, 171, 171,
-    171, 171, 171, 60, 59, 166, 167, 126, 175, 172, 168, 94, 0, 2, 95, 123,
-    2, 174, 113, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    111, 104, 112, 154, 118, 129, 100, 171, 156, 159, 0, 175, 171, 171, 171, 171,
+    171, 171, 94, 173, 125, 0, 53, 171, 171, 57, 124, 175, 171, 171, 171, 114,
+    126, 171, 171, 171, 60, 59, 166, 167, 122, 172, 168, 2, 95, 123, 0, 174,
+    4, 113, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -378,32 +417,32 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 171, 116, 227, 1, 4, 4, 5, 79, 68, 127, 66, 124,
-    174, 122, 3, 223, 3, 3, 0, 0, 105, 69, 93, 131, 96, 98, 71, 99,
-    82, 97, 173, 65, 70, 108, 121, 110, 81, 171, 171, 171, 171, 133, 171, 171,
-    171, 171, 171, 148, 136, 171, 91, 92, 106, 0, 67, 171, 171, 171, 171, 171,
-    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 89, 107,
-    90, 78, 2, 287, 130, 171, 171, 171, 171, 49, 171, 171, 9, 171, 171, 23,
-    171, 171, 171, 171, 0, 80, 171, 171, 50, 171, 171, 171, 171, 171, 171, 171,
-    38, 171, 171, 171, 171, 29, 43, 171, 171, 171, 171, 171, 22, 171, 36, 171,
-    39, 171, 171, 171, 72, 171, 171, 171, 171, 171, 13, 48, 27, 171, 171, 171,
-    171, 171, 171, 171, 35, 171, 171, 25, 171, 17, 171, 171, 171, 171, 171, 171,
-    171, 47, 171, 171, 171, 171, 16, 41, 171, 42, 171, 44, 171, 171, 74, 171,
-    171, 20, 6, 171, 18, 171, 171, 19, 171, 171, 171, 14, 171, 8, 171, 21,
-    171, 171, 28, 171, 171, 51, 171, 171, 171, 171, 171, 171, 34, 171, 7, 171,
-    171, 10, 171, 171, 171, 171, 31, 171, 24, 171, 171, 171, 15, 171, 171, 171,
-    171, 171, 12, 171, 171, 171, 171, 33, 171, 171, 171, 32, 171, 30, 171, 171,
-    171, 11, 171, 171, 171, 171, 171, 37, 26, 40, 0, 0, 172, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 119,
-    101, 172, 172, 132, 139, 137, 140, 138, 141, 144, 147, 143, 146, 157, 153, 155,
-    142, 145, 171, 152, 150, 151, 149, 171, 171, 171, 171, 171, 171, 171, 171, 171,
-    171, 171, 171, 171, 171, 171, 64, 171, 62, 171, 171, 61, 171, 63, 158, 172,
-    172, 169, 162, 163, 171, 171, 171, 171, 171, 171, 171, 56, 171, 52, 171, 171,
-    171, 171, 55, 54, 171, 171, 171, 171, 171, 58, 134, 135, 164, 165, 172, 172,
-    170, 160, 161, 0, 111, 104, 112, 154, 0, 103, 109, 118, 129, 171, 156, 159,
-    100, 0, 171, 171, 171, 171, 171, 171, 173, 125, 53, 171, 171, 57, 0, 114,
-    175, 171, 171, 171, 171, 171, 171, 60, 59, 166, 167, 126, 175, 172, 168, 94,
-    0, 2, 95, 123, 2, 174, 113, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 171, 116, 227, 1, 4, 4, 5, 79, 127, 68, 66, 174, 3,
+    222, 3, 3, 0, 0, 594, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173,
+    65, 70, 108, 121, 110, 81, 171, 171, 171, 171, 133, 171, 171, 171, 171, 171,
+    148, 136, 171, 91, 92, 106, 0, 67, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 89, 107, 90, 78, 2,
+    286, 2, 171, 171, 171, 171, 49, 171, 171, 9, 171, 171, 23, 171, 171, 171,
+    171, 304, 80, 171, 171, 50, 171, 171, 171, 171, 171, 171, 171, 38, 171, 171,
+    171, 171, 29, 43, 171, 171, 171, 171, 171, 22, 171, 36, 171, 39, 171, 171,
+    171, 72, 171, 171, 171, 171, 171, 13, 48, 27, 171, 171, 171, 171, 171, 171,
+    171, 35, 171, 171, 25, 171, 17, 171, 171, 171, 171, 171, 171, 171, 47, 171,
+    171, 171, 171, 16, 41, 171, 42, 171, 44, 171, 171, 74, 171, 171, 20, 6,
+    171, 18, 171, 171, 19, 171, 171, 171, 14, 171, 8, 171, 21, 171, 171, 28,
+    171, 171, 51, 171, 171, 171, 171, 171, 171, 34, 171, 7, 171, 171, 10, 171,
+    171, 171, 171, 31, 171, 24, 171, 171, 171, 15, 171, 171, 171, 171, 171, 12,
+    171, 171, 171, 171, 33, 171, 171, 171, 32, 171, 30, 171, 171, 171, 11, 171,
+    171, 171, 171, 171, 37, 26, 40, 0, 0, 172, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 0, 103, 109, 130,
+    101, 119, 172, 172, 132, 139, 137, 140, 138, 141, 144, 147, 143, 146, 157, 153,
+    155, 142, 145, 171, 152, 150, 151, 149, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 64, 171, 62, 171, 171, 61, 171, 63, 158,
+    172, 172, 169, 162, 163, 171, 171, 171, 171, 171, 171, 171, 56, 171, 52, 171,
+    171, 171, 171, 55, 54, 171, 171, 171, 171, 171, 58, 134, 135, 164, 165, 172,
+    172, 170, 160, 161, 0, 111, 104, 112, 154, 118, 129, 100, 171, 156, 159, 0,
+    175, 171, 171, 171, 171, 171, 171, 94, 173, 125, 0, 53, 171, 171, 57, 124,
+    175, 171, 171, 171, 114, 126, 171, 171, 171, 60, 59, 166, 167, 122, 172, 168,
+    2, 95, 123, 0, 174, 4, 113, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -417,32 +456,31 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 171, 116, 228, 1, 4, 4, 5, 79,
-    68, 127, 66, 124, 174, 122, 3, 223, 3, 3, 0, 0, 587, 69, 93, 131,
-    96, 98, 71, 99, 82, 97, 173, 65, 70, 108, 121, 110, 81, 171, 171, 171,
-    171, 133, 171, 171, 171, 171, 171, 148, 136, 171, 91, 92, 106, 0, 67, 171,
+    127, 68, 66, 174, 3, 222, 3, 3, 0, 0, 105, 69, 93, 131, 96, 98,
+    71, 99, 82, 97, 173, 65, 70, 108, 121, 110, 81, 171, 171, 171, 171, 133,
+    171, 171, 171, 171, 171, 148, 136, 171, 91, 92, 106, 0, 67, 171, 171, 171,
     171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
-    171, 171, 89, 107, 90, 78, 2, 287, 130, 171, 171, 171, 171, 49, 171, 171,
-    9, 171, 171, 23, 171, 171, 171, 171, 305, 80, 171, 171, 50, 171, 171, 171,
-    171, 171, 171, 171, 38, 171, 171, 171, 171, 29, 43, 171, 171, 171, 171, 171,
-    22, 171, 36, 171, 39, 171, 171, 171, 72, 171, 171, 171, 171, 171, 13, 48,
-    27, 171, 171, 171, 171, 171, 171, 171, 35, 171, 171, 25, 171, 17, 171, 171,
-    171, 171, 171, 171, 171, 47, 171, 171, 171, 171, 16, 41, 171, 42, 171, 44,
-    171, 171, 74, 171, 171, 20, 6, 171, 18, 171, 171, 19, 171, 171, 171, 14,
-    171, 8, 171, 21, 171, 171, 28, 171, 171, 51, 171, 171, 171, 171, 171, 171,
-    34, 171, 7, 171, 171, 10, 171, 171, 171, 171, 31, 171, 24, 171, 171, 171,
-    15, 171, 171, 171, 171, 171, 12, 171, 171, 171, 171, 33, 171, 171, 171, 32,
-    171, 30, 171, 171, 171, 11, 171, 171, 171, 171, 171, 37, 26, 40, 0, 0,
-    172, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0,
-    0, 45, 128, 119, 101, 172, 172, 132, 139, 137, 140, 138, 141, 144, 147, 143,
-    146, 157, 153, 155, 142, 145, 171, 152, 150, 151, 149, 171, 171, 171, 171, 171,
-    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 64, 171, 62, 171, 171, 61,
-    171, 63, 158, 172, 172, 169, 162, 163, 171, 171, 171, 171, 171, 171, 171, 56,
-    171, 52, 171, 171, 171, 171, 55, 54, 171, 171, 171, 171, 171, 58, 134, 135,
-    164, 165, 172, 172, 170, 160, 161, 0, 111, 104, 112, 154, 0, 103, 109, 118,
-    129, 171, 156, 159, 100, 0, 171, 171, 171, 171, 171, 171, 173, 125, 53, 171,
-    171, 57, 0, 114, 175, 171, 171, 171, 171, 171, 171, 60, 59, 166, 167, 126,
-    175, 172, 168, 94, 0, 2, 95, 123, 2, 174, 113, 4, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    89, 107, 90, 78, 2, 286, 2, 171, 171, 171, 171, 49, 171, 171, 9, 171,
+    171, 23, 171, 171, 171, 171, 0, 80, 171, 171, 50, 171, 171, 171, 171, 171,
+    171, 171, 38, 171, 171, 171, 171, 29, 43, 171, 171, 171, 171, 171, 22, 171,
+    36, 171, 39, 171, 171, 171, 72, 171, 171, 171, 171, 171, 13, 48, 27, 171,
+    171, 171, 171, 171, 171, 171, 35, 171, 171, 25, 171, 17, 171, 171, 171, 171,
+    171, 171, 171, 47, 171, 171, 171, 171, 16, 41, 171, 42, 171, 44, 171, 171,
+    74, 171, 171, 20, 6, 171, 18, 171, 171, 19, 171, 171, 171, 14, 171, 8,
+    171, 21, 171, 171, 28, 171, 171, 51, 171, 171, 171, 171, 171, 171, 34, 171,
+    7, 171, 171, 10, 171, 171, 171, 171, 31, 171, 24, 171, 171, 171, 15, 171,
+    171, 171, 171, 171, 12, 171, 171, 171, 171, 33, 171, 171, 171, 32, 171, 30,
+    171, 171, 171, 11, 171, 171, 171, 171, 171, 37, 26, 40, 0, 0, 172, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45,
+    128, 0, 103, 109, 130, 101, 119, 172, 172, 132, 139, 137, 140, 138, 141, 144,
+    147, 143, 146, 157, 153, 155, 142, 145, 171, 152, 150, 151, 149, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 64, 171, 62, 171,
+    171, 61, 171, 63, 158, 172, 172, 169, 162, 163, 171, 171, 171, 171, 171, 171,
+    171, 56, 171, 52, 171, 171, 171, 171, 55, 54, 171, 171, 171, 171, 171, 58,
+    134, 135, 164, 165, 172, 172, 170, 160, 161, 0, 111, 104, 112, 154, 118, 129,
+    100, 171, 156, 159, 0, 175, 171, 171, 171, 171, 171, 171, 94, 173, 125, 0,
+    53, 171, 171, 57, 124, 175, 171, 171, 171, 114, 126, 171, 171, 171, 60, 59,
+    166, 167, 122, 172, 168, 2, 95, 123, 0, 174, 4, 113, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -454,33 +492,34 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 171, 116, 229, 1,
-    4, 4, 5, 79, 68, 127, 66, 124, 174, 122, 3, 223, 3, 3, 0, 0,
-    105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65, 70, 108, 121, 110,
-    81, 171, 171, 171, 171, 133, 171, 171, 171, 171, 171, 148, 136, 171, 91, 92,
-    106, 0, 67, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
-    171, 171, 171, 171, 171, 171, 89, 107, 90, 78, 2, 287, 130, 171, 171, 171,
-    171, 49, 171, 171, 9, 171, 171, 23, 171, 171, 171, 171, 0, 80, 171, 171,
-    50, 171, 171, 171, 171, 171, 171, 171, 38, 171, 171, 171, 171, 29, 43, 171,
-    171, 171, 171, 171, 22, 171, 36, 171, 39, 171, 171, 171, 72, 171, 171, 171,
-    171, 171, 13, 48, 27, 171, 171, 171, 171, 171, 171, 171, 35, 171, 171, 25,
-    171, 17, 171, 171, 171, 171, 171, 171, 171, 47, 171, 171, 171, 171, 16, 41,
-    171, 42, 171, 44, 171, 171, 74, 171, 171, 20, 6, 171, 18, 171, 171, 19,
-    171, 171, 171, 14, 171, 8, 171, 21, 171, 171, 28, 171, 171, 51, 171, 171,
-    171, 171, 171, 171, 34, 171, 7, 171, 171, 10, 171, 171, 171, 171, 31, 171,
-    24, 171, 171, 171, 15, 171, 171, 171, 171, 171, 12, 171, 171, 171, 171, 33,
-    171, 171, 171, 32, 171, 30, 171, 171, 171, 11, 171, 171, 171, 171, 171, 37,
-    26, 40, 0, 0, 172, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    46, 0, 0, 0, 0, 45, 128, 119, 101, 172, 172, 132, 139, 137, 140, 138,
-    141, 144, 147, 143, 146, 157, 153, 155, 142, 145, 171, 152, 150, 151, 149, 171,
-    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 64, 171,
-    62, 171, 171, 61, 171, 63, 158, 172, 172, 169, 162, 163, 171, 171, 171, 171,
-    171, 171, 171, 56, 171, 52, 171, 171, 171, 171, 55, 54, 171, 171, 171, 171,
-    171, 58, 134, 135, 164, 165, 172, 172, 170, 160, 161, 0, 111, 104, 112, 154,
-    0, 103, 109, 118, 129, 171, 156, 159, 100, 0, 171, 171, 171, 171, 171, 171,
-    173, 125, 53, 171, 171, 57, 0, 114, 175, 171, 171, 171, 171, 171, 171, 60,
-    59, 166, 167, 126, 175, 172, 168, 94, 0, 2, 95, 123, 2, 174, 113, 4,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 171, 116, 229,
+    1, 4, 4, 5, 79, 127, 68, 66, 174, 3, 222, 3, 3, 0, 0, 105,
+    69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65, 70, 108, 121, 110, 81,
+    171, 171, 171, 171, 133, 171, 171, 171, 171, 171, 148, 136, 171, 91, 92, 106,
+    0, 67, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 89, 107, 90, 78, 2, 286, 2, 171, 171, 171, 171,
+    49, 171, 171, 9, 171, 171, 23, 171, 171, 171, 171, 0, 80, 171, 171, 50,
+    171, 171, 171, 171, 171, 171, 171, 38, 171, 171, 171, 171, 29, 43, 171, 171,
+    171, 171, 171, 22, 171, 36, 171, 39, 171, 171, 171, 72, 171, 171, 171, 171,
+    171, 13, 48, 27, 171, 171, 171, 171, 171, 171, 171, 35, 171, 171, 25, 171,
+    17, 171, 171, 171, 171, 171, 171, 171, 47, 171, 171, 171, 171, 16, 41, 171,
+    42, 171, 44, 171, 171, 74, 171, 171, 20, 6, 171, 18, 171, 171, 19, 171,
+    171, 171, 14, 171, 8, 171, 21, 171, 171, 28, 171, 171, 51, 171, 171, 171,
+    171, 171, 171, 34, 171, 7, 171, 171, 10, 171, 171, 171, 171, 31, 171, 24,
+    171, 171, 171, 15, 171, 171, 171, 171, 171, 12, 171, 171, 171, 171, 33, 171,
+    171, 171, 32, 171, 30, 171, 171, 171, 11, 171, 171, 171, 171, 171, 37, 26,
+    40, 0, 0, 172, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46,
+    0, 0, 0, 0, 45, 128, 0, 103, 109, 130, 101, 119, 172, 172, 132, 139,
+    137, 140, 138, 141, 144, 147, 143, 146, 157, 153, 155, 142, 145, 171, 152, 150,
+    151, 149, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 64, 171, 62, 171, 171, 61, 171, 63, 158, 172, 172, 169, 162, 163, 171,
+    171, 171, 171, 171, 171, 171, 56, 171, 52, 171, 171, 171, 171, 55, 54, 171,
+    171, 171, 171, 171, 58, 134, 135, 164, 165, 172, 172, 170, 160, 161, 0, 111,
+    104, 112, 154, 118, 129, 100, 171, 156, 159, 0, 175, 171, 171, 171, 171, 171,
+    171, 94, 173, 125, 0, 53, 171, 171, 57, 124, 175, 171, 171, 171, 114, 126,
+    171, 171, 171, 60, 59, 166, 167, 122, 172, 168, 2, 95, 123, 0, 174, 4,
+    113, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -493,12 +532,12 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    171, 116, 230, 1, 4, 4, 5, 79, 68, 127, 66, 124, 174, 122, 3, 223,
+    0, 0, 171, 116, 230, 1, 4, 4, 5, 79, 127, 68, 66, 174, 3, 222,
     3, 3, 0, 0, 105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65,
     70, 108, 121, 110, 81, 171, 171, 171, 171, 133, 171, 171, 171, 171, 171, 148,
     136, 171, 91, 92, 106, 0, 67, 171, 171, 171, 171, 171, 171, 171, 171, 171,
-    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 89, 107, 90, 78, 2, 287,
-    130, 171, 171, 171, 171, 49, 171, 171, 9, 171, 171, 23, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 89, 107, 90, 78, 2, 286,
+    2, 171, 171, 171, 171, 49, 171, 171, 9, 171, 171, 23, 171, 171, 171, 171,
     0, 80, 171, 171, 50, 171, 171, 171, 171, 171, 171, 171, 38, 171, 171, 171,
     171, 29, 43, 171, 171, 171, 171, 171, 22, 171, 36, 171, 39, 171, 171, 171,
     72, 171, 171, 171, 171, 171, 13, 48, 27, 171, 171, 171, 171, 171, 171, 171,
@@ -509,16 +548,16 @@ extern token_type_t const lexer_transition_table[51408] = {
     171, 171, 31, 171, 24, 171, 171, 171, 15, 171, 171, 171, 171, 171, 12, 171,
     171, 171, 171, 33, 171, 171, 171, 32, 171, 30, 171, 171, 171, 11, 171, 171,
     171, 171, 171, 37, 26, 40, 0, 0, 172, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 119, 101, 172, 172, 132,
-    139, 137, 140, 138, 141, 144, 147, 143, 146, 157, 153, 155, 142, 145, 171, 152,
-    150, 151, 149, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
-    171, 171, 64, 171, 62, 171, 171, 61, 171, 63, 158, 172, 172, 169, 162, 163,
-    171, 171, 171, 171, 171, 171, 171, 56, 171, 52, 171, 171, 171, 171, 55, 54,
-    171, 171, 171, 171, 171, 58, 134, 135, 164, 165, 172, 172, 170, 160, 161, 0,
-    111, 104, 112, 154, 0, 103, 109, 118, 129, 171, 156, 159, 100, 0, 171, 171,
-    171, 171, 171, 171, 173, 125, 53, 171, 171, 57, 0, 114, 175, 171, 171, 171,
-    171, 171, 171, 60, 59, 166, 167, 126, 175, 172, 168, 94, 0, 2, 95, 123,
-    2, 174, 113, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 0, 103, 109, 130, 101,
+    119, 172, 172, 132, 139, 137, 140, 138, 141, 144, 147, 143, 146, 157, 153, 155,
+    142, 145, 171, 152, 150, 151, 149, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 64, 171, 62, 171, 171, 61, 171, 63, 158, 172,
+    172, 169, 162, 163, 171, 171, 171, 171, 171, 171, 171, 56, 171, 52, 171, 171,
+    171, 171, 55, 54, 171, 171, 171, 171, 171, 58, 134, 135, 164, 165, 172, 172,
+    170, 160, 161, 0, 111, 104, 112, 154, 118, 129, 100, 171, 156, 159, 0, 175,
+    171, 171, 171, 171, 171, 171, 94, 173, 125, 0, 53, 171, 171, 57, 124, 175,
+    171, 171, 171, 114, 126, 171, 171, 171, 60, 59, 166, 167, 122, 172, 168, 2,
+    95, 123, 0, 174, 4, 113, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -531,12 +570,127 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 171, 116, 231, 1, 4, 4, 5, 79, 68, 127, 66, 124,
-    174, 122, 3, 223, 3, 3, 0, 0, 105, 69, 93, 131, 96, 98, 71, 99,
-    82, 97, 173, 65, 70, 108, 121, 110, 81, 171, 171, 171, 171, 133, 171, 171,
+    0, 0, 0, 0, 0, 0, 0, 171, 116, 231, 1, 4, 4, 5, 79, 127,
+    68, 66, 174, 3, 222, 3, 3, 0, 0, 105, 69, 93, 131, 96, 98, 71,
+    99, 82, 222, 173, 65, 70, 108, 121, 110, 81, 171, 171, 171, 171, 133, 171,
+    171, 171, 171, 171, 148, 136, 171, 91, 92, 106, 0, 67, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 89,
+    107, 90, 78, 2, 286, 2, 171, 171, 171, 171, 49, 171, 171, 9, 171, 171,
+    23, 171, 171, 171, 171, 0, 80, 171, 171, 50, 171, 171, 171, 171, 171, 171,
+    171, 38, 171, 171, 171, 171, 29, 43, 171, 171, 171, 171, 171, 22, 171, 36,
+    171, 39, 171, 171, 171, 72, 171, 171, 171, 171, 171, 13, 48, 27, 171, 171,
+    171, 171, 171, 171, 171, 35, 171, 171, 25, 171, 17, 171, 171, 171, 171, 171,
+    171, 171, 47, 171, 171, 171, 171, 16, 41, 171, 42, 171, 44, 171, 171, 74,
+    171, 171, 20, 6, 171, 18, 171, 171, 19, 171, 171, 171, 14, 171, 8, 171,
+    21, 171, 171, 28, 171, 171, 51, 171, 171, 171, 171, 171, 171, 34, 171, 7,
+    171, 171, 10, 171, 171, 171, 171, 31, 171, 24, 171, 171, 171, 15, 171, 171,
+    171, 171, 171, 12, 171, 171, 171, 171, 33, 171, 171, 171, 32, 171, 30, 171,
+    171, 171, 11, 171, 171, 171, 171, 171, 37, 26, 40, 0, 0, 172, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128,
+    0, 103, 109, 130, 101, 119, 172, 172, 132, 139, 137, 140, 138, 141, 144, 147,
+    143, 146, 157, 153, 155, 142, 145, 171, 152, 150, 151, 149, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 64, 171, 62, 171, 171,
+    61, 171, 63, 158, 172, 172, 169, 162, 163, 171, 171, 171, 171, 171, 171, 171,
+    56, 171, 52, 171, 171, 171, 171, 55, 54, 171, 171, 171, 171, 171, 58, 134,
+    135, 164, 165, 172, 172, 170, 160, 161, 0, 111, 104, 112, 154, 118, 129, 100,
+    171, 156, 159, 0, 175, 171, 171, 171, 171, 171, 171, 94, 173, 125, 0, 53,
+    171, 171, 57, 124, 175, 171, 171, 171, 114, 126, 171, 171, 171, 60, 59, 166,
+    167, 122, 172, 168, 2, 95, 123, 0, 174, 4, 113, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 171, 116, 232, 1,
+    4, 4, 5, 79, 127, 68, 66, 174, 3, 222, 3, 3, 0, 0, 105, 69,
+    93, 131, 96, 581, 71, 99, 82, 97, 173, 65, 70, 108, 121, 110, 81, 171,
+    171, 171, 171, 133, 171, 171, 171, 171, 171, 148, 136, 171, 91, 92, 106, 0,
+    67, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 89, 107, 90, 78, 2, 286, 2, 171, 171, 171, 171, 49,
+    171, 171, 9, 171, 171, 23, 171, 171, 171, 171, 0, 80, 171, 171, 50, 171,
+    171, 171, 171, 171, 171, 171, 38, 171, 171, 171, 171, 29, 43, 171, 171, 171,
+    171, 171, 22, 171, 36, 171, 39, 171, 171, 171, 72, 171, 171, 171, 171, 171,
+    13, 48, 27, 171, 171, 171, 171, 171, 171, 171, 35, 171, 171, 25, 171, 17,
+    171, 171, 171, 171, 171, 171, 171, 47, 171, 171, 171, 171, 16, 41, 171, 42,
+    171, 44, 171, 171, 74, 171, 171, 20, 6, 171, 18, 171, 171, 19, 171, 171,
+    171, 14, 171, 8, 171, 21, 171, 171, 28, 171, 171, 51, 171, 171, 171, 171,
+    171, 171, 34, 171, 7, 171, 171, 10, 171, 171, 171, 171, 31, 171, 24, 171,
+    171, 171, 15, 171, 171, 171, 171, 171, 12, 171, 171, 171, 171, 33, 171, 171,
+    171, 32, 171, 30, 171, 171, 171, 11, 171, 171, 171, 171, 171, 37, 26, 40,
+    0, 0, 172, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0,
+    0, 0, 0, 45, 128, 0, 103, 109, 130, 101, 119, 172, 172, 132, 139, 137,
+    140, 138, 141, 144, 147, 143, 146, 157, 153, 155, 142, 145, 171, 152, 150, 151,
+    149, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    64, 171, 62, 171, 171, 61, 171, 63, 158, 172, 172, 169, 162, 163, 171, 171,
+    171, 171, 171, 171, 171, 56, 171, 52, 171, 171, 171, 171, 55, 54, 171, 171,
+    171, 171, 171, 58, 134, 135, 164, 165, 172, 172, 170, 160, 161, 0, 111, 104,
+    112, 154, 118, 129, 100, 171, 156, 159, 0, 175, 171, 171, 171, 171, 171, 171,
+    94, 173, 125, 0, 53, 171, 171, 57, 124, 175, 171, 171, 171, 114, 126, 171,
+    171, 171, 60, 59, 166, 167, 122, 172, 168, 2, 95, 123, 0, 174, 4, 113,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 171, 116, 233, 1, 4, 4, 5, 79, 127, 68, 66, 174, 3, 222, 3,
+    3, 0, 0, 105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65, 70,
+    108, 121, 110, 81, 171, 171, 171, 171, 133, 171, 171, 171, 171, 171, 148, 136,
+    171, 91, 92, 106, 0, 67, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 89, 107, 90, 78, 2, 286, 2,
+    171, 171, 171, 171, 49, 171, 171, 9, 171, 171, 23, 171, 171, 171, 171, 0,
+    80, 171, 171, 50, 171, 171, 171, 171, 171, 171, 171, 38, 171, 171, 171, 171,
+    29, 43, 171, 171, 171, 171, 171, 22, 171, 36, 171, 39, 171, 171, 171, 72,
+    171, 171, 171, 171, 171, 13, 48, 27, 171, 171, 171, 171, 171, 171, 171, 35,
+    171, 171, 25, 171, 17, 171, 171, 171, 171, 171, 171, 171, 47, 171, 171, 171,
+    171, 16, 41, 171, 42, 171, 44, 171, 171, 74, 171, 171, 20, 6, 171, 18,
+    171, 171, 19, 171, 171, 171, 14, 171, 8, 171, 21, 171, 171, 28, 171, 171,
+    51, 171, 171, 171, 171, 171, 171, 34, 171, 7, 171, 171, 10, 171, 171, 171,
+    171, 31, 171, 24, 171, 171, 171, 15, 171, 171, 171, 171, 171, 12, 171, 171,
+    171, 171, 33, 171, 171, 171, 32, 171, 30, 171, 171, 171, 11, 171, 171, 171,
+    171, 171, 37, 26, 40, 0, 0, 172, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 0, 103, 109, 130, 101, 119,
+    172, 172, 132, 139, 137, 140, 138, 141, 144, 147, 143, 146, 157, 153, 155, 142,
+    145, 171, 152, 150, 151, 149, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 64, 171, 62, 171, 171, 61, 171, 63, 158, 172, 172,
+    169, 162, 163, 171, 171, 171, 171, 171, 171, 171, 56, 171, 52, 171, 171, 171,
+    171, 55, 54, 171, 171, 171, 171, 171, 58, 134, 135, 164, 165, 172, 172, 170,
+    160, 161, 0, 111, 104, 112, 154, 118, 129, 100, 171, 156, 159, 0, 175, 171,
+    171, 171, 171, 171, 171, 94, 173, 125, 0, 53, 171, 171, 57, 124, 175, 171,
+    171, 171, 114, 126, 171, 171, 171, 60, 59, 166, 167, 122, 172, 168, 2, 95,
+    123, 0, 174, 4, 113, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 171, 116, 234, 1, 4, 4, 5, 79, 127, 68,
+    66, 174, 3, 222, 3, 3, 0, 0, 105, 69, 93, 131, 96, 98, 71, 607,
+    82, 97, 173, 65, 70, 474, 121, 562, 81, 171, 171, 171, 171, 133, 171, 171,
     171, 171, 171, 148, 136, 171, 91, 92, 106, 0, 67, 171, 171, 171, 171, 171,
     171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 89, 107,
-    90, 78, 2, 287, 130, 171, 171, 171, 171, 49, 171, 171, 9, 171, 171, 23,
+    90, 78, 2, 286, 2, 171, 171, 171, 171, 49, 171, 171, 9, 171, 171, 23,
     171, 171, 171, 171, 0, 80, 171, 171, 50, 171, 171, 171, 171, 171, 171, 171,
     38, 171, 171, 171, 171, 29, 43, 171, 171, 171, 171, 171, 22, 171, 36, 171,
     39, 171, 171, 171, 72, 171, 171, 171, 171, 171, 13, 48, 27, 171, 171, 171,
@@ -547,16 +701,16 @@ extern token_type_t const lexer_transition_table[51408] = {
     171, 10, 171, 171, 171, 171, 31, 171, 24, 171, 171, 171, 15, 171, 171, 171,
     171, 171, 12, 171, 171, 171, 171, 33, 171, 171, 171, 32, 171, 30, 171, 171,
     171, 11, 171, 171, 171, 171, 171, 37, 26, 40, 0, 0, 172, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 119,
-    101, 172, 172, 132, 139, 137, 140, 138, 141, 144, 147, 143, 146, 157, 153, 155,
-    142, 145, 171, 152, 150, 151, 149, 171, 171, 171, 171, 171, 171, 171, 171, 171,
-    171, 171, 171, 171, 171, 171, 64, 171, 62, 171, 171, 61, 171, 63, 158, 172,
-    172, 169, 162, 163, 171, 171, 171, 171, 171, 171, 171, 56, 171, 52, 171, 171,
-    171, 171, 55, 54, 171, 171, 171, 171, 171, 58, 134, 135, 164, 165, 172, 172,
-    170, 160, 161, 0, 111, 104, 112, 154, 0, 103, 109, 118, 129, 171, 156, 159,
-    100, 0, 171, 171, 171, 171, 171, 171, 173, 125, 53, 171, 171, 57, 0, 114,
-    175, 171, 171, 171, 171, 171, 171, 60, 59, 166, 167, 126, 175, 172, 168, 94,
-    0, 2, 95, 123, 2, 174, 113, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 0,
+    103, 109, 130, 101, 119, 172, 172, 132, 139, 137, 140, 138, 141, 144, 147, 143,
+    146, 157, 153, 155, 142, 145, 171, 152, 150, 151, 149, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 64, 171, 62, 171, 171, 61,
+    171, 63, 158, 172, 172, 169, 162, 163, 171, 171, 171, 171, 171, 171, 171, 56,
+    171, 52, 171, 171, 171, 171, 55, 54, 171, 171, 171, 171, 171, 58, 134, 135,
+    164, 165, 172, 172, 170, 160, 161, 0, 111, 104, 112, 154, 118, 129, 100, 171,
+    156, 159, 0, 175, 171, 171, 171, 171, 171, 171, 94, 173, 125, 0, 53, 171,
+    171, 57, 124, 175, 171, 171, 171, 114, 126, 171, 171, 171, 60, 59, 166, 167,
+    122, 172, 168, 2, 95, 123, 0, 174, 4, 113, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -569,32 +723,32 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 171, 116, 232, 1, 4, 4, 5, 79,
-    68, 127, 66, 124, 174, 122, 3, 223, 3, 3, 0, 0, 105, 69, 93, 131,
-    96, 98, 71, 99, 82, 223, 173, 65, 70, 108, 121, 110, 81, 171, 171, 171,
-    171, 133, 171, 171, 171, 171, 171, 148, 136, 171, 91, 92, 106, 0, 67, 171,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 171, 116, 235, 1, 4,
+    4, 5, 79, 127, 68, 66, 609, 3, 222, 3, 3, 0, 0, 105, 69, 93,
+    131, 96, 98, 71, 99, 82, 97, 573, 65, 70, 108, 121, 110, 81, 171, 171,
+    171, 171, 133, 171, 171, 171, 171, 171, 148, 136, 171, 91, 92, 106, 0, 67,
     171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
-    171, 171, 89, 107, 90, 78, 2, 287, 130, 171, 171, 171, 171, 49, 171, 171,
-    9, 171, 171, 23, 171, 171, 171, 171, 0, 80, 171, 171, 50, 171, 171, 171,
-    171, 171, 171, 171, 38, 171, 171, 171, 171, 29, 43, 171, 171, 171, 171, 171,
-    22, 171, 36, 171, 39, 171, 171, 171, 72, 171, 171, 171, 171, 171, 13, 48,
-    27, 171, 171, 171, 171, 171, 171, 171, 35, 171, 171, 25, 171, 17, 171, 171,
-    171, 171, 171, 171, 171, 47, 171, 171, 171, 171, 16, 41, 171, 42, 171, 44,
-    171, 171, 74, 171, 171, 20, 6, 171, 18, 171, 171, 19, 171, 171, 171, 14,
-    171, 8, 171, 21, 171, 171, 28, 171, 171, 51, 171, 171, 171, 171, 171, 171,
-    34, 171, 7, 171, 171, 10, 171, 171, 171, 171, 31, 171, 24, 171, 171, 171,
-    15, 171, 171, 171, 171, 171, 12, 171, 171, 171, 171, 33, 171, 171, 171, 32,
-    171, 30, 171, 171, 171, 11, 171, 171, 171, 171, 171, 37, 26, 40, 0, 0,
-    172, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0,
-    0, 45, 128, 119, 101, 172, 172, 132, 139, 137, 140, 138, 141, 144, 147, 143,
-    146, 157, 153, 155, 142, 145, 171, 152, 150, 151, 149, 171, 171, 171, 171, 171,
-    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 64, 171, 62, 171, 171, 61,
-    171, 63, 158, 172, 172, 169, 162, 163, 171, 171, 171, 171, 171, 171, 171, 56,
-    171, 52, 171, 171, 171, 171, 55, 54, 171, 171, 171, 171, 171, 58, 134, 135,
-    164, 165, 172, 172, 170, 160, 161, 0, 111, 104, 112, 154, 0, 103, 109, 118,
-    129, 171, 156, 159, 100, 0, 171, 171, 171, 171, 171, 171, 173, 125, 53, 171,
-    171, 57, 0, 114, 175, 171, 171, 171, 171, 171, 171, 60, 59, 166, 167, 126,
-    175, 172, 168, 94, 0, 2, 95, 123, 2, 174, 113, 4, 0, 0, 0, 0,
+    171, 171, 171, 89, 107, 90, 78, 2, 286, 2, 171, 171, 171, 171, 49, 171,
+    171, 9, 171, 171, 23, 171, 171, 171, 171, 0, 80, 171, 171, 50, 171, 171,
+    171, 171, 171, 171, 171, 38, 171, 171, 171, 171, 29, 43, 171, 171, 171, 171,
+    171, 22, 171, 36, 171, 39, 171, 171, 171, 72, 171, 171, 171, 171, 171, 13,
+    48, 27, 171, 171, 171, 171, 171, 171, 171, 35, 171, 171, 25, 171, 17, 171,
+    171, 171, 171, 171, 171, 171, 47, 171, 171, 171, 171, 16, 41, 171, 42, 171,
+    44, 171, 171, 74, 171, 171, 20, 6, 171, 18, 171, 171, 19, 171, 171, 171,
+    14, 171, 8, 171, 21, 171, 171, 28, 171, 171, 51, 171, 171, 171, 171, 171,
+    171, 34, 171, 7, 171, 171, 10, 171, 171, 171, 171, 31, 171, 24, 171, 171,
+    171, 15, 171, 171, 171, 171, 171, 12, 171, 171, 171, 171, 33, 171, 171, 171,
+    32, 171, 30, 171, 171, 171, 11, 171, 171, 171, 171, 171, 37, 26, 40, 0,
+    0, 172, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0,
+    0, 0, 45, 128, 0, 103, 109, 130, 101, 119, 172, 172, 132, 139, 137, 140,
+    138, 141, 144, 147, 143, 146, 157, 153, 155, 142, 145, 171, 152, 150, 151, 149,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 64,
+    171, 62, 171, 171, 61, 171, 63, 158, 172, 172, 169, 162, 163, 171, 171, 171,
+    171, 171, 171, 171, 56, 171, 52, 171, 171, 171, 171, 55, 54, 171, 171, 171,
+    171, 171, 58, 134, 135, 164, 165, 172, 172, 170, 160, 161, 0, 111, 104, 112,
+    154, 118, 129, 100, 171, 156, 159, 0, 175, 171, 171, 171, 171, 171, 171, 94,
+    173, 125, 0, 53, 171, 171, 57, 124, 584, 171, 171, 171, 114, 126, 171, 171,
+    171, 60, 59, 166, 167, 122, 172, 168, 2, 95, 123, 0, 174, 4, 113, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -607,33 +761,33 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 171, 116, 233, 1,
-    4, 4, 5, 79, 68, 127, 66, 124, 174, 122, 3, 223, 3, 3, 0, 0,
-    105, 69, 93, 131, 96, 603, 71, 99, 82, 97, 173, 65, 70, 108, 121, 110,
-    81, 171, 171, 171, 171, 133, 171, 171, 171, 171, 171, 148, 136, 171, 91, 92,
-    106, 0, 67, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
-    171, 171, 171, 171, 171, 171, 89, 107, 90, 78, 2, 287, 130, 171, 171, 171,
-    171, 49, 171, 171, 9, 171, 171, 23, 171, 171, 171, 171, 0, 80, 171, 171,
-    50, 171, 171, 171, 171, 171, 171, 171, 38, 171, 171, 171, 171, 29, 43, 171,
-    171, 171, 171, 171, 22, 171, 36, 171, 39, 171, 171, 171, 72, 171, 171, 171,
-    171, 171, 13, 48, 27, 171, 171, 171, 171, 171, 171, 171, 35, 171, 171, 25,
-    171, 17, 171, 171, 171, 171, 171, 171, 171, 47, 171, 171, 171, 171, 16, 41,
-    171, 42, 171, 44, 171, 171, 74, 171, 171, 20, 6, 171, 18, 171, 171, 19,
-    171, 171, 171, 14, 171, 8, 171, 21, 171, 171, 28, 171, 171, 51, 171, 171,
-    171, 171, 171, 171, 34, 171, 7, 171, 171, 10, 171, 171, 171, 171, 31, 171,
-    24, 171, 171, 171, 15, 171, 171, 171, 171, 171, 12, 171, 171, 171, 171, 33,
-    171, 171, 171, 32, 171, 30, 171, 171, 171, 11, 171, 171, 171, 171, 171, 37,
-    26, 40, 0, 0, 172, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    46, 0, 0, 0, 0, 45, 128, 119, 101, 172, 172, 132, 139, 137, 140, 138,
-    141, 144, 147, 143, 146, 157, 153, 155, 142, 145, 171, 152, 150, 151, 149, 171,
-    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 64, 171,
-    62, 171, 171, 61, 171, 63, 158, 172, 172, 169, 162, 163, 171, 171, 171, 171,
-    171, 171, 171, 56, 171, 52, 171, 171, 171, 171, 55, 54, 171, 171, 171, 171,
-    171, 58, 134, 135, 164, 165, 172, 172, 170, 160, 161, 0, 111, 104, 112, 154,
-    0, 103, 109, 118, 129, 171, 156, 159, 100, 0, 171, 171, 171, 171, 171, 171,
-    173, 125, 53, 171, 171, 57, 0, 114, 175, 171, 171, 171, 171, 171, 171, 60,
-    59, 166, 167, 126, 175, 172, 168, 94, 0, 2, 95, 123, 2, 174, 113, 4,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    171, 116, 236, 1, 4, 4, 5, 79, 127, 68, 66, 174, 3, 222, 3, 3,
+    0, 0, 105, 69, 93, 131, 96, 98, 71, 99, 82, 286, 173, 65, 70, 108,
+    121, 110, 81, 171, 171, 171, 171, 133, 171, 171, 171, 171, 171, 148, 136, 171,
+    91, 92, 106, 0, 67, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 89, 107, 90, 78, 2, 286, 2, 171,
+    171, 171, 171, 49, 171, 171, 9, 171, 171, 23, 171, 171, 171, 171, 0, 80,
+    171, 171, 50, 171, 171, 171, 171, 171, 171, 171, 38, 171, 171, 171, 171, 29,
+    43, 171, 171, 171, 171, 171, 22, 171, 36, 171, 39, 171, 171, 171, 72, 171,
+    171, 171, 171, 171, 13, 48, 27, 171, 171, 171, 171, 171, 171, 171, 35, 171,
+    171, 25, 171, 17, 171, 171, 171, 171, 171, 171, 171, 47, 171, 171, 171, 171,
+    16, 41, 171, 42, 171, 44, 171, 171, 74, 171, 171, 20, 6, 171, 18, 171,
+    171, 19, 171, 171, 171, 14, 171, 8, 171, 21, 171, 171, 28, 171, 171, 51,
+    171, 171, 171, 171, 171, 171, 34, 171, 7, 171, 171, 10, 171, 171, 171, 171,
+    31, 171, 24, 171, 171, 171, 15, 171, 171, 171, 171, 171, 12, 171, 171, 171,
+    171, 33, 171, 171, 171, 32, 171, 30, 171, 171, 171, 11, 171, 171, 171, 171,
+    171, 37, 26, 40, 0, 0, 172, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 46, 0, 0, 0, 0, 45, 128, 0, 103, 109, 130, 101, 119, 172,
+    172, 132, 139, 137, 140, 138, 141, 144, 147, 143, 146, 157, 153, 155, 142, 145,
+    171, 152, 150, 151, 149, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 64, 171, 62, 171, 171, 61, 171, 63, 158, 172, 172, 169,
+    162, 163, 171, 171, 171, 171, 171, 171, 171, 56, 171, 52, 171, 171, 171, 171,
+    55, 54, 171, 171, 171, 171, 171, 58, 134, 135, 164, 165, 172, 172, 170, 160,
+    161, 0, 111, 104, 112, 154, 118, 129, 100, 171, 156, 159, 0, 175, 171, 171,
+    171, 171, 171, 171, 94, 173, 125, 0, 53, 171, 171, 57, 124, 175, 171, 171,
+    171, 114, 126, 171, 171, 171, 60, 59, 166, 167, 122, 172, 168, 2, 95, 123,
+    0, 174, 4, 113, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -646,32 +800,32 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    171, 116, 234, 1, 4, 4, 5, 79, 68, 127, 66, 124, 174, 122, 3, 223,
-    3, 3, 0, 0, 105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65,
-    70, 108, 121, 110, 81, 171, 171, 171, 171, 133, 171, 171, 171, 171, 171, 148,
-    136, 171, 91, 92, 106, 0, 67, 171, 171, 171, 171, 171, 171, 171, 171, 171,
-    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 89, 107, 90, 78, 2, 287,
-    130, 171, 171, 171, 171, 49, 171, 171, 9, 171, 171, 23, 171, 171, 171, 171,
-    0, 80, 171, 171, 50, 171, 171, 171, 171, 171, 171, 171, 38, 171, 171, 171,
-    171, 29, 43, 171, 171, 171, 171, 171, 22, 171, 36, 171, 39, 171, 171, 171,
-    72, 171, 171, 171, 171, 171, 13, 48, 27, 171, 171, 171, 171, 171, 171, 171,
-    35, 171, 171, 25, 171, 17, 171, 171, 171, 171, 171, 171, 171, 47, 171, 171,
-    171, 171, 16, 41, 171, 42, 171, 44, 171, 171, 74, 171, 171, 20, 6, 171,
-    18, 171, 171, 19, 171, 171, 171, 14, 171, 8, 171, 21, 171, 171, 28, 171,
-    171, 51, 171, 171, 171, 171, 171, 171, 34, 171, 7, 171, 171, 10, 171, 171,
-    171, 171, 31, 171, 24, 171, 171, 171, 15, 171, 171, 171, 171, 171, 12, 171,
-    171, 171, 171, 33, 171, 171, 171, 32, 171, 30, 171, 171, 171, 11, 171, 171,
-    171, 171, 171, 37, 26, 40, 0, 0, 172, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 119, 101, 172, 172, 132,
-    139, 137, 140, 138, 141, 144, 147, 143, 146, 157, 153, 155, 142, 145, 171, 152,
-    150, 151, 149, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
-    171, 171, 64, 171, 62, 171, 171, 61, 171, 63, 158, 172, 172, 169, 162, 163,
-    171, 171, 171, 171, 171, 171, 171, 56, 171, 52, 171, 171, 171, 171, 55, 54,
-    171, 171, 171, 171, 171, 58, 134, 135, 164, 165, 172, 172, 170, 160, 161, 0,
-    111, 104, 112, 154, 0, 103, 109, 118, 129, 171, 156, 159, 100, 0, 171, 171,
-    171, 171, 171, 171, 173, 125, 53, 171, 171, 57, 0, 114, 175, 171, 171, 171,
-    171, 171, 171, 60, 59, 166, 167, 126, 175, 172, 168, 94, 0, 2, 95, 123,
-    2, 174, 113, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 209, 116, 237, 1, 4, 4, 5, 79, 127, 68, 66,
+    220, 3, 222, 3, 3, 220, 590, 105, 69, 93, 131, 96, 98, 71, 99, 82,
+    97, 237, 65, 70, 108, 121, 110, 81, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 91, 92, 106, 0, 67, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 89, 107, 90,
+    78, 2, 286, 2, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 0, 80, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 0, 0, 455, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 0, 103,
+    109, 130, 101, 119, 455, 455, 455, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 455, 455, 455, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 455, 455, 455, 247, 247, 0, 111, 104, 112, 247, 118, 129, 100, 247, 247,
+    247, 582, 574, 247, 247, 247, 247, 247, 247, 94, 582, 125, 574, 247, 247, 247,
+    247, 124, 590, 247, 247, 247, 114, 126, 247, 247, 247, 247, 247, 247, 247, 122,
+    455, 455, 2, 95, 123, 610, 610, 4, 113, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -684,32 +838,32 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 171, 116, 235, 1, 4, 4, 5, 79, 68, 127, 66, 124,
-    174, 122, 3, 223, 3, 3, 0, 0, 105, 69, 93, 131, 96, 98, 71, 606,
-    82, 97, 173, 65, 70, 564, 121, 559, 81, 171, 171, 171, 171, 133, 171, 171,
-    171, 171, 171, 148, 136, 171, 91, 92, 106, 0, 67, 171, 171, 171, 171, 171,
-    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 89, 107,
-    90, 78, 2, 287, 130, 171, 171, 171, 171, 49, 171, 171, 9, 171, 171, 23,
-    171, 171, 171, 171, 0, 80, 171, 171, 50, 171, 171, 171, 171, 171, 171, 171,
-    38, 171, 171, 171, 171, 29, 43, 171, 171, 171, 171, 171, 22, 171, 36, 171,
-    39, 171, 171, 171, 72, 171, 171, 171, 171, 171, 13, 48, 27, 171, 171, 171,
-    171, 171, 171, 171, 35, 171, 171, 25, 171, 17, 171, 171, 171, 171, 171, 171,
-    171, 47, 171, 171, 171, 171, 16, 41, 171, 42, 171, 44, 171, 171, 74, 171,
-    171, 20, 6, 171, 18, 171, 171, 19, 171, 171, 171, 14, 171, 8, 171, 21,
-    171, 171, 28, 171, 171, 51, 171, 171, 171, 171, 171, 171, 34, 171, 7, 171,
-    171, 10, 171, 171, 171, 171, 31, 171, 24, 171, 171, 171, 15, 171, 171, 171,
-    171, 171, 12, 171, 171, 171, 171, 33, 171, 171, 171, 32, 171, 30, 171, 171,
-    171, 11, 171, 171, 171, 171, 171, 37, 26, 40, 0, 0, 172, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 119,
-    101, 172, 172, 132, 139, 137, 140, 138, 141, 144, 147, 143, 146, 157, 153, 155,
-    142, 145, 171, 152, 150, 151, 149, 171, 171, 171, 171, 171, 171, 171, 171, 171,
-    171, 171, 171, 171, 171, 171, 64, 171, 62, 171, 171, 61, 171, 63, 158, 172,
-    172, 169, 162, 163, 171, 171, 171, 171, 171, 171, 171, 56, 171, 52, 171, 171,
-    171, 171, 55, 54, 171, 171, 171, 171, 171, 58, 134, 135, 164, 165, 172, 172,
-    170, 160, 161, 0, 111, 104, 112, 154, 0, 103, 109, 118, 129, 171, 156, 159,
-    100, 0, 171, 171, 171, 171, 171, 171, 173, 125, 53, 171, 171, 57, 0, 114,
-    175, 171, 171, 171, 171, 171, 171, 60, 59, 166, 167, 126, 175, 172, 168, 94,
-    0, 2, 95, 123, 2, 174, 113, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 209, 116, 237, 1, 4, 4,
+    5, 79, 127, 68, 66, 220, 3, 222, 3, 3, 220, 0, 105, 69, 93, 131,
+    96, 98, 71, 99, 82, 97, 237, 65, 70, 108, 121, 110, 81, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 91, 92, 106, 0, 67, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 89, 107, 90, 78, 2, 286, 2, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 0, 80, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 0, 0,
+    455, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0,
+    0, 45, 128, 0, 103, 109, 130, 101, 119, 455, 455, 455, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 455, 455, 455, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 455, 455, 455, 247, 247, 0, 111, 104, 112, 247,
+    118, 129, 100, 247, 247, 247, 582, 175, 247, 247, 247, 247, 247, 247, 94, 582,
+    125, 0, 247, 247, 247, 247, 124, 175, 247, 247, 247, 114, 126, 247, 247, 247,
+    247, 247, 247, 247, 122, 455, 455, 2, 95, 123, 610, 610, 4, 113, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -722,32 +876,33 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 171, 116, 236, 1, 4, 4, 5, 79,
-    68, 127, 66, 124, 604, 122, 3, 223, 3, 3, 0, 0, 105, 69, 93, 131,
-    96, 98, 71, 99, 82, 97, 573, 65, 70, 108, 121, 110, 81, 171, 171, 171,
-    171, 133, 171, 171, 171, 171, 171, 148, 136, 171, 91, 92, 106, 0, 67, 171,
-    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
-    171, 171, 89, 107, 90, 78, 2, 287, 130, 171, 171, 171, 171, 49, 171, 171,
-    9, 171, 171, 23, 171, 171, 171, 171, 0, 80, 171, 171, 50, 171, 171, 171,
-    171, 171, 171, 171, 38, 171, 171, 171, 171, 29, 43, 171, 171, 171, 171, 171,
-    22, 171, 36, 171, 39, 171, 171, 171, 72, 171, 171, 171, 171, 171, 13, 48,
-    27, 171, 171, 171, 171, 171, 171, 171, 35, 171, 171, 25, 171, 17, 171, 171,
-    171, 171, 171, 171, 171, 47, 171, 171, 171, 171, 16, 41, 171, 42, 171, 44,
-    171, 171, 74, 171, 171, 20, 6, 171, 18, 171, 171, 19, 171, 171, 171, 14,
-    171, 8, 171, 21, 171, 171, 28, 171, 171, 51, 171, 171, 171, 171, 171, 171,
-    34, 171, 7, 171, 171, 10, 171, 171, 171, 171, 31, 171, 24, 171, 171, 171,
-    15, 171, 171, 171, 171, 171, 12, 171, 171, 171, 171, 33, 171, 171, 171, 32,
-    171, 30, 171, 171, 171, 11, 171, 171, 171, 171, 171, 37, 26, 40, 0, 0,
-    172, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0,
-    0, 45, 128, 119, 101, 172, 172, 132, 139, 137, 140, 138, 141, 144, 147, 143,
-    146, 157, 153, 155, 142, 145, 171, 152, 150, 151, 149, 171, 171, 171, 171, 171,
-    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 64, 171, 62, 171, 171, 61,
-    171, 63, 158, 172, 172, 169, 162, 163, 171, 171, 171, 171, 171, 171, 171, 56,
-    171, 52, 171, 171, 171, 171, 55, 54, 171, 171, 171, 171, 171, 58, 134, 135,
-    164, 165, 172, 172, 170, 160, 161, 0, 111, 104, 112, 154, 0, 103, 109, 118,
-    129, 171, 156, 159, 100, 0, 171, 171, 171, 171, 171, 171, 173, 125, 53, 171,
-    171, 57, 0, 114, 586, 171, 171, 171, 171, 171, 171, 60, 59, 166, 167, 126,
-    175, 172, 168, 94, 0, 2, 95, 123, 2, 174, 113, 4, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 171,
+    116, 238, 1, 4, 4, 5, 79, 127, 68, 66, 174, 3, 222, 3, 3, 0,
+    0, 105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65, 70, 108, 121,
+    110, 81, 171, 171, 171, 171, 133, 171, 171, 171, 171, 171, 148, 136, 171, 91,
+    92, 106, 0, 67, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 89, 107, 90, 78, 2, 286, 2, 171, 171,
+    171, 171, 49, 171, 171, 9, 171, 171, 23, 171, 171, 171, 171, 0, 80, 171,
+    171, 50, 171, 171, 171, 171, 171, 171, 171, 38, 171, 171, 171, 171, 29, 43,
+    171, 171, 171, 171, 171, 22, 171, 36, 171, 39, 171, 171, 171, 72, 171, 171,
+    171, 171, 171, 13, 48, 27, 171, 171, 171, 171, 171, 171, 171, 35, 171, 171,
+    25, 171, 17, 171, 171, 171, 171, 171, 171, 171, 47, 171, 171, 171, 171, 16,
+    41, 171, 42, 171, 44, 171, 171, 74, 171, 171, 20, 6, 171, 18, 171, 171,
+    19, 171, 171, 171, 14, 171, 8, 171, 21, 171, 171, 28, 171, 171, 51, 171,
+    171, 171, 171, 171, 171, 34, 171, 7, 171, 171, 10, 171, 171, 171, 171, 31,
+    171, 24, 171, 171, 171, 15, 171, 171, 171, 171, 171, 12, 171, 171, 171, 171,
+    33, 171, 171, 171, 32, 171, 30, 171, 171, 171, 11, 171, 171, 171, 171, 171,
+    37, 26, 40, 0, 0, 172, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 46, 0, 0, 0, 0, 45, 128, 0, 103, 109, 130, 101, 119, 172, 172,
+    132, 139, 137, 140, 138, 141, 144, 147, 143, 146, 157, 153, 155, 142, 145, 171,
+    152, 150, 151, 149, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 64, 171, 62, 171, 171, 61, 171, 63, 158, 172, 172, 169, 162,
+    163, 171, 171, 171, 171, 171, 171, 171, 56, 171, 52, 171, 171, 171, 171, 55,
+    54, 171, 171, 171, 171, 171, 58, 134, 135, 164, 165, 172, 172, 170, 160, 161,
+    0, 111, 104, 112, 154, 118, 129, 100, 171, 156, 159, 0, 175, 171, 171, 171,
+    171, 171, 171, 94, 173, 125, 0, 53, 171, 171, 57, 124, 175, 171, 171, 171,
+    114, 126, 171, 171, 171, 60, 59, 166, 167, 122, 172, 168, 2, 95, 123, 0,
+    174, 4, 113, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -760,32 +915,37 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 171, 116, 237, 1,
-    4, 4, 5, 79, 68, 127, 66, 124, 174, 122, 3, 223, 3, 3, 0, 0,
-    105, 69, 93, 131, 96, 98, 71, 99, 82, 287, 173, 65, 70, 108, 121, 110,
-    81, 171, 171, 171, 171, 133, 171, 171, 171, 171, 171, 148, 136, 171, 91, 92,
-    106, 0, 67, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
-    171, 171, 171, 171, 171, 171, 89, 107, 90, 78, 2, 287, 130, 171, 171, 171,
-    171, 49, 171, 171, 9, 171, 171, 23, 171, 171, 171, 171, 0, 80, 171, 171,
-    50, 171, 171, 171, 171, 171, 171, 171, 38, 171, 171, 171, 171, 29, 43, 171,
-    171, 171, 171, 171, 22, 171, 36, 171, 39, 171, 171, 171, 72, 171, 171, 171,
-    171, 171, 13, 48, 27, 171, 171, 171, 171, 171, 171, 171, 35, 171, 171, 25,
-    171, 17, 171, 171, 171, 171, 171, 171, 171, 47, 171, 171, 171, 171, 16, 41,
-    171, 42, 171, 44, 171, 171, 74, 171, 171, 20, 6, 171, 18, 171, 171, 19,
-    171, 171, 171, 14, 171, 8, 171, 21, 171, 171, 28, 171, 171, 51, 171, 171,
-    171, 171, 171, 171, 34, 171, 7, 171, 171, 10, 171, 171, 171, 171, 31, 171,
-    24, 171, 171, 171, 15, 171, 171, 171, 171, 171, 12, 171, 171, 171, 171, 33,
-    171, 171, 171, 32, 171, 30, 171, 171, 171, 11, 171, 171, 171, 171, 171, 37,
-    26, 40, 0, 0, 172, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    46, 0, 0, 0, 0, 45, 128, 119, 101, 172, 172, 132, 139, 137, 140, 138,
-    141, 144, 147, 143, 146, 157, 153, 155, 142, 145, 171, 152, 150, 151, 149, 171,
-    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 64, 171,
-    62, 171, 171, 61, 171, 63, 158, 172, 172, 169, 162, 163, 171, 171, 171, 171,
-    171, 171, 171, 56, 171, 52, 171, 171, 171, 171, 55, 54, 171, 171, 171, 171,
-    171, 58, 134, 135, 164, 165, 172, 172, 170, 160, 161, 0, 111, 104, 112, 154,
-    0, 103, 109, 118, 129, 171, 156, 159, 100, 0, 171, 171, 171, 171, 171, 171,
-    173, 125, 53, 171, 171, 57, 0, 114, 175, 171, 171, 171, 171, 171, 171, 60,
-    59, 166, 167, 126, 175, 172, 168, 94, 0, 2, 95, 123, 2, 174, 113, 4,
+    0, 0, 0, 0, 171, 116, 239, 1, 4, 4, 5, 79, 127, 68, 66, 174,
+    3, 222, 3, 3, 0, 0, 105, 69, 93, 131, 96, 98, 71, 99, 82, 97,
+    173, 65, 70, 108, 121, 110, 81, 171, 171, 171, 171, 133, 171, 171, 171, 171,
+    171, 148, 136, 171, 91, 92, 106, 0, 67, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 89, 107, 90, 78,
+    2, 286, 2, 171, 171, 171, 171, 49, 171, 171, 9, 171, 171, 23, 171, 171,
+    171, 171, 0, 80, 171, 171, 50, 171, 171, 171, 171, 171, 171, 171, 38, 171,
+    171, 171, 171, 29, 43, 171, 171, 171, 171, 171, 22, 171, 36, 171, 39, 171,
+    171, 171, 72, 171, 171, 171, 171, 171, 13, 48, 27, 171, 171, 171, 171, 171,
+    171, 171, 35, 171, 171, 25, 171, 17, 171, 171, 171, 171, 171, 171, 171, 47,
+    171, 171, 171, 171, 16, 41, 171, 42, 171, 44, 171, 171, 74, 171, 171, 20,
+    6, 171, 18, 171, 171, 19, 171, 171, 171, 14, 171, 8, 171, 21, 171, 171,
+    28, 171, 171, 51, 171, 171, 171, 171, 171, 171, 34, 171, 7, 171, 171, 10,
+    171, 171, 171, 171, 31, 171, 24, 171, 171, 171, 15, 171, 171, 171, 171, 171,
+    12, 171, 171, 171, 171, 33, 171, 171, 171, 32, 171, 30, 171, 171, 171, 11,
+    171, 171, 171, 171, 171, 37, 26, 40, 0, 0, 172, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 0, 103, 109,
+    130, 101, 119, 172, 172, 132, 139, 137, 140, 138, 141, 144, 147, 143, 146, 157,
+    153, 155, 142, 145, 171, 152, 150, 151, 149, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 64, 171, 62, 171, 171, 61, 171, 63,
+    158, 172, 172, 169, 162, 163, 171, 171, 171, 171, 171, 171, 171, 56, 171, 52,
+    171, 171, 171, 171, 55, 54, 171, 171, 171, 171, 171, 58, 134, 135, 164, 165,
+    172, 172, 170, 160, 161, 0, 111, 104, 112, 154, 118, 129, 100, 171, 156, 159,
+    0, 175, 171, 171, 171, 171, 171, 171, 94, 173, 125, 0, 53, 171, 171, 57,
+    124, 175, 171, 171, 171, 114, 126, 171, 171, 171, 60, 59, 166, 167, 122, 172,
+    168, 2, 95, 123, 0, 174, 4, 113, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -793,38 +953,71 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 171, 116, 240, 1, 4, 4, 5,
+    79, 127, 68, 66, 174, 3, 222, 3, 3, 0, 0, 105, 69, 93, 131, 96,
+    98, 71, 99, 82, 97, 173, 65, 70, 475, 121, 110, 81, 171, 171, 171, 171,
+    133, 171, 171, 171, 171, 171, 148, 136, 171, 91, 92, 106, 0, 67, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 89, 107, 90, 78, 2, 286, 2, 171, 171, 171, 171, 49, 171, 171, 9,
+    171, 171, 23, 171, 171, 171, 171, 0, 80, 171, 171, 50, 171, 171, 171, 171,
+    171, 171, 171, 38, 171, 171, 171, 171, 29, 43, 171, 171, 171, 171, 171, 22,
+    171, 36, 171, 39, 171, 171, 171, 72, 171, 171, 171, 171, 171, 13, 48, 27,
+    171, 171, 171, 171, 171, 171, 171, 35, 171, 171, 25, 171, 17, 171, 171, 171,
+    171, 171, 171, 171, 47, 171, 171, 171, 171, 16, 41, 171, 42, 171, 44, 171,
+    171, 74, 171, 171, 20, 6, 171, 18, 171, 171, 19, 171, 171, 171, 14, 171,
+    8, 171, 21, 171, 171, 28, 171, 171, 51, 171, 171, 171, 171, 171, 171, 34,
+    171, 7, 171, 171, 10, 171, 171, 171, 171, 31, 171, 24, 171, 171, 171, 15,
+    171, 171, 171, 171, 171, 12, 171, 171, 171, 171, 33, 171, 171, 171, 32, 171,
+    30, 171, 171, 171, 11, 171, 171, 171, 171, 171, 37, 26, 40, 0, 0, 172,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0,
+    45, 128, 569, 103, 567, 130, 101, 119, 172, 172, 132, 139, 137, 140, 138, 141,
+    144, 147, 143, 146, 157, 153, 155, 142, 145, 171, 152, 150, 151, 149, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 64, 171, 62,
+    171, 171, 61, 171, 63, 158, 172, 172, 169, 162, 163, 171, 171, 171, 171, 171,
+    171, 171, 56, 171, 52, 171, 171, 171, 171, 55, 54, 171, 171, 171, 171, 171,
+    58, 134, 135, 164, 165, 172, 172, 170, 160, 161, 0, 111, 104, 112, 154, 118,
+    129, 100, 171, 156, 159, 0, 175, 171, 171, 171, 171, 171, 171, 94, 173, 125,
+    0, 53, 171, 171, 57, 124, 175, 171, 171, 171, 114, 126, 171, 171, 171, 60,
+    59, 166, 167, 122, 172, 168, 2, 95, 123, 0, 174, 4, 113, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    208, 116, 238, 1, 4, 4, 5, 79, 68, 127, 66, 124, 220, 122, 3, 223,
-    3, 3, 220, 588, 105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 238, 65,
-    70, 108, 121, 110, 81, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 91, 92, 106, 0, 67, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 89, 107, 90, 78, 2, 287,
-    130, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    0, 80, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 0, 0, 456, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 119, 101, 456, 456, 456,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 456, 456, 456, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 456, 456, 456, 248, 248, 0,
-    111, 104, 112, 248, 0, 103, 109, 118, 129, 248, 248, 248, 100, 580, 248, 248,
-    248, 248, 248, 248, 580, 125, 248, 248, 248, 248, 600, 114, 588, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 126, 600, 456, 456, 94, 609, 2, 95, 123,
-    2, 609, 113, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 171, 116,
+    241, 1, 4, 4, 5, 612, 127, 68, 66, 174, 3, 222, 3, 3, 0, 0,
+    595, 69, 93, 131, 589, 603, 71, 608, 82, 583, 173, 65, 70, 476, 565, 563,
+    81, 171, 171, 171, 171, 133, 171, 171, 171, 171, 171, 148, 136, 171, 91, 92,
+    473, 0, 67, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 89, 217, 90, 78, 2, 286, 2, 171, 171, 171,
+    171, 49, 171, 171, 9, 171, 171, 23, 171, 171, 171, 171, 0, 80, 171, 171,
+    50, 171, 171, 171, 171, 171, 171, 171, 38, 171, 171, 171, 171, 29, 43, 171,
+    171, 171, 171, 171, 22, 171, 36, 171, 39, 171, 171, 171, 72, 171, 171, 171,
+    171, 171, 13, 48, 27, 171, 171, 171, 171, 171, 171, 171, 35, 171, 171, 25,
+    171, 17, 171, 171, 171, 171, 171, 171, 171, 47, 171, 171, 171, 171, 16, 41,
+    171, 42, 171, 44, 171, 171, 74, 171, 171, 20, 6, 171, 18, 171, 171, 19,
+    171, 171, 171, 14, 171, 8, 171, 21, 171, 171, 28, 171, 171, 51, 171, 171,
+    171, 171, 171, 171, 34, 171, 7, 171, 171, 10, 171, 171, 171, 171, 31, 171,
+    24, 171, 171, 171, 15, 171, 171, 171, 171, 171, 12, 171, 171, 171, 171, 33,
+    171, 171, 171, 32, 171, 30, 171, 171, 171, 11, 171, 171, 171, 171, 171, 37,
+    26, 40, 0, 0, 172, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    46, 0, 0, 0, 0, 45, 128, 0, 568, 109, 130, 101, 119, 172, 172, 132,
+    139, 137, 140, 138, 141, 144, 147, 143, 146, 157, 153, 155, 142, 145, 171, 152,
+    150, 151, 149, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 64, 171, 62, 171, 171, 61, 171, 63, 158, 172, 172, 169, 162, 163,
+    171, 171, 171, 171, 171, 171, 171, 56, 171, 52, 171, 171, 171, 171, 55, 54,
+    171, 171, 171, 171, 171, 58, 134, 135, 164, 165, 172, 172, 170, 160, 161, 0,
+    111, 477, 112, 154, 118, 129, 100, 171, 156, 159, 0, 175, 171, 171, 171, 171,
+    171, 171, 94, 173, 125, 0, 53, 171, 171, 57, 124, 175, 171, 171, 171, 114,
+    126, 171, 171, 171, 60, 59, 166, 167, 122, 172, 168, 2, 95, 123, 0, 174,
+    4, 113, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -837,32 +1030,32 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 208, 116, 238, 1, 4, 4, 5, 79, 68, 127, 66, 124,
-    220, 122, 3, 223, 3, 3, 220, 0, 105, 69, 93, 131, 96, 98, 71, 99,
-    82, 97, 238, 65, 70, 108, 121, 110, 81, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 91, 92, 106, 0, 67, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 89, 107,
-    90, 78, 2, 287, 130, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 0, 80, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 0, 0, 456, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 119,
-    101, 456, 456, 456, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 456,
-    456, 456, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 456, 456,
-    456, 248, 248, 0, 111, 104, 112, 248, 0, 103, 109, 118, 129, 248, 248, 248,
-    100, 580, 248, 248, 248, 248, 248, 248, 580, 125, 248, 248, 248, 248, 0, 114,
-    175, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 126, 175, 456, 456, 94,
-    609, 2, 95, 123, 2, 609, 113, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 171, 116, 242, 1, 4, 4, 5, 79, 127, 68, 66, 174, 3,
+    222, 3, 3, 0, 0, 105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173,
+    65, 70, 108, 121, 564, 81, 171, 171, 171, 171, 133, 171, 171, 171, 171, 171,
+    148, 136, 171, 91, 92, 106, 0, 67, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 89, 107, 90, 78, 2,
+    286, 2, 171, 171, 171, 171, 49, 171, 171, 9, 171, 171, 23, 171, 171, 171,
+    171, 0, 80, 171, 171, 50, 171, 171, 171, 171, 171, 171, 171, 38, 171, 171,
+    171, 171, 29, 43, 171, 171, 171, 171, 171, 22, 171, 36, 171, 39, 171, 171,
+    171, 72, 171, 171, 171, 171, 171, 13, 48, 27, 171, 171, 171, 171, 171, 171,
+    171, 35, 171, 171, 25, 171, 17, 171, 171, 171, 171, 171, 171, 171, 47, 171,
+    171, 171, 171, 16, 41, 171, 42, 171, 44, 171, 171, 74, 171, 171, 20, 6,
+    171, 18, 171, 171, 19, 171, 171, 171, 14, 171, 8, 171, 21, 171, 171, 28,
+    171, 171, 51, 171, 171, 171, 171, 171, 171, 34, 171, 7, 171, 171, 10, 171,
+    171, 171, 171, 31, 171, 24, 171, 171, 171, 15, 171, 171, 171, 171, 171, 12,
+    171, 171, 171, 171, 33, 171, 171, 171, 32, 171, 30, 171, 171, 171, 11, 171,
+    171, 171, 171, 171, 37, 26, 40, 0, 0, 172, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 0, 103, 109, 130,
+    101, 119, 172, 172, 132, 139, 137, 140, 138, 141, 144, 147, 143, 146, 157, 153,
+    155, 142, 145, 171, 152, 150, 151, 149, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 64, 171, 62, 171, 171, 61, 171, 63, 158,
+    172, 172, 169, 162, 163, 171, 171, 171, 171, 171, 171, 171, 56, 171, 52, 171,
+    171, 171, 171, 55, 54, 171, 171, 171, 171, 171, 58, 134, 135, 164, 165, 172,
+    172, 170, 160, 161, 478, 479, 104, 112, 154, 118, 129, 100, 171, 156, 159, 0,
+    175, 171, 171, 171, 171, 171, 171, 94, 173, 125, 0, 53, 171, 171, 57, 124,
+    175, 171, 171, 171, 114, 126, 171, 171, 171, 60, 59, 166, 167, 122, 172, 168,
+    2, 95, 123, 0, 174, 4, 113, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -875,32 +1068,32 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 171, 116, 239, 1, 4, 4, 5, 79,
-    68, 127, 66, 124, 174, 122, 3, 223, 3, 3, 0, 0, 105, 69, 93, 131,
-    96, 98, 71, 99, 82, 97, 173, 65, 70, 108, 121, 110, 81, 171, 171, 171,
-    171, 133, 171, 171, 171, 171, 171, 148, 136, 171, 91, 92, 106, 0, 67, 171,
+    0, 0, 0, 0, 0, 0, 0, 0, 171, 116, 243, 1, 4, 4, 5, 79,
+    127, 68, 66, 174, 3, 222, 3, 3, 0, 0, 105, 69, 93, 131, 96, 98,
+    71, 99, 82, 97, 173, 65, 70, 108, 121, 110, 81, 171, 171, 171, 171, 133,
+    171, 171, 171, 171, 171, 148, 136, 171, 91, 92, 106, 0, 67, 171, 171, 171,
     171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
-    171, 171, 89, 107, 90, 78, 2, 287, 130, 171, 171, 171, 171, 49, 171, 171,
-    9, 171, 171, 23, 171, 171, 171, 171, 0, 80, 171, 171, 50, 171, 171, 171,
-    171, 171, 171, 171, 38, 171, 171, 171, 171, 29, 43, 171, 171, 171, 171, 171,
-    22, 171, 36, 171, 39, 171, 171, 171, 72, 171, 171, 171, 171, 171, 13, 48,
-    27, 171, 171, 171, 171, 171, 171, 171, 35, 171, 171, 25, 171, 17, 171, 171,
-    171, 171, 171, 171, 171, 47, 171, 171, 171, 171, 16, 41, 171, 42, 171, 44,
-    171, 171, 74, 171, 171, 20, 6, 171, 18, 171, 171, 19, 171, 171, 171, 14,
-    171, 8, 171, 21, 171, 171, 28, 171, 171, 51, 171, 171, 171, 171, 171, 171,
-    34, 171, 7, 171, 171, 10, 171, 171, 171, 171, 31, 171, 24, 171, 171, 171,
-    15, 171, 171, 171, 171, 171, 12, 171, 171, 171, 171, 33, 171, 171, 171, 32,
-    171, 30, 171, 171, 171, 11, 171, 171, 171, 171, 171, 37, 26, 40, 0, 0,
-    172, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0,
-    0, 45, 128, 119, 101, 172, 172, 132, 139, 137, 140, 138, 141, 144, 147, 143,
-    146, 157, 153, 155, 142, 145, 171, 152, 150, 151, 149, 171, 171, 171, 171, 171,
-    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 64, 171, 62, 171, 171, 61,
-    171, 63, 158, 172, 172, 169, 162, 163, 171, 171, 171, 171, 171, 171, 171, 56,
-    171, 52, 171, 171, 171, 171, 55, 54, 171, 171, 171, 171, 171, 58, 134, 135,
-    164, 165, 172, 172, 170, 160, 161, 0, 111, 104, 112, 154, 0, 103, 109, 118,
-    129, 171, 156, 159, 100, 0, 171, 171, 171, 171, 171, 171, 173, 125, 53, 171,
-    171, 57, 0, 114, 175, 171, 171, 171, 171, 171, 171, 60, 59, 166, 167, 126,
-    175, 172, 168, 94, 0, 2, 95, 123, 2, 174, 113, 4, 0, 0, 0, 0,
+    89, 107, 90, 78, 2, 286, 2, 171, 171, 171, 171, 49, 171, 171, 9, 171,
+    171, 23, 171, 171, 171, 171, 0, 80, 171, 171, 50, 171, 171, 171, 171, 171,
+    171, 171, 38, 171, 171, 171, 171, 29, 43, 171, 171, 171, 171, 171, 22, 171,
+    36, 171, 39, 171, 171, 171, 72, 171, 171, 171, 171, 171, 13, 48, 27, 171,
+    171, 171, 171, 171, 171, 171, 35, 171, 171, 25, 171, 17, 171, 171, 171, 171,
+    171, 171, 171, 47, 171, 171, 171, 171, 16, 41, 171, 42, 171, 44, 171, 171,
+    74, 171, 171, 20, 6, 171, 18, 171, 171, 19, 171, 171, 171, 14, 171, 8,
+    171, 21, 171, 171, 28, 171, 171, 51, 171, 171, 171, 171, 171, 171, 34, 171,
+    7, 171, 171, 10, 171, 171, 171, 171, 31, 171, 24, 171, 171, 171, 15, 171,
+    171, 171, 171, 171, 12, 171, 171, 171, 171, 33, 171, 171, 171, 32, 171, 30,
+    171, 171, 171, 11, 171, 171, 171, 171, 171, 37, 26, 40, 0, 0, 172, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45,
+    128, 0, 103, 109, 130, 101, 119, 172, 172, 132, 139, 137, 140, 138, 141, 144,
+    147, 143, 146, 157, 153, 155, 142, 145, 171, 152, 150, 151, 149, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 64, 171, 62, 171,
+    171, 61, 171, 63, 158, 172, 172, 169, 162, 163, 171, 171, 171, 171, 171, 171,
+    171, 56, 171, 52, 171, 171, 171, 171, 55, 54, 171, 171, 171, 171, 171, 58,
+    134, 135, 164, 165, 172, 172, 170, 160, 161, 0, 111, 104, 112, 154, 118, 129,
+    100, 171, 156, 159, 0, 175, 171, 171, 171, 171, 171, 171, 94, 173, 125, 0,
+    53, 171, 171, 57, 124, 175, 171, 171, 171, 114, 126, 171, 171, 171, 60, 59,
+    166, 167, 122, 172, 168, 2, 95, 123, 0, 174, 4, 113, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -913,33 +1106,33 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 171, 116, 240, 1,
-    4, 4, 5, 79, 68, 127, 66, 124, 174, 122, 3, 223, 3, 3, 0, 0,
-    105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65, 70, 108, 121, 110,
-    81, 171, 171, 171, 171, 133, 171, 171, 171, 171, 171, 148, 136, 171, 91, 92,
-    106, 0, 67, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
-    171, 171, 171, 171, 171, 171, 89, 107, 90, 78, 2, 287, 130, 171, 171, 171,
-    171, 49, 171, 171, 9, 171, 171, 23, 171, 171, 171, 171, 0, 80, 171, 171,
-    50, 171, 171, 171, 171, 171, 171, 171, 38, 171, 171, 171, 171, 29, 43, 171,
-    171, 171, 171, 171, 22, 171, 36, 171, 39, 171, 171, 171, 72, 171, 171, 171,
-    171, 171, 13, 48, 27, 171, 171, 171, 171, 171, 171, 171, 35, 171, 171, 25,
-    171, 17, 171, 171, 171, 171, 171, 171, 171, 47, 171, 171, 171, 171, 16, 41,
-    171, 42, 171, 44, 171, 171, 74, 171, 171, 20, 6, 171, 18, 171, 171, 19,
-    171, 171, 171, 14, 171, 8, 171, 21, 171, 171, 28, 171, 171, 51, 171, 171,
-    171, 171, 171, 171, 34, 171, 7, 171, 171, 10, 171, 171, 171, 171, 31, 171,
-    24, 171, 171, 171, 15, 171, 171, 171, 171, 171, 12, 171, 171, 171, 171, 33,
-    171, 171, 171, 32, 171, 30, 171, 171, 171, 11, 171, 171, 171, 171, 171, 37,
-    26, 40, 0, 0, 172, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    46, 0, 0, 0, 0, 45, 128, 119, 101, 172, 172, 132, 139, 137, 140, 138,
-    141, 144, 147, 143, 146, 157, 153, 155, 142, 145, 171, 152, 150, 151, 149, 171,
-    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 64, 171,
-    62, 171, 171, 61, 171, 63, 158, 172, 172, 169, 162, 163, 171, 171, 171, 171,
-    171, 171, 171, 56, 171, 52, 171, 171, 171, 171, 55, 54, 171, 171, 171, 171,
-    171, 58, 134, 135, 164, 165, 172, 172, 170, 160, 161, 0, 111, 104, 112, 154,
-    0, 103, 109, 118, 129, 171, 156, 159, 100, 0, 171, 171, 171, 171, 171, 171,
-    173, 125, 53, 171, 171, 57, 0, 114, 175, 171, 171, 171, 171, 171, 171, 60,
-    59, 166, 167, 126, 175, 172, 168, 94, 0, 2, 95, 123, 2, 174, 113, 4,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 171, 116, 244,
+    1, 4, 4, 5, 79, 127, 68, 66, 220, 3, 222, 3, 3, 220, 0, 105,
+    69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65, 70, 108, 121, 110, 81,
+    560, 247, 247, 247, 247, 247, 247, 591, 247, 247, 247, 247, 247, 91, 92, 106,
+    247, 67, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 89, 107, 90, 78, 2, 286, 2, 171, 171, 171, 171,
+    49, 171, 171, 9, 171, 171, 23, 171, 171, 171, 171, 0, 80, 171, 171, 50,
+    171, 171, 171, 171, 171, 171, 171, 38, 171, 171, 171, 171, 29, 43, 171, 171,
+    171, 171, 171, 22, 171, 36, 171, 39, 171, 171, 171, 72, 171, 171, 171, 171,
+    171, 13, 48, 27, 171, 171, 171, 171, 171, 171, 171, 35, 171, 171, 25, 171,
+    17, 171, 171, 171, 171, 171, 171, 171, 47, 171, 171, 171, 171, 16, 41, 171,
+    42, 171, 44, 171, 171, 74, 171, 171, 20, 6, 171, 18, 171, 171, 19, 171,
+    171, 171, 14, 171, 8, 171, 21, 171, 171, 28, 171, 171, 51, 171, 171, 171,
+    171, 171, 171, 34, 171, 7, 171, 171, 10, 171, 171, 171, 171, 31, 171, 24,
+    171, 171, 171, 15, 171, 171, 171, 171, 171, 12, 171, 171, 171, 171, 33, 171,
+    171, 171, 32, 171, 30, 171, 171, 171, 11, 171, 171, 171, 171, 171, 37, 26,
+    40, 0, 0, 455, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46,
+    0, 0, 0, 0, 45, 128, 0, 103, 109, 130, 101, 119, 455, 455, 455, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 518, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 455, 455, 455, 247, 247, 579,
+    586, 547, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 600, 247, 247, 247, 247, 247, 247, 247, 455, 455, 455, 561, 247, 0, 111,
+    104, 112, 247, 118, 129, 100, 247, 247, 247, 0, 175, 247, 577, 247, 247, 247,
+    247, 94, 173, 125, 0, 247, 247, 588, 247, 124, 175, 247, 593, 247, 114, 126,
+    597, 247, 599, 247, 247, 247, 247, 122, 455, 455, 2, 95, 123, 610, 610, 4,
+    113, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -952,12 +1145,12 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    171, 116, 241, 1, 4, 4, 5, 79, 68, 127, 66, 124, 174, 122, 3, 223,
-    3, 3, 0, 0, 105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65,
-    70, 565, 121, 110, 81, 171, 171, 171, 171, 133, 171, 171, 171, 171, 171, 148,
-    136, 171, 91, 92, 106, 0, 67, 171, 171, 171, 171, 171, 171, 171, 171, 171,
-    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 89, 107, 90, 78, 2, 287,
-    130, 171, 171, 171, 171, 49, 171, 171, 9, 171, 171, 23, 171, 171, 171, 171,
+    0, 0, 171, 116, 245, 1, 4, 4, 5, 79, 127, 68, 66, 220, 3, 222,
+    3, 3, 220, 0, 105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65,
+    70, 108, 121, 110, 81, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 91, 92, 106, 247, 67, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 89, 107, 90, 78, 2, 286,
+    2, 171, 171, 171, 171, 49, 171, 171, 9, 171, 171, 23, 171, 171, 171, 171,
     0, 80, 171, 171, 50, 171, 171, 171, 171, 171, 171, 171, 38, 171, 171, 171,
     171, 29, 43, 171, 171, 171, 171, 171, 22, 171, 36, 171, 39, 171, 171, 171,
     72, 171, 171, 171, 171, 171, 13, 48, 27, 171, 171, 171, 171, 171, 171, 171,
@@ -967,55 +1160,18 @@ extern token_type_t const lexer_transition_table[51408] = {
     171, 51, 171, 171, 171, 171, 171, 171, 34, 171, 7, 171, 171, 10, 171, 171,
     171, 171, 31, 171, 24, 171, 171, 171, 15, 171, 171, 171, 171, 171, 12, 171,
     171, 171, 171, 33, 171, 171, 171, 32, 171, 30, 171, 171, 171, 11, 171, 171,
-    171, 171, 171, 37, 26, 40, 0, 0, 172, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 119, 101, 172, 172, 132,
-    139, 137, 140, 138, 141, 144, 147, 143, 146, 157, 153, 155, 142, 145, 171, 152,
-    150, 151, 149, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
-    171, 171, 64, 171, 62, 171, 171, 61, 171, 63, 158, 172, 172, 169, 162, 163,
-    171, 171, 171, 171, 171, 171, 171, 56, 171, 52, 171, 171, 171, 171, 55, 54,
-    171, 171, 171, 171, 171, 58, 134, 135, 164, 165, 172, 172, 170, 160, 161, 0,
-    111, 104, 112, 154, 572, 103, 567, 118, 129, 171, 156, 159, 100, 0, 171, 171,
-    171, 171, 171, 171, 173, 125, 53, 171, 171, 57, 0, 114, 175, 171, 171, 171,
-    171, 171, 171, 60, 59, 166, 167, 126, 175, 172, 168, 94, 0, 2, 95, 123,
-    2, 174, 113, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    171, 171, 171, 37, 26, 40, 0, 0, 455, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 0, 103, 109, 130, 101,
+    119, 455, 455, 455, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 455,
+    455, 455, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 455, 455,
+    455, 247, 247, 0, 111, 104, 112, 247, 118, 129, 100, 247, 247, 247, 0, 175,
+    247, 247, 247, 247, 247, 247, 94, 173, 125, 0, 247, 247, 247, 247, 124, 175,
+    247, 247, 247, 114, 126, 247, 247, 247, 247, 247, 247, 247, 122, 455, 455, 2,
+    95, 123, 610, 610, 4, 113, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 171, 116, 242, 1, 4, 4, 5, 610, 68, 127, 66, 124,
-    174, 122, 3, 223, 3, 3, 0, 0, 599, 69, 93, 131, 219, 221, 71, 607,
-    82, 581, 173, 65, 70, 566, 562, 560, 81, 171, 171, 171, 171, 133, 171, 171,
-    171, 171, 171, 148, 136, 171, 91, 92, 474, 0, 67, 171, 171, 171, 171, 171,
-    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 89, 217,
-    90, 78, 2, 287, 130, 171, 171, 171, 171, 49, 171, 171, 9, 171, 171, 23,
-    171, 171, 171, 171, 0, 80, 171, 171, 50, 171, 171, 171, 171, 171, 171, 171,
-    38, 171, 171, 171, 171, 29, 43, 171, 171, 171, 171, 171, 22, 171, 36, 171,
-    39, 171, 171, 171, 72, 171, 171, 171, 171, 171, 13, 48, 27, 171, 171, 171,
-    171, 171, 171, 171, 35, 171, 171, 25, 171, 17, 171, 171, 171, 171, 171, 171,
-    171, 47, 171, 171, 171, 171, 16, 41, 171, 42, 171, 44, 171, 171, 74, 171,
-    171, 20, 6, 171, 18, 171, 171, 19, 171, 171, 171, 14, 171, 8, 171, 21,
-    171, 171, 28, 171, 171, 51, 171, 171, 171, 171, 171, 171, 34, 171, 7, 171,
-    171, 10, 171, 171, 171, 171, 31, 171, 24, 171, 171, 171, 15, 171, 171, 171,
-    171, 171, 12, 171, 171, 171, 171, 33, 171, 171, 171, 32, 171, 30, 171, 171,
-    171, 11, 171, 171, 171, 171, 171, 37, 26, 40, 0, 0, 172, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 119,
-    101, 172, 172, 132, 139, 137, 140, 138, 141, 144, 147, 143, 146, 157, 153, 155,
-    142, 145, 171, 152, 150, 151, 149, 171, 171, 171, 171, 171, 171, 171, 171, 171,
-    171, 171, 171, 171, 171, 171, 64, 171, 62, 171, 171, 61, 171, 63, 158, 172,
-    172, 169, 162, 163, 171, 171, 171, 171, 171, 171, 171, 56, 171, 52, 171, 171,
-    171, 171, 55, 54, 171, 171, 171, 171, 171, 58, 134, 135, 164, 165, 172, 172,
-    170, 160, 161, 0, 111, 288, 112, 154, 0, 568, 109, 118, 129, 171, 156, 159,
-    100, 0, 171, 171, 171, 171, 171, 171, 173, 125, 53, 171, 171, 57, 0, 114,
-    175, 171, 171, 171, 171, 171, 171, 60, 59, 166, 167, 126, 175, 172, 168, 94,
-    0, 2, 95, 123, 2, 174, 113, 4, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -1027,33 +1183,32 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 171, 116, 243, 1, 4, 4, 5, 79,
-    68, 127, 66, 124, 174, 122, 3, 223, 3, 3, 0, 0, 105, 69, 93, 131,
-    96, 98, 71, 99, 82, 97, 173, 65, 70, 108, 121, 561, 81, 171, 171, 171,
-    171, 133, 171, 171, 171, 171, 171, 148, 136, 171, 91, 92, 106, 0, 67, 171,
-    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
-    171, 171, 89, 107, 90, 78, 2, 287, 130, 171, 171, 171, 171, 49, 171, 171,
-    9, 171, 171, 23, 171, 171, 171, 171, 0, 80, 171, 171, 50, 171, 171, 171,
-    171, 171, 171, 171, 38, 171, 171, 171, 171, 29, 43, 171, 171, 171, 171, 171,
-    22, 171, 36, 171, 39, 171, 171, 171, 72, 171, 171, 171, 171, 171, 13, 48,
-    27, 171, 171, 171, 171, 171, 171, 171, 35, 171, 171, 25, 171, 17, 171, 171,
-    171, 171, 171, 171, 171, 47, 171, 171, 171, 171, 16, 41, 171, 42, 171, 44,
-    171, 171, 74, 171, 171, 20, 6, 171, 18, 171, 171, 19, 171, 171, 171, 14,
-    171, 8, 171, 21, 171, 171, 28, 171, 171, 51, 171, 171, 171, 171, 171, 171,
-    34, 171, 7, 171, 171, 10, 171, 171, 171, 171, 31, 171, 24, 171, 171, 171,
-    15, 171, 171, 171, 171, 171, 12, 171, 171, 171, 171, 33, 171, 171, 171, 32,
-    171, 30, 171, 171, 171, 11, 171, 171, 171, 171, 171, 37, 26, 40, 0, 0,
-    172, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0,
-    0, 45, 128, 119, 101, 172, 172, 132, 139, 137, 140, 138, 141, 144, 147, 143,
-    146, 157, 153, 155, 142, 145, 171, 152, 150, 151, 149, 171, 171, 171, 171, 171,
-    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 64, 171, 62, 171, 171, 61,
-    171, 63, 158, 172, 172, 169, 162, 163, 171, 171, 171, 171, 171, 171, 171, 56,
-    171, 52, 171, 171, 171, 171, 55, 54, 171, 171, 171, 171, 171, 58, 134, 135,
-    164, 165, 172, 172, 170, 160, 161, 476, 475, 104, 112, 154, 0, 103, 109, 118,
-    129, 171, 156, 159, 100, 0, 171, 171, 171, 171, 171, 171, 173, 125, 53, 171,
-    171, 57, 0, 114, 175, 171, 171, 171, 171, 171, 171, 60, 59, 166, 167, 126,
-    175, 172, 168, 94, 0, 2, 95, 123, 2, 174, 113, 4, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 171, 116, 246, 1, 4, 4, 5, 79, 127,
+    68, 66, 220, 3, 222, 3, 3, 220, 0, 105, 69, 93, 131, 96, 98, 71,
+    99, 82, 97, 173, 65, 70, 108, 121, 110, 81, 247, 247, 555, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 91, 92, 106, 247, 67, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 89,
+    107, 90, 78, 2, 286, 2, 171, 171, 171, 171, 49, 171, 171, 9, 171, 171,
+    23, 171, 171, 171, 171, 0, 80, 171, 171, 50, 171, 171, 171, 171, 171, 171,
+    171, 38, 171, 171, 171, 171, 29, 43, 171, 171, 171, 171, 171, 22, 171, 36,
+    171, 39, 171, 171, 171, 72, 171, 171, 171, 171, 171, 13, 48, 27, 171, 171,
+    171, 171, 171, 171, 171, 35, 171, 171, 25, 171, 17, 171, 171, 171, 171, 171,
+    171, 171, 47, 171, 171, 171, 171, 16, 41, 171, 42, 171, 44, 171, 171, 74,
+    171, 171, 20, 6, 171, 18, 171, 171, 19, 171, 171, 171, 14, 171, 8, 171,
+    21, 171, 171, 28, 171, 171, 51, 171, 171, 171, 171, 171, 171, 34, 171, 7,
+    171, 171, 10, 171, 171, 171, 171, 31, 171, 24, 171, 171, 171, 15, 171, 171,
+    171, 171, 171, 12, 171, 171, 171, 171, 33, 171, 171, 171, 32, 171, 30, 171,
+    171, 171, 11, 171, 171, 171, 171, 171, 37, 26, 40, 0, 0, 455, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128,
+    0, 103, 109, 130, 101, 119, 455, 455, 455, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 522,
+    247, 247, 247, 247, 455, 455, 455, 247, 247, 580, 247, 247, 575, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 556, 247, 455, 455, 455, 247, 247, 0, 111, 104, 112, 247, 118, 129, 100,
+    247, 247, 247, 0, 175, 247, 247, 247, 247, 247, 247, 94, 173, 125, 0, 247,
+    247, 247, 247, 124, 175, 247, 247, 247, 114, 126, 247, 247, 247, 247, 247, 247,
+    247, 122, 455, 455, 2, 95, 123, 610, 610, 4, 113, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -1066,32 +1221,32 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 171, 116, 244, 1,
-    4, 4, 5, 79, 68, 127, 66, 124, 174, 122, 3, 223, 3, 3, 0, 0,
-    105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65, 70, 108, 121, 110,
-    81, 171, 171, 171, 171, 133, 171, 171, 171, 171, 171, 148, 136, 171, 91, 92,
-    106, 0, 67, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
-    171, 171, 171, 171, 171, 171, 89, 107, 90, 78, 2, 287, 130, 171, 171, 171,
-    171, 49, 171, 171, 9, 171, 171, 23, 171, 171, 171, 171, 0, 80, 171, 171,
-    50, 171, 171, 171, 171, 171, 171, 171, 38, 171, 171, 171, 171, 29, 43, 171,
-    171, 171, 171, 171, 22, 171, 36, 171, 39, 171, 171, 171, 72, 171, 171, 171,
-    171, 171, 13, 48, 27, 171, 171, 171, 171, 171, 171, 171, 35, 171, 171, 25,
-    171, 17, 171, 171, 171, 171, 171, 171, 171, 47, 171, 171, 171, 171, 16, 41,
-    171, 42, 171, 44, 171, 171, 74, 171, 171, 20, 6, 171, 18, 171, 171, 19,
-    171, 171, 171, 14, 171, 8, 171, 21, 171, 171, 28, 171, 171, 51, 171, 171,
-    171, 171, 171, 171, 34, 171, 7, 171, 171, 10, 171, 171, 171, 171, 31, 171,
-    24, 171, 171, 171, 15, 171, 171, 171, 171, 171, 12, 171, 171, 171, 171, 33,
-    171, 171, 171, 32, 171, 30, 171, 171, 171, 11, 171, 171, 171, 171, 171, 37,
-    26, 40, 0, 0, 172, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    46, 0, 0, 0, 0, 45, 128, 119, 101, 172, 172, 132, 139, 137, 140, 138,
-    141, 144, 147, 143, 146, 157, 153, 155, 142, 145, 171, 152, 150, 151, 149, 171,
-    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 64, 171,
-    62, 171, 171, 61, 171, 63, 158, 172, 172, 169, 162, 163, 171, 171, 171, 171,
-    171, 171, 171, 56, 171, 52, 171, 171, 171, 171, 55, 54, 171, 171, 171, 171,
-    171, 58, 134, 135, 164, 165, 172, 172, 170, 160, 161, 0, 111, 104, 112, 154,
-    0, 103, 109, 118, 129, 171, 156, 159, 100, 0, 171, 171, 171, 171, 171, 171,
-    173, 125, 53, 171, 171, 57, 0, 114, 175, 171, 171, 171, 171, 171, 171, 60,
-    59, 166, 167, 126, 175, 172, 168, 94, 0, 2, 95, 123, 2, 174, 113, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 171, 116, 247, 1,
+    4, 4, 5, 79, 127, 68, 66, 220, 3, 222, 3, 3, 220, 0, 105, 69,
+    93, 131, 96, 98, 71, 99, 82, 97, 173, 65, 70, 108, 121, 110, 81, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 91, 92, 106, 247,
+    67, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 89, 107, 90, 78, 2, 286, 2, 171, 171, 171, 171, 49,
+    171, 171, 9, 171, 171, 23, 171, 171, 171, 171, 0, 80, 171, 171, 50, 171,
+    171, 171, 171, 171, 171, 171, 38, 171, 171, 171, 171, 29, 43, 171, 171, 171,
+    171, 171, 22, 171, 36, 171, 39, 171, 171, 171, 72, 171, 171, 171, 171, 171,
+    13, 48, 27, 171, 171, 171, 171, 171, 171, 171, 35, 171, 171, 25, 171, 17,
+    171, 171, 171, 171, 171, 171, 171, 47, 171, 171, 171, 171, 16, 41, 171, 42,
+    171, 44, 171, 171, 74, 171, 171, 20, 6, 171, 18, 171, 171, 19, 171, 171,
+    171, 14, 171, 8, 171, 21, 171, 171, 28, 171, 171, 51, 171, 171, 171, 171,
+    171, 171, 34, 171, 7, 171, 171, 10, 171, 171, 171, 171, 31, 171, 24, 171,
+    171, 171, 15, 171, 171, 171, 171, 171, 12, 171, 171, 171, 171, 33, 171, 171,
+    171, 32, 171, 30, 171, 171, 171, 11, 171, 171, 171, 171, 171, 37, 26, 40,
+    0, 0, 455, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0,
+    0, 0, 0, 45, 128, 0, 103, 109, 130, 101, 119, 455, 455, 455, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 508, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 455, 455, 455, 247, 247, 532, 247,
+    247, 247, 247, 537, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 551, 247, 247, 247, 247, 247, 247, 455, 455, 455, 247, 247, 0, 111, 104,
+    112, 247, 118, 129, 100, 523, 247, 247, 0, 175, 247, 247, 247, 247, 536, 247,
+    94, 173, 125, 0, 247, 247, 247, 247, 124, 175, 247, 596, 550, 114, 126, 247,
+    247, 247, 247, 247, 247, 247, 122, 455, 455, 2, 95, 123, 610, 610, 4, 113,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -1105,32 +1260,32 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    171, 116, 245, 1, 4, 4, 5, 79, 68, 127, 66, 124, 220, 122, 3, 223,
-    3, 3, 220, 0, 105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65,
-    70, 108, 121, 110, 81, 557, 248, 248, 248, 248, 248, 248, 589, 248, 248, 248,
-    248, 248, 91, 92, 106, 248, 67, 171, 171, 171, 171, 171, 171, 171, 171, 171,
-    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 89, 107, 90, 78, 2, 287,
-    130, 171, 171, 171, 171, 49, 171, 171, 9, 171, 171, 23, 171, 171, 171, 171,
-    0, 80, 171, 171, 50, 171, 171, 171, 171, 171, 171, 171, 38, 171, 171, 171,
-    171, 29, 43, 171, 171, 171, 171, 171, 22, 171, 36, 171, 39, 171, 171, 171,
-    72, 171, 171, 171, 171, 171, 13, 48, 27, 171, 171, 171, 171, 171, 171, 171,
-    35, 171, 171, 25, 171, 17, 171, 171, 171, 171, 171, 171, 171, 47, 171, 171,
-    171, 171, 16, 41, 171, 42, 171, 44, 171, 171, 74, 171, 171, 20, 6, 171,
-    18, 171, 171, 19, 171, 171, 171, 14, 171, 8, 171, 21, 171, 171, 28, 171,
-    171, 51, 171, 171, 171, 171, 171, 171, 34, 171, 7, 171, 171, 10, 171, 171,
-    171, 171, 31, 171, 24, 171, 171, 171, 15, 171, 171, 171, 171, 171, 12, 171,
-    171, 171, 171, 33, 171, 171, 171, 32, 171, 30, 171, 171, 171, 11, 171, 171,
-    171, 171, 171, 37, 26, 40, 0, 0, 456, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 119, 101, 456, 456, 456,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 515, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 456, 456, 456, 248, 248,
-    578, 583, 544, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 596, 248, 248, 248, 248, 248, 248, 248, 456, 456, 456, 558, 248, 0,
-    111, 104, 112, 248, 0, 103, 109, 118, 129, 248, 248, 248, 100, 0, 248, 576,
-    248, 248, 248, 248, 173, 125, 248, 248, 585, 248, 0, 114, 175, 248, 591, 248,
-    593, 248, 595, 248, 248, 248, 248, 126, 175, 456, 456, 94, 609, 2, 95, 123,
-    2, 609, 113, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 171, 116, 247, 1, 4, 4, 5, 79, 127, 68, 66, 220, 3, 222, 3,
+    3, 220, 0, 105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65, 70,
+    108, 121, 110, 81, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 91, 92, 106, 247, 67, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 89, 107, 90, 78, 2, 286, 2,
+    171, 171, 171, 171, 49, 171, 171, 9, 171, 171, 23, 171, 171, 171, 171, 0,
+    80, 171, 171, 50, 171, 171, 171, 171, 171, 171, 171, 38, 171, 171, 171, 171,
+    29, 43, 171, 171, 171, 171, 171, 22, 171, 36, 171, 39, 171, 171, 171, 72,
+    171, 171, 171, 171, 171, 13, 48, 27, 171, 171, 171, 171, 171, 171, 171, 35,
+    171, 171, 25, 171, 17, 171, 171, 171, 171, 171, 171, 171, 47, 171, 171, 171,
+    171, 16, 41, 171, 42, 171, 44, 171, 171, 74, 171, 171, 20, 6, 171, 18,
+    171, 171, 19, 171, 171, 171, 14, 171, 8, 171, 21, 171, 171, 28, 171, 171,
+    51, 171, 171, 171, 171, 171, 171, 34, 171, 7, 171, 171, 10, 171, 171, 171,
+    171, 31, 171, 24, 171, 171, 171, 15, 171, 171, 171, 171, 171, 12, 171, 171,
+    171, 171, 33, 171, 171, 171, 32, 171, 30, 171, 171, 171, 11, 171, 171, 171,
+    171, 171, 37, 26, 40, 0, 0, 455, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 0, 103, 109, 130, 101, 119,
+    455, 455, 455, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 505, 247, 247, 247, 497, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 455, 455,
+    455, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 455, 455, 455,
+    247, 247, 0, 111, 104, 112, 247, 118, 129, 100, 247, 247, 247, 0, 175, 247,
+    247, 247, 247, 247, 247, 94, 173, 125, 0, 247, 247, 247, 247, 124, 175, 247,
+    247, 247, 114, 126, 247, 247, 247, 247, 247, 247, 247, 122, 455, 455, 2, 95,
+    123, 610, 610, 4, 113, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -1143,12 +1298,12 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 171, 116, 246, 1, 4, 4, 5, 79, 68, 127, 66, 124,
-    220, 122, 3, 223, 3, 3, 220, 0, 105, 69, 93, 131, 96, 98, 71, 99,
-    82, 97, 173, 65, 70, 108, 121, 110, 81, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 91, 92, 106, 248, 67, 171, 171, 171, 171, 171,
+    0, 0, 0, 0, 0, 0, 171, 116, 248, 1, 4, 4, 5, 79, 127, 68,
+    66, 220, 3, 222, 3, 3, 220, 0, 105, 69, 93, 131, 96, 98, 71, 99,
+    82, 97, 173, 65, 70, 108, 121, 110, 81, 247, 247, 247, 247, 553, 247, 247,
+    247, 247, 247, 500, 483, 247, 91, 92, 106, 247, 67, 171, 171, 171, 171, 171,
     171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 89, 107,
-    90, 78, 2, 287, 130, 171, 171, 171, 171, 49, 171, 171, 9, 171, 171, 23,
+    90, 78, 2, 286, 2, 171, 171, 171, 171, 49, 171, 171, 9, 171, 171, 23,
     171, 171, 171, 171, 0, 80, 171, 171, 50, 171, 171, 171, 171, 171, 171, 171,
     38, 171, 171, 171, 171, 29, 43, 171, 171, 171, 171, 171, 22, 171, 36, 171,
     39, 171, 171, 171, 72, 171, 171, 171, 171, 171, 13, 48, 27, 171, 171, 171,
@@ -1158,17 +1313,17 @@ extern token_type_t const lexer_transition_table[51408] = {
     171, 171, 28, 171, 171, 51, 171, 171, 171, 171, 171, 171, 34, 171, 7, 171,
     171, 10, 171, 171, 171, 171, 31, 171, 24, 171, 171, 171, 15, 171, 171, 171,
     171, 171, 12, 171, 171, 171, 171, 33, 171, 171, 171, 32, 171, 30, 171, 171,
-    171, 11, 171, 171, 171, 171, 171, 37, 26, 40, 0, 0, 456, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 119,
-    101, 456, 456, 456, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 456,
-    456, 456, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 456, 456,
-    456, 248, 248, 0, 111, 104, 112, 248, 0, 103, 109, 118, 129, 248, 248, 248,
-    100, 0, 248, 248, 248, 248, 248, 248, 173, 125, 248, 248, 248, 248, 0, 114,
-    175, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 126, 175, 456, 456, 94,
-    609, 2, 95, 123, 2, 609, 113, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    171, 11, 171, 171, 171, 171, 171, 37, 26, 40, 0, 0, 455, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 0,
+    103, 109, 130, 101, 119, 455, 455, 455, 495, 485, 490, 487, 488, 489, 247, 491,
+    247, 247, 571, 525, 496, 247, 247, 494, 493, 566, 498, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 455, 455, 455, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 554, 247,
+    247, 247, 455, 455, 455, 247, 247, 0, 111, 104, 112, 492, 118, 129, 100, 247,
+    572, 247, 0, 175, 247, 247, 247, 247, 247, 247, 94, 173, 125, 0, 247, 247,
+    247, 247, 124, 175, 247, 247, 247, 114, 126, 247, 247, 247, 247, 247, 247, 247,
+    122, 455, 455, 2, 95, 123, 610, 610, 4, 113, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -1181,71 +1336,36 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 171, 116, 247, 1, 4, 4, 5, 79,
-    68, 127, 66, 124, 220, 122, 3, 223, 3, 3, 220, 0, 105, 69, 93, 131,
-    96, 98, 71, 99, 82, 97, 173, 65, 70, 108, 121, 110, 81, 248, 248, 552,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 91, 92, 106, 248, 67, 171,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 171, 116, 247, 1, 4,
+    4, 5, 79, 127, 68, 66, 174, 3, 222, 3, 3, 0, 0, 105, 69, 93,
+    131, 96, 98, 71, 99, 82, 97, 173, 65, 70, 108, 121, 110, 81, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 91, 92, 106, 247, 67,
     171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
-    171, 171, 89, 107, 90, 78, 2, 287, 130, 171, 171, 171, 171, 49, 171, 171,
-    9, 171, 171, 23, 171, 171, 171, 171, 0, 80, 171, 171, 50, 171, 171, 171,
-    171, 171, 171, 171, 38, 171, 171, 171, 171, 29, 43, 171, 171, 171, 171, 171,
-    22, 171, 36, 171, 39, 171, 171, 171, 72, 171, 171, 171, 171, 171, 13, 48,
-    27, 171, 171, 171, 171, 171, 171, 171, 35, 171, 171, 25, 171, 17, 171, 171,
-    171, 171, 171, 171, 171, 47, 171, 171, 171, 171, 16, 41, 171, 42, 171, 44,
-    171, 171, 74, 171, 171, 20, 6, 171, 18, 171, 171, 19, 171, 171, 171, 14,
-    171, 8, 171, 21, 171, 171, 28, 171, 171, 51, 171, 171, 171, 171, 171, 171,
-    34, 171, 7, 171, 171, 10, 171, 171, 171, 171, 31, 171, 24, 171, 171, 171,
-    15, 171, 171, 171, 171, 171, 12, 171, 171, 171, 171, 33, 171, 171, 171, 32,
-    171, 30, 171, 171, 171, 11, 171, 171, 171, 171, 171, 37, 26, 40, 0, 0,
-    456, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0,
-    0, 45, 128, 119, 101, 456, 456, 456, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 519, 248,
-    248, 248, 248, 456, 456, 456, 248, 248, 579, 248, 248, 574, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
-    553, 248, 456, 456, 456, 248, 248, 0, 111, 104, 112, 248, 0, 103, 109, 118,
-    129, 248, 248, 248, 100, 0, 248, 248, 248, 248, 248, 248, 173, 125, 248, 248,
-    248, 248, 0, 114, 175, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 126,
-    175, 456, 456, 94, 609, 2, 95, 123, 2, 609, 113, 4, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    171, 171, 171, 89, 107, 90, 78, 2, 286, 2, 171, 171, 171, 171, 49, 171,
+    171, 9, 171, 171, 23, 171, 171, 171, 171, 0, 80, 171, 171, 50, 171, 171,
+    171, 171, 171, 171, 171, 38, 171, 171, 171, 171, 29, 43, 171, 171, 171, 171,
+    171, 22, 171, 36, 171, 39, 171, 171, 171, 72, 171, 171, 171, 171, 171, 13,
+    48, 27, 171, 171, 171, 171, 171, 171, 171, 35, 171, 171, 25, 171, 17, 171,
+    171, 171, 171, 171, 171, 171, 47, 171, 171, 171, 171, 16, 41, 171, 42, 171,
+    44, 171, 171, 74, 171, 171, 20, 6, 171, 18, 171, 171, 19, 171, 171, 171,
+    14, 171, 8, 171, 21, 171, 171, 28, 171, 171, 51, 171, 171, 171, 171, 171,
+    171, 34, 171, 7, 171, 171, 10, 171, 171, 171, 171, 31, 171, 24, 171, 171,
+    171, 15, 171, 171, 171, 171, 171, 12, 171, 171, 171, 171, 33, 171, 171, 171,
+    32, 171, 30, 171, 171, 171, 11, 171, 171, 171, 171, 171, 37, 26, 40, 0,
+    0, 455, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0,
+    0, 0, 45, 128, 0, 103, 109, 130, 101, 119, 455, 455, 455, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 455, 455, 455, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 455, 455, 455, 247, 247, 0, 111, 104, 112,
+    247, 118, 129, 100, 247, 247, 247, 0, 175, 247, 247, 247, 247, 247, 247, 94,
+    173, 125, 0, 247, 247, 247, 247, 124, 175, 247, 247, 247, 114, 126, 247, 247,
+    247, 247, 247, 247, 247, 122, 455, 455, 2, 95, 123, 0, 174, 4, 113, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 171, 116, 248, 1,
-    4, 4, 5, 79, 68, 127, 66, 124, 220, 122, 3, 223, 3, 3, 220, 0,
-    105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65, 70, 108, 121, 110,
-    81, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 91, 92,
-    106, 248, 67, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
-    171, 171, 171, 171, 171, 171, 89, 107, 90, 78, 2, 287, 130, 171, 171, 171,
-    171, 49, 171, 171, 9, 171, 171, 23, 171, 171, 171, 171, 0, 80, 171, 171,
-    50, 171, 171, 171, 171, 171, 171, 171, 38, 171, 171, 171, 171, 29, 43, 171,
-    171, 171, 171, 171, 22, 171, 36, 171, 39, 171, 171, 171, 72, 171, 171, 171,
-    171, 171, 13, 48, 27, 171, 171, 171, 171, 171, 171, 171, 35, 171, 171, 25,
-    171, 17, 171, 171, 171, 171, 171, 171, 171, 47, 171, 171, 171, 171, 16, 41,
-    171, 42, 171, 44, 171, 171, 74, 171, 171, 20, 6, 171, 18, 171, 171, 19,
-    171, 171, 171, 14, 171, 8, 171, 21, 171, 171, 28, 171, 171, 51, 171, 171,
-    171, 171, 171, 171, 34, 171, 7, 171, 171, 10, 171, 171, 171, 171, 31, 171,
-    24, 171, 171, 171, 15, 171, 171, 171, 171, 171, 12, 171, 171, 171, 171, 33,
-    171, 171, 171, 32, 171, 30, 171, 171, 171, 11, 171, 171, 171, 171, 171, 37,
-    26, 40, 0, 0, 456, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    46, 0, 0, 0, 0, 45, 128, 119, 101, 456, 456, 456, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 248, 505, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 456, 456, 456, 248, 248, 529, 248, 248, 248,
-    248, 534, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 548,
-    248, 248, 248, 248, 248, 248, 456, 456, 456, 248, 248, 0, 111, 104, 112, 248,
-    0, 103, 109, 118, 129, 520, 248, 248, 100, 0, 248, 248, 248, 248, 533, 248,
-    173, 125, 248, 248, 248, 248, 0, 114, 175, 248, 592, 547, 248, 248, 248, 248,
-    248, 248, 248, 126, 175, 456, 456, 94, 609, 2, 95, 123, 2, 609, 113, 4,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -1255,35 +1375,32 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    171, 116, 248, 1, 4, 4, 5, 79, 68, 127, 66, 124, 220, 122, 3, 223,
-    3, 3, 220, 0, 105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65,
-    70, 108, 121, 110, 81, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 91, 92, 106, 248, 67, 171, 171, 171, 171, 171, 171, 171, 171, 171,
-    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 89, 107, 90, 78, 2, 287,
-    130, 171, 171, 171, 171, 49, 171, 171, 9, 171, 171, 23, 171, 171, 171, 171,
-    0, 80, 171, 171, 50, 171, 171, 171, 171, 171, 171, 171, 38, 171, 171, 171,
-    171, 29, 43, 171, 171, 171, 171, 171, 22, 171, 36, 171, 39, 171, 171, 171,
-    72, 171, 171, 171, 171, 171, 13, 48, 27, 171, 171, 171, 171, 171, 171, 171,
-    35, 171, 171, 25, 171, 17, 171, 171, 171, 171, 171, 171, 171, 47, 171, 171,
-    171, 171, 16, 41, 171, 42, 171, 44, 171, 171, 74, 171, 171, 20, 6, 171,
-    18, 171, 171, 19, 171, 171, 171, 14, 171, 8, 171, 21, 171, 171, 28, 171,
-    171, 51, 171, 171, 171, 171, 171, 171, 34, 171, 7, 171, 171, 10, 171, 171,
-    171, 171, 31, 171, 24, 171, 171, 171, 15, 171, 171, 171, 171, 171, 12, 171,
-    171, 171, 171, 33, 171, 171, 171, 32, 171, 30, 171, 171, 171, 11, 171, 171,
-    171, 171, 171, 37, 26, 40, 0, 0, 456, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 119, 101, 456, 456, 456,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 502, 248, 248, 248, 494, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 456, 456, 456, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 456, 456, 456, 248, 248, 0,
-    111, 104, 112, 248, 0, 103, 109, 118, 129, 248, 248, 248, 100, 0, 248, 248,
-    248, 248, 248, 248, 173, 125, 248, 248, 248, 248, 0, 114, 175, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 126, 175, 456, 456, 94, 609, 2, 95, 123,
-    2, 609, 113, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    171, 116, 249, 1, 4, 4, 5, 79, 127, 68, 66, 174, 3, 222, 3, 3,
+    0, 0, 105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65, 70, 108,
+    121, 110, 81, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    91, 92, 106, 247, 67, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 89, 107, 90, 78, 2, 286, 2, 171,
+    171, 171, 171, 49, 171, 171, 9, 171, 171, 23, 171, 171, 171, 171, 0, 80,
+    171, 171, 50, 171, 171, 171, 171, 171, 171, 171, 38, 171, 171, 171, 171, 29,
+    43, 171, 171, 171, 171, 171, 22, 171, 36, 171, 39, 171, 171, 171, 72, 171,
+    171, 171, 171, 171, 13, 48, 27, 171, 171, 171, 171, 171, 171, 171, 35, 171,
+    171, 25, 171, 17, 171, 171, 171, 171, 171, 171, 171, 47, 171, 171, 171, 171,
+    16, 41, 171, 42, 171, 44, 171, 171, 74, 171, 171, 20, 6, 171, 18, 171,
+    171, 19, 171, 171, 171, 14, 171, 8, 171, 21, 171, 171, 28, 171, 171, 51,
+    171, 171, 171, 171, 171, 171, 34, 171, 7, 171, 171, 10, 171, 171, 171, 171,
+    31, 171, 24, 171, 171, 171, 15, 171, 171, 171, 171, 171, 12, 171, 171, 171,
+    171, 33, 171, 171, 171, 32, 171, 30, 171, 171, 171, 11, 171, 171, 171, 171,
+    171, 37, 26, 40, 0, 0, 455, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 46, 0, 0, 0, 0, 45, 128, 0, 103, 109, 130, 101, 119, 455,
+    455, 455, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 455, 455, 455,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 455, 455, 455, 247,
+    247, 0, 111, 104, 112, 247, 118, 129, 100, 247, 247, 247, 0, 175, 247, 247,
+    247, 247, 247, 247, 94, 173, 125, 0, 247, 247, 247, 247, 124, 175, 247, 247,
+    247, 114, 126, 247, 247, 247, 247, 247, 247, 247, 122, 455, 455, 2, 95, 123,
+    0, 174, 4, 113, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -1296,32 +1413,32 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 171, 116, 249, 1, 4, 4, 5, 79, 68, 127, 66, 124,
-    220, 122, 3, 223, 3, 3, 220, 0, 105, 69, 93, 131, 96, 98, 71, 99,
-    82, 97, 173, 65, 70, 108, 121, 110, 81, 248, 248, 248, 248, 550, 248, 248,
-    248, 248, 248, 497, 480, 248, 91, 92, 106, 248, 67, 171, 171, 171, 171, 171,
-    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 89, 107,
-    90, 78, 2, 287, 130, 171, 171, 171, 171, 49, 171, 171, 9, 171, 171, 23,
-    171, 171, 171, 171, 0, 80, 171, 171, 50, 171, 171, 171, 171, 171, 171, 171,
-    38, 171, 171, 171, 171, 29, 43, 171, 171, 171, 171, 171, 22, 171, 36, 171,
-    39, 171, 171, 171, 72, 171, 171, 171, 171, 171, 13, 48, 27, 171, 171, 171,
-    171, 171, 171, 171, 35, 171, 171, 25, 171, 17, 171, 171, 171, 171, 171, 171,
-    171, 47, 171, 171, 171, 171, 16, 41, 171, 42, 171, 44, 171, 171, 74, 171,
-    171, 20, 6, 171, 18, 171, 171, 19, 171, 171, 171, 14, 171, 8, 171, 21,
-    171, 171, 28, 171, 171, 51, 171, 171, 171, 171, 171, 171, 34, 171, 7, 171,
-    171, 10, 171, 171, 171, 171, 31, 171, 24, 171, 171, 171, 15, 171, 171, 171,
-    171, 171, 12, 171, 171, 171, 171, 33, 171, 171, 171, 32, 171, 30, 171, 171,
-    171, 11, 171, 171, 171, 171, 171, 37, 26, 40, 0, 0, 456, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 119,
-    101, 456, 456, 456, 492, 482, 487, 484, 485, 486, 248, 488, 248, 248, 570, 522,
-    493, 248, 248, 491, 490, 563, 495, 248, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 456,
-    456, 456, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 551, 248, 248, 248, 456, 456,
-    456, 248, 248, 0, 111, 104, 112, 489, 0, 103, 109, 118, 129, 248, 571, 248,
-    100, 0, 248, 248, 248, 248, 248, 248, 173, 125, 248, 248, 248, 248, 0, 114,
-    175, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 126, 175, 456, 456, 94,
-    609, 2, 95, 123, 2, 609, 113, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 171, 116, 247, 1, 4, 4, 5, 79, 127, 68, 66,
+    174, 3, 222, 3, 3, 0, 0, 105, 69, 93, 131, 96, 98, 71, 99, 82,
+    97, 173, 65, 70, 108, 121, 110, 81, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 91, 92, 106, 247, 67, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 89, 107, 90,
+    78, 2, 286, 2, 171, 171, 171, 171, 49, 171, 171, 9, 171, 171, 23, 171,
+    171, 171, 171, 0, 80, 171, 171, 50, 171, 171, 171, 171, 171, 171, 171, 38,
+    171, 171, 171, 171, 29, 43, 171, 171, 171, 171, 171, 22, 171, 36, 171, 39,
+    171, 171, 171, 72, 171, 171, 171, 171, 171, 13, 48, 27, 171, 171, 171, 171,
+    171, 171, 171, 35, 171, 171, 25, 171, 17, 171, 171, 171, 171, 171, 171, 171,
+    47, 171, 171, 171, 171, 16, 41, 171, 42, 171, 44, 171, 171, 74, 171, 171,
+    20, 6, 171, 18, 171, 171, 19, 171, 171, 171, 14, 171, 8, 171, 21, 171,
+    171, 28, 171, 171, 51, 171, 171, 171, 171, 171, 171, 34, 171, 7, 171, 171,
+    10, 171, 171, 171, 171, 31, 171, 24, 171, 171, 171, 15, 171, 171, 171, 171,
+    171, 12, 171, 171, 171, 171, 33, 171, 171, 171, 32, 171, 30, 171, 171, 171,
+    11, 171, 171, 171, 171, 171, 37, 26, 40, 0, 0, 455, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 0, 103,
+    109, 130, 101, 119, 455, 455, 455, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 513, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 455, 455, 455, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 585, 247, 247, 247, 247, 247, 247, 247,
+    247, 455, 455, 455, 247, 247, 0, 111, 104, 112, 247, 118, 129, 100, 247, 247,
+    247, 0, 175, 247, 247, 247, 247, 247, 247, 94, 173, 125, 0, 247, 247, 247,
+    247, 124, 175, 247, 247, 247, 114, 126, 247, 247, 247, 247, 247, 247, 247, 122,
+    455, 455, 2, 95, 123, 0, 174, 4, 113, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -1334,12 +1451,12 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 171, 116, 248, 1, 4, 4, 5, 79,
-    68, 127, 66, 124, 174, 122, 3, 223, 3, 3, 0, 0, 105, 69, 93, 131,
-    96, 98, 71, 99, 82, 97, 173, 65, 70, 108, 121, 110, 81, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 91, 92, 106, 248, 67, 171,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 171, 116, 247, 1, 4, 4,
+    5, 79, 127, 68, 66, 174, 3, 222, 3, 3, 0, 0, 105, 69, 93, 131,
+    96, 98, 71, 99, 82, 97, 173, 65, 70, 108, 121, 110, 81, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 91, 92, 106, 247, 67, 171,
     171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
-    171, 171, 89, 107, 90, 78, 2, 287, 130, 171, 171, 171, 171, 49, 171, 171,
+    171, 171, 89, 107, 90, 78, 2, 286, 2, 171, 171, 171, 171, 49, 171, 171,
     9, 171, 171, 23, 171, 171, 171, 171, 0, 80, 171, 171, 50, 171, 171, 171,
     171, 171, 171, 171, 38, 171, 171, 171, 171, 29, 43, 171, 171, 171, 171, 171,
     22, 171, 36, 171, 39, 171, 171, 171, 72, 171, 171, 171, 171, 171, 13, 48,
@@ -1350,54 +1467,16 @@ extern token_type_t const lexer_transition_table[51408] = {
     34, 171, 7, 171, 171, 10, 171, 171, 171, 171, 31, 171, 24, 171, 171, 171,
     15, 171, 171, 171, 171, 171, 12, 171, 171, 171, 171, 33, 171, 171, 171, 32,
     171, 30, 171, 171, 171, 11, 171, 171, 171, 171, 171, 37, 26, 40, 0, 0,
-    456, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0,
-    0, 45, 128, 119, 101, 456, 456, 456, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 456, 456, 456, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 456, 456, 456, 248, 248, 0, 111, 104, 112, 248, 0, 103, 109, 118,
-    129, 248, 248, 248, 100, 0, 248, 248, 248, 248, 248, 248, 173, 125, 248, 248,
-    248, 248, 0, 114, 175, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 126,
-    175, 456, 456, 94, 0, 2, 95, 123, 2, 174, 113, 4, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 171, 116, 250, 1,
-    4, 4, 5, 79, 68, 127, 66, 124, 174, 122, 3, 223, 3, 3, 0, 0,
-    105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65, 70, 108, 121, 110,
-    81, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 91, 92,
-    106, 248, 67, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
-    171, 171, 171, 171, 171, 171, 89, 107, 90, 78, 2, 287, 130, 171, 171, 171,
-    171, 49, 171, 171, 9, 171, 171, 23, 171, 171, 171, 171, 0, 80, 171, 171,
-    50, 171, 171, 171, 171, 171, 171, 171, 38, 171, 171, 171, 171, 29, 43, 171,
-    171, 171, 171, 171, 22, 171, 36, 171, 39, 171, 171, 171, 72, 171, 171, 171,
-    171, 171, 13, 48, 27, 171, 171, 171, 171, 171, 171, 171, 35, 171, 171, 25,
-    171, 17, 171, 171, 171, 171, 171, 171, 171, 47, 171, 171, 171, 171, 16, 41,
-    171, 42, 171, 44, 171, 171, 74, 171, 171, 20, 6, 171, 18, 171, 171, 19,
-    171, 171, 171, 14, 171, 8, 171, 21, 171, 171, 28, 171, 171, 51, 171, 171,
-    171, 171, 171, 171, 34, 171, 7, 171, 171, 10, 171, 171, 171, 171, 31, 171,
-    24, 171, 171, 171, 15, 171, 171, 171, 171, 171, 12, 171, 171, 171, 171, 33,
-    171, 171, 171, 32, 171, 30, 171, 171, 171, 11, 171, 171, 171, 171, 171, 37,
-    26, 40, 0, 0, 456, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    46, 0, 0, 0, 0, 45, 128, 119, 101, 456, 456, 456, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 456, 456, 456, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 456, 456, 456, 248, 248, 0, 111, 104, 112, 248,
-    0, 103, 109, 118, 129, 248, 248, 248, 100, 0, 248, 248, 248, 248, 248, 248,
-    173, 125, 248, 248, 248, 248, 0, 114, 175, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 126, 175, 456, 456, 94, 0, 2, 95, 123, 2, 174, 113, 4,
+    455, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0,
+    0, 45, 128, 0, 103, 109, 130, 101, 119, 455, 455, 455, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 519,
+    247, 247, 247, 247, 247, 247, 247, 455, 455, 455, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 540, 247, 247, 247, 544, 545, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 455, 455, 455, 247, 247, 0, 111, 104, 112, 247,
+    118, 129, 100, 247, 247, 247, 0, 175, 247, 247, 247, 247, 247, 247, 94, 173,
+    125, 0, 247, 247, 247, 247, 124, 175, 247, 247, 247, 114, 126, 247, 247, 247,
+    247, 247, 247, 247, 122, 455, 455, 2, 95, 123, 0, 174, 4, 113, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -1410,33 +1489,33 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    171, 116, 248, 1, 4, 4, 5, 79, 68, 127, 66, 124, 174, 122, 3, 223,
-    3, 3, 0, 0, 105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65,
-    70, 108, 121, 110, 81, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 91, 92, 106, 248, 67, 171, 171, 171, 171, 171, 171, 171, 171, 171,
-    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 89, 107, 90, 78, 2, 287,
-    130, 171, 171, 171, 171, 49, 171, 171, 9, 171, 171, 23, 171, 171, 171, 171,
-    0, 80, 171, 171, 50, 171, 171, 171, 171, 171, 171, 171, 38, 171, 171, 171,
-    171, 29, 43, 171, 171, 171, 171, 171, 22, 171, 36, 171, 39, 171, 171, 171,
-    72, 171, 171, 171, 171, 171, 13, 48, 27, 171, 171, 171, 171, 171, 171, 171,
-    35, 171, 171, 25, 171, 17, 171, 171, 171, 171, 171, 171, 171, 47, 171, 171,
-    171, 171, 16, 41, 171, 42, 171, 44, 171, 171, 74, 171, 171, 20, 6, 171,
-    18, 171, 171, 19, 171, 171, 171, 14, 171, 8, 171, 21, 171, 171, 28, 171,
-    171, 51, 171, 171, 171, 171, 171, 171, 34, 171, 7, 171, 171, 10, 171, 171,
-    171, 171, 31, 171, 24, 171, 171, 171, 15, 171, 171, 171, 171, 171, 12, 171,
-    171, 171, 171, 33, 171, 171, 171, 32, 171, 30, 171, 171, 171, 11, 171, 171,
-    171, 171, 171, 37, 26, 40, 0, 0, 456, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 119, 101, 456, 456, 456,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 510, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 456, 456, 456, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 582, 248, 248, 248, 248, 248, 248, 248, 248, 456, 456, 456, 248, 248, 0,
-    111, 104, 112, 248, 0, 103, 109, 118, 129, 248, 248, 248, 100, 0, 248, 248,
-    248, 248, 248, 248, 173, 125, 248, 248, 248, 248, 0, 114, 175, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 126, 175, 456, 456, 94, 0, 2, 95, 123,
-    2, 174, 113, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 171,
+    116, 250, 1, 4, 4, 5, 79, 127, 68, 66, 174, 3, 222, 3, 3, 0,
+    0, 105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65, 70, 108, 121,
+    110, 81, 247, 247, 247, 247, 247, 247, 601, 247, 247, 247, 247, 247, 247, 91,
+    92, 106, 247, 67, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 89, 107, 90, 78, 2, 286, 2, 171, 171,
+    171, 171, 49, 171, 171, 9, 171, 171, 23, 171, 171, 171, 171, 0, 80, 171,
+    171, 50, 171, 171, 171, 171, 171, 171, 171, 38, 171, 171, 171, 171, 29, 43,
+    171, 171, 171, 171, 171, 22, 171, 36, 171, 39, 171, 171, 171, 72, 171, 171,
+    171, 171, 171, 13, 48, 27, 171, 171, 171, 171, 171, 171, 171, 35, 171, 171,
+    25, 171, 17, 171, 171, 171, 171, 171, 171, 171, 47, 171, 171, 171, 171, 16,
+    41, 171, 42, 171, 44, 171, 171, 74, 171, 171, 20, 6, 171, 18, 171, 171,
+    19, 171, 171, 171, 14, 171, 8, 171, 21, 171, 171, 28, 171, 171, 51, 171,
+    171, 171, 171, 171, 171, 34, 171, 7, 171, 171, 10, 171, 171, 171, 171, 31,
+    171, 24, 171, 171, 171, 15, 171, 171, 171, 171, 171, 12, 171, 171, 171, 171,
+    33, 171, 171, 171, 32, 171, 30, 171, 171, 171, 11, 171, 171, 171, 171, 171,
+    37, 26, 40, 0, 0, 455, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 46, 0, 0, 0, 0, 45, 128, 0, 103, 109, 130, 101, 119, 455, 455,
+    455, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 506, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 455, 455, 455, 247,
+    247, 533, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 455, 455, 455, 247, 247,
+    0, 111, 104, 112, 247, 118, 129, 100, 247, 247, 247, 0, 175, 247, 247, 247,
+    247, 247, 247, 94, 173, 125, 0, 247, 247, 247, 247, 124, 175, 592, 247, 247,
+    114, 126, 598, 247, 247, 247, 247, 602, 247, 122, 455, 455, 2, 95, 123, 0,
+    174, 4, 113, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -1449,32 +1528,32 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 171, 116, 248, 1, 4, 4, 5, 79, 68, 127, 66, 124,
-    174, 122, 3, 223, 3, 3, 0, 0, 105, 69, 93, 131, 96, 98, 71, 99,
-    82, 97, 173, 65, 70, 108, 121, 110, 81, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 91, 92, 106, 248, 67, 171, 171, 171, 171, 171,
-    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 89, 107,
-    90, 78, 2, 287, 130, 171, 171, 171, 171, 49, 171, 171, 9, 171, 171, 23,
-    171, 171, 171, 171, 0, 80, 171, 171, 50, 171, 171, 171, 171, 171, 171, 171,
-    38, 171, 171, 171, 171, 29, 43, 171, 171, 171, 171, 171, 22, 171, 36, 171,
-    39, 171, 171, 171, 72, 171, 171, 171, 171, 171, 13, 48, 27, 171, 171, 171,
-    171, 171, 171, 171, 35, 171, 171, 25, 171, 17, 171, 171, 171, 171, 171, 171,
-    171, 47, 171, 171, 171, 171, 16, 41, 171, 42, 171, 44, 171, 171, 74, 171,
-    171, 20, 6, 171, 18, 171, 171, 19, 171, 171, 171, 14, 171, 8, 171, 21,
-    171, 171, 28, 171, 171, 51, 171, 171, 171, 171, 171, 171, 34, 171, 7, 171,
-    171, 10, 171, 171, 171, 171, 31, 171, 24, 171, 171, 171, 15, 171, 171, 171,
-    171, 171, 12, 171, 171, 171, 171, 33, 171, 171, 171, 32, 171, 30, 171, 171,
-    171, 11, 171, 171, 171, 171, 171, 37, 26, 40, 0, 0, 456, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 119,
-    101, 456, 456, 456, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 516, 248, 248, 248, 248, 248, 248, 248, 456,
-    456, 456, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 537, 248, 248, 248,
-    541, 542, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 456, 456,
-    456, 248, 248, 0, 111, 104, 112, 248, 0, 103, 109, 118, 129, 248, 248, 248,
-    100, 0, 248, 248, 248, 248, 248, 248, 173, 125, 248, 248, 248, 248, 0, 114,
-    175, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 126, 175, 456, 456, 94,
-    0, 2, 95, 123, 2, 174, 113, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 171, 116, 247, 1, 4, 4, 5, 79, 127, 68, 66, 174,
+    3, 222, 3, 3, 0, 0, 105, 69, 93, 131, 96, 98, 71, 99, 82, 97,
+    173, 65, 70, 108, 121, 110, 81, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 91, 92, 106, 247, 67, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 89, 107, 90, 78,
+    2, 286, 2, 171, 171, 171, 171, 49, 171, 171, 9, 171, 171, 23, 171, 171,
+    171, 171, 0, 80, 171, 171, 50, 171, 171, 171, 171, 171, 171, 171, 38, 171,
+    171, 171, 171, 29, 43, 171, 171, 171, 171, 171, 22, 171, 36, 171, 39, 171,
+    171, 171, 72, 171, 171, 171, 171, 171, 13, 48, 27, 171, 171, 171, 171, 171,
+    171, 171, 35, 171, 171, 25, 171, 17, 171, 171, 171, 171, 171, 171, 171, 47,
+    171, 171, 171, 171, 16, 41, 171, 42, 171, 44, 171, 171, 74, 171, 171, 20,
+    6, 171, 18, 171, 171, 19, 171, 171, 171, 14, 171, 8, 171, 21, 171, 171,
+    28, 171, 171, 51, 171, 171, 171, 171, 171, 171, 34, 171, 7, 171, 171, 10,
+    171, 171, 171, 171, 31, 171, 24, 171, 171, 171, 15, 171, 171, 171, 171, 171,
+    12, 171, 171, 171, 171, 33, 171, 171, 171, 32, 171, 30, 171, 171, 171, 11,
+    171, 171, 171, 171, 171, 37, 26, 40, 0, 0, 455, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 0, 103, 109,
+    130, 101, 119, 455, 455, 455, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 570, 247, 247, 247, 247, 247, 247, 247, 247, 247, 509, 247,
+    247, 247, 512, 247, 514, 247, 247, 517, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 455, 455, 455, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    455, 455, 455, 247, 247, 0, 111, 104, 112, 247, 118, 129, 100, 247, 247, 247,
+    0, 175, 247, 247, 247, 247, 247, 247, 94, 173, 125, 0, 247, 247, 247, 247,
+    124, 175, 247, 247, 247, 114, 126, 247, 247, 247, 247, 247, 247, 247, 122, 455,
+    455, 2, 95, 123, 0, 174, 4, 113, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -1487,32 +1566,32 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 171, 116, 251, 1, 4, 4, 5, 79,
-    68, 127, 66, 124, 174, 122, 3, 223, 3, 3, 0, 0, 105, 69, 93, 131,
-    96, 98, 71, 99, 82, 97, 173, 65, 70, 108, 121, 110, 81, 248, 248, 248,
-    248, 248, 248, 597, 248, 248, 248, 248, 248, 248, 91, 92, 106, 248, 67, 171,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 171, 116, 251, 1, 4, 4, 5,
+    79, 127, 68, 66, 174, 3, 222, 3, 3, 0, 0, 105, 69, 93, 131, 96,
+    98, 71, 99, 82, 97, 173, 65, 70, 108, 121, 110, 81, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 91, 92, 106, 247, 67, 171, 171,
     171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
-    171, 171, 89, 107, 90, 78, 2, 287, 130, 171, 171, 171, 171, 49, 171, 171,
-    9, 171, 171, 23, 171, 171, 171, 171, 0, 80, 171, 171, 50, 171, 171, 171,
-    171, 171, 171, 171, 38, 171, 171, 171, 171, 29, 43, 171, 171, 171, 171, 171,
-    22, 171, 36, 171, 39, 171, 171, 171, 72, 171, 171, 171, 171, 171, 13, 48,
-    27, 171, 171, 171, 171, 171, 171, 171, 35, 171, 171, 25, 171, 17, 171, 171,
-    171, 171, 171, 171, 171, 47, 171, 171, 171, 171, 16, 41, 171, 42, 171, 44,
-    171, 171, 74, 171, 171, 20, 6, 171, 18, 171, 171, 19, 171, 171, 171, 14,
-    171, 8, 171, 21, 171, 171, 28, 171, 171, 51, 171, 171, 171, 171, 171, 171,
-    34, 171, 7, 171, 171, 10, 171, 171, 171, 171, 31, 171, 24, 171, 171, 171,
-    15, 171, 171, 171, 171, 171, 12, 171, 171, 171, 171, 33, 171, 171, 171, 32,
-    171, 30, 171, 171, 171, 11, 171, 171, 171, 171, 171, 37, 26, 40, 0, 0,
-    456, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0,
-    0, 45, 128, 119, 101, 456, 456, 456, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 503, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 456, 456, 456, 248, 248, 530, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 456, 456, 456, 248, 248, 0, 111, 104, 112, 248, 0, 103, 109, 118,
-    129, 248, 248, 248, 100, 0, 248, 248, 248, 248, 248, 248, 173, 125, 248, 248,
-    248, 248, 0, 114, 175, 590, 248, 248, 594, 248, 248, 248, 248, 598, 248, 126,
-    175, 456, 456, 94, 0, 2, 95, 123, 2, 174, 113, 4, 0, 0, 0, 0,
+    171, 89, 107, 90, 78, 2, 286, 2, 171, 171, 171, 171, 49, 171, 171, 9,
+    171, 171, 23, 171, 171, 171, 171, 0, 80, 171, 171, 50, 171, 171, 171, 171,
+    171, 171, 171, 38, 171, 171, 171, 171, 29, 43, 171, 171, 171, 171, 171, 22,
+    171, 36, 171, 39, 171, 171, 171, 72, 171, 171, 171, 171, 171, 13, 48, 27,
+    171, 171, 171, 171, 171, 171, 171, 35, 171, 171, 25, 171, 17, 171, 171, 171,
+    171, 171, 171, 171, 47, 171, 171, 171, 171, 16, 41, 171, 42, 171, 44, 171,
+    171, 74, 171, 171, 20, 6, 171, 18, 171, 171, 19, 171, 171, 171, 14, 171,
+    8, 171, 21, 171, 171, 28, 171, 171, 51, 171, 171, 171, 171, 171, 171, 34,
+    171, 7, 171, 171, 10, 171, 171, 171, 171, 31, 171, 24, 171, 171, 171, 15,
+    171, 171, 171, 171, 171, 12, 171, 171, 171, 171, 33, 171, 171, 171, 32, 171,
+    30, 171, 171, 171, 11, 171, 171, 171, 171, 171, 37, 26, 40, 0, 0, 455,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0,
+    45, 128, 0, 103, 109, 130, 101, 119, 455, 455, 455, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 515, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 455, 455, 455, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 543, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 455, 455, 455, 247, 247, 0, 111, 104, 112, 247, 118,
+    129, 100, 247, 247, 247, 0, 175, 247, 247, 247, 247, 247, 247, 94, 173, 125,
+    0, 247, 247, 247, 247, 124, 175, 247, 247, 247, 114, 126, 247, 247, 247, 247,
+    247, 247, 247, 122, 455, 455, 2, 95, 123, 0, 174, 4, 113, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -1525,12 +1604,12 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 171, 116, 248, 1,
-    4, 4, 5, 79, 68, 127, 66, 124, 174, 122, 3, 223, 3, 3, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 171, 116,
+    252, 1, 4, 4, 5, 79, 127, 68, 66, 174, 3, 222, 3, 3, 0, 0,
     105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65, 70, 108, 121, 110,
-    81, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 91, 92,
-    106, 248, 67, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
-    171, 171, 171, 171, 171, 171, 89, 107, 90, 78, 2, 287, 130, 171, 171, 171,
+    81, 247, 247, 247, 247, 247, 247, 247, 247, 529, 247, 247, 247, 247, 91, 92,
+    106, 247, 67, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 89, 107, 90, 78, 2, 286, 2, 171, 171, 171,
     171, 49, 171, 171, 9, 171, 171, 23, 171, 171, 171, 171, 0, 80, 171, 171,
     50, 171, 171, 171, 171, 171, 171, 171, 38, 171, 171, 171, 171, 29, 43, 171,
     171, 171, 171, 171, 22, 171, 36, 171, 39, 171, 171, 171, 72, 171, 171, 171,
@@ -1541,55 +1620,17 @@ extern token_type_t const lexer_transition_table[51408] = {
     171, 171, 171, 171, 34, 171, 7, 171, 171, 10, 171, 171, 171, 171, 31, 171,
     24, 171, 171, 171, 15, 171, 171, 171, 171, 171, 12, 171, 171, 171, 171, 33,
     171, 171, 171, 32, 171, 30, 171, 171, 171, 11, 171, 171, 171, 171, 171, 37,
-    26, 40, 0, 0, 456, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    46, 0, 0, 0, 0, 45, 128, 119, 101, 456, 456, 456, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 569, 248, 248, 248, 248, 248,
-    248, 248, 248, 248, 506, 248, 248, 248, 509, 248, 511, 248, 248, 514, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 456, 456, 456, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 456, 456, 456, 248, 248, 0, 111, 104, 112, 248,
-    0, 103, 109, 118, 129, 248, 248, 248, 100, 0, 248, 248, 248, 248, 248, 248,
-    173, 125, 248, 248, 248, 248, 0, 114, 175, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 126, 175, 456, 456, 94, 0, 2, 95, 123, 2, 174, 113, 4,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    171, 116, 252, 1, 4, 4, 5, 79, 68, 127, 66, 124, 174, 122, 3, 223,
-    3, 3, 0, 0, 105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65,
-    70, 108, 121, 110, 81, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 91, 92, 106, 248, 67, 171, 171, 171, 171, 171, 171, 171, 171, 171,
-    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 89, 107, 90, 78, 2, 287,
-    130, 171, 171, 171, 171, 49, 171, 171, 9, 171, 171, 23, 171, 171, 171, 171,
-    0, 80, 171, 171, 50, 171, 171, 171, 171, 171, 171, 171, 38, 171, 171, 171,
-    171, 29, 43, 171, 171, 171, 171, 171, 22, 171, 36, 171, 39, 171, 171, 171,
-    72, 171, 171, 171, 171, 171, 13, 48, 27, 171, 171, 171, 171, 171, 171, 171,
-    35, 171, 171, 25, 171, 17, 171, 171, 171, 171, 171, 171, 171, 47, 171, 171,
-    171, 171, 16, 41, 171, 42, 171, 44, 171, 171, 74, 171, 171, 20, 6, 171,
-    18, 171, 171, 19, 171, 171, 171, 14, 171, 8, 171, 21, 171, 171, 28, 171,
-    171, 51, 171, 171, 171, 171, 171, 171, 34, 171, 7, 171, 171, 10, 171, 171,
-    171, 171, 31, 171, 24, 171, 171, 171, 15, 171, 171, 171, 171, 171, 12, 171,
-    171, 171, 171, 33, 171, 171, 171, 32, 171, 30, 171, 171, 171, 11, 171, 171,
-    171, 171, 171, 37, 26, 40, 0, 0, 456, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 119, 101, 456, 456, 456,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 512,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 456, 456, 456, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 540, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 456, 456, 456, 248, 248, 0,
-    111, 104, 112, 248, 0, 103, 109, 118, 129, 248, 248, 248, 100, 0, 248, 248,
-    248, 248, 248, 248, 173, 125, 248, 248, 248, 248, 0, 114, 175, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 126, 175, 456, 456, 94, 0, 2, 95, 123,
-    2, 174, 113, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    26, 40, 0, 0, 455, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    46, 0, 0, 0, 0, 45, 128, 0, 103, 109, 130, 101, 119, 455, 455, 455,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 510, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 455, 455, 455, 530, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 455, 455, 455, 247, 247, 0,
+    111, 104, 112, 247, 118, 129, 100, 247, 247, 247, 0, 175, 247, 247, 247, 247,
+    247, 247, 94, 173, 125, 0, 247, 247, 247, 247, 124, 175, 247, 247, 247, 114,
+    126, 247, 247, 247, 247, 247, 247, 247, 122, 455, 455, 2, 95, 123, 0, 174,
+    4, 113, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -1602,32 +1643,32 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 171, 116, 253, 1, 4, 4, 5, 79, 68, 127, 66, 124,
-    174, 122, 3, 223, 3, 3, 0, 0, 105, 69, 93, 131, 96, 98, 71, 99,
-    82, 97, 173, 65, 70, 108, 121, 110, 81, 248, 248, 248, 248, 248, 248, 248,
-    248, 526, 248, 248, 248, 248, 91, 92, 106, 248, 67, 171, 171, 171, 171, 171,
-    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 89, 107,
-    90, 78, 2, 287, 130, 171, 171, 171, 171, 49, 171, 171, 9, 171, 171, 23,
-    171, 171, 171, 171, 0, 80, 171, 171, 50, 171, 171, 171, 171, 171, 171, 171,
-    38, 171, 171, 171, 171, 29, 43, 171, 171, 171, 171, 171, 22, 171, 36, 171,
-    39, 171, 171, 171, 72, 171, 171, 171, 171, 171, 13, 48, 27, 171, 171, 171,
-    171, 171, 171, 171, 35, 171, 171, 25, 171, 17, 171, 171, 171, 171, 171, 171,
-    171, 47, 171, 171, 171, 171, 16, 41, 171, 42, 171, 44, 171, 171, 74, 171,
-    171, 20, 6, 171, 18, 171, 171, 19, 171, 171, 171, 14, 171, 8, 171, 21,
-    171, 171, 28, 171, 171, 51, 171, 171, 171, 171, 171, 171, 34, 171, 7, 171,
-    171, 10, 171, 171, 171, 171, 31, 171, 24, 171, 171, 171, 15, 171, 171, 171,
-    171, 171, 12, 171, 171, 171, 171, 33, 171, 171, 171, 32, 171, 30, 171, 171,
-    171, 11, 171, 171, 171, 171, 171, 37, 26, 40, 0, 0, 456, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 119,
-    101, 456, 456, 456, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 507, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 456,
-    456, 456, 527, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 456, 456,
-    456, 248, 248, 0, 111, 104, 112, 248, 0, 103, 109, 118, 129, 248, 248, 248,
-    100, 0, 248, 248, 248, 248, 248, 248, 173, 125, 248, 248, 248, 248, 0, 114,
-    175, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 126, 175, 456, 456, 94,
-    0, 2, 95, 123, 2, 174, 113, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 171, 116, 253, 1, 4, 4, 5, 79, 127, 68, 66, 174, 3,
+    222, 3, 3, 0, 0, 105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173,
+    65, 70, 108, 121, 110, 81, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 91, 92, 106, 247, 67, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 89, 107, 90, 78, 2,
+    286, 2, 171, 171, 171, 171, 49, 171, 171, 9, 171, 171, 23, 171, 171, 171,
+    171, 0, 80, 171, 171, 50, 171, 171, 171, 171, 171, 171, 171, 38, 171, 171,
+    171, 171, 29, 43, 171, 171, 171, 171, 171, 22, 171, 36, 171, 39, 171, 171,
+    171, 72, 171, 171, 171, 171, 171, 13, 48, 27, 171, 171, 171, 171, 171, 171,
+    171, 35, 171, 171, 25, 171, 17, 171, 171, 171, 171, 171, 171, 171, 47, 171,
+    171, 171, 171, 16, 41, 171, 42, 171, 44, 171, 171, 74, 171, 171, 20, 6,
+    171, 18, 171, 171, 19, 171, 171, 171, 14, 171, 8, 171, 21, 171, 171, 28,
+    171, 171, 51, 171, 171, 171, 171, 171, 171, 34, 171, 7, 171, 171, 10, 171,
+    171, 171, 171, 31, 171, 24, 171, 171, 171, 15, 171, 171, 171, 171, 171, 12,
+    171, 171, 171, 171, 33, 171, 171, 171, 32, 171, 30, 171, 171, 171, 11, 171,
+    171, 171, 171, 171, 37, 26, 40, 0, 0, 455, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 0, 103, 109, 130,
+    101, 119, 455, 455, 455, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    455, 455, 455, 247, 247, 247, 247, 247, 247, 539, 247, 538, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 552, 247, 247, 247, 247, 247, 455,
+    455, 455, 247, 247, 0, 111, 104, 112, 247, 118, 129, 100, 247, 247, 247, 0,
+    175, 542, 247, 247, 247, 247, 247, 94, 173, 125, 0, 247, 247, 247, 247, 124,
+    175, 247, 247, 247, 114, 126, 247, 247, 247, 247, 247, 247, 247, 122, 455, 455,
+    2, 95, 123, 0, 174, 4, 113, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -1641,31 +1682,31 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 171, 116, 254, 1, 4, 4, 5, 79,
-    68, 127, 66, 124, 174, 122, 3, 223, 3, 3, 0, 0, 105, 69, 93, 131,
-    96, 98, 71, 99, 82, 97, 173, 65, 70, 108, 121, 110, 81, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 91, 92, 106, 248, 67, 171,
+    127, 68, 66, 174, 3, 222, 3, 3, 0, 0, 105, 69, 93, 131, 96, 98,
+    71, 99, 82, 97, 173, 65, 70, 108, 121, 110, 81, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 501, 247, 247, 91, 92, 106, 247, 67, 171, 171, 171,
     171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
-    171, 171, 89, 107, 90, 78, 2, 287, 130, 171, 171, 171, 171, 49, 171, 171,
-    9, 171, 171, 23, 171, 171, 171, 171, 0, 80, 171, 171, 50, 171, 171, 171,
-    171, 171, 171, 171, 38, 171, 171, 171, 171, 29, 43, 171, 171, 171, 171, 171,
-    22, 171, 36, 171, 39, 171, 171, 171, 72, 171, 171, 171, 171, 171, 13, 48,
-    27, 171, 171, 171, 171, 171, 171, 171, 35, 171, 171, 25, 171, 17, 171, 171,
-    171, 171, 171, 171, 171, 47, 171, 171, 171, 171, 16, 41, 171, 42, 171, 44,
-    171, 171, 74, 171, 171, 20, 6, 171, 18, 171, 171, 19, 171, 171, 171, 14,
-    171, 8, 171, 21, 171, 171, 28, 171, 171, 51, 171, 171, 171, 171, 171, 171,
-    34, 171, 7, 171, 171, 10, 171, 171, 171, 171, 31, 171, 24, 171, 171, 171,
-    15, 171, 171, 171, 171, 171, 12, 171, 171, 171, 171, 33, 171, 171, 171, 32,
-    171, 30, 171, 171, 171, 11, 171, 171, 171, 171, 171, 37, 26, 40, 0, 0,
-    456, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0,
-    0, 45, 128, 119, 101, 456, 456, 456, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 456, 456, 456, 248, 248, 248, 248, 248, 248, 536, 248, 535, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 549, 248, 248, 248,
-    248, 248, 456, 456, 456, 248, 248, 0, 111, 104, 112, 248, 0, 103, 109, 118,
-    129, 248, 248, 248, 100, 0, 539, 248, 248, 248, 248, 248, 173, 125, 248, 248,
-    248, 248, 0, 114, 175, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 126,
-    175, 456, 456, 94, 0, 2, 95, 123, 2, 174, 113, 4, 0, 0, 0, 0,
+    89, 107, 90, 78, 2, 286, 2, 171, 171, 171, 171, 49, 171, 171, 9, 171,
+    171, 23, 171, 171, 171, 171, 0, 80, 171, 171, 50, 171, 171, 171, 171, 171,
+    171, 171, 38, 171, 171, 171, 171, 29, 43, 171, 171, 171, 171, 171, 22, 171,
+    36, 171, 39, 171, 171, 171, 72, 171, 171, 171, 171, 171, 13, 48, 27, 171,
+    171, 171, 171, 171, 171, 171, 35, 171, 171, 25, 171, 17, 171, 171, 171, 171,
+    171, 171, 171, 47, 171, 171, 171, 171, 16, 41, 171, 42, 171, 44, 171, 171,
+    74, 171, 171, 20, 6, 171, 18, 171, 171, 19, 171, 171, 171, 14, 171, 8,
+    171, 21, 171, 171, 28, 171, 171, 51, 171, 171, 171, 171, 171, 171, 34, 171,
+    7, 171, 171, 10, 171, 171, 171, 171, 31, 171, 24, 171, 171, 171, 15, 171,
+    171, 171, 171, 171, 12, 171, 171, 171, 171, 33, 171, 171, 171, 32, 171, 30,
+    171, 171, 171, 11, 171, 171, 171, 171, 171, 37, 26, 40, 0, 0, 455, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45,
+    128, 0, 103, 109, 130, 101, 119, 455, 455, 455, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 499, 503, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 521,
+    247, 247, 247, 247, 247, 455, 455, 455, 247, 247, 534, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 546, 247, 247, 247, 247, 247, 548, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 455, 455, 455, 247, 247, 0, 111, 104, 112, 247, 118, 129,
+    100, 247, 247, 247, 0, 175, 247, 247, 247, 247, 247, 247, 94, 173, 125, 0,
+    247, 247, 247, 247, 124, 175, 247, 247, 247, 114, 126, 247, 247, 247, 247, 247,
+    247, 247, 122, 455, 455, 2, 95, 123, 0, 174, 4, 113, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -1678,33 +1719,33 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 171, 116, 255, 1,
-    4, 4, 5, 79, 68, 127, 66, 124, 174, 122, 3, 223, 3, 3, 0, 0,
-    105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65, 70, 108, 121, 110,
-    81, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 498, 248, 248, 91, 92,
-    106, 248, 67, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
-    171, 171, 171, 171, 171, 171, 89, 107, 90, 78, 2, 287, 130, 171, 171, 171,
-    171, 49, 171, 171, 9, 171, 171, 23, 171, 171, 171, 171, 0, 80, 171, 171,
-    50, 171, 171, 171, 171, 171, 171, 171, 38, 171, 171, 171, 171, 29, 43, 171,
-    171, 171, 171, 171, 22, 171, 36, 171, 39, 171, 171, 171, 72, 171, 171, 171,
-    171, 171, 13, 48, 27, 171, 171, 171, 171, 171, 171, 171, 35, 171, 171, 25,
-    171, 17, 171, 171, 171, 171, 171, 171, 171, 47, 171, 171, 171, 171, 16, 41,
-    171, 42, 171, 44, 171, 171, 74, 171, 171, 20, 6, 171, 18, 171, 171, 19,
-    171, 171, 171, 14, 171, 8, 171, 21, 171, 171, 28, 171, 171, 51, 171, 171,
-    171, 171, 171, 171, 34, 171, 7, 171, 171, 10, 171, 171, 171, 171, 31, 171,
-    24, 171, 171, 171, 15, 171, 171, 171, 171, 171, 12, 171, 171, 171, 171, 33,
-    171, 171, 171, 32, 171, 30, 171, 171, 171, 11, 171, 171, 171, 171, 171, 37,
-    26, 40, 0, 0, 456, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    46, 0, 0, 0, 0, 45, 128, 119, 101, 456, 456, 456, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 496, 500,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 518, 248, 248, 248, 248, 248, 456, 456, 456, 248, 248, 531, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 543, 248, 248, 248, 248, 248, 545, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 456, 456, 456, 248, 248, 0, 111, 104, 112, 248,
-    0, 103, 109, 118, 129, 248, 248, 248, 100, 0, 248, 248, 248, 248, 248, 248,
-    173, 125, 248, 248, 248, 248, 0, 114, 175, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 126, 175, 456, 456, 94, 0, 2, 95, 123, 2, 174, 113, 4,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 171, 116, 247,
+    1, 4, 4, 5, 79, 127, 68, 66, 174, 3, 222, 3, 3, 0, 0, 105,
+    69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65, 70, 108, 121, 110, 81,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 91, 92, 106,
+    247, 67, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 89, 107, 90, 78, 2, 286, 2, 171, 171, 171, 171,
+    49, 171, 171, 9, 171, 171, 23, 171, 171, 171, 171, 0, 80, 171, 171, 50,
+    171, 171, 171, 171, 171, 171, 171, 38, 171, 171, 171, 171, 29, 43, 171, 171,
+    171, 171, 171, 22, 171, 36, 171, 39, 171, 171, 171, 72, 171, 171, 171, 171,
+    171, 13, 48, 27, 171, 171, 171, 171, 171, 171, 171, 35, 171, 171, 25, 171,
+    17, 171, 171, 171, 171, 171, 171, 171, 47, 171, 171, 171, 171, 16, 41, 171,
+    42, 171, 44, 171, 171, 74, 171, 171, 20, 6, 171, 18, 171, 171, 19, 171,
+    171, 171, 14, 171, 8, 171, 21, 171, 171, 28, 171, 171, 51, 171, 171, 171,
+    171, 171, 171, 34, 171, 7, 171, 171, 10, 171, 171, 171, 171, 31, 171, 24,
+    171, 171, 171, 15, 171, 171, 171, 171, 171, 12, 171, 171, 171, 171, 33, 171,
+    171, 171, 32, 171, 30, 171, 171, 171, 11, 171, 171, 171, 171, 171, 37, 26,
+    40, 0, 0, 455, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46,
+    0, 0, 0, 0, 45, 128, 0, 103, 109, 130, 101, 119, 455, 455, 455, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 504, 247, 247, 247, 247, 247, 520, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 455, 455, 455, 247, 247, 247,
+    247, 247, 576, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 455, 455, 455, 247, 247, 0, 111,
+    104, 112, 247, 118, 129, 100, 247, 247, 247, 0, 175, 247, 247, 578, 247, 247,
+    535, 94, 173, 125, 0, 247, 587, 247, 247, 124, 175, 247, 247, 247, 114, 126,
+    247, 549, 247, 247, 247, 247, 247, 122, 455, 455, 2, 95, 123, 0, 174, 4,
+    113, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -1717,12 +1758,12 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    171, 116, 248, 1, 4, 4, 5, 79, 68, 127, 66, 124, 174, 122, 3, 223,
+    0, 0, 171, 116, 255, 1, 4, 4, 5, 79, 127, 68, 66, 174, 3, 222,
     3, 3, 0, 0, 105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65,
-    70, 108, 121, 110, 81, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 91, 92, 106, 248, 67, 171, 171, 171, 171, 171, 171, 171, 171, 171,
-    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 89, 107, 90, 78, 2, 287,
-    130, 171, 171, 171, 171, 49, 171, 171, 9, 171, 171, 23, 171, 171, 171, 171,
+    70, 108, 121, 110, 81, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    484, 247, 91, 92, 106, 247, 67, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 89, 107, 90, 78, 2, 286,
+    2, 171, 171, 171, 171, 49, 171, 171, 9, 171, 171, 23, 171, 171, 171, 171,
     0, 80, 171, 171, 50, 171, 171, 171, 171, 171, 171, 171, 38, 171, 171, 171,
     171, 29, 43, 171, 171, 171, 171, 171, 22, 171, 36, 171, 39, 171, 171, 171,
     72, 171, 171, 171, 171, 171, 13, 48, 27, 171, 171, 171, 171, 171, 171, 171,
@@ -1732,17 +1773,17 @@ extern token_type_t const lexer_transition_table[51408] = {
     171, 51, 171, 171, 171, 171, 171, 171, 34, 171, 7, 171, 171, 10, 171, 171,
     171, 171, 31, 171, 24, 171, 171, 171, 15, 171, 171, 171, 171, 171, 12, 171,
     171, 171, 171, 33, 171, 171, 171, 32, 171, 30, 171, 171, 171, 11, 171, 171,
-    171, 171, 171, 37, 26, 40, 0, 0, 456, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 119, 101, 456, 456, 456,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 248, 501, 248, 248, 248, 248, 248, 517, 248, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 456, 456, 456, 248, 248,
-    248, 248, 248, 575, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 456, 456, 456, 248, 248, 0,
-    111, 104, 112, 248, 0, 103, 109, 118, 129, 248, 248, 248, 100, 0, 248, 248,
-    577, 248, 248, 532, 173, 125, 248, 584, 248, 248, 0, 114, 175, 248, 248, 248,
-    248, 546, 248, 248, 248, 248, 248, 126, 175, 456, 456, 94, 0, 2, 95, 123,
-    2, 174, 113, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    171, 171, 171, 37, 26, 40, 0, 0, 455, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 0, 103, 109, 130, 101,
+    119, 455, 455, 455, 247, 486, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 511, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 455,
+    455, 455, 531, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 455, 455,
+    455, 247, 247, 0, 111, 104, 112, 247, 118, 129, 100, 247, 247, 247, 0, 175,
+    247, 247, 247, 541, 247, 247, 94, 173, 125, 0, 247, 247, 247, 247, 124, 175,
+    247, 247, 247, 114, 126, 247, 247, 247, 247, 247, 247, 247, 122, 455, 455, 2,
+    95, 123, 0, 174, 4, 113, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -1755,70 +1796,32 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 171, 116, 256, 1, 4, 4, 5, 79, 68, 127, 66, 124,
-    174, 122, 3, 223, 3, 3, 0, 0, 105, 69, 93, 131, 96, 98, 71, 99,
-    82, 97, 173, 65, 70, 108, 121, 110, 81, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 248, 481, 248, 91, 92, 106, 248, 67, 171, 171, 171, 171, 171,
-    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 89, 107,
-    90, 78, 2, 287, 130, 171, 171, 171, 171, 49, 171, 171, 9, 171, 171, 23,
-    171, 171, 171, 171, 0, 80, 171, 171, 50, 171, 171, 171, 171, 171, 171, 171,
-    38, 171, 171, 171, 171, 29, 43, 171, 171, 171, 171, 171, 22, 171, 36, 171,
-    39, 171, 171, 171, 72, 171, 171, 171, 171, 171, 13, 48, 27, 171, 171, 171,
-    171, 171, 171, 171, 35, 171, 171, 25, 171, 17, 171, 171, 171, 171, 171, 171,
-    171, 47, 171, 171, 171, 171, 16, 41, 171, 42, 171, 44, 171, 171, 74, 171,
-    171, 20, 6, 171, 18, 171, 171, 19, 171, 171, 171, 14, 171, 8, 171, 21,
-    171, 171, 28, 171, 171, 51, 171, 171, 171, 171, 171, 171, 34, 171, 7, 171,
-    171, 10, 171, 171, 171, 171, 31, 171, 24, 171, 171, 171, 15, 171, 171, 171,
-    171, 171, 12, 171, 171, 171, 171, 33, 171, 171, 171, 32, 171, 30, 171, 171,
-    171, 11, 171, 171, 171, 171, 171, 37, 26, 40, 0, 0, 456, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 119,
-    101, 456, 456, 456, 248, 483, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 508, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 456,
-    456, 456, 528, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 456, 456,
-    456, 248, 248, 0, 111, 104, 112, 248, 0, 103, 109, 118, 129, 248, 248, 248,
-    100, 0, 248, 248, 248, 538, 248, 248, 173, 125, 248, 248, 248, 248, 0, 114,
-    175, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 126, 175, 456, 456, 94,
-    0, 2, 95, 123, 2, 174, 113, 4, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 171, 116, 257, 1, 4, 4, 5, 79,
-    68, 127, 66, 124, 174, 122, 3, 223, 3, 3, 0, 0, 105, 69, 93, 131,
-    96, 98, 71, 99, 82, 97, 173, 65, 70, 108, 121, 110, 81, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 91, 92, 106, 248, 67, 171,
-    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
-    171, 171, 89, 107, 90, 78, 2, 287, 130, 171, 171, 171, 171, 49, 171, 171,
-    9, 171, 171, 23, 171, 171, 171, 171, 0, 80, 171, 171, 50, 171, 171, 171,
-    171, 171, 171, 171, 38, 171, 171, 171, 171, 29, 43, 171, 171, 171, 171, 171,
-    22, 171, 36, 171, 39, 171, 171, 171, 72, 171, 171, 171, 171, 171, 13, 48,
-    27, 171, 171, 171, 171, 171, 171, 171, 35, 171, 171, 25, 171, 17, 171, 171,
-    171, 171, 171, 171, 171, 47, 171, 171, 171, 171, 16, 41, 171, 42, 171, 44,
-    171, 171, 74, 171, 171, 20, 6, 171, 18, 171, 171, 19, 171, 171, 171, 14,
-    171, 8, 171, 21, 171, 171, 28, 171, 171, 51, 171, 171, 171, 171, 171, 171,
-    34, 171, 7, 171, 171, 10, 171, 171, 171, 171, 31, 171, 24, 171, 171, 171,
-    15, 171, 171, 171, 171, 171, 12, 171, 171, 171, 171, 33, 171, 171, 171, 32,
-    171, 30, 171, 171, 171, 11, 171, 171, 171, 171, 171, 37, 26, 40, 0, 0,
-    456, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0,
-    0, 45, 128, 119, 101, 456, 456, 456, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 456, 456, 456, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 456, 456, 456, 248, 248, 0, 111, 104, 112, 248, 0, 103, 109, 118,
-    129, 248, 248, 248, 100, 0, 248, 248, 248, 248, 248, 248, 173, 125, 248, 248,
-    248, 248, 0, 114, 175, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 126,
-    175, 456, 456, 94, 0, 2, 95, 123, 2, 174, 113, 4, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 171, 116, 256, 1, 4, 4, 5, 79, 127,
+    68, 66, 174, 3, 222, 3, 3, 0, 0, 105, 69, 93, 131, 96, 98, 71,
+    99, 82, 97, 173, 65, 70, 108, 121, 110, 81, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 91, 92, 106, 247, 67, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 89,
+    107, 90, 78, 2, 286, 2, 171, 171, 171, 171, 49, 171, 171, 9, 171, 171,
+    23, 171, 171, 171, 171, 0, 80, 171, 171, 50, 171, 171, 171, 171, 171, 171,
+    171, 38, 171, 171, 171, 171, 29, 43, 171, 171, 171, 171, 171, 22, 171, 36,
+    171, 39, 171, 171, 171, 72, 171, 171, 171, 171, 171, 13, 48, 27, 171, 171,
+    171, 171, 171, 171, 171, 35, 171, 171, 25, 171, 17, 171, 171, 171, 171, 171,
+    171, 171, 47, 171, 171, 171, 171, 16, 41, 171, 42, 171, 44, 171, 171, 74,
+    171, 171, 20, 6, 171, 18, 171, 171, 19, 171, 171, 171, 14, 171, 8, 171,
+    21, 171, 171, 28, 171, 171, 51, 171, 171, 171, 171, 171, 171, 34, 171, 7,
+    171, 171, 10, 171, 171, 171, 171, 31, 171, 24, 171, 171, 171, 15, 171, 171,
+    171, 171, 171, 12, 171, 171, 171, 171, 33, 171, 171, 171, 32, 171, 30, 171,
+    171, 171, 11, 171, 171, 171, 171, 171, 37, 26, 40, 0, 0, 455, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128,
+    0, 103, 109, 130, 101, 119, 455, 455, 455, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 455, 455, 455, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 455, 455, 455, 247, 247, 0, 111, 104, 112, 247, 118, 129, 100,
+    247, 247, 247, 0, 175, 247, 247, 247, 247, 247, 247, 94, 173, 125, 0, 247,
+    247, 247, 247, 124, 175, 247, 247, 247, 114, 126, 247, 247, 247, 247, 247, 247,
+    247, 122, 455, 455, 2, 95, 123, 0, 174, 4, 113, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -1831,32 +1834,32 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 171, 116, 248, 1,
-    4, 4, 5, 79, 68, 127, 66, 124, 174, 122, 3, 223, 3, 3, 0, 0,
-    105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65, 70, 108, 121, 110,
-    81, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 91, 92,
-    106, 248, 67, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
-    171, 171, 171, 171, 171, 171, 89, 107, 90, 78, 2, 287, 130, 171, 171, 171,
-    171, 49, 171, 171, 9, 171, 171, 23, 171, 171, 171, 171, 0, 80, 171, 171,
-    50, 171, 171, 171, 171, 171, 171, 171, 38, 171, 171, 171, 171, 29, 43, 171,
-    171, 171, 171, 171, 22, 171, 36, 171, 39, 171, 171, 171, 72, 171, 171, 171,
-    171, 171, 13, 48, 27, 171, 171, 171, 171, 171, 171, 171, 35, 171, 171, 25,
-    171, 17, 171, 171, 171, 171, 171, 171, 171, 47, 171, 171, 171, 171, 16, 41,
-    171, 42, 171, 44, 171, 171, 74, 171, 171, 20, 6, 171, 18, 171, 171, 19,
-    171, 171, 171, 14, 171, 8, 171, 21, 171, 171, 28, 171, 171, 51, 171, 171,
-    171, 171, 171, 171, 34, 171, 7, 171, 171, 10, 171, 171, 171, 171, 31, 171,
-    24, 171, 171, 171, 15, 171, 171, 171, 171, 171, 12, 171, 171, 171, 171, 33,
-    171, 171, 171, 32, 171, 30, 171, 171, 171, 11, 171, 171, 171, 171, 171, 37,
-    26, 40, 0, 0, 456, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    46, 0, 0, 0, 0, 45, 128, 119, 101, 456, 456, 456, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 513, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 456, 456, 456, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 456, 456, 456, 248, 248, 0, 111, 104, 112, 248,
-    0, 103, 109, 118, 129, 248, 248, 248, 100, 0, 248, 248, 248, 248, 248, 248,
-    173, 125, 248, 248, 248, 248, 0, 114, 175, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 126, 175, 456, 456, 94, 0, 2, 95, 123, 2, 174, 113, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 171, 116, 247, 1,
+    4, 4, 5, 79, 127, 68, 66, 174, 3, 222, 3, 3, 0, 0, 105, 69,
+    93, 131, 96, 98, 71, 99, 82, 97, 173, 65, 70, 108, 121, 110, 81, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 91, 92, 106, 247,
+    67, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 89, 107, 90, 78, 2, 286, 2, 171, 171, 171, 171, 49,
+    171, 171, 9, 171, 171, 23, 171, 171, 171, 171, 0, 80, 171, 171, 50, 171,
+    171, 171, 171, 171, 171, 171, 38, 171, 171, 171, 171, 29, 43, 171, 171, 171,
+    171, 171, 22, 171, 36, 171, 39, 171, 171, 171, 72, 171, 171, 171, 171, 171,
+    13, 48, 27, 171, 171, 171, 171, 171, 171, 171, 35, 171, 171, 25, 171, 17,
+    171, 171, 171, 171, 171, 171, 171, 47, 171, 171, 171, 171, 16, 41, 171, 42,
+    171, 44, 171, 171, 74, 171, 171, 20, 6, 171, 18, 171, 171, 19, 171, 171,
+    171, 14, 171, 8, 171, 21, 171, 171, 28, 171, 171, 51, 171, 171, 171, 171,
+    171, 171, 34, 171, 7, 171, 171, 10, 171, 171, 171, 171, 31, 171, 24, 171,
+    171, 171, 15, 171, 171, 171, 171, 171, 12, 171, 171, 171, 171, 33, 171, 171,
+    171, 32, 171, 30, 171, 171, 171, 11, 171, 171, 171, 171, 171, 37, 26, 40,
+    0, 0, 455, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0,
+    0, 0, 0, 45, 128, 0, 103, 109, 130, 101, 119, 455, 455, 455, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 516, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 455, 455, 455, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 455, 455, 455, 247, 247, 0, 111, 104,
+    112, 247, 118, 129, 100, 247, 247, 247, 0, 175, 247, 247, 247, 247, 247, 247,
+    94, 173, 125, 0, 247, 247, 247, 247, 124, 175, 247, 247, 247, 114, 126, 247,
+    247, 247, 247, 247, 247, 247, 122, 455, 455, 2, 95, 123, 0, 174, 4, 113,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -1870,32 +1873,32 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    171, 116, 248, 1, 4, 4, 5, 79, 68, 127, 66, 124, 174, 122, 3, 223,
-    3, 3, 0, 0, 105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65,
-    70, 108, 121, 110, 81, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 499,
-    248, 248, 91, 92, 106, 248, 67, 171, 171, 171, 171, 171, 171, 171, 171, 171,
-    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 89, 107, 90, 78, 2, 287,
-    130, 171, 171, 171, 171, 49, 171, 171, 9, 171, 171, 23, 171, 171, 171, 171,
-    0, 80, 171, 171, 50, 171, 171, 171, 171, 171, 171, 171, 38, 171, 171, 171,
-    171, 29, 43, 171, 171, 171, 171, 171, 22, 171, 36, 171, 39, 171, 171, 171,
-    72, 171, 171, 171, 171, 171, 13, 48, 27, 171, 171, 171, 171, 171, 171, 171,
-    35, 171, 171, 25, 171, 17, 171, 171, 171, 171, 171, 171, 171, 47, 171, 171,
-    171, 171, 16, 41, 171, 42, 171, 44, 171, 171, 74, 171, 171, 20, 6, 171,
-    18, 171, 171, 19, 171, 171, 171, 14, 171, 8, 171, 21, 171, 171, 28, 171,
-    171, 51, 171, 171, 171, 171, 171, 171, 34, 171, 7, 171, 171, 10, 171, 171,
-    171, 171, 31, 171, 24, 171, 171, 171, 15, 171, 171, 171, 171, 171, 12, 171,
-    171, 171, 171, 33, 171, 171, 171, 32, 171, 30, 171, 171, 171, 11, 171, 171,
-    171, 171, 171, 37, 26, 40, 0, 0, 456, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 119, 101, 456, 456, 456,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 521, 248, 248, 456, 456, 456, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 456, 456, 456, 248, 248, 0,
-    111, 104, 112, 248, 0, 103, 109, 118, 129, 248, 248, 248, 100, 0, 248, 248,
-    248, 248, 248, 248, 173, 125, 248, 248, 248, 248, 0, 114, 175, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 126, 175, 456, 456, 94, 0, 2, 95, 123,
-    2, 174, 113, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 171, 116, 247, 1, 4, 4, 5, 79, 127, 68, 66, 174, 3, 222, 3,
+    3, 0, 0, 105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65, 70,
+    108, 121, 110, 81, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 502, 247,
+    247, 91, 92, 106, 247, 67, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 89, 107, 90, 78, 2, 286, 2,
+    171, 171, 171, 171, 49, 171, 171, 9, 171, 171, 23, 171, 171, 171, 171, 0,
+    80, 171, 171, 50, 171, 171, 171, 171, 171, 171, 171, 38, 171, 171, 171, 171,
+    29, 43, 171, 171, 171, 171, 171, 22, 171, 36, 171, 39, 171, 171, 171, 72,
+    171, 171, 171, 171, 171, 13, 48, 27, 171, 171, 171, 171, 171, 171, 171, 35,
+    171, 171, 25, 171, 17, 171, 171, 171, 171, 171, 171, 171, 47, 171, 171, 171,
+    171, 16, 41, 171, 42, 171, 44, 171, 171, 74, 171, 171, 20, 6, 171, 18,
+    171, 171, 19, 171, 171, 171, 14, 171, 8, 171, 21, 171, 171, 28, 171, 171,
+    51, 171, 171, 171, 171, 171, 171, 34, 171, 7, 171, 171, 10, 171, 171, 171,
+    171, 31, 171, 24, 171, 171, 171, 15, 171, 171, 171, 171, 171, 12, 171, 171,
+    171, 171, 33, 171, 171, 171, 32, 171, 30, 171, 171, 171, 11, 171, 171, 171,
+    171, 171, 37, 26, 40, 0, 0, 455, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 0, 103, 109, 130, 101, 119,
+    455, 455, 455, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 524, 247, 247, 455, 455,
+    455, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 455, 455, 455,
+    247, 247, 0, 111, 104, 112, 247, 118, 129, 100, 247, 247, 247, 0, 175, 247,
+    247, 247, 247, 247, 247, 94, 173, 125, 0, 247, 247, 247, 247, 124, 175, 247,
+    247, 247, 114, 126, 247, 247, 247, 247, 247, 247, 247, 122, 455, 455, 2, 95,
+    123, 0, 174, 4, 113, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -1908,12 +1911,12 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 171, 116, 258, 1, 4, 4, 5, 79, 68, 127, 66, 124,
-    174, 122, 3, 223, 3, 3, 0, 0, 105, 69, 93, 131, 96, 98, 71, 99,
+    0, 0, 0, 0, 0, 0, 171, 116, 257, 1, 4, 4, 5, 79, 127, 68,
+    66, 174, 3, 222, 3, 3, 0, 0, 105, 69, 93, 131, 96, 98, 71, 99,
     82, 97, 173, 65, 70, 108, 121, 110, 81, 171, 171, 171, 171, 133, 171, 171,
     171, 171, 171, 148, 136, 171, 91, 92, 106, 0, 67, 171, 171, 171, 171, 171,
     171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 89, 107,
-    90, 78, 2, 287, 130, 171, 171, 171, 171, 49, 171, 171, 9, 171, 171, 23,
+    90, 78, 2, 286, 2, 171, 171, 171, 171, 49, 171, 171, 9, 171, 171, 23,
     171, 171, 171, 171, 0, 80, 171, 171, 50, 171, 171, 171, 171, 171, 171, 171,
     38, 171, 171, 171, 171, 29, 43, 171, 171, 171, 171, 171, 22, 171, 36, 171,
     39, 171, 171, 171, 72, 171, 171, 171, 171, 171, 13, 48, 27, 171, 171, 171,
@@ -1924,16 +1927,16 @@ extern token_type_t const lexer_transition_table[51408] = {
     171, 10, 171, 171, 171, 171, 31, 171, 24, 171, 171, 171, 15, 171, 171, 171,
     171, 171, 12, 171, 171, 171, 171, 33, 171, 171, 171, 32, 171, 30, 171, 171,
     171, 11, 171, 171, 171, 171, 171, 37, 26, 40, 0, 0, 172, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 119,
-    101, 172, 172, 132, 139, 137, 140, 138, 141, 144, 147, 143, 146, 157, 153, 155,
-    142, 145, 171, 152, 150, 151, 149, 171, 171, 171, 171, 171, 171, 171, 171, 171,
-    171, 171, 171, 171, 171, 171, 64, 171, 62, 171, 171, 61, 171, 63, 158, 172,
-    172, 169, 162, 163, 171, 171, 171, 171, 171, 171, 171, 56, 171, 52, 171, 171,
-    171, 171, 55, 54, 171, 171, 171, 171, 171, 58, 134, 135, 164, 165, 172, 172,
-    170, 160, 161, 0, 111, 104, 112, 154, 0, 103, 109, 118, 129, 171, 156, 159,
-    100, 0, 171, 171, 171, 171, 171, 171, 173, 125, 53, 171, 171, 57, 0, 114,
-    175, 171, 171, 171, 171, 171, 171, 60, 59, 166, 167, 126, 175, 172, 168, 94,
-    0, 2, 95, 123, 2, 174, 113, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 0,
+    103, 109, 130, 101, 119, 172, 172, 132, 139, 137, 140, 138, 141, 144, 147, 143,
+    146, 157, 153, 155, 142, 145, 171, 152, 150, 151, 149, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 64, 171, 62, 171, 171, 61,
+    171, 63, 158, 172, 172, 169, 162, 163, 171, 171, 171, 171, 171, 171, 171, 56,
+    171, 52, 171, 171, 171, 171, 55, 54, 171, 171, 171, 171, 171, 58, 134, 135,
+    164, 165, 172, 172, 170, 160, 161, 0, 111, 104, 112, 154, 118, 129, 100, 171,
+    156, 159, 0, 175, 171, 171, 171, 171, 171, 171, 94, 173, 125, 0, 53, 171,
+    171, 57, 124, 175, 171, 171, 171, 114, 126, 171, 171, 171, 60, 59, 166, 167,
+    122, 172, 168, 2, 95, 123, 0, 174, 4, 113, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -1946,33 +1949,32 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 171, 116, 259, 1, 4, 4, 5, 79,
-    68, 127, 66, 124, 174, 122, 3, 223, 3, 3, 0, 0, 105, 69, 93, 131,
-    96, 98, 71, 99, 82, 97, 173, 65, 70, 108, 121, 110, 81, 171, 171, 171,
-    171, 133, 171, 171, 171, 171, 171, 148, 136, 171, 91, 92, 106, 0, 67, 171,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 171, 116, 258, 1, 4,
+    4, 5, 79, 127, 68, 66, 174, 3, 222, 3, 3, 0, 0, 105, 69, 93,
+    131, 96, 98, 71, 99, 82, 97, 173, 65, 70, 108, 121, 110, 81, 171, 171,
+    171, 171, 133, 171, 171, 171, 171, 171, 148, 136, 171, 91, 92, 106, 0, 67,
     171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
-    171, 171, 89, 107, 90, 78, 2, 287, 130, 171, 171, 171, 171, 49, 171, 171,
-    9, 171, 171, 23, 171, 171, 171, 171, 0, 80, 171, 171, 50, 171, 171, 171,
-    171, 171, 171, 171, 38, 171, 171, 171, 171, 29, 43, 171, 171, 171, 171, 171,
-    22, 171, 36, 171, 39, 171, 171, 171, 72, 171, 171, 171, 171, 171, 13, 48,
-    27, 171, 171, 171, 171, 171, 171, 171, 35, 171, 171, 25, 171, 17, 171, 171,
-    171, 171, 171, 171, 171, 47, 171, 171, 171, 171, 16, 41, 171, 42, 171, 44,
-    171, 171, 74, 171, 171, 20, 6, 171, 18, 171, 171, 19, 171, 171, 171, 14,
-    171, 8, 171, 21, 171, 171, 28, 171, 171, 51, 171, 171, 171, 171, 171, 171,
-    34, 171, 7, 171, 171, 10, 171, 171, 171, 171, 31, 171, 24, 171, 171, 171,
-    15, 171, 171, 171, 171, 171, 12, 171, 171, 171, 171, 33, 171, 171, 171, 32,
-    171, 30, 171, 171, 171, 11, 171, 171, 171, 171, 171, 37, 26, 40, 0, 0,
-    172, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0,
-    0, 45, 128, 119, 101, 172, 172, 132, 139, 137, 140, 138, 141, 144, 147, 143,
-    146, 157, 153, 155, 142, 145, 171, 152, 150, 151, 149, 171, 171, 171, 171, 171,
-    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 64, 171, 62, 171, 171, 61,
-    171, 63, 158, 172, 172, 169, 162, 163, 171, 171, 171, 171, 171, 171, 171, 56,
-    171, 52, 171, 171, 171, 171, 55, 54, 171, 171, 171, 171, 171, 58, 134, 135,
-    164, 165, 172, 172, 170, 160, 161, 0, 111, 104, 112, 154, 0, 103, 109, 118,
-    129, 171, 156, 159, 100, 0, 171, 171, 171, 171, 171, 171, 173, 125, 53, 171,
-    171, 57, 0, 114, 175, 171, 171, 171, 171, 171, 171, 60, 59, 166, 167, 126,
-    175, 172, 168, 94, 0, 2, 95, 123, 2, 174, 113, 4, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    171, 171, 171, 89, 107, 90, 78, 2, 286, 2, 171, 171, 171, 171, 49, 171,
+    171, 9, 171, 171, 23, 171, 171, 171, 171, 0, 80, 171, 171, 50, 171, 171,
+    171, 171, 171, 171, 171, 38, 171, 171, 171, 171, 29, 43, 171, 171, 171, 171,
+    171, 22, 171, 36, 171, 39, 171, 171, 171, 72, 171, 171, 171, 171, 171, 13,
+    48, 27, 171, 171, 171, 171, 171, 171, 171, 35, 171, 171, 25, 171, 17, 171,
+    171, 171, 171, 171, 171, 171, 47, 171, 171, 171, 171, 16, 41, 171, 42, 171,
+    44, 171, 171, 74, 171, 171, 20, 6, 171, 18, 171, 171, 19, 171, 171, 171,
+    14, 171, 8, 171, 21, 171, 171, 28, 171, 171, 51, 171, 171, 171, 171, 171,
+    171, 34, 171, 7, 171, 171, 10, 171, 171, 171, 171, 31, 171, 24, 171, 171,
+    171, 15, 171, 171, 171, 171, 171, 12, 171, 171, 171, 171, 33, 171, 171, 171,
+    32, 171, 30, 171, 171, 171, 11, 171, 171, 171, 171, 171, 37, 26, 40, 0,
+    0, 172, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0,
+    0, 0, 45, 128, 0, 103, 109, 130, 101, 119, 172, 172, 132, 139, 137, 140,
+    138, 141, 144, 147, 143, 146, 157, 153, 155, 142, 145, 171, 152, 150, 151, 149,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 64,
+    171, 62, 171, 171, 61, 171, 63, 158, 172, 172, 169, 162, 163, 171, 171, 171,
+    171, 171, 171, 171, 56, 171, 52, 171, 171, 171, 171, 55, 54, 171, 171, 171,
+    171, 171, 58, 134, 135, 164, 165, 172, 172, 170, 160, 161, 0, 111, 104, 112,
+    154, 118, 129, 100, 171, 156, 159, 0, 175, 171, 171, 171, 171, 171, 171, 94,
+    173, 125, 0, 53, 171, 171, 57, 124, 175, 171, 171, 171, 114, 126, 171, 171,
+    171, 60, 59, 166, 167, 122, 172, 168, 2, 95, 123, 0, 174, 4, 113, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -1984,37 +1986,34 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 171, 116, 260, 1,
-    4, 4, 5, 79, 68, 127, 66, 124, 174, 122, 3, 223, 3, 3, 0, 0,
-    105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65, 70, 108, 121, 110,
-    81, 171, 171, 171, 171, 133, 171, 171, 171, 171, 171, 148, 136, 171, 91, 92,
-    106, 0, 67, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
-    171, 171, 171, 171, 171, 171, 89, 107, 90, 78, 2, 287, 130, 171, 171, 171,
-    171, 49, 171, 171, 9, 171, 171, 23, 171, 171, 171, 171, 0, 80, 171, 171,
-    50, 171, 171, 171, 171, 171, 171, 171, 38, 171, 171, 171, 171, 29, 43, 171,
-    171, 171, 171, 171, 22, 171, 36, 171, 39, 171, 171, 171, 72, 171, 171, 171,
-    171, 171, 13, 48, 27, 171, 171, 171, 171, 171, 171, 171, 35, 171, 171, 25,
-    171, 17, 171, 171, 171, 171, 171, 171, 171, 47, 171, 171, 171, 171, 16, 41,
-    171, 42, 171, 44, 171, 171, 74, 171, 171, 20, 6, 171, 18, 171, 171, 19,
-    171, 171, 171, 14, 171, 8, 171, 21, 171, 171, 28, 171, 171, 51, 171, 171,
-    171, 171, 171, 171, 34, 171, 7, 171, 171, 10, 171, 171, 171, 171, 31, 171,
-    24, 171, 171, 171, 15, 171, 171, 171, 171, 171, 12, 171, 171, 171, 171, 33,
-    171, 171, 171, 32, 171, 30, 171, 171, 171, 11, 171, 171, 171, 171, 171, 37,
-    26, 40, 0, 0, 172, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    46, 0, 0, 0, 0, 45, 128, 119, 101, 172, 172, 132, 139, 137, 140, 138,
-    141, 144, 147, 143, 146, 157, 153, 155, 142, 145, 171, 152, 150, 151, 149, 171,
-    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 64, 171,
-    62, 171, 171, 61, 171, 63, 158, 172, 172, 169, 162, 163, 171, 171, 171, 171,
-    171, 171, 171, 56, 171, 52, 171, 171, 171, 171, 55, 54, 171, 171, 171, 171,
-    171, 58, 134, 135, 164, 165, 172, 172, 170, 160, 161, 0, 111, 104, 112, 154,
-    0, 103, 109, 118, 129, 171, 156, 159, 100, 0, 171, 171, 171, 171, 171, 171,
-    173, 125, 53, 171, 171, 57, 0, 114, 175, 171, 171, 171, 171, 171, 171, 60,
-    59, 166, 167, 126, 175, 172, 168, 94, 0, 2, 95, 123, 2, 174, 113, 4,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    171, 116, 259, 1, 4, 4, 5, 79, 127, 68, 66, 174, 3, 222, 3, 3,
+    0, 0, 105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65, 70, 108,
+    121, 110, 81, 171, 171, 171, 171, 133, 171, 171, 171, 171, 171, 148, 136, 171,
+    91, 92, 106, 0, 67, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 89, 107, 90, 78, 2, 286, 2, 171,
+    171, 171, 171, 49, 171, 171, 9, 171, 171, 23, 171, 171, 171, 171, 0, 80,
+    171, 171, 50, 171, 171, 171, 171, 171, 171, 171, 38, 171, 171, 171, 171, 29,
+    43, 171, 171, 171, 171, 171, 22, 171, 36, 171, 39, 171, 171, 171, 72, 171,
+    171, 171, 171, 171, 13, 48, 27, 171, 171, 171, 171, 171, 171, 171, 35, 171,
+    171, 25, 171, 17, 171, 171, 171, 171, 171, 171, 171, 47, 171, 171, 171, 171,
+    16, 41, 171, 42, 171, 44, 171, 171, 74, 171, 171, 20, 6, 171, 18, 171,
+    171, 19, 171, 171, 171, 14, 171, 8, 171, 21, 171, 171, 28, 171, 171, 51,
+    171, 171, 171, 171, 171, 171, 34, 171, 7, 171, 171, 10, 171, 171, 171, 171,
+    31, 171, 24, 171, 171, 171, 15, 171, 171, 171, 171, 171, 12, 171, 171, 171,
+    171, 33, 171, 171, 171, 32, 171, 30, 171, 171, 171, 11, 171, 171, 171, 171,
+    171, 37, 26, 40, 0, 0, 172, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 46, 0, 0, 0, 0, 45, 128, 0, 103, 109, 130, 101, 119, 172,
+    172, 132, 139, 137, 140, 138, 141, 144, 147, 143, 146, 157, 153, 155, 142, 145,
+    171, 152, 150, 151, 149, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 64, 171, 62, 171, 171, 61, 171, 63, 158, 172, 172, 169,
+    162, 163, 171, 171, 171, 171, 171, 171, 171, 56, 171, 52, 171, 171, 171, 171,
+    55, 54, 171, 171, 171, 171, 171, 58, 134, 135, 164, 165, 172, 172, 170, 160,
+    161, 0, 111, 104, 112, 154, 118, 129, 100, 171, 156, 159, 0, 175, 171, 171,
+    171, 171, 171, 171, 94, 173, 125, 0, 53, 171, 171, 57, 124, 175, 171, 171,
+    171, 114, 126, 171, 171, 171, 60, 59, 166, 167, 122, 172, 168, 2, 95, 123,
+    0, 174, 4, 113, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -2023,36 +2022,36 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    208, 116, 261, 1, 4, 4, 5, 79, 68, 127, 66, 124, 174, 122, 3, 223,
-    3, 3, 0, 0, 105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65,
-    70, 108, 121, 110, 81, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 91, 92, 106, 455, 67, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 89, 107, 90, 78, 2, 287,
-    130, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    0, 80, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 358, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 0, 0, 456, 0, 0, 0, 0, 462, 0, 0,
-    0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 119, 101, 456, 456, 456,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 504, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 456, 456, 456, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 456, 456, 456, 248, 248, 0,
-    111, 104, 112, 248, 0, 103, 109, 118, 129, 248, 248, 248, 100, 0, 248, 248,
-    248, 248, 248, 248, 173, 125, 248, 248, 248, 248, 0, 114, 175, 248, 248, 248,
-    248, 248, 248, 248, 248, 248, 248, 126, 175, 456, 456, 94, 0, 2, 95, 123,
-    2, 174, 113, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 209, 116, 260, 1, 4, 4, 5, 79, 127, 68, 66,
+    174, 3, 222, 3, 3, 0, 0, 105, 69, 93, 131, 96, 98, 71, 99, 82,
+    97, 173, 65, 70, 108, 121, 110, 81, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 91, 92, 106, 454, 67, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 89, 107, 90,
+    78, 2, 286, 2, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 0, 80, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 357, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 0, 0, 455, 0, 0, 0, 0,
+    461, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 0, 103,
+    109, 130, 101, 119, 455, 455, 455, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 507, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 455, 455, 455, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 455, 455, 455, 247, 247, 0, 111, 104, 112, 247, 118, 129, 100, 247, 247,
+    247, 0, 175, 247, 247, 247, 247, 247, 247, 94, 173, 125, 0, 247, 247, 247,
+    247, 124, 175, 247, 247, 247, 114, 126, 247, 247, 247, 247, 247, 247, 247, 122,
+    455, 455, 2, 95, 123, 0, 174, 4, 113, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -2061,36 +2060,36 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 171, 116, 262, 1, 4, 4, 5, 79, 68, 127, 66, 124,
-    174, 122, 3, 223, 3, 3, 0, 0, 105, 69, 93, 131, 96, 98, 71, 99,
-    82, 97, 173, 65, 70, 108, 121, 110, 81, 171, 171, 171, 171, 133, 171, 171,
-    171, 171, 171, 148, 136, 171, 91, 92, 106, 0, 67, 171, 171, 171, 171, 171,
-    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 89, 107,
-    90, 78, 2, 287, 130, 171, 171, 171, 171, 49, 171, 171, 9, 171, 171, 23,
-    171, 171, 171, 171, 0, 80, 171, 171, 50, 171, 171, 171, 171, 171, 171, 171,
-    38, 171, 171, 171, 171, 29, 43, 171, 171, 171, 171, 171, 22, 171, 36, 171,
-    39, 171, 171, 171, 72, 171, 171, 171, 171, 171, 13, 48, 27, 171, 171, 171,
-    171, 171, 171, 171, 35, 171, 171, 25, 171, 17, 171, 171, 171, 171, 171, 171,
-    171, 47, 171, 171, 171, 171, 16, 41, 171, 42, 171, 44, 171, 171, 74, 171,
-    171, 20, 6, 171, 18, 171, 171, 19, 171, 171, 171, 14, 171, 8, 171, 21,
-    171, 171, 28, 171, 171, 51, 171, 171, 171, 171, 171, 171, 34, 171, 7, 171,
-    171, 10, 171, 171, 171, 171, 31, 171, 24, 171, 171, 171, 15, 171, 171, 171,
-    171, 171, 12, 171, 171, 171, 171, 33, 171, 171, 171, 32, 171, 30, 171, 171,
-    171, 11, 171, 171, 171, 171, 171, 37, 26, 40, 0, 0, 172, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 119,
-    101, 172, 172, 132, 139, 137, 140, 138, 141, 144, 147, 143, 146, 157, 153, 155,
-    142, 145, 171, 152, 150, 151, 149, 171, 171, 171, 171, 171, 171, 171, 171, 171,
-    171, 171, 171, 171, 171, 171, 64, 171, 62, 171, 171, 61, 171, 63, 158, 172,
-    172, 169, 162, 163, 171, 171, 171, 171, 171, 171, 171, 56, 171, 52, 171, 171,
-    171, 171, 55, 54, 171, 171, 171, 171, 171, 58, 134, 135, 164, 165, 172, 172,
-    170, 160, 161, 0, 111, 104, 112, 154, 0, 103, 109, 118, 129, 171, 156, 159,
-    100, 0, 171, 171, 171, 171, 171, 171, 173, 125, 53, 171, 171, 57, 0, 114,
-    175, 171, 171, 171, 171, 171, 171, 60, 59, 166, 167, 126, 175, 172, 168, 94,
-    0, 2, 95, 123, 2, 174, 113, 4, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 171, 116, 261, 1, 4, 4,
+    5, 79, 127, 68, 66, 174, 3, 222, 3, 3, 0, 0, 105, 69, 93, 131,
+    96, 98, 71, 99, 82, 97, 173, 65, 70, 108, 121, 110, 81, 171, 171, 171,
+    171, 133, 171, 171, 171, 171, 171, 148, 136, 171, 91, 92, 106, 0, 67, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 89, 107, 90, 78, 2, 286, 2, 171, 171, 171, 171, 49, 171, 171,
+    9, 171, 171, 23, 171, 171, 171, 171, 0, 80, 171, 171, 50, 171, 171, 171,
+    171, 171, 171, 171, 38, 171, 171, 171, 171, 29, 43, 171, 171, 171, 171, 171,
+    22, 171, 36, 171, 39, 171, 171, 171, 72, 171, 171, 171, 171, 171, 13, 48,
+    27, 171, 171, 171, 171, 171, 171, 171, 35, 171, 171, 25, 171, 17, 171, 171,
+    171, 171, 171, 171, 171, 47, 171, 171, 171, 171, 16, 41, 171, 42, 171, 44,
+    171, 171, 74, 171, 171, 20, 6, 171, 18, 171, 171, 19, 171, 171, 171, 14,
+    171, 8, 171, 21, 171, 171, 28, 171, 171, 51, 171, 171, 171, 171, 171, 171,
+    34, 171, 7, 171, 171, 10, 171, 171, 171, 171, 31, 171, 24, 171, 171, 171,
+    15, 171, 171, 171, 171, 171, 12, 171, 171, 171, 171, 33, 171, 171, 171, 32,
+    171, 30, 171, 171, 171, 11, 171, 171, 171, 171, 171, 37, 26, 40, 0, 0,
+    172, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0,
+    0, 45, 128, 0, 103, 109, 130, 101, 119, 172, 172, 132, 139, 137, 140, 138,
+    141, 144, 147, 143, 146, 157, 153, 155, 142, 145, 171, 152, 150, 151, 149, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 64, 171,
+    62, 171, 171, 61, 171, 63, 158, 172, 172, 169, 162, 163, 171, 171, 171, 171,
+    171, 171, 171, 56, 171, 52, 171, 171, 171, 171, 55, 54, 171, 171, 171, 171,
+    171, 58, 134, 135, 164, 165, 172, 172, 170, 160, 161, 0, 111, 104, 112, 154,
+    118, 129, 100, 171, 156, 159, 0, 175, 171, 171, 171, 171, 171, 171, 94, 173,
+    125, 0, 53, 171, 171, 57, 124, 175, 171, 171, 171, 114, 126, 171, 171, 171,
+    60, 59, 166, 167, 122, 172, 168, 2, 95, 123, 0, 174, 4, 113, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -2099,36 +2098,37 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 208, 116, 263, 1, 4, 4, 5, 79,
-    68, 127, 66, 124, 220, 122, 3, 223, 3, 3, 220, 0, 105, 69, 93, 131,
-    96, 98, 71, 99, 82, 97, 173, 65, 70, 108, 121, 110, 81, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 91, 92, 106, 208, 67, 208,
-    208, 421, 411, 208, 388, 208, 208, 376, 366, 208, 208, 208, 208, 208, 208, 208,
-    297, 208, 89, 107, 90, 78, 2, 287, 130, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 301, 208, 208, 208, 0, 80, 208, 208, 208, 208, 323, 317,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 338, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 415, 208, 208, 208, 208, 420, 208, 208, 431, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 438, 208, 208,
-    208, 208, 208, 444, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 457, 0,
-    456, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 471, 0,
-    0, 45, 128, 119, 101, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 524, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 0, 111, 104, 112, 456, 0, 103, 109, 118,
-    129, 456, 456, 456, 100, 0, 456, 456, 456, 456, 456, 456, 173, 125, 456, 456,
-    456, 456, 0, 114, 175, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 126,
-    175, 456, 456, 94, 609, 2, 95, 123, 2, 609, 113, 4, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 209,
+    116, 262, 1, 4, 4, 5, 79, 127, 68, 66, 220, 3, 222, 3, 3, 220,
+    0, 105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65, 70, 108, 121,
+    110, 81, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 91,
+    92, 106, 209, 67, 209, 209, 420, 410, 209, 387, 209, 209, 375, 365, 209, 209,
+    209, 209, 209, 209, 209, 296, 209, 89, 107, 90, 78, 2, 286, 2, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 300, 209, 209, 209, 0, 80, 209,
+    209, 209, 209, 322, 316, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 337, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 414, 209, 209, 209, 209,
+    419, 209, 209, 430, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 437, 209, 209, 209, 209, 209, 443, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 456, 0, 455, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 46, 0, 470, 0, 0, 45, 128, 0, 103, 109, 130, 101, 119, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 527, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    0, 111, 104, 112, 455, 118, 129, 100, 455, 455, 455, 0, 175, 455, 455, 455,
+    455, 455, 455, 94, 173, 125, 0, 455, 455, 455, 455, 124, 175, 455, 455, 455,
+    114, 126, 455, 455, 455, 455, 455, 455, 455, 122, 455, 455, 2, 95, 123, 610,
+    610, 4, 113, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -2137,36 +2137,36 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 208, 116, 264, 1,
-    4, 4, 5, 79, 68, 127, 66, 124, 220, 122, 3, 223, 3, 3, 220, 0,
-    105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65, 70, 108, 121, 110,
-    81, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 91, 92,
-    106, 208, 67, 446, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 89, 107, 90, 78, 2, 287, 130, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 0, 80, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 379, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 0, 0, 456, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    46, 0, 0, 0, 0, 45, 128, 119, 101, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 0, 111, 104, 112, 456,
-    0, 103, 109, 118, 129, 456, 456, 456, 100, 0, 456, 456, 456, 456, 456, 456,
-    173, 125, 456, 456, 456, 456, 0, 114, 175, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 126, 175, 456, 456, 94, 609, 2, 95, 123, 2, 609, 113, 4,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 209, 116, 263, 1, 4, 4, 5, 79, 127, 68, 66, 220,
+    3, 222, 3, 3, 220, 0, 105, 69, 93, 131, 96, 98, 71, 99, 82, 97,
+    173, 65, 70, 108, 121, 110, 81, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 91, 92, 106, 209, 67, 445, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 89, 107, 90, 78,
+    2, 286, 2, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 0, 80, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 378, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 0, 0, 455, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 0, 103, 109,
+    130, 101, 119, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 0, 111, 104, 112, 455, 118, 129, 100, 455, 455, 455,
+    0, 175, 455, 455, 455, 455, 455, 455, 94, 173, 125, 0, 455, 455, 455, 455,
+    124, 175, 455, 455, 455, 114, 126, 455, 455, 455, 455, 455, 455, 455, 122, 455,
+    455, 2, 95, 123, 610, 610, 4, 113, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -2176,35 +2176,35 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    208, 116, 265, 1, 4, 4, 5, 79, 68, 127, 66, 124, 220, 122, 3, 223,
-    3, 3, 220, 0, 105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65,
-    70, 108, 121, 110, 81, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 91, 92, 106, 208, 67, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 89, 107, 90, 78, 2, 287,
-    130, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    0, 80, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 320,
-    208, 208, 208, 208, 208, 208, 327, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 359, 208, 208, 208, 208, 208, 208, 208, 372, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 397, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 0, 0, 456, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 119, 101, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 0,
-    111, 104, 112, 456, 0, 103, 109, 118, 129, 456, 456, 456, 100, 0, 456, 456,
-    456, 456, 456, 456, 173, 125, 456, 456, 456, 456, 0, 114, 175, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 126, 175, 456, 456, 94, 609, 2, 95, 123,
-    2, 609, 113, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 209, 116, 264, 1, 4, 4, 5,
+    79, 127, 68, 66, 220, 3, 222, 3, 3, 220, 0, 105, 69, 93, 131, 96,
+    98, 71, 99, 82, 97, 173, 65, 70, 108, 121, 110, 81, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 91, 92, 106, 209, 67, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 89, 107, 90, 78, 2, 286, 2, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 0, 80, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 319, 209, 209, 209, 209, 209, 209, 326, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 358, 209, 209,
+    209, 209, 209, 209, 209, 371, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 396, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 0, 0, 455,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0,
+    45, 128, 0, 103, 109, 130, 101, 119, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 0, 111, 104, 112, 455, 118,
+    129, 100, 455, 455, 455, 0, 175, 455, 455, 455, 455, 455, 455, 94, 173, 125,
+    0, 455, 455, 455, 455, 124, 175, 455, 455, 455, 114, 126, 455, 455, 455, 455,
+    455, 455, 455, 122, 455, 455, 2, 95, 123, 610, 610, 4, 113, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -2214,35 +2214,36 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 208, 116, 266, 1, 4, 4, 5, 79, 68, 127, 66, 124,
-    220, 122, 3, 223, 3, 3, 220, 0, 105, 69, 93, 131, 96, 98, 71, 99,
-    82, 97, 173, 65, 70, 108, 121, 110, 81, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 91, 92, 106, 208, 67, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 89, 107,
-    90, 78, 2, 287, 130, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 0, 80, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 343, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 369, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 449, 208, 208, 208, 208, 208, 0, 0, 456, 0, 0, 0,
-    0, 0, 463, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 119,
-    101, 456, 479, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 0, 111, 104, 112, 456, 0, 103, 109, 118, 129, 456, 456, 456,
-    100, 0, 456, 456, 456, 456, 456, 456, 173, 125, 456, 456, 456, 456, 0, 114,
-    175, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 126, 175, 456, 456, 94,
-    609, 2, 95, 123, 2, 609, 113, 4, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 209, 116,
+    265, 1, 4, 4, 5, 79, 127, 68, 66, 220, 3, 222, 3, 3, 220, 0,
+    105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65, 70, 108, 121, 110,
+    81, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 91, 92,
+    106, 209, 67, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 89, 107, 90, 78, 2, 286, 2, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 0, 80, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 342, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 368, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 448, 209, 209, 209,
+    209, 209, 0, 0, 455, 0, 0, 0, 0, 0, 462, 0, 0, 0, 0, 0,
+    46, 0, 0, 0, 0, 45, 128, 0, 103, 109, 130, 101, 119, 455, 482, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 0,
+    111, 104, 112, 455, 118, 129, 100, 455, 455, 455, 0, 175, 455, 455, 455, 455,
+    455, 455, 94, 173, 125, 0, 455, 455, 455, 455, 124, 175, 455, 455, 455, 114,
+    126, 455, 455, 455, 455, 455, 455, 455, 122, 455, 455, 2, 95, 123, 610, 610,
+    4, 113, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -2252,35 +2253,35 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 208, 116, 267, 1, 4, 4, 5, 79,
-    68, 127, 66, 124, 220, 122, 3, 223, 3, 3, 220, 0, 105, 69, 93, 131,
-    96, 98, 71, 99, 82, 97, 173, 65, 70, 108, 121, 110, 81, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 523, 456, 456, 456, 91, 92, 106, 208, 67, 208,
-    208, 208, 412, 208, 389, 208, 208, 377, 208, 208, 208, 208, 337, 208, 208, 208,
-    208, 208, 89, 107, 90, 78, 2, 287, 130, 208, 208, 208, 293, 208, 208, 296,
-    208, 208, 208, 208, 208, 208, 208, 208, 0, 80, 208, 308, 208, 208, 208, 208,
-    208, 208, 315, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 332, 208, 334, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 346, 208, 348, 208, 208, 351, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 364, 208, 208, 208, 208, 208, 370, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 380, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 395, 208, 208, 398, 208, 208, 401, 208, 208, 208, 208, 208, 208, 208,
-    208, 410, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 430, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    441, 208, 443, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 0, 0,
-    456, 0, 0, 460, 0, 0, 0, 469, 465, 0, 467, 0, 46, 0, 0, 0,
-    0, 45, 128, 119, 101, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 0, 111, 104, 112, 456, 0, 103, 109, 118,
-    129, 456, 456, 456, 100, 0, 456, 456, 456, 456, 456, 456, 173, 125, 456, 456,
-    456, 456, 0, 114, 175, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 126,
-    175, 456, 456, 94, 609, 2, 95, 123, 2, 609, 113, 4, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 209, 116, 266, 1, 4, 4, 5, 79, 127, 68, 66, 220, 3,
+    222, 3, 3, 220, 0, 105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173,
+    65, 70, 108, 121, 110, 81, 455, 455, 455, 455, 455, 455, 455, 455, 455, 526,
+    455, 455, 455, 91, 92, 106, 209, 67, 209, 209, 209, 411, 209, 388, 209, 209,
+    376, 209, 209, 209, 209, 336, 209, 209, 209, 209, 209, 89, 107, 90, 78, 2,
+    286, 2, 209, 209, 209, 292, 209, 209, 295, 209, 209, 209, 209, 209, 209, 209,
+    209, 0, 80, 209, 307, 209, 209, 209, 209, 209, 209, 314, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 331, 209, 333, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 345, 209, 347, 209, 209, 350,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 363, 209, 209, 209,
+    209, 209, 369, 209, 209, 209, 209, 209, 209, 209, 209, 209, 379, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 394, 209, 209, 397, 209,
+    209, 400, 209, 209, 209, 209, 209, 209, 209, 209, 409, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 429, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 440, 209, 442, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 0, 0, 455, 0, 0, 459, 0, 0, 0,
+    468, 464, 0, 466, 0, 46, 0, 0, 0, 0, 45, 128, 0, 103, 109, 130,
+    101, 119, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 0, 111, 104, 112, 455, 118, 129, 100, 455, 455, 455, 0,
+    175, 455, 455, 455, 455, 455, 455, 94, 173, 125, 0, 455, 455, 455, 455, 124,
+    175, 455, 455, 455, 114, 126, 455, 455, 455, 455, 455, 455, 455, 122, 455, 455,
+    2, 95, 123, 610, 610, 4, 113, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -2290,35 +2291,35 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 208, 116, 268, 1,
-    4, 4, 5, 79, 68, 127, 66, 124, 220, 122, 3, 223, 3, 3, 220, 0,
-    105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65, 70, 108, 121, 110,
-    81, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 91, 92,
-    106, 208, 67, 208, 208, 208, 208, 208, 208, 208, 382, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 89, 107, 90, 78, 2, 287, 130, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 0, 80, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 336, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 414, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 0, 0, 456, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    46, 0, 0, 0, 0, 45, 128, 119, 101, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 0, 111, 104, 112, 456,
-    0, 103, 109, 118, 129, 456, 456, 456, 100, 0, 456, 456, 456, 456, 456, 456,
-    173, 125, 456, 456, 456, 456, 0, 114, 175, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 126, 175, 456, 456, 94, 609, 2, 95, 123, 2, 609, 113, 4,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 209, 116, 267, 1, 4, 4, 5, 79,
+    127, 68, 66, 220, 3, 222, 3, 3, 220, 0, 105, 69, 93, 131, 96, 98,
+    71, 99, 82, 97, 173, 65, 70, 108, 121, 110, 81, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 91, 92, 106, 209, 67, 209, 209, 209,
+    209, 209, 209, 209, 381, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    89, 107, 90, 78, 2, 286, 2, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 0, 80, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 335, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 413, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 0, 0, 455, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45,
+    128, 0, 103, 109, 130, 101, 119, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 0, 111, 104, 112, 455, 118, 129,
+    100, 455, 455, 455, 0, 175, 455, 455, 455, 455, 455, 455, 94, 173, 125, 0,
+    455, 455, 455, 455, 124, 175, 455, 455, 455, 114, 126, 455, 455, 455, 455, 455,
+    455, 455, 122, 455, 455, 2, 95, 123, 610, 610, 4, 113, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -2329,34 +2330,35 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    208, 116, 269, 1, 4, 4, 5, 79, 68, 127, 66, 124, 174, 122, 3, 223,
-    3, 3, 0, 0, 105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65,
-    70, 108, 121, 110, 81, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 91, 92, 106, 208, 67, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 89, 107, 90, 78, 2, 287,
-    130, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    0, 80, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 0, 0, 456, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 119, 101, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 0,
-    111, 104, 112, 456, 0, 103, 109, 118, 129, 456, 456, 456, 100, 0, 456, 456,
-    456, 456, 456, 456, 173, 125, 456, 456, 456, 456, 0, 114, 175, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 126, 175, 456, 456, 94, 0, 2, 95, 123,
-    2, 174, 113, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 209, 116, 268,
+    1, 4, 4, 5, 79, 127, 68, 66, 174, 3, 222, 3, 3, 0, 0, 105,
+    69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65, 70, 108, 121, 110, 81,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 91, 92, 106,
+    209, 67, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 89, 107, 90, 78, 2, 286, 2, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 0, 80, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 0, 0, 455, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46,
+    0, 0, 0, 0, 45, 128, 0, 103, 109, 130, 101, 119, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 0, 111,
+    104, 112, 455, 118, 129, 100, 455, 455, 455, 0, 175, 455, 455, 455, 455, 455,
+    455, 94, 173, 125, 0, 455, 455, 455, 455, 124, 175, 455, 455, 455, 114, 126,
+    455, 455, 455, 455, 455, 455, 455, 122, 455, 455, 2, 95, 123, 0, 174, 4,
+    113, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -2367,34 +2369,34 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 208, 116, 208, 1, 4, 4, 5, 79, 68, 127, 66, 124,
-    174, 122, 3, 223, 3, 3, 0, 0, 105, 69, 93, 131, 96, 98, 71, 99,
-    82, 97, 173, 65, 70, 108, 121, 110, 81, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 91, 92, 106, 208, 67, 208, 208, 422, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 289, 89, 107,
-    90, 78, 2, 287, 130, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 0, 80, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 321, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 0, 0, 456, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 119,
-    101, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 0, 111, 104, 112, 456, 0, 103, 109, 118, 129, 456, 456, 456,
-    100, 0, 456, 456, 456, 456, 456, 456, 173, 125, 456, 456, 456, 456, 0, 114,
-    175, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 126, 175, 456, 456, 94,
-    0, 2, 95, 123, 2, 174, 113, 4, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 209, 116, 209, 1, 4, 4, 5, 79, 127, 68, 66, 174, 3, 222,
+    3, 3, 0, 0, 105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65,
+    70, 108, 121, 110, 81, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 91, 92, 106, 209, 67, 209, 209, 421, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 288, 89, 107, 90, 78, 2, 286,
+    2, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    0, 80, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    320, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 0, 0, 455, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 0, 103, 109, 130, 101,
+    119, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 0, 111, 104, 112, 455, 118, 129, 100, 455, 455, 455, 0, 175,
+    455, 455, 455, 455, 455, 455, 94, 173, 125, 0, 455, 455, 455, 455, 124, 175,
+    455, 455, 455, 114, 126, 455, 455, 455, 455, 455, 455, 455, 122, 455, 455, 2,
+    95, 123, 0, 174, 4, 113, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -2405,34 +2407,34 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 208, 116, 270, 1, 4, 4, 5, 79,
-    68, 127, 66, 124, 174, 122, 3, 223, 3, 3, 0, 0, 105, 69, 93, 131,
-    96, 98, 71, 99, 82, 97, 173, 65, 70, 108, 121, 110, 81, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 91, 92, 106, 208, 67, 208,
-    208, 208, 208, 208, 390, 208, 208, 208, 367, 208, 208, 208, 208, 309, 208, 208,
-    208, 208, 89, 107, 90, 78, 2, 287, 130, 294, 291, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 0, 80, 208, 208, 208, 208, 208, 318,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 355, 208, 357, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 427, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 450, 208, 208, 208, 208, 0, 0,
-    456, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 472,
-    0, 45, 128, 119, 101, 478, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 0, 111, 104, 112, 456, 0, 103, 109, 118,
-    129, 456, 456, 456, 100, 0, 456, 456, 456, 456, 456, 456, 173, 125, 456, 456,
-    456, 456, 0, 114, 175, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 126,
-    175, 456, 456, 94, 0, 2, 95, 123, 2, 174, 113, 4, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 209, 116, 269, 1, 4, 4, 5, 79, 127,
+    68, 66, 174, 3, 222, 3, 3, 0, 0, 105, 69, 93, 131, 96, 98, 71,
+    99, 82, 97, 173, 65, 70, 108, 121, 110, 81, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 91, 92, 106, 209, 67, 209, 209, 209, 209,
+    209, 389, 209, 209, 209, 366, 209, 209, 209, 209, 308, 209, 209, 209, 209, 89,
+    107, 90, 78, 2, 286, 2, 293, 290, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 0, 80, 209, 209, 209, 209, 209, 317, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 354, 209, 356, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 426,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 449, 209, 209, 209, 209, 0, 0, 455, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 471, 0, 45, 128,
+    0, 103, 109, 130, 101, 119, 481, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 0, 111, 104, 112, 455, 118, 129, 100,
+    455, 455, 455, 0, 175, 455, 455, 455, 455, 455, 455, 94, 173, 125, 0, 455,
+    455, 455, 455, 124, 175, 455, 455, 455, 114, 126, 455, 455, 455, 455, 455, 455,
+    455, 122, 455, 455, 2, 95, 123, 0, 174, 4, 113, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -2443,34 +2445,34 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 208, 116, 208, 1,
-    4, 4, 5, 79, 68, 127, 66, 124, 174, 122, 3, 223, 3, 3, 0, 0,
-    105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65, 70, 108, 121, 110,
-    81, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 91, 92,
-    106, 208, 67, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 89, 107, 90, 78, 2, 287, 130, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 0, 80, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 0, 0, 456, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    46, 0, 0, 0, 0, 45, 128, 119, 101, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 0, 111, 104, 112, 456,
-    0, 103, 109, 118, 129, 456, 456, 456, 100, 0, 456, 456, 456, 456, 456, 456,
-    173, 125, 456, 456, 456, 456, 0, 114, 175, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 126, 175, 456, 456, 94, 0, 2, 95, 123, 2, 174, 113, 4,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 209, 116, 209, 1,
+    4, 4, 5, 79, 127, 68, 66, 174, 3, 222, 3, 3, 0, 0, 105, 69,
+    93, 131, 96, 98, 71, 99, 82, 97, 173, 65, 70, 108, 121, 110, 81, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 91, 92, 106, 209,
+    67, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 89, 107, 90, 78, 2, 286, 2, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 0, 80, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    0, 0, 455, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0,
+    0, 0, 0, 45, 128, 0, 103, 109, 130, 101, 119, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 0, 111, 104,
+    112, 455, 118, 129, 100, 455, 455, 455, 0, 175, 455, 455, 455, 455, 455, 455,
+    94, 173, 125, 0, 455, 455, 455, 455, 124, 175, 455, 455, 455, 114, 126, 455,
+    455, 455, 455, 455, 455, 455, 122, 455, 455, 2, 95, 123, 0, 174, 4, 113,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -2482,34 +2484,34 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    208, 116, 208, 1, 4, 4, 5, 79, 68, 127, 66, 124, 174, 122, 3, 223,
-    3, 3, 0, 0, 105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65,
-    70, 108, 121, 110, 81, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 91, 92, 106, 208, 67, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 89, 107, 90, 78, 2, 287,
-    130, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    0, 80, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 445, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 0, 0, 456, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 119, 101, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 0,
-    111, 104, 112, 456, 0, 103, 109, 118, 129, 456, 456, 456, 100, 0, 456, 456,
-    456, 456, 456, 456, 173, 125, 456, 456, 456, 456, 0, 114, 175, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 126, 175, 456, 456, 94, 0, 2, 95, 123,
-    2, 174, 113, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 209, 116, 209, 1, 4, 4, 5, 79, 127, 68, 66, 174, 3, 222, 3,
+    3, 0, 0, 105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65, 70,
+    108, 121, 110, 81, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 91, 92, 106, 209, 67, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 89, 107, 90, 78, 2, 286, 2,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 0,
+    80, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 444, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 0, 0, 455, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 0, 103, 109, 130, 101, 119,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 0, 111, 104, 112, 455, 118, 129, 100, 455, 455, 455, 0, 175, 455,
+    455, 455, 455, 455, 455, 94, 173, 125, 0, 455, 455, 455, 455, 124, 175, 455,
+    455, 455, 114, 126, 455, 455, 455, 455, 455, 455, 455, 122, 455, 455, 2, 95,
+    123, 0, 174, 4, 113, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -2520,34 +2522,34 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 208, 116, 271, 1, 4, 4, 5, 79, 68, 127, 66, 124,
-    174, 122, 3, 223, 3, 3, 0, 0, 105, 69, 93, 131, 96, 98, 71, 99,
-    82, 97, 173, 65, 70, 108, 121, 110, 81, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 91, 92, 106, 208, 67, 208, 208, 208, 208, 402,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 89, 107,
-    90, 78, 2, 287, 130, 208, 208, 208, 208, 208, 295, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 0, 80, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    381, 208, 208, 208, 208, 208, 208, 208, 399, 208, 394, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 405, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 417, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 0, 0, 456, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 473, 45, 128, 119,
-    101, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    525, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 556,
-    456, 456, 456, 0, 111, 104, 112, 456, 0, 103, 109, 118, 129, 456, 456, 456,
-    100, 0, 456, 456, 456, 456, 456, 456, 173, 125, 456, 456, 456, 456, 0, 114,
-    175, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 126, 175, 456, 456, 94,
-    0, 2, 95, 123, 2, 174, 113, 4, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 209, 116, 270, 1, 4, 4, 5, 79, 127, 68,
+    66, 174, 3, 222, 3, 3, 0, 0, 105, 69, 93, 131, 96, 98, 71, 99,
+    82, 97, 173, 65, 70, 108, 121, 110, 81, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 91, 92, 106, 209, 67, 209, 209, 209, 209, 401,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 89, 107,
+    90, 78, 2, 286, 2, 209, 209, 209, 209, 209, 294, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 0, 80, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    380, 209, 209, 209, 209, 209, 209, 209, 398, 209, 393, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 404, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 416, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 0, 0, 455, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 472, 45, 128, 0,
+    103, 109, 130, 101, 119, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 528, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 559, 455, 455, 455, 0, 111, 104, 112, 455, 118, 129, 100, 455,
+    455, 455, 0, 175, 455, 455, 455, 455, 455, 455, 94, 173, 125, 0, 455, 455,
+    455, 455, 124, 175, 455, 455, 455, 114, 126, 455, 455, 455, 455, 455, 455, 455,
+    122, 455, 455, 2, 95, 123, 0, 174, 4, 113, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -2558,34 +2560,34 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 208, 116, 272, 1, 4, 4, 5, 79,
-    68, 127, 66, 124, 174, 122, 3, 223, 3, 3, 0, 0, 105, 69, 93, 131,
-    96, 98, 71, 99, 82, 97, 173, 65, 70, 108, 121, 110, 81, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 91, 92, 106, 208, 67, 208,
-    208, 208, 208, 403, 208, 208, 208, 208, 208, 356, 353, 208, 208, 208, 208, 208,
-    208, 208, 89, 107, 90, 78, 2, 287, 130, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 0, 80, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 316, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 435, 208, 437, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 452, 208, 208, 208, 208, 208, 208, 0, 454,
-    456, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0,
-    0, 45, 128, 119, 101, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 0, 111, 104, 112, 456, 0, 103, 109, 118,
-    129, 456, 456, 456, 100, 0, 456, 456, 456, 456, 456, 456, 173, 125, 456, 456,
-    456, 456, 0, 114, 175, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 126,
-    175, 456, 456, 94, 0, 2, 95, 123, 2, 174, 113, 4, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 209, 116, 271, 1, 4,
+    4, 5, 79, 127, 68, 66, 174, 3, 222, 3, 3, 0, 0, 105, 69, 93,
+    131, 96, 98, 71, 99, 82, 97, 173, 65, 70, 108, 121, 110, 81, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 91, 92, 106, 209, 67,
+    209, 209, 209, 209, 402, 209, 209, 209, 209, 209, 355, 352, 209, 209, 209, 209,
+    209, 209, 209, 89, 107, 90, 78, 2, 286, 2, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 0, 80, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 315, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 434, 209, 436, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 451, 209, 209, 209, 209, 209, 209, 0,
+    453, 455, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0,
+    0, 0, 45, 128, 0, 103, 109, 130, 101, 119, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 0, 111, 104, 112,
+    455, 118, 129, 100, 455, 455, 455, 0, 175, 455, 455, 455, 455, 455, 455, 94,
+    173, 125, 0, 455, 455, 455, 455, 124, 175, 455, 455, 455, 114, 126, 455, 455,
+    455, 455, 455, 455, 455, 122, 455, 455, 2, 95, 123, 0, 174, 4, 113, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -2596,35 +2598,35 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 208, 116, 273, 1,
-    4, 4, 5, 79, 68, 127, 66, 124, 174, 122, 3, 223, 3, 3, 0, 0,
-    105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65, 70, 108, 121, 110,
-    81, 456, 456, 456, 456, 456, 601, 456, 456, 456, 456, 456, 456, 456, 91, 92,
-    106, 208, 67, 208, 208, 208, 208, 208, 391, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 300, 208, 208, 89, 107, 90, 78, 2, 287, 130, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 0, 80, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 342, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 354, 208, 208,
-    208, 208, 208, 208, 208, 362, 208, 208, 208, 208, 208, 371, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 378, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 396, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 425, 208, 208, 208, 428, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 0, 0, 456, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    46, 0, 0, 0, 0, 45, 128, 119, 101, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 0, 111, 104, 112, 456,
-    0, 103, 109, 118, 129, 456, 456, 456, 100, 0, 456, 456, 456, 456, 456, 456,
-    173, 125, 456, 456, 456, 456, 0, 114, 175, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 126, 175, 456, 456, 94, 0, 2, 95, 123, 2, 174, 113, 4,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    209, 116, 272, 1, 4, 4, 5, 79, 127, 68, 66, 174, 3, 222, 3, 3,
+    0, 0, 105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65, 70, 108,
+    121, 110, 81, 455, 455, 455, 455, 455, 604, 455, 455, 455, 455, 455, 455, 455,
+    91, 92, 106, 209, 67, 209, 209, 209, 209, 209, 390, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 299, 209, 209, 89, 107, 90, 78, 2, 286, 2, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 0, 80,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 341, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 353,
+    209, 209, 209, 209, 209, 209, 209, 361, 209, 209, 209, 209, 209, 370, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 377, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 395, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 424, 209, 209, 209, 427, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 0, 0, 455, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 46, 0, 0, 0, 0, 45, 128, 0, 103, 109, 130, 101, 119, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 0, 111, 104, 112, 455, 118, 129, 100, 455, 455, 455, 0, 175, 455, 455,
+    455, 455, 455, 455, 94, 173, 125, 0, 455, 455, 455, 455, 124, 175, 455, 455,
+    455, 114, 126, 455, 455, 455, 455, 455, 455, 455, 122, 455, 455, 2, 95, 123,
+    0, 174, 4, 113, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -2635,34 +2637,34 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    208, 116, 274, 1, 4, 4, 5, 79, 68, 127, 66, 124, 174, 122, 3, 223,
-    3, 3, 0, 0, 105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65,
-    70, 108, 121, 110, 81, 456, 554, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 477, 91, 92, 106, 208, 67, 208, 208, 423, 413, 208, 392, 385, 208, 208,
-    368, 208, 208, 208, 208, 208, 208, 208, 208, 208, 89, 107, 90, 78, 2, 287,
-    130, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    0, 80, 208, 208, 208, 208, 324, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 335, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 360, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 375, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 387, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 406, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 434, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 451, 208, 208, 208, 0, 0, 456, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 119, 101, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 555, 456, 456, 456, 456, 0,
-    111, 104, 112, 456, 0, 103, 109, 118, 129, 456, 456, 456, 100, 0, 456, 456,
-    456, 456, 456, 456, 173, 125, 456, 456, 456, 456, 0, 114, 175, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 126, 175, 456, 456, 94, 0, 2, 95, 123,
-    2, 174, 113, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 209, 116, 273, 1, 4, 4, 5, 79, 127, 68, 66,
+    174, 3, 222, 3, 3, 0, 0, 105, 69, 93, 131, 96, 98, 71, 99, 82,
+    97, 173, 65, 70, 108, 121, 110, 81, 455, 557, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 480, 91, 92, 106, 209, 67, 209, 209, 422, 412, 209, 391,
+    384, 209, 209, 367, 209, 209, 209, 209, 209, 209, 209, 209, 209, 89, 107, 90,
+    78, 2, 286, 2, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 0, 80, 209, 209, 209, 209, 323, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 334, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 359, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 374, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 386, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 405, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 433, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 450, 209, 209, 209, 0, 0, 455, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 0, 103,
+    109, 130, 101, 119, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 558, 455, 455, 455, 455, 0, 111, 104, 112, 455, 118, 129, 100, 455, 455,
+    455, 0, 175, 455, 455, 455, 455, 455, 455, 94, 173, 125, 0, 455, 455, 455,
+    455, 124, 175, 455, 455, 455, 114, 126, 455, 455, 455, 455, 455, 455, 455, 122,
+    455, 455, 2, 95, 123, 0, 174, 4, 113, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -2673,34 +2675,34 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 208, 116, 275, 1, 4, 4, 5, 79, 68, 127, 66, 124,
-    174, 122, 3, 223, 3, 3, 0, 0, 105, 69, 93, 131, 96, 98, 71, 99,
-    82, 97, 173, 65, 70, 108, 121, 110, 81, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 91, 92, 106, 208, 67, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 89, 107,
-    90, 78, 2, 287, 130, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 0, 80, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 322, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 404, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 439, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 0, 0, 456, 458, 459, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 119,
-    101, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 0, 111, 104, 112, 456, 0, 103, 109, 118, 129, 456, 456, 456,
-    100, 0, 456, 456, 456, 456, 456, 456, 173, 125, 456, 456, 456, 456, 0, 114,
-    175, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 126, 175, 456, 456, 94,
-    0, 2, 95, 123, 2, 174, 113, 4, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 209, 116, 274, 1, 4, 4,
+    5, 79, 127, 68, 66, 174, 3, 222, 3, 3, 0, 0, 105, 69, 93, 131,
+    96, 98, 71, 99, 82, 97, 173, 65, 70, 108, 121, 110, 81, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 91, 92, 106, 209, 67, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 89, 107, 90, 78, 2, 286, 2, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 0, 80, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 321, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 403, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 438, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 0, 0,
+    455, 457, 458, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0,
+    0, 45, 128, 0, 103, 109, 130, 101, 119, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 0, 111, 104, 112, 455,
+    118, 129, 100, 455, 455, 455, 0, 175, 455, 455, 455, 455, 455, 455, 94, 173,
+    125, 0, 455, 455, 455, 455, 124, 175, 455, 455, 455, 114, 126, 455, 455, 455,
+    455, 455, 455, 455, 122, 455, 455, 2, 95, 123, 0, 174, 4, 113, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -2711,34 +2713,35 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 208, 116, 208, 1, 4, 4, 5, 79,
-    68, 127, 66, 124, 174, 122, 3, 223, 3, 3, 0, 0, 105, 69, 93, 131,
-    96, 98, 71, 99, 82, 97, 173, 65, 70, 108, 121, 110, 81, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 91, 92, 106, 208, 67, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 89, 107, 90, 78, 2, 287, 130, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 0, 80, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 384, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 0, 0,
-    456, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0,
-    0, 45, 128, 119, 101, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 0, 111, 104, 112, 456, 0, 103, 109, 118,
-    129, 456, 456, 456, 100, 0, 456, 456, 456, 456, 456, 456, 173, 125, 456, 456,
-    456, 456, 0, 114, 175, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 126,
-    175, 456, 456, 94, 0, 2, 95, 123, 2, 174, 113, 4, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 209,
+    116, 209, 1, 4, 4, 5, 79, 127, 68, 66, 174, 3, 222, 3, 3, 0,
+    0, 105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65, 70, 108, 121,
+    110, 81, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 91,
+    92, 106, 209, 67, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 89, 107, 90, 78, 2, 286, 2, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 0, 80, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 383, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 0, 0, 455, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 46, 0, 0, 0, 0, 45, 128, 0, 103, 109, 130, 101, 119, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    0, 111, 104, 112, 455, 118, 129, 100, 455, 455, 455, 0, 175, 455, 455, 455,
+    455, 455, 455, 94, 173, 125, 0, 455, 455, 455, 455, 124, 175, 455, 455, 455,
+    114, 126, 455, 455, 455, 455, 455, 455, 455, 122, 455, 455, 2, 95, 123, 0,
+    174, 4, 113, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -2749,34 +2752,34 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 208, 116, 276, 1,
-    4, 4, 5, 79, 68, 127, 66, 124, 174, 122, 3, 223, 3, 3, 0, 0,
-    105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65, 70, 108, 121, 110,
-    81, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 91, 92,
-    106, 208, 67, 208, 442, 208, 208, 208, 208, 208, 383, 208, 208, 208, 208, 345,
-    208, 208, 306, 208, 208, 290, 89, 107, 90, 78, 2, 287, 130, 208, 208, 208,
-    208, 208, 208, 208, 208, 298, 208, 208, 208, 302, 208, 208, 0, 80, 208, 208,
-    208, 208, 325, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    341, 208, 208, 208, 208, 208, 208, 208, 349, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 365, 208, 208, 208, 208, 208, 208, 208,
-    374, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 393, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 432, 208, 208, 208, 208, 208, 208, 208, 208, 436, 433, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 0, 0, 456, 0, 0, 0, 461, 0, 464, 0, 0, 0, 0, 0,
-    46, 0, 0, 0, 0, 45, 128, 119, 101, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 0, 111, 104, 112, 456,
-    0, 103, 109, 118, 129, 456, 456, 456, 100, 0, 456, 456, 456, 456, 456, 456,
-    173, 125, 456, 456, 456, 456, 0, 114, 175, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 126, 175, 456, 456, 94, 0, 2, 95, 123, 2, 174, 113, 4,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 209, 116, 275, 1, 4, 4, 5, 79, 127, 68, 66, 174,
+    3, 222, 3, 3, 0, 0, 105, 69, 93, 131, 96, 98, 71, 99, 82, 97,
+    173, 65, 70, 108, 121, 110, 81, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 91, 92, 106, 209, 67, 209, 441, 209, 209, 209, 209, 209,
+    382, 209, 209, 209, 209, 344, 209, 209, 305, 209, 209, 289, 89, 107, 90, 78,
+    2, 286, 2, 209, 209, 209, 209, 209, 209, 209, 209, 297, 209, 209, 209, 301,
+    209, 209, 0, 80, 209, 209, 209, 209, 324, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 340, 209, 209, 209, 209, 209, 209, 209, 348, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 364, 209,
+    209, 209, 209, 209, 209, 209, 373, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 392, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 431, 209, 209, 209, 209, 209, 209, 209,
+    209, 435, 432, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 0, 0, 455, 0, 0, 0, 460, 0,
+    463, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 0, 103, 109,
+    130, 101, 119, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 0, 111, 104, 112, 455, 118, 129, 100, 455, 455, 455,
+    0, 175, 455, 455, 455, 455, 455, 455, 94, 173, 125, 0, 455, 455, 455, 455,
+    124, 175, 455, 455, 455, 114, 126, 455, 455, 455, 455, 455, 455, 455, 122, 455,
+    455, 2, 95, 123, 0, 174, 4, 113, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -2788,33 +2791,33 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    208, 116, 277, 1, 4, 4, 5, 79, 68, 127, 66, 124, 174, 122, 3, 223,
-    3, 3, 0, 0, 105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65,
-    70, 108, 121, 110, 81, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 91, 92, 106, 208, 67, 447, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 89, 107, 90, 78, 2, 287,
-    130, 208, 208, 208, 208, 208, 208, 208, 208, 208, 299, 208, 208, 208, 208, 208,
-    0, 80, 208, 208, 208, 208, 208, 208, 313, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 330, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 347, 208, 208, 208, 208, 352,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 400,
-    208, 208, 409, 208, 208, 208, 208, 408, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 440, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 453, 208,
-    208, 208, 208, 208, 208, 208, 0, 0, 456, 0, 0, 0, 0, 0, 0, 0,
-    0, 466, 0, 0, 46, 0, 0, 0, 0, 45, 128, 119, 101, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 0,
-    111, 104, 112, 456, 0, 103, 109, 118, 129, 456, 456, 456, 100, 0, 456, 456,
-    456, 456, 456, 456, 173, 125, 456, 456, 456, 456, 0, 114, 175, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 126, 175, 456, 456, 94, 0, 2, 95, 123,
-    2, 174, 113, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 209, 116, 276, 1, 4, 4, 5,
+    79, 127, 68, 66, 174, 3, 222, 3, 3, 0, 0, 105, 69, 93, 131, 96,
+    98, 71, 99, 82, 97, 173, 65, 70, 108, 121, 110, 81, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 91, 92, 106, 209, 67, 446, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 89, 107, 90, 78, 2, 286, 2, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 298, 209, 209, 209, 209, 209, 0, 80, 209, 209, 209, 209, 209, 209, 312,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    329, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 346, 209, 209, 209, 209, 351, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 399, 209, 209, 408, 209, 209, 209, 209, 407, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 439, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 452, 209, 209, 209, 209, 209, 209, 209, 0, 0, 455,
+    0, 0, 0, 0, 0, 0, 0, 0, 465, 0, 0, 46, 0, 0, 0, 0,
+    45, 128, 0, 103, 109, 130, 101, 119, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 0, 111, 104, 112, 455, 118,
+    129, 100, 455, 455, 455, 0, 175, 455, 455, 455, 455, 455, 455, 94, 173, 125,
+    0, 455, 455, 455, 455, 124, 175, 455, 455, 455, 114, 126, 455, 455, 455, 455,
+    455, 455, 455, 122, 455, 455, 2, 95, 123, 0, 174, 4, 113, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -2826,33 +2829,34 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 208, 116, 278, 1, 4, 4, 5, 79, 68, 127, 66, 124,
-    174, 122, 3, 223, 3, 3, 0, 0, 105, 69, 93, 131, 96, 98, 71, 99,
-    82, 97, 173, 65, 70, 108, 121, 110, 81, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 91, 92, 106, 208, 67, 208, 208, 424, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 310, 208, 208, 208, 208, 89, 107,
-    90, 78, 2, 287, 130, 208, 208, 292, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 0, 80, 208, 208, 208, 208, 208, 208, 208, 314, 208, 208,
-    208, 208, 319, 208, 208, 208, 208, 331, 208, 208, 208, 328, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 339, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 363, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 386, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 419,
-    208, 208, 208, 208, 208, 418, 208, 208, 208, 208, 208, 208, 208, 426, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 0, 0, 456, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 468, 46, 470, 0, 0, 0, 45, 128, 119,
-    101, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 0, 111, 104, 112, 456, 0, 103, 109, 118, 129, 456, 456, 456,
-    100, 0, 456, 456, 456, 456, 456, 456, 173, 125, 456, 456, 456, 456, 0, 114,
-    175, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 126, 175, 602, 456, 94,
-    0, 2, 95, 123, 2, 174, 113, 4, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 209, 116,
+    277, 1, 4, 4, 5, 79, 127, 68, 66, 174, 3, 222, 3, 3, 0, 0,
+    105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65, 70, 108, 121, 110,
+    81, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 91, 92,
+    106, 209, 67, 209, 209, 423, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 309, 209, 209, 209, 209, 89, 107, 90, 78, 2, 286, 2, 209, 209, 291,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 0, 80, 209, 209,
+    209, 209, 209, 209, 209, 313, 209, 209, 209, 209, 318, 209, 209, 209, 209, 330,
+    209, 209, 209, 327, 209, 209, 209, 209, 209, 209, 209, 209, 209, 338, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 362, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 385, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 418, 209, 209, 209, 209, 209, 417, 209, 209,
+    209, 209, 209, 209, 209, 425, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 0, 0, 455, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 467,
+    46, 469, 0, 0, 0, 45, 128, 0, 103, 109, 130, 101, 119, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 0,
+    111, 104, 112, 455, 118, 129, 100, 455, 455, 455, 0, 175, 455, 455, 455, 455,
+    455, 455, 94, 173, 125, 0, 455, 455, 455, 455, 124, 175, 455, 455, 455, 114,
+    126, 455, 455, 455, 455, 455, 455, 455, 122, 605, 455, 2, 95, 123, 0, 174,
+    4, 113, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -2864,33 +2868,33 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 208, 116, 279, 1, 4, 4, 5, 79,
-    68, 127, 66, 124, 174, 122, 3, 223, 3, 3, 0, 0, 105, 69, 93, 131,
-    96, 98, 71, 99, 82, 97, 173, 65, 70, 108, 121, 110, 81, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 91, 92, 106, 208, 67, 448,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 89, 107, 90, 78, 2, 287, 130, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 0, 80, 307, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 326, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 340, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    361, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 416, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 429, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 0, 0,
-    456, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0,
-    0, 45, 128, 119, 101, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 0, 111, 104, 112, 456, 0, 103, 109, 118,
-    129, 456, 456, 456, 100, 0, 456, 456, 456, 456, 456, 456, 173, 125, 456, 456,
-    456, 456, 0, 114, 175, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 126,
-    175, 456, 456, 94, 0, 2, 95, 123, 2, 174, 113, 4, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 209, 116, 278, 1, 4, 4, 5, 79, 127, 68, 66, 174, 3,
+    222, 3, 3, 0, 0, 105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173,
+    65, 70, 108, 121, 110, 81, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 91, 92, 106, 209, 67, 447, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 89, 107, 90, 78, 2,
+    286, 2, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 0, 80, 306, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 325, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 339, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 360, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    415, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 428, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 0, 0, 455, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 0, 103, 109, 130,
+    101, 119, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 0, 111, 104, 112, 455, 118, 129, 100, 455, 455, 455, 0,
+    175, 455, 455, 455, 455, 455, 455, 94, 173, 125, 0, 455, 455, 455, 455, 124,
+    175, 455, 455, 455, 114, 126, 455, 455, 455, 455, 455, 455, 455, 122, 455, 455,
+    2, 95, 123, 0, 174, 4, 113, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -2902,33 +2906,33 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 208, 116, 280, 1,
-    4, 4, 5, 79, 68, 127, 66, 124, 174, 122, 3, 223, 3, 3, 0, 0,
-    105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65, 70, 108, 121, 110,
-    81, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 91, 92,
-    106, 208, 67, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 89, 107, 90, 78, 2, 287, 130, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 0, 80, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 350, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 0, 0, 456, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    46, 0, 0, 0, 0, 45, 128, 119, 101, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 0, 111, 104, 112, 456,
-    0, 103, 109, 118, 129, 456, 456, 456, 100, 0, 456, 456, 456, 456, 456, 456,
-    173, 125, 456, 456, 456, 456, 0, 114, 175, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 126, 175, 456, 456, 94, 0, 2, 95, 123, 2, 174, 113, 4,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 209, 116, 279, 1, 4, 4, 5, 79,
+    127, 68, 66, 174, 3, 222, 3, 3, 0, 0, 105, 69, 93, 131, 96, 98,
+    71, 99, 82, 97, 173, 65, 70, 108, 121, 110, 81, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 91, 92, 106, 209, 67, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    89, 107, 90, 78, 2, 286, 2, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 0, 80, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 349, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 0, 0, 455, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45,
+    128, 0, 103, 109, 130, 101, 119, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 0, 111, 104, 112, 455, 118, 129,
+    100, 455, 455, 455, 0, 175, 455, 455, 455, 455, 455, 455, 94, 173, 125, 0,
+    455, 455, 455, 455, 124, 175, 455, 455, 455, 114, 126, 455, 455, 455, 455, 455,
+    455, 455, 122, 455, 455, 2, 95, 123, 0, 174, 4, 113, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -2941,32 +2945,33 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    208, 116, 281, 1, 4, 4, 5, 79, 68, 127, 66, 124, 174, 122, 3, 223,
-    3, 3, 0, 0, 105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65,
-    70, 108, 121, 110, 81, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 91, 92, 106, 208, 67, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 311, 208, 208, 208, 208, 89, 107, 90, 78, 2, 287,
-    130, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    0, 80, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 329, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 0, 0, 456, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 119, 101, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 0,
-    111, 104, 112, 456, 0, 103, 109, 118, 129, 456, 456, 456, 100, 0, 456, 456,
-    456, 456, 456, 456, 173, 125, 456, 456, 456, 456, 0, 114, 175, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 126, 175, 456, 456, 94, 0, 2, 95, 123,
-    2, 174, 113, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 209, 116, 280,
+    1, 4, 4, 5, 79, 127, 68, 66, 174, 3, 222, 3, 3, 0, 0, 105,
+    69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65, 70, 108, 121, 110, 81,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 91, 92, 106,
+    209, 67, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    310, 209, 209, 209, 209, 89, 107, 90, 78, 2, 286, 2, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 0, 80, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 328,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 0, 0, 455, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46,
+    0, 0, 0, 0, 45, 128, 0, 103, 109, 130, 101, 119, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 0, 111,
+    104, 112, 455, 118, 129, 100, 455, 455, 455, 0, 175, 455, 455, 455, 455, 455,
+    455, 94, 173, 125, 0, 455, 455, 455, 455, 124, 175, 455, 455, 455, 114, 126,
+    455, 455, 455, 455, 455, 455, 455, 122, 455, 455, 2, 95, 123, 0, 174, 4,
+    113, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -2979,32 +2984,32 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 208, 116, 208, 1, 4, 4, 5, 79, 68, 127, 66, 124,
-    174, 122, 3, 223, 3, 3, 0, 0, 105, 69, 93, 131, 96, 98, 71, 99,
-    82, 97, 173, 65, 70, 108, 121, 110, 81, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 91, 92, 106, 208, 67, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 89, 107,
-    90, 78, 2, 287, 130, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 0, 80, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 373, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 0, 0, 456, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 119,
-    101, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 0, 111, 104, 112, 456, 0, 103, 109, 118, 129, 456, 456, 456,
-    100, 0, 456, 456, 456, 456, 456, 456, 173, 125, 456, 456, 456, 456, 0, 114,
-    175, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 126, 175, 456, 456, 94,
-    0, 2, 95, 123, 2, 174, 113, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 209, 116, 209, 1, 4, 4, 5, 79, 127, 68, 66, 174, 3, 222,
+    3, 3, 0, 0, 105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65,
+    70, 108, 121, 110, 81, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 91, 92, 106, 209, 67, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 89, 107, 90, 78, 2, 286,
+    2, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    0, 80, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 372, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 0, 0, 455, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 0, 103, 109, 130, 101,
+    119, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 0, 111, 104, 112, 455, 118, 129, 100, 455, 455, 455, 0, 175,
+    455, 455, 455, 455, 455, 455, 94, 173, 125, 0, 455, 455, 455, 455, 124, 175,
+    455, 455, 455, 114, 126, 455, 455, 455, 455, 455, 455, 455, 122, 455, 455, 2,
+    95, 123, 0, 174, 4, 113, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -3017,32 +3022,32 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 208, 116, 208, 1, 4, 4, 5, 79,
-    68, 127, 66, 124, 174, 122, 3, 223, 3, 3, 0, 0, 105, 69, 93, 131,
-    96, 98, 71, 99, 82, 97, 173, 65, 70, 108, 121, 110, 81, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 91, 92, 106, 208, 67, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 312, 208, 208,
-    208, 208, 89, 107, 90, 78, 2, 287, 130, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 303, 208, 0, 80, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 344,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 407, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 0, 0,
-    456, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0,
-    0, 45, 128, 119, 101, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 0, 111, 104, 112, 456, 0, 103, 109, 118,
-    129, 456, 456, 456, 100, 0, 456, 456, 456, 456, 456, 456, 173, 125, 456, 456,
-    456, 456, 0, 114, 175, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 126,
-    175, 456, 456, 94, 0, 2, 95, 123, 2, 174, 113, 4, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 209, 116, 209, 1, 4, 4, 5, 79, 127,
+    68, 66, 174, 3, 222, 3, 3, 0, 0, 105, 69, 93, 131, 96, 98, 71,
+    99, 82, 97, 173, 65, 70, 108, 121, 110, 81, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 91, 92, 106, 209, 67, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 311, 209, 209, 209, 209, 89,
+    107, 90, 78, 2, 286, 2, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 302, 209, 0, 80, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 343, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 406, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 0, 0, 455, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128,
+    0, 103, 109, 130, 101, 119, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 0, 111, 104, 112, 455, 118, 129, 100,
+    455, 455, 455, 0, 175, 455, 455, 455, 455, 455, 455, 94, 173, 125, 0, 455,
+    455, 455, 455, 124, 175, 455, 455, 455, 114, 126, 455, 455, 455, 455, 455, 455,
+    455, 122, 455, 455, 2, 95, 123, 0, 174, 4, 113, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -3055,32 +3060,32 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 208, 116, 208, 1,
-    4, 4, 5, 79, 68, 127, 66, 124, 174, 122, 3, 223, 3, 3, 0, 0,
-    105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65, 70, 108, 121, 110,
-    81, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 91, 92,
-    106, 208, 67, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 89, 107, 90, 78, 2, 287, 130, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 0, 80, 208, 208,
-    208, 333, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-    208, 208, 0, 0, 456, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    46, 0, 0, 0, 0, 45, 128, 119, 101, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 0, 111, 104, 112, 456,
-    0, 103, 109, 118, 129, 456, 456, 456, 100, 0, 456, 456, 456, 456, 456, 456,
-    173, 125, 456, 456, 456, 456, 0, 114, 175, 456, 456, 456, 456, 456, 456, 456,
-    456, 456, 456, 126, 175, 456, 456, 94, 0, 2, 95, 123, 2, 174, 113, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 209, 116, 209, 1,
+    4, 4, 5, 79, 127, 68, 66, 174, 3, 222, 3, 3, 0, 0, 105, 69,
+    93, 131, 96, 98, 71, 99, 82, 97, 173, 65, 70, 108, 121, 110, 81, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 91, 92, 106, 209,
+    67, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 89, 107, 90, 78, 2, 286, 2, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 0, 80, 209, 209, 209, 332,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+    0, 0, 455, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0,
+    0, 0, 0, 45, 128, 0, 103, 109, 130, 101, 119, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455,
+    455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 455, 0, 111, 104,
+    112, 455, 118, 129, 100, 455, 455, 455, 0, 175, 455, 455, 455, 455, 455, 455,
+    94, 173, 125, 0, 455, 455, 455, 455, 124, 175, 455, 455, 455, 114, 126, 455,
+    455, 455, 455, 455, 455, 455, 122, 455, 455, 2, 95, 123, 0, 174, 4, 113,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -3094,32 +3099,32 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    171, 116, 282, 1, 4, 4, 5, 79, 68, 127, 66, 124, 174, 122, 3, 223,
-    3, 3, 0, 0, 105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65,
-    70, 108, 121, 110, 81, 171, 171, 171, 171, 133, 171, 171, 171, 171, 171, 148,
-    136, 171, 91, 92, 106, 0, 67, 171, 171, 171, 171, 171, 171, 171, 171, 171,
-    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 89, 107, 90, 78, 2, 287,
-    130, 171, 171, 171, 171, 49, 171, 171, 9, 171, 171, 23, 171, 171, 171, 171,
-    0, 80, 171, 171, 50, 171, 171, 171, 171, 171, 171, 171, 38, 171, 171, 171,
-    171, 29, 43, 171, 171, 171, 171, 171, 22, 171, 36, 171, 39, 171, 171, 171,
-    72, 171, 171, 171, 171, 171, 13, 48, 27, 171, 171, 171, 171, 171, 171, 171,
-    35, 171, 171, 25, 171, 17, 171, 171, 171, 171, 171, 171, 171, 47, 171, 171,
-    171, 171, 16, 41, 171, 42, 171, 44, 171, 171, 74, 171, 171, 20, 6, 171,
-    18, 171, 171, 19, 171, 171, 171, 14, 171, 8, 171, 21, 171, 171, 28, 171,
-    171, 51, 171, 171, 171, 171, 171, 171, 34, 171, 7, 171, 171, 10, 171, 171,
-    171, 171, 31, 171, 24, 171, 171, 171, 15, 171, 171, 171, 171, 171, 12, 171,
-    171, 171, 171, 33, 171, 171, 171, 32, 171, 30, 171, 171, 171, 11, 171, 171,
-    171, 171, 171, 37, 26, 40, 0, 0, 172, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 119, 101, 172, 172, 132,
-    139, 137, 140, 138, 141, 144, 147, 143, 146, 157, 153, 155, 142, 145, 171, 152,
-    150, 151, 149, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
-    171, 171, 64, 171, 62, 171, 171, 61, 171, 63, 158, 172, 172, 169, 162, 163,
-    171, 171, 171, 171, 171, 171, 171, 56, 171, 52, 171, 171, 171, 171, 55, 54,
-    171, 171, 171, 171, 171, 58, 134, 135, 164, 165, 172, 172, 170, 160, 161, 0,
-    111, 104, 112, 154, 0, 103, 109, 118, 129, 171, 156, 159, 100, 0, 171, 171,
-    171, 171, 171, 171, 173, 125, 53, 171, 171, 57, 0, 114, 175, 171, 171, 171,
-    171, 171, 171, 60, 59, 166, 167, 126, 175, 172, 168, 94, 0, 2, 95, 123,
-    2, 174, 113, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 171, 116, 281, 1, 4, 4, 5, 79, 127, 68, 66, 174, 3, 222, 3,
+    3, 0, 0, 105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65, 70,
+    108, 121, 110, 81, 171, 171, 171, 171, 133, 171, 171, 171, 171, 171, 148, 136,
+    171, 91, 92, 106, 0, 67, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 89, 107, 90, 78, 2, 286, 2,
+    171, 171, 171, 171, 49, 171, 171, 9, 171, 171, 23, 171, 171, 171, 171, 0,
+    80, 171, 171, 50, 171, 171, 171, 171, 171, 171, 171, 38, 171, 171, 171, 171,
+    29, 43, 171, 171, 171, 171, 171, 22, 171, 36, 171, 39, 171, 171, 171, 72,
+    171, 171, 171, 171, 171, 13, 48, 27, 171, 171, 171, 171, 171, 171, 171, 35,
+    171, 171, 25, 171, 17, 171, 171, 171, 171, 171, 171, 171, 47, 171, 171, 171,
+    171, 16, 41, 171, 42, 171, 44, 171, 171, 74, 171, 171, 20, 6, 171, 18,
+    171, 171, 19, 171, 171, 171, 14, 171, 8, 171, 21, 171, 171, 28, 171, 171,
+    51, 171, 171, 171, 171, 171, 171, 34, 171, 7, 171, 171, 10, 171, 171, 171,
+    171, 31, 171, 24, 171, 171, 171, 15, 171, 171, 171, 171, 171, 12, 171, 171,
+    171, 171, 33, 171, 171, 171, 32, 171, 30, 171, 171, 171, 11, 171, 171, 171,
+    171, 171, 37, 26, 40, 0, 0, 172, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 0, 103, 109, 130, 101, 119,
+    172, 172, 132, 139, 137, 140, 138, 141, 144, 147, 143, 146, 157, 153, 155, 142,
+    145, 171, 152, 150, 151, 149, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 64, 171, 62, 171, 171, 61, 171, 63, 158, 172, 172,
+    169, 162, 163, 171, 171, 171, 171, 171, 171, 171, 56, 171, 52, 171, 171, 171,
+    171, 55, 54, 171, 171, 171, 171, 171, 58, 134, 135, 164, 165, 172, 172, 170,
+    160, 161, 0, 111, 104, 112, 154, 118, 129, 100, 171, 156, 159, 0, 175, 171,
+    171, 171, 171, 171, 171, 94, 173, 125, 0, 53, 171, 171, 57, 124, 175, 171,
+    171, 171, 114, 126, 171, 171, 171, 60, 59, 166, 167, 122, 172, 168, 2, 95,
+    123, 0, 174, 4, 113, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -3132,12 +3137,12 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 171, 116, 283, 1, 4, 4, 5, 79, 68, 127, 66, 124,
-    174, 122, 3, 223, 3, 3, 0, 0, 105, 69, 93, 131, 96, 98, 71, 99,
+    0, 0, 0, 0, 0, 0, 171, 116, 282, 1, 4, 4, 5, 79, 127, 68,
+    66, 174, 3, 222, 3, 3, 0, 0, 105, 69, 93, 131, 96, 98, 71, 99,
     82, 97, 173, 65, 70, 108, 121, 110, 81, 171, 171, 171, 171, 133, 171, 171,
     171, 171, 171, 148, 136, 171, 91, 92, 106, 0, 67, 171, 171, 171, 171, 171,
-    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 89, 209,
-    90, 78, 2, 287, 130, 171, 171, 171, 171, 49, 171, 171, 9, 171, 171, 23,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 89, 210,
+    90, 78, 2, 286, 2, 171, 171, 171, 171, 49, 171, 171, 9, 171, 171, 23,
     171, 171, 171, 171, 0, 80, 171, 171, 50, 171, 171, 171, 171, 171, 171, 171,
     38, 171, 171, 171, 171, 29, 43, 171, 171, 171, 171, 171, 22, 171, 36, 171,
     39, 171, 171, 171, 72, 171, 171, 171, 171, 171, 13, 48, 27, 171, 171, 171,
@@ -3148,54 +3153,16 @@ extern token_type_t const lexer_transition_table[51408] = {
     171, 10, 171, 171, 171, 171, 31, 171, 24, 171, 171, 171, 15, 171, 171, 171,
     171, 171, 12, 171, 171, 171, 171, 33, 171, 171, 171, 32, 171, 30, 171, 171,
     171, 11, 171, 171, 171, 171, 171, 37, 26, 40, 0, 0, 172, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 119,
-    101, 172, 172, 132, 139, 137, 140, 138, 141, 144, 147, 143, 146, 157, 153, 155,
-    142, 145, 171, 152, 150, 151, 149, 171, 171, 171, 171, 171, 171, 171, 171, 171,
-    171, 171, 171, 171, 171, 171, 64, 171, 62, 171, 171, 61, 171, 63, 158, 172,
-    172, 169, 162, 163, 171, 171, 171, 171, 171, 171, 171, 56, 171, 52, 171, 171,
-    171, 171, 55, 54, 171, 171, 171, 171, 171, 58, 134, 135, 164, 165, 172, 172,
-    170, 160, 161, 0, 111, 104, 112, 154, 0, 103, 109, 118, 129, 171, 156, 159,
-    100, 0, 171, 171, 171, 171, 171, 171, 173, 125, 53, 171, 171, 57, 0, 114,
-    175, 171, 171, 171, 171, 171, 171, 60, 59, 166, 167, 126, 175, 172, 168, 94,
-    0, 2, 95, 123, 2, 174, 113, 4, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 171, 116, 284, 1, 4, 4, 5, 79,
-    68, 127, 66, 124, 174, 122, 3, 223, 3, 3, 0, 0, 105, 69, 93, 131,
-    96, 98, 71, 99, 82, 97, 173, 65, 70, 108, 121, 110, 81, 171, 171, 171,
-    171, 133, 171, 171, 171, 171, 171, 148, 136, 171, 91, 92, 106, 0, 67, 171,
-    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
-    171, 171, 89, 107, 90, 78, 2, 287, 130, 171, 171, 171, 171, 49, 171, 171,
-    9, 171, 171, 23, 171, 171, 171, 171, 0, 80, 171, 171, 50, 171, 171, 171,
-    171, 171, 171, 171, 38, 171, 171, 171, 171, 29, 43, 171, 171, 171, 171, 171,
-    22, 171, 36, 171, 39, 171, 171, 171, 72, 171, 171, 171, 171, 171, 13, 48,
-    27, 171, 171, 171, 171, 171, 171, 171, 35, 171, 171, 25, 171, 17, 171, 171,
-    171, 171, 171, 171, 171, 47, 171, 171, 171, 171, 16, 41, 171, 42, 171, 44,
-    171, 171, 74, 171, 171, 20, 6, 171, 18, 171, 171, 19, 171, 171, 171, 14,
-    171, 8, 171, 21, 171, 171, 28, 171, 171, 51, 171, 171, 171, 171, 171, 171,
-    34, 171, 7, 171, 171, 10, 171, 171, 171, 171, 31, 171, 24, 171, 171, 171,
-    15, 171, 171, 171, 171, 171, 12, 171, 171, 171, 171, 33, 171, 171, 171, 32,
-    171, 30, 171, 171, 171, 11, 171, 171, 171, 171, 171, 37, 26, 40, 0, 0,
-    172, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0,
-    0, 45, 128, 119, 101, 172, 172, 132, 139, 137, 140, 138, 141, 144, 147, 143,
+    0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 128, 0,
+    103, 109, 130, 101, 119, 172, 172, 132, 139, 137, 140, 138, 141, 144, 147, 143,
     146, 157, 153, 155, 142, 145, 171, 152, 150, 151, 149, 171, 171, 171, 171, 171,
     171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 64, 171, 62, 171, 171, 61,
     171, 63, 158, 172, 172, 169, 162, 163, 171, 171, 171, 171, 171, 171, 171, 56,
     171, 52, 171, 171, 171, 171, 55, 54, 171, 171, 171, 171, 171, 58, 134, 135,
-    164, 165, 172, 172, 170, 160, 161, 0, 111, 104, 112, 154, 0, 103, 109, 118,
-    129, 171, 156, 159, 100, 0, 171, 171, 171, 171, 171, 171, 173, 125, 53, 171,
-    171, 57, 0, 114, 175, 171, 171, 171, 171, 171, 171, 60, 59, 166, 167, 126,
-    175, 172, 168, 94, 0, 2, 95, 123, 2, 174, 113, 4, 0, 0, 0, 0,
+    164, 165, 172, 172, 170, 160, 161, 0, 111, 104, 112, 154, 118, 129, 100, 171,
+    156, 159, 0, 175, 171, 171, 171, 171, 171, 171, 94, 173, 125, 0, 53, 171,
+    171, 57, 124, 175, 171, 171, 171, 114, 126, 171, 171, 171, 60, 59, 166, 167,
+    122, 172, 168, 2, 95, 123, 0, 174, 4, 113, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -3208,31 +3175,70 @@ extern token_type_t const lexer_transition_table[51408] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 171, 116, 285, 1,
-    4, 4, 5, 79, 68, 127, 66, 124, 174, 122, 3, 223, 3, 3, 0, 0,
-    105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65, 70, 108, 121, 110,
-    81, 171, 171, 171, 171, 133, 171, 171, 171, 171, 171, 148, 136, 171, 91, 92,
-    106, 0, 67, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
-    171, 171, 171, 171, 171, 171, 89, 107, 90, 78, 2, 287, 130, 171, 171, 171,
-    171, 49, 171, 171, 9, 171, 171, 23, 171, 171, 171, 171, 0, 80, 171, 171,
-    50, 171, 171, 171, 171, 171, 171, 171, 38, 171, 171, 171, 171, 29, 43, 171,
-    171, 171, 171, 171, 22, 171, 36, 171, 39, 171, 171, 171, 72, 171, 171, 171,
-    171, 171, 13, 48, 27, 171, 171, 171, 171, 171, 171, 171, 35, 171, 171, 25,
-    171, 17, 171, 171, 171, 171, 171, 171, 171, 47, 171, 171, 171, 171, 16, 41,
-    171, 42, 171, 44, 171, 171, 74, 171, 171, 20, 6, 171, 18, 171, 171, 19,
-    171, 171, 171, 14, 171, 8, 171, 21, 171, 171, 28, 171, 171, 51, 171, 171,
-    171, 171, 171, 171, 34, 171, 7, 171, 171, 10, 171, 171, 171, 171, 31, 171,
-    24, 171, 171, 171, 15, 171, 171, 171, 171, 171, 12, 171, 171, 171, 171, 33,
-    171, 171, 171, 32, 171, 30, 171, 171, 171, 11, 171, 171, 171, 171, 171, 37,
-    26, 40, 0, 0, 172, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    46, 0, 0, 0, 0, 45, 128, 119, 101, 172, 172, 132, 139, 137, 140, 138,
-    141, 144, 147, 143, 146, 157, 153, 155, 142, 145, 171, 152, 150, 151, 149, 171,
-    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 64, 171,
-    62, 171, 171, 61, 171, 63, 158, 172, 172, 169, 162, 163, 171, 171, 171, 171,
-    171, 171, 171, 56, 171, 52, 171, 171, 171, 171, 55, 54, 171, 171, 171, 171,
-    171, 58, 134, 135, 164, 165, 172, 172, 170, 160, 161, 0, 111, 104, 112, 154,
-    0, 103, 109, 118, 129, 171, 156, 159, 100, 0, 171, 171, 171, 171, 171, 171,
-    173, 125, 53, 171, 171, 57, 0, 114, 175, 171, 171, 171, 171, 171, 171, 60,
-    59, 166, 167, 126, 175, 172, 168, 94, 0, 2, 95, 123, 2, 174, 113, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 171, 116, 283, 1, 4,
+    4, 5, 79, 127, 68, 66, 174, 3, 222, 3, 3, 0, 0, 105, 69, 93,
+    131, 96, 98, 71, 99, 82, 97, 173, 65, 70, 108, 121, 110, 81, 171, 171,
+    171, 171, 133, 171, 171, 171, 171, 171, 148, 136, 171, 91, 92, 106, 0, 67,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 89, 107, 90, 78, 2, 286, 2, 171, 171, 171, 171, 49, 171,
+    171, 9, 171, 171, 23, 171, 171, 171, 171, 0, 80, 171, 171, 50, 171, 171,
+    171, 171, 171, 171, 171, 38, 171, 171, 171, 171, 29, 43, 171, 171, 171, 171,
+    171, 22, 171, 36, 171, 39, 171, 171, 171, 72, 171, 171, 171, 171, 171, 13,
+    48, 27, 171, 171, 171, 171, 171, 171, 171, 35, 171, 171, 25, 171, 17, 171,
+    171, 171, 171, 171, 171, 171, 47, 171, 171, 171, 171, 16, 41, 171, 42, 171,
+    44, 171, 171, 74, 171, 171, 20, 6, 171, 18, 171, 171, 19, 171, 171, 171,
+    14, 171, 8, 171, 21, 171, 171, 28, 171, 171, 51, 171, 171, 171, 171, 171,
+    171, 34, 171, 7, 171, 171, 10, 171, 171, 171, 171, 31, 171, 24, 171, 171,
+    171, 15, 171, 171, 171, 171, 171, 12, 171, 171, 171, 171, 33, 171, 171, 171,
+    32, 171, 30, 171, 171, 171, 11, 171, 171, 171, 171, 171, 37, 26, 40, 0,
+    0, 172, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0,
+    0, 0, 45, 128, 0, 103, 109, 130, 101, 119, 172, 172, 132, 139, 137, 140,
+    138, 141, 144, 147, 143, 146, 157, 153, 155, 142, 145, 171, 152, 150, 151, 149,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 64,
+    171, 62, 171, 171, 61, 171, 63, 158, 172, 172, 169, 162, 163, 171, 171, 171,
+    171, 171, 171, 171, 56, 171, 52, 171, 171, 171, 171, 55, 54, 171, 171, 171,
+    171, 171, 58, 134, 135, 164, 165, 172, 172, 170, 160, 161, 0, 111, 104, 112,
+    154, 118, 129, 100, 171, 156, 159, 0, 175, 171, 171, 171, 171, 171, 171, 94,
+    173, 125, 0, 53, 171, 171, 57, 124, 175, 171, 171, 171, 114, 126, 171, 171,
+    171, 60, 59, 166, 167, 122, 172, 168, 2, 95, 123, 0, 174, 4, 113, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    171, 116, 284, 1, 4, 4, 5, 79, 127, 68, 66, 174, 3, 222, 3, 3,
+    0, 0, 105, 69, 93, 131, 96, 98, 71, 99, 82, 97, 173, 65, 70, 108,
+    121, 110, 81, 171, 171, 171, 171, 133, 171, 171, 171, 171, 171, 148, 136, 171,
+    91, 92, 106, 0, 67, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 89, 107, 90, 78, 2, 286, 2, 171,
+    171, 171, 171, 49, 171, 171, 9, 171, 171, 23, 171, 171, 171, 171, 0, 80,
+    171, 171, 50, 171, 171, 171, 171, 171, 171, 171, 38, 171, 171, 171, 171, 29,
+    43, 171, 171, 171, 171, 171, 22, 171, 36, 171, 39, 171, 171, 171, 72, 171,
+    171, 171, 171, 171, 13, 48, 27, 171, 171, 171, 171, 171, 171, 171, 35, 171,
+    171, 25, 171, 17, 171, 171, 171, 171, 171, 171, 171, 47, 171, 171, 171, 171,
+    16, 41, 171, 42, 171, 44, 171, 171, 74, 171, 171, 20, 6, 171, 18, 171,
+    171, 19, 171, 171, 171, 14, 171, 8, 171, 21, 171, 171, 28, 171, 171, 51,
+    171, 171, 171, 171, 171, 171, 34, 171, 7, 171, 171, 10, 171, 171, 171, 171,
+    31, 171, 24, 171, 171, 171, 15, 171, 171, 171, 171, 171, 12, 171, 171, 171,
+    171, 33, 171, 171, 171, 32, 171, 30, 171, 171, 171, 11, 171, 171, 171, 171,
+    171, 37, 26, 40, 0, 0, 172, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 46, 0, 0, 0, 0, 45, 128, 0, 103, 109, 130, 101, 119, 172,
+    172, 132, 139, 137, 140, 138, 141, 144, 147, 143, 146, 157, 153, 155, 142, 145,
+    171, 152, 150, 151, 149, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 64, 171, 62, 171, 171, 61, 171, 63, 158, 172, 172, 169,
+    162, 163, 171, 171, 171, 171, 171, 171, 171, 56, 171, 52, 171, 171, 171, 171,
+    55, 54, 171, 171, 171, 171, 171, 58, 134, 135, 164, 165, 172, 172, 170, 160,
+    161, 0, 111, 104, 112, 154, 118, 129, 100, 171, 156, 159, 0, 175, 171, 171,
+    171, 171, 171, 171, 94, 173, 125, 0, 53, 171, 171, 57, 124, 175, 171, 171,
+    171, 114, 126, 171, 171, 171, 60, 59, 166, 167, 122, 172, 168, 2, 95, 123,
+    0, 174, 4, 113,
 };
 } // namespace lex
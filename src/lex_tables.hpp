@@ -211,7 +211,8 @@ constexpr token_type_t TOK_byte_block_bank_switch_ay = 204;
 constexpr token_type_t TOK_byte_block_byte_array = 205;
 constexpr token_type_t TOK_byte_block_locator_array = 206;
 constexpr token_type_t TOK_byte_block_sub_proc = 207;
-constexpr token_type_t TOK_END = 208;
+constexpr token_type_t TOK_byte_block_pending_array = 208;
+constexpr token_type_t TOK_END = 209;
 inline std::string_view token_name(token_type_t type)
 {
     using namespace std::literals;
@@ -425,6 +426,7 @@ inline std::string_view token_name(token_type_t type)
     case TOK_byte_block_byte_array: return "byte_block_byte_array"sv;
     case TOK_byte_block_locator_array: return "byte_block_locator_array"sv;
     case TOK_byte_block_sub_proc: return "byte_block_sub_proc"sv;
+    case TOK_byte_block_pending_array: return "byte_block_pending_array"sv;
     }
 }
 inline std::string_view token_string(token_type_t type)
@@ -640,6 +642,7 @@ inline std::string_view token_string(token_type_t type)
     case TOK_byte_block_byte_array: return "byte block array"sv;
     case TOK_byte_block_locator_array: return "byte block locator array"sv;
     case TOK_byte_block_sub_proc: return "byte block sub proc"sv;
+    case TOK_byte_block_pending_array: return "byte block pending array"sv;
     }
 }
 constexpr unsigned char token_precedence_table[] =
@@ -852,6 +855,7 @@ constexpr unsigned char token_precedence_table[] =
     0,
     0,
     0,
+    0,
 };
 constexpr bool token_right_assoc_table[] =
 {
@@ -1063,6 +1067,7 @@ constexpr bool token_right_assoc_table[] =
     0,
     0,
     0,
+    0,
 };
 #define lex_TOK_KEY_CASES \
     case TOK_if:\
@@ -1190,8 +1195,8 @@ constexpr bool token_right_assoc_table[] =
     case TOK_rshift_assign:\
     case TOK_rparen:\
 
-constexpr token_type_t TOK_LAST_STATE = 207;
-constexpr token_type_t TOK_START = 210;
+constexpr token_type_t TOK_LAST_STATE = 208;
+constexpr token_type_t TOK_START = 211;
 extern unsigned const lexer_ec_table[256];
-extern token_type_t const lexer_transition_table[51408];
+extern token_type_t const lexer_transition_table[51492];
 } // namespace lex
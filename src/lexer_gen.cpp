@@ -884,7 +884,8 @@ int main()
         accept("byte_block_bank_switch_ay", "assembly bank switch AY", eof()),
         accept("byte_block_byte_array", "byte block array", eof()),
         accept("byte_block_locator_array", "byte block locator array", eof()),
-        accept("byte_block_sub_proc", "byte block sub proc", eof())
+        accept("byte_block_sub_proc", "byte block sub proc", eof()),
+        accept("byte_block_pending_array", "byte block pending array", eof())
 
         ),
         nfa_nodes);
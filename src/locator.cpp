@@ -8,6 +8,7 @@
 #include "lt.hpp"
 #include "rom.hpp"
 #include "runtime.hpp"
+#include "outline.hpp"
 #include "fnv1a.hpp"
 #include "compiler_error.hpp"
 
@@ -85,6 +86,8 @@ std::string to_string(locator_t loc)
         str = fmt("nmi_index %", loc.fn()->global.name); break;
     case LOC_IRQ_INDEX:
         str = fmt("irq_index %", loc.fn()->global.name); break;
+    case LOC_OUTLINE:
+        str = "outline"; break;
     case LOC_CARRY_PAIR:
         str = fmt("carry_pair % %", loc.first_carry(), loc.second_carry()); break;
     }
@@ -206,7 +209,7 @@ type_t locator_t::type() const
         break;
     case LOC_ROM_ARRAY:
         if(rom_array_ht const a = rom_array())
-            return type_t::tea(TYPE_U, a.safe().data().size()); // TODO: use a proper pointer, with groups
+            return type_t::tea(TYPE_U, a.safe().size()); // TODO: use a proper pointer, with groups
         break;
     case LOC_LT_EXPR:
         assert(lt());
@@ -318,6 +321,12 @@ locator_t locator_t::link(romv_t romv, fn_ht fn_h, int bank) const
         }
         return *this;
 
+    case LOC_OUTLINE:
+        if(auto const* info = outline_proc->asm_proc(romv).lookup_label(minor_label(data())))
+            return from_offset(rom_alloc(romv), info->offset);
+        else // Likely a compiler bug:
+            throw std::runtime_error(fmt("Missing label during link: %", *this));
+
     case LOC_FN:
         // Functions with a known first bank must be called using that bank:
         if(is() == IS_BANK && fn()->first_bank_switch())
@@ -420,8 +429,8 @@ locator_t locator_t::link(romv_t romv, fn_ht fn_h, int bank) const
         {
             try
             {
-                std::uint8_t lo = linked_to_rom(v.results[romv].bytes[index].link(romv));
-                std::uint8_t hi = linked_to_rom(v.results[romv].bytes[index+1].link(romv));
+                std::uint8_t lo = linked_to_rom(v.results[romv].linked[index]);
+                std::uint8_t hi = linked_to_rom(v.results[romv].linked[index+1]);
                 return locator_t::addr(lo + (hi << 8) + offset());
             }
             catch(...)
@@ -430,8 +439,10 @@ locator_t locator_t::link(romv_t romv, fn_ht fn_h, int bank) const
             }
         }
 
-        passert(index < v.results[romv].bytes.size(), int(index), v.results[romv].bytes.size());
+        passert(index < v.results[romv].linked.size(), int(index), v.results[romv].linked.size());
 
+        if(locator_t const linked = v.results[romv].linked[index])
+            return linked;
         return v.results[romv].bytes[index].link(romv);
     };
 }
@@ -470,6 +481,8 @@ rom_data_ht locator_t::rom_data() const
         }
     case LOC_ASM_GOTO_MODE:
         return fn()->asm_goto_mode_rom_proc(data());
+    case LOC_OUTLINE:
+        return ::outline_proc;
     };
 }
 
@@ -90,6 +90,8 @@ enum locator_class_t : std::uint8_t
 
     LOC_ASM_GOTO_MODE,
 
+    LOC_OUTLINE, // Code shared by several fns, see outline.hpp
+
     NUM_LCLASS,
 };
 
@@ -577,6 +579,9 @@ public:
     constexpr static locator_t irq_index(fn_ht fn)
         { return fn ? locator_t(LOC_IRQ_INDEX, fn.id, 0, 0).with_is(IS_PTR) : const_byte(0); }
 
+    constexpr static locator_t outline(std::uint16_t label_id)
+        { return locator_t(LOC_OUTLINE, 0, label_id, 0); }
+
     constexpr static locator_t carry_pair(carry_t first, carry_t second)
         { return locator_t(LOC_CARRY_PAIR, 0, (first << 8) | second, 0).with_is(IS_PTR); }
 
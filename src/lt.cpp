@@ -1,5 +1,7 @@
 #include "lt.hpp"
 
+#include <stdexcept>
+
 #include "eval.hpp"
 
 lt_ht alloc_lt_value(type_t type, ast_node_t const& expr)
@@ -20,5 +22,21 @@ void lt_value_t::resolve(romv_t romv)
     append_locator_bytes(results[romv].bytes, rpair.value, type, ast.token.pstring);
     assert(resolved(romv));
 
+    // Cache the linked bytes, as they get requested repeatedly:
+    results[romv].linked.clear();
+    results[romv].linked.reserve(results[romv].bytes.size());
+    for(locator_t loc : results[romv].bytes)
+    {
+        try
+        {
+            results[romv].linked.push_back(loc.link(romv));
+        }
+        catch(std::runtime_error const&)
+        {
+            // Leave it null; 'locator_t::link' retries it, reporting the error where it's used.
+            results[romv].linked.push_back({});
+        }
+    }
+
     results[romv].rval = std::move(rpair.value);
 }
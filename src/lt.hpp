@@ -27,6 +27,7 @@ struct lt_value_t
     {
         rval_t rval;
         std::vector<locator_t> bytes;
+        std::vector<locator_t> linked; // 'bytes', after linking.
     };
 
     // After linking, the resolved value:
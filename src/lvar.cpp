@@ -98,6 +98,21 @@ lvars_manager_t::lvars_manager_t(fn_ht fn, asm_graph_t const& graph)
     // Also add every argument / return that has been referenced:
     fn->for_each_referenced_locator([&](locator_t loc){ insert_this_lvar(loc); });
 
+    // Args that callers were compiled against keep their storage, even if unused:
+    for(locator_t loc : fn->pinned_args())
+        insert_this_lvar(loc);
+
+    // Register-passed args and returns get spilled by whoever needs them,
+    // which might only be the caller:
+    if(fn->reg_args())
+    {
+        for(unsigned i = 0; i < fn->def().num_params; ++i)
+            insert_this_lvar(locator_t::arg(fn, i, 0, 0));
+
+        if(fn->type().return_type().name() != TYPE_VOID)
+            insert_this_lvar(locator_t::ret(fn, 0, 0));
+    }
+
     m_num_this_lvars = m_map.size();
     assert(m_this_lvar_info.size() == m_map.size());
 
@@ -9,6 +9,7 @@
 
 #include <boost/program_options.hpp>
 
+#include "convert.hpp"
 #include "file.hpp"
 #include "options.hpp"
 #include "parser.hpp"
@@ -21,12 +22,15 @@
 #include "rom_link.hpp"
 #include "ram_init.hpp"
 #include "cg_isel.hpp"
+#include "pbqp.hpp"
 #include "text.hpp"
 #include "compiler_error.hpp"
 #include "string.hpp"
 #include "mlb.hpp"
 #include "macro.hpp"
 #include "guard.hpp"
+#include "eval.hpp"
+#include "outline.hpp"
 
 extern char __GIT_COMMIT;
 
@@ -133,6 +137,9 @@ void handle_options(fs::path dir, po::options_description const& cfg_desc, po::v
     if(vm.count("build-time"))
         _options.build_time = true;
 
+    if(vm.count("verify-determinism"))
+        _options.verify_determinism = true;
+
     if(vm.count("error-on-warning"))
         _options.werror = true;
 
@@ -227,6 +234,71 @@ void handle_options(fs::path dir, po::options_description const& cfg_desc, po::v
 
     if(vm.count("unsafe-bank-switch"))
         _options.unsafe_bank_switch = true;
+
+    if(vm.count("avoid-page-cross"))
+        _options.avoid_page_cross = true;
+
+    if(vm.count("reg-args"))
+        _options.reg_args = true;
+
+    if(vm.count("explore-schedules"))
+        _options.explore_schedules = true;
+
+    if(vm.count("outline"))
+        _options.outline = true;
+}
+
+static std::string shell_quote(std::string_view arg)
+{
+#ifdef _WIN32
+    return '"' + std::string(arg) + '"';
+#else
+    std::string ret = "'";
+    for(char c : arg)
+    {
+        if(c == '\'')
+            ret += "'\\''";
+        else
+            ret.push_back(c);
+    }
+    ret.push_back('\'');
+    return ret;
+#endif
+}
+
+// Rebuilds in a single-threaded child process, then compares its ROM against 'rom'.
+static void verify_determinism(int argc, char** argv, std::vector<std::uint8_t> const& rom)
+{
+    std::string const ref_file = compiler_options().output_file + ".j1";
+
+    std::string command = shell_quote(argv[0]);
+    for(int i = 1; i < argc; ++i)
+        command += ' ' + shell_quote(argv[i]);
+    command += " --determinism-reference " + shell_quote(ref_file);
+#ifdef _WIN32
+    command = '"' + command + '"';
+#endif
+
+    if(std::system(command.c_str()) != 0)
+        throw std::runtime_error("Unable to verify determinism: single-threaded build failed.");
+
+    std::ifstream ifs(ref_file, std::ios::binary);
+    std::vector<std::uint8_t> const ref((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+    ifs.close();
+    std::filesystem::remove(ref_file);
+
+    if(ref.size() != rom.size())
+    {
+        throw std::runtime_error(fmt("Output is not deterministic: ROM size is % with -j1, but % with -j%.",
+                                     ref.size(), rom.size(), compiler_options().num_threads));
+    }
+
+    auto const mismatch = std::mismatch(ref.begin(), ref.end(), rom.begin());
+    if(mismatch.first != ref.end())
+    {
+        throw std::runtime_error(fmt("Output is not deterministic: -j1 and -j% differ at file offset %.",
+                                     compiler_options().num_threads, mismatch.first - ref.begin()));
+    }
 }
 
 int main(int argc, char** argv)
@@ -250,6 +322,7 @@ int main(int argc, char** argv)
             po::options_description cmdline_hidden("Hidden command line options");
             cmdline_hidden.add_options()
                 ("print-cpp-sizes", "print size of C++ objects")
+                ("determinism-reference", po::value<std::string>(), "single-threaded build used by --verify-determinism")
             ;
 
             po::options_description basic("Options");
@@ -262,6 +335,7 @@ int main(int argc, char** argv)
                 ("error-on-warning,W", "turn warnings into errors")
                 ("pause", "await input on stdin before exiting")
                 ("sloppy", "faster compile times, but worse optimization")
+                ("verify-determinism", "check that the output doesn't depend on thread count")
             ;
 
             po::options_description mapper_opt("Mapper options");
@@ -278,6 +352,10 @@ int main(int argc, char** argv)
             code_opt.add_options()
                 ("system,S", po::value<std::string>(), "target NES system")
                 ("unsafe-bank-switch", "faster but less safe bank switches")
+                ("avoid-page-cross", "place loops and the arrays they index to avoid page crossings")
+                ("reg-args", "pass the arguments of small leaf fns in registers")
+                ("explore-schedules", "slower compiles, recompiling each fn with several instruction schedules and keeping the smallest (chosen per fn, not per block)")
+                ("outline", "smaller but slower code, sharing repeated instruction sequences as subroutines")
                 ("mlb", po::value<std::string>(), "generate Mesen label file")
             ;
 
@@ -348,6 +426,18 @@ int main(int argc, char** argv)
 
             handle_options(fs::path(), config_full, vm);
 
+            if(vm.count("determinism-reference"))
+            {
+                // We're the child process of '--verify-determinism'.
+                // Build single-threaded, writing nothing but the ROM.
+                _options.num_threads = 1;
+                _options.output_file = vm["determinism-reference"].as<std::string>();
+                _options.raw_mlb.clear();
+                _options.graphviz = _options.ir_info = _options.ram_info = _options.rom_info = false;
+                _options.build_time = false;
+                _options.verify_determinism = false;
+            }
+
             if(compiler_options().source_names.empty())
                 throw std::runtime_error("No input files.");
 
@@ -469,24 +559,20 @@ int main(int argc, char** argv)
 
         // Parse the files, loading everything into globals:
         set_compiler_phase(PHASE_PARSE);
-        std::atomic<unsigned> next_file_i = 0;
+        unsigned next_file_i = 0;
         unsigned end_file_i = compiler_options().num_fab;
 
         do
         {
-            parallelize(compiler_options().num_threads,
-            [&next_file_i, end_file_i](std::atomic<bool>& exception_thrown)
+            // Parsing creates globals, and the order they're created in determines 
+            // their handles, which in turn affects the output.
+            // Thus, parsing is done on a single thread to keep the output deterministic.
+            // (Parsing is cheap compared to compiling.)
+            while(next_file_i < end_file_i)
             {
-                while(!exception_thrown)
-                {
-                    unsigned const file_i = next_file_i++;
-                    if(file_i >= end_file_i)
-                        return;
-
-                    file_contents_t file(file_i);
-                    parse<pass1_t>(file);
-                }
-            }, []{});
+                file_contents_t file(next_file_i++);
+                parse<pass1_t>(file);
+            }
 
             auto pair = finalize_macros();
             next_file_i = pair.first;
@@ -529,6 +615,7 @@ int main(int argc, char** argv)
 
         set_compiler_phase(PHASE_RESOLVE);
         global_t::resolve_all();
+        finish_conversions();
         output_time("resolve:  ");
 
         set_compiler_phase(PHASE_ORDER_PRECHECK);
@@ -548,6 +635,19 @@ int main(int argc, char** argv)
         global_t::compile_all();
         output_time("compile:  ");
 
+        if(compiler_options().build_time)
+        {
+            std::printf("pbqp: %llu exact, %llu fallback, %llu steps, %llu heuristic\n",
+                        (unsigned long long)pbqp_stats.exact_solves,
+                        (unsigned long long)pbqp_stats.exact_fallbacks,
+                        (unsigned long long)pbqp_stats.exact_steps,
+                        (unsigned long long)pbqp_stats.heuristic_reductions);
+            std::printf("ct memo: %llu hits, %llu misses, %llu clears\n",
+                        (unsigned long long)ct_memo_stats.hits,
+                        (unsigned long long)ct_memo_stats.misses,
+                        (unsigned long long)ct_memo_stats.clears);
+        }
+
         auto write_info = make_scope_guard([&]() {
             for(fn_t const& fn : fn_ht::values())
             {
@@ -586,11 +686,13 @@ int main(int argc, char** argv)
 
         set_compiler_phase(PHASE_INITIAL_VALUES);
         gen_group_var_inits();
+        create_outline_proc();
         output_time("init vals:");
 
         set_compiler_phase(PHASE_PREPARE_ALLOC_ROM);
         prune_rom_data();
         link_variables_optimize();
+        outline_procs();
         alloc_rom(nullptr, rom_allocator);
         if(compiler_options().ram_info)
         {
@@ -615,6 +717,12 @@ int main(int argc, char** argv)
         std::fclose(of);
         output_time("link:     ");
 
+        if(compiler_options().verify_determinism)
+        {
+            verify_determinism(argc, argv, rom);
+            output_time("verify:   ");
+        }
+
         if(mlb_out)
             print_mlb(mlb_out);
     }
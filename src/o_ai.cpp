@@ -1,13 +1,17 @@
 #include "o_ai.hpp"
 #include "o.hpp"
 
+#include <algorithm>
 #include <array>
+#include <vector>
 
 #include <boost/container/small_vector.hpp>
 
 #include "flat/flat_map.hpp"
 #include "flat/small_map.hpp"
 #include "flat/small_set.hpp"
+#include "robin/hash.hpp"
+#include "robin/map.hpp"
 
 #include "alloca.hpp"
 #include "bitset.hpp"
@@ -24,6 +28,7 @@
 #include "multi.hpp"
 #include "switch.hpp"
 #include "guard.hpp"
+#include "globals.hpp"
 
 namespace bc = ::boost::container;
 
@@ -107,6 +112,131 @@ void new_ssa(ssa_ht ssa)
         init_constraint(ssa);
 }
 
+// Only these ops are memoized, as their abstract functions are costly,
+// and set every result constraint, no matter its prior value.
+bool memoizable(ssa_op_t op, unsigned result_size)
+{
+    switch(op)
+    {
+    case SSA_add:
+    case SSA_sub:
+    case SSA_shl:
+    case SSA_shr:
+    case SSA_rol:
+    case SSA_ror:
+        return result_size <= 2;
+    case SSA_mul:
+    case SSA_eq:
+    case SSA_not_eq:
+    case SSA_lt:
+    case SSA_lte:
+    case SSA_multi_eq:
+    case SSA_multi_not_eq:
+        return result_size <= 1;
+    default:
+        return false;
+    }
+}
+
+// Abstract functions are pure, and many nodes share identical constraints,
+// particularly after byteify. This caches their results, keyed by the op and
+// the exact constraints going in.
+class abstract_memo_t
+{
+public:
+    // Returns nullptr on a miss, after which 'insert' should be called.
+    constraints_vec_t const* lookup(ssa_op_t op, constraints_def_t const* cv, unsigned argn, 
+                                    constraints_def_t const& result)
+    {
+        // Keep the memory bounded:
+        if(m_entries.size() >= MAX_ENTRIES)
+        {
+            m_buckets.clear();
+            m_entries.clear();
+            m_keys.clear();
+        }
+
+        m_key_begin = m_keys.size();
+        m_keys.push_back(op);
+        m_keys.push_back(argn);
+        push(result.cm);
+        m_keys.push_back(result.vec.size());
+        for(unsigned i = 0; i < argn; ++i)
+        {
+            push(cv[i].cm);
+            m_keys.push_back(cv[i].vec.size());
+            for(constraints_t const& c : cv[i].vec)
+            {
+                m_keys.push_back(c.bounds.min);
+                m_keys.push_back(c.bounds.max);
+                m_keys.push_back(c.bits.known0);
+                m_keys.push_back(c.bits.known1);
+            }
+        }
+
+        m_hash = 0;
+        for(unsigned i = m_key_begin; i < m_keys.size(); ++i)
+            m_hash = rh::hash_combine(m_hash, m_keys[i]);
+
+        if(unsigned const* head = m_buckets.mapped(m_hash))
+        {
+            for(unsigned e = *head; e != NO_ENTRY; e = m_entries[e].next)
+            {
+                entry_t const& entry = m_entries[e];
+                if(std::equal(m_keys.begin() + entry.key_begin, m_keys.begin() + entry.key_end,
+                              m_keys.begin() + m_key_begin, m_keys.end()))
+                {
+                    m_keys.resize(m_key_begin);
+                    return &entry.result;
+                }
+            }
+        }
+
+        return nullptr;
+    }
+
+    // Records the result of the last 'lookup'.
+    void insert(constraints_vec_t const& result)
+    {
+        unsigned& head = m_buckets.emplace(m_hash, []{ return NO_ENTRY; }).first->second;
+
+        entry_t& entry = m_entries.emplace_back();
+        entry.key_begin = m_key_begin;
+        entry.key_end = m_keys.size();
+        entry.next = head;
+        entry.result.assign(result.begin(), result.end());
+
+        head = m_entries.size() - 1;
+    }
+
+private:
+    void push(constraints_mask_t cm)
+    {
+        m_keys.push_back(cm.mask);
+        m_keys.push_back(cm.signed_);
+    }
+
+    static constexpr unsigned MAX_ENTRIES = 1 << 16;
+    static constexpr unsigned NO_ENTRY = ~0u;
+
+    struct entry_t
+    {
+        unsigned key_begin; // Into 'm_keys'.
+        unsigned key_end;
+        unsigned next; // The next entry in the same bucket.
+        constraints_vec_t result;
+    };
+
+    std::vector<std::uint64_t> m_keys;
+    std::vector<entry_t> m_entries;
+    rh::batman_map<std::size_t, unsigned> m_buckets; // Holds the first entry.
+
+    unsigned m_key_begin = 0;
+    std::size_t m_hash = 0;
+};
+
+TLS abstract_memo_t abstract_memo;
+
 
 } // End anonymous namespace
 
@@ -608,16 +738,17 @@ void ai_t::insert_traces()
         if(output_size < 2)
             continue;
 
-        assert(cfg_branch->last_daisy());
-        ssa_node_t& ssa_branch = *cfg_branch->last_daisy();
+        // Use a handle, as inserting traces can reallocate the SSA pool.
+        ssa_ht const ssa_branch = cfg_branch->last_daisy();
+        assert(ssa_branch);
 
         // If the condition is const, there's no point
         // in making a trace partition out of it.
-        ssa_value_t const condition = get_condition(ssa_branch);
+        ssa_value_t const condition = get_condition(*ssa_branch);
         if(!condition.is_handle())
             continue;
 
-        if(ssa_branch.op() == SSA_if)
+        if(ssa_branch->op() == SSA_if)
         {
             // Create new CFG nodes along each branch and insert SSA_traces into them.
             for(unsigned i = 0; i < output_size; ++i)
@@ -630,10 +761,10 @@ void ai_t::insert_traces()
                 insert_trace(cfg_trace, condition.handle(), ssa_value_t(i, type_name), 0);
             }
         }
-        else if(is_switch(ssa_branch.op()))
+        else if(is_switch(ssa_branch->op()))
         {
             // Create new CFG nodes along each non-default branch and insert SSA_traces into them.
-            unsigned const cases = ssa_switch_cases(ssa_branch.op());
+            unsigned const cases = ssa_switch_cases(ssa_branch->op());
             for(unsigned i = cases, j = 1; i < output_size; ++i, ++j)
             {
                 type_name_t const type_name = condition.type().name();
@@ -642,7 +773,7 @@ void ai_t::insert_traces()
                 cfg_ht const cfg_trace = ir.split_edge(cfg_branch->output_edge(i));
                 assert(cfg_trace->input_size() == 1 && cfg_trace->output_size() == 1);
                 new_cfg(cfg_trace);
-                insert_trace(cfg_trace, condition.handle(), ssa_value_t(ssa_branch.input(j).fixed(), type_name), 0);
+                insert_trace(cfg_trace, condition.handle(), ssa_value_t(ssa_branch->input(j).fixed(), type_name), 0);
             }
         }
         else
@@ -867,7 +998,27 @@ void ai_t::compute_constraints(executable_index_t exec_i, ssa_ht ssa_node)
             if(c.vec.size())
                 dprint(log, "--I", c.vec[0]);
 #endif
-        abstract_fn(ssa_node->op())(c.data(), input_size, d.constraints());
+
+        if(!memoizable(ssa_node->op(), d.constraints().vec.size()))
+            abstract_fn(ssa_node->op())(c.data(), input_size, d.constraints());
+        else if(constraints_vec_t const* memo = abstract_memo.lookup(ssa_node->op(), c.data(), input_size, d.constraints()))
+            d.constraints().vec = *memo;
+        else
+        {
+            abstract_fn(ssa_node->op())(c.data(), input_size, d.constraints());
+            abstract_memo.insert(d.constraints().vec);
+        }
+
+        // Args can be narrowed to what every caller passes:
+        if(ssa_node->op() == SSA_read_global && d.constraints().vec.size() == 1
+           && ssa_node->input(0).holds_ref() && ssa_node->input(0)->op() == SSA_entry)
+        {
+            locator_t const loc = ssa_node->input(1).locator();
+            constraints_mask_t const cm = d.constraints().cm;
+            if(loc.lclass() == LOC_ARG)
+                if(constraints_t const* arg = loc.fn()->arg_constraints(loc, cm))
+                    d.constraints().vec[0] = normalize(intersect(d.constraints().vec[0], *arg), cm);
+        }
     }
 }
 
@@ -2468,11 +2619,101 @@ void ai_t::rewrite_loops()
 
 } // End anonymous namespace
 
+namespace // Anonymous namespace
+{
+
+// Records the IR, and everything else the pass reads, in full detail.
+// If two signatures compare equal, the pass will do the same thing on both.
+struct ai_signature_t
+{
+    ir_t const* ir = nullptr;
+    bool byteified = false;
+    std::vector<std::uint64_t> words;
+    std::vector<type_t> types;
+
+    bool operator==(ai_signature_t const&) const = default;
+};
+
+void build_signature(ai_signature_t& sig, ir_t const& ir, bool byteified)
+{
+    sig.ir = &ir;
+    sig.byteified = byteified;
+    sig.words.clear();
+    sig.types.clear();
+
+    sig.words.push_back(ir.root.id);
+
+    for(cfg_ht cfg_it = ir.cfg_begin(); cfg_it; ++cfg_it)
+    {
+        cfg_node_t const& cfg = *cfg_it;
+
+        sig.words.push_back(cfg_it.id);
+        sig.words.push_back(cfg.input_size());
+        for(unsigned i = 0; i < cfg.input_size(); ++i)
+        {
+            cfg_fwd_edge_t const edge = cfg.input_edge(i);
+            sig.words.push_back((std::uint64_t(edge.handle.id) << 32) | edge.index);
+        }
+        sig.words.push_back(cfg.output_size());
+        for(unsigned i = 0; i < cfg.output_size(); ++i)
+            sig.words.push_back(cfg.output(i).id);
+
+        sig.words.push_back(cfg.ssa_size());
+        for(ssa_ht ssa_it = cfg.ssa_begin(); ssa_it; ++ssa_it)
+        {
+            ssa_node_t const& ssa = *ssa_it;
+
+            sig.words.push_back((std::uint64_t(ssa_it.id) << 32) | ssa.op());
+            sig.types.push_back(ssa.type());
+
+            sig.words.push_back(ssa.input_size());
+            for(unsigned i = 0; i < ssa.input_size(); ++i)
+                sig.words.push_back(ssa.input(i).value);
+
+            // Outputs are visited in order during propagation, which can affect widening.
+            sig.words.push_back(ssa.output_size());
+            for(unsigned i = 0; i < ssa.output_size(); ++i)
+            {
+                ssa_bck_edge_t const edge = ssa.output_edge(i);
+                sig.words.push_back((std::uint64_t(edge.handle.id) << 32) | edge.index);
+            }
+
+            if(constraints_t const* c = ai_prep(ssa_it).constraints.get())
+            {
+                sig.words.push_back(1);
+                sig.words.push_back(c->bounds.min);
+                sig.words.push_back(c->bounds.max);
+                sig.words.push_back(c->bits.known0);
+                sig.words.push_back(c->bits.known1);
+            }
+            else
+                sig.words.push_back(0);
+        }
+
+        for(ssa_ht ssa_it = cfg.first_daisy(); ssa_it; ssa_it = ssa_it->next_daisy())
+            sig.words.push_back(ssa_it.id);
+        sig.words.push_back(~0ull);
+    }
+}
+
+// The signature of the IR after the last run that didn't update anything.
+TLS ai_signature_t last_fixpoint;
+TLS ai_signature_t current_signature;
+
+} // End anonymous namespace
+
 bool o_abstract_interpret(log_t* log, ir_t& ir, bool byteified)
 {
     bool updated = false;
     resize_ai_prep();
 
+    // The pass is deterministic, so if nothing has changed since it last
+    // reached a fixpoint, it would reach the same one again.
+    build_signature(current_signature, ir, byteified);
+    if(current_signature == last_fixpoint)
+        return false;
+    last_fixpoint.ir = nullptr;
+
     {
         cfg_data_pool::scope_guard_t<cfg_ai_d> cg(cfg_pool::array_size());
         ssa_data_pool::scope_guard_t<ssa_ai_d> sg(ssa_pool::array_size());
@@ -2492,5 +2733,11 @@ bool o_abstract_interpret(log_t* log, ir_t& ir, bool byteified)
     // clean-up phis created by ai_t
     o_phis(log, ir);
 
+    if(!updated)
+    {
+        resize_ai_prep();
+        build_signature(last_fixpoint, ir, byteified);
+    }
+
     return updated;
 }
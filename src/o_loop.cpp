@@ -533,6 +533,10 @@ bool reverse_loop(cfg_ht header, iv_t& root, fixed_sint_t init, fixed_sint_t inc
         if(root.deps & VALUE_DEP)
             return false;
 
+        // An end of 0 wraps around, and the first index would become -1.
+        if((root.deps & INDEX_DEP) && end.eq_whole(0))
+            return false;
+
         // Rewrite array outputs:
         if(root.deps & INDEX_DEP)
             increment_array_offsets(root, -1);
@@ -631,8 +635,25 @@ bool rewrite_loop(bool is_do, bool is_byteified, iv_t& root,
     return true;
 }
 
+struct unroll_params_t
+{
+    unsigned max_cost; // Of the unrolled body, using 'estimate_cost'.
+    unsigned max_added_per_saved; // How much the body can grow for each unit saved.
+};
+
+constexpr unroll_params_t unroll_params(loop_goal_t goal)
+{
+    switch(goal)
+    {
+    default:
+    case LOOP_BALANCED: return { 64, ~0u };
+    case LOOP_SPEED:    return { 256, ~0u };
+    case LOOP_SIZE:     return { 64, 0 }; // Only unroll if it doesn't grow the code.
+    }
+}
+
 // Returns times unrolled, or 0 if nothing happened.
-fixed_sint_t unroll_loop(cfg_ht header, fixed_sint_t iterations)
+fixed_sint_t unroll_loop(cfg_ht header, fixed_sint_t iterations, loop_goal_t goal)
 {
     auto const& hd = header_data(header);
 
@@ -640,9 +661,10 @@ fixed_sint_t unroll_loop(cfg_ht header, fixed_sint_t iterations)
         return 0;
     cfg_ht const body = hd.simple_unroll_body;
 
+    unroll_params_t const params = unroll_params(goal);
+
     // Estimate the cost of each loop iteration.
 
-    constexpr unsigned MAX_COST = 64;
     unsigned cost_per_iter = 0;
 
     auto const calc_cost_per_iter = [&](cfg_ht cfg)
@@ -652,7 +674,7 @@ fixed_sint_t unroll_loop(cfg_ht header, fixed_sint_t iterations)
             if(ssa != hd.simple_condition && ssa != hd.simple_branch)
             {
                 cost_per_iter += estimate_cost(*ssa);
-                if(cost_per_iter > MAX_COST / 2)
+                if(cost_per_iter > params.max_cost / 2)
                     return false;
             }
         }
@@ -669,14 +691,58 @@ fixed_sint_t unroll_loop(cfg_ht header, fixed_sint_t iterations)
     if(cost_per_iter == 0)
         return 0;
 
-    unsigned unroll_amount = estimate_unroll_divisor(iterations, MAX_COST / cost_per_iter);
-    passert(iterations % unroll_amount == 0, iterations, unroll_amount);
+    // The cost paid each time the loop branches back:
+    unsigned const overhead = estimate_cost(*hd.simple_condition) + estimate_cost(*hd.simple_branch);
 
-    if(unroll_amount <= 1)
-        return 0;
+    // Unrolling 'amount' times removes all but one in 'amount' of the loop's branches,
+    // or every branch when fully unrolled, but copies the body 'amount - 1' times.
+    auto const saved = [&](fixed_sint_t amount) -> std::int64_t
+    {
+        std::int64_t const remaining = amount == iterations ? 0 : iterations / amount;
+        return (iterations - remaining) * overhead;
+    };
+
+    auto const added = [&](fixed_sint_t amount) -> std::int64_t
+    {
+        std::int64_t const copies = (amount - 1) * cost_per_iter;
+        return amount == iterations ? copies - overhead : copies;
+    };
+
+    auto const worth_it = [&](fixed_sint_t amount)
+    {
+        return added(amount) <= 0 || std::uint64_t(added(amount)) <= std::uint64_t(saved(amount)) * params.max_added_per_saved;
+    };
+
+    // Evaluate each divisor that fits, along with fully unrolling,
+    // keeping whichever saves the most. Not unrolling is the fallback.
+    fixed_sint_t unroll_amount = 1;
+
+    auto const consider = [&](fixed_sint_t amount)
+    {
+        if(amount <= 1 || !worth_it(amount))
+            return;
+        if(unroll_amount == 1 || saved(amount) > saved(unroll_amount)
+           || (saved(amount) == saved(unroll_amount) && added(amount) < added(unroll_amount)))
+        {
+            unroll_amount = amount;
+        }
+    };
+
+    for(unsigned d = params.max_cost / cost_per_iter; d > 1;)
+    {
+        unsigned const divisor = estimate_unroll_divisor(iterations, d);
+        passert(iterations % divisor == 0, iterations, divisor);
+        consider(divisor);
+        d = divisor - 1;
+    }
 
+    // If half the iterations fit, fully unroll instead,
+    // as the branch can then be removed entirely.
     if(unroll_amount * 2 >= iterations)
-        unroll_amount = iterations;
+        consider(iterations);
+
+    if(unroll_amount <= 1)
+        return 0;
 
     auto const in_unroll = [&](cfg_ht cfg) { return cfg == header || cfg == body; };
 
@@ -799,7 +865,343 @@ fixed_sint_t unroll_loop(cfg_ht header, fixed_sint_t iterations)
     return unroll_amount;
 }
 
-bool initial_loop_processing(log_t* log, ir_t& ir, bool is_byteified)
+// Splits a loop that walks an array larger than a page into strips of up to 256 iterations.
+// Each strip counts with a U and indexes with 'read_array8'/'write_array8' plus a constant offset,
+// which turns 16-bit pointer arithmetic into X/Y indexing.
+// The strips are built as 'do' loops, replacing the original CFG nodes.
+bool strip_loop(ir_t& ir, cfg_ht header, iv_t& root, fixed_sint_t increment, bool is_byteified, loop_goal_t goal)
+{
+    using namespace ssai::array;
+
+    auto const& hd = header_data(header);
+
+    // Array16 ops are gone once byteified.
+    if(is_byteified || goal == LOOP_SIZE)
+        return false;
+
+    if(!hd.simple_unroll_body || hd.loop_exits != 1)
+        return false;
+
+    cfg_ht const body = hd.simple_unroll_body;
+    ssa_ht const condition = hd.simple_condition;
+    ssa_ht const branch = hd.simple_branch;
+    cfg_ht const branch_cfg = branch->cfg_node();
+
+    type_name_t const root_type = root.phi->type().name();
+    if(is_signed(root_type) || whole_bytes(root_type) != 2 || frac_bytes(root_type) != 0)
+        return false;
+
+    // Only count up by 1:
+    if(!root.plus() || fixed_uint_t(increment) != low_bit_only(numeric_bitmask(root_type)))
+        return false;
+
+    if(!root.init.is_num() || hd.simple_condition_iv_i != 0)
+        return false;
+
+    ssa_value_t const compare_with = condition->input(1);
+    if(!compare_with.is_num())
+        return false;
+
+    // 'while' loops check the phi before the body runs, 'do' loops check after.
+    bool const on_arith = condition->input(0) == root.arith;
+    if(!hd.simple_do && on_arith)
+        return false;
+
+    // The first value the condition exits on:
+    std::int64_t const first = root.init.whole();
+    std::int64_t end = compare_with.whole();
+
+    switch(condition->op())
+    {
+    case SSA_lte:
+        end += 1;
+        break;
+    case SSA_lt:
+    case SSA_not_eq:
+        break;
+    default:
+        return false;
+    }
+
+    if(end > std::int64_t(numeric_bitmask(root_type) >> fixed_t::shift))
+        return false;
+
+    std::int64_t const iterations = end - first + (hd.simple_do && !on_arith);
+
+    // Smaller loops don't need strips:
+    if(iterations <= 256)
+        return false;
+
+    auto const in_loop = [&](ssa_ht ssa) { return ssa->cfg_node() == header || ssa->cfg_node() == body; };
+
+    // The IV can only index arrays, beyond counting:
+    bool indexes = false;
+    bool arith_indexes = false;
+
+    auto const check_outputs = [&](ssa_ht iv_ssa, ssa_ht other) -> bool
+    {
+        for(unsigned i = 0; i < iv_ssa->output_size(); ++i)
+        {
+            auto const oe = iv_ssa->output_edge(i);
+
+            if(oe.handle == other || oe.handle == condition)
+                continue;
+
+            if((oe.handle->op() == SSA_read_array16 || oe.handle->op() == SSA_write_array16)
+               && oe.index == INDEX && in_loop(oe.handle) && oe.handle->input(OFFSET).is_num())
+            {
+                indexes = true;
+                arith_indexes |= iv_ssa == root.arith;
+                continue;
+            }
+
+            return false;
+        }
+        return true;
+    };
+
+    if(!check_outputs(root.phi, root.arith) || !check_outputs(root.arith, root.phi) || !indexes)
+        return false;
+
+    // The body can't merge control flow:
+    if(body != header && body->phi_begin())
+        return false;
+
+    // 'while' loops get rotated into 'do' loops,
+    // which is only possible when the header does nothing but branch.
+    if(!hd.simple_do)
+        for(ssa_ht ssa = header->ssa_begin(); ssa; ++ssa)
+            if(ssa->op() != SSA_phi && ssa != condition && ssa != branch)
+                return false;
+
+    // Every strip copies the loop, so it has to be cheap.
+    unsigned cost = 0;
+    auto const add_cost = [&](cfg_ht cfg)
+    {
+        for(ssa_ht ssa = cfg->ssa_begin(); ssa; ++ssa)
+            if(ssa != condition && ssa != branch)
+                cost += estimate_cost(*ssa);
+    };
+
+    add_cost(header);
+    if(body != header)
+        add_cost(body);
+
+    // An arith index would wrap at 256, so its strips stop one short.
+    unsigned const strip_size = arith_indexes ? 255 : 256;
+    unsigned const strips = (iterations + strip_size - 1) / strip_size;
+
+    if((strips - 1) * cost > unroll_params(goal).max_cost)
+        return false;
+
+    // Number the nodes to copy, skipping the old condition and branch:
+    std::vector<ssa_ht> orig_map;
+    std::vector<ssa_value_t> reentry_values;
+
+    auto const init_map = [&](cfg_ht cfg)
+    {
+        for(ssa_ht ssa = cfg->ssa_begin(); ssa; ++ssa)
+        {
+            if(ssa == condition || ssa == branch)
+                continue;
+
+            // After a 'while' loop, only the header's phis are visible.
+            if(!hd.simple_do && ssa->op() != SSA_phi)
+                for(unsigned i = 0; i < ssa->output_size(); ++i)
+                    if(!in_loop(ssa->output(i)))
+                        return false;
+
+            data(ssa).unroll_i = orig_map.size();
+            orig_map.push_back(ssa);
+            reentry_values.push_back(ssa->op() == SSA_phi ? ssa->input(hd.simple_reentry_i) : ssa_value_t{});
+        }
+        return true;
+    };
+
+    if(!init_map(header) || (body != header && !init_map(body)))
+        return false;
+
+    unsigned const phi_i = data(root.phi).unroll_i;
+    unsigned const arith_i = data(root.arith).unroll_i;
+
+    std::vector<ssa_value_t> map(orig_map.size());
+    std::vector<ssa_value_t> prev_map(orig_map.size());
+
+    auto const lookup = [&](std::vector<ssa_value_t> const& m, ssa_value_t v) -> ssa_value_t
+    {
+        if(v.holds_ref() && in_loop(v.handle()))
+            return m[data(v.handle()).unroll_i];
+        return v;
+    };
+
+    // Phis receive the values the previous strip would have looped with,
+    // except for the IV, which restarts at 0.
+    auto const entry_fn = [&](ssa_ht phi) -> ssa_value_t
+    {
+        unsigned const i = data(phi).unroll_i;
+        if(i == phi_i)
+            return ssa_value_t(0u, TYPE_U);
+        return lookup(prev_map, reentry_values[i]);
+    };
+
+    auto const reentry_fn = [&](ssa_ht phi) -> ssa_value_t
+    {
+        return lookup(map, reentry_values[data(phi).unroll_i]);
+    };
+
+    cfg_ht prev_header = {};
+    cfg_ht prev_body = {};
+
+    for(unsigned p = 0; p < strips; ++p)
+    {
+        unsigned const length = std::min<std::int64_t>(strip_size, iterations - p * strip_size);
+        unsigned const offset = first + p * strip_size;
+
+        cfg_ht const strip_header = ir.emplace_cfg();
+        cfg_ht const strip_body = body != header ? ir.emplace_cfg() : strip_header;
+
+        // Create new nodes, but don't fill their inputs yet.
+        for(unsigned i = 0; i < orig_map.size(); ++i)
+        {
+            ssa_ht const orig = orig_map[i];
+            cfg_ht const cfg = orig->cfg_node() == header ? strip_header : strip_body;
+
+            ssa_op_t op = orig->op();
+            type_t type = orig->type();
+
+            if(i == phi_i || i == arith_i)
+                type = TYPE_U;
+            else if(op == SSA_read_array16 || op == SSA_write_array16)
+            {
+                ssa_value_t const index = orig->input(INDEX);
+                if(index == root.phi || index == root.arith)
+                    op = (op == SSA_read_array16) ? SSA_read_array8 : SSA_write_array8;
+            }
+
+            ssa_ht const ssa = cfg->emplace_ssa(op, type);
+            new_ssa(ssa);
+            data(ssa).unroll_i = i;
+
+            if(orig->in_daisy())
+                ssa->append_daisy();
+
+            map[i] = ssa;
+        }
+
+        // Finish new nodes:
+        for(unsigned i = 0; i < orig_map.size(); ++i)
+        {
+            ssa_ht const orig = orig_map[i];
+            ssa_ht const ssa = map[i].handle();
+
+            if(orig->op() == SSA_phi)
+                continue; // Phis get their inputs as the CFG is linked.
+
+            if(i == arith_i)
+            {
+                ssa->alloc_input(3);
+                ssa->build_set_input(root.arith_to_phi_input, map[phi_i]);
+                ssa->build_set_input(!root.arith_to_phi_input, ssa_value_t(1u, TYPE_U));
+                ssa->build_set_input(2, orig->input(2));
+                continue;
+            }
+
+            unsigned const input_size = orig->input_size();
+            for(unsigned j = 0; j < input_size; ++j)
+                ssa->link_append_input(lookup(map, orig->input(j)));
+
+            if(ssa->op() != orig->op())
+                ssa->link_change_input(OFFSET, ssa_value_t(orig->input(OFFSET).whole() + offset, TYPE_U20));
+        }
+
+        // Loop until the arith wraps around to the strip's length:
+        ssa_ht const strip_condition = strip_body->emplace_ssa(
+            SSA_not_eq, TYPE_BOOL, map[arith_i], ssa_value_t(length & 0xFF, TYPE_U));
+        new_ssa(strip_condition);
+
+        ssa_ht const strip_branch = strip_body->emplace_ssa(SSA_if, TYPE_VOID, strip_condition);
+        new_ssa(strip_branch);
+        strip_branch->append_daisy();
+
+        if(p == 0)
+        {
+            // Move the loop's entries over to the first strip.
+            std::vector<ssa_value_t> entry_values(orig_map.size());
+
+            for(unsigned i = 0; i < header->input_size();)
+            {
+                cfg_ht const input = header->input(i);
+                if(input == header || input == body)
+                {
+                    ++i;
+                    continue;
+                }
+
+                for(ssa_ht phi = header->phi_begin(); phi; ++phi)
+                    entry_values[data(phi).unroll_i] = phi->input(i);
+
+                // This replaces input 'i' with the last input, so 'i' isn't incremented.
+                input->link_change_output(header->input_edge(i).index, strip_header, [&](ssa_ht phi) -> ssa_value_t
+                {
+                    unsigned const k = data(phi).unroll_i;
+                    if(k == phi_i)
+                        return ssa_value_t(0u, TYPE_U);
+                    return entry_values[k];
+                });
+            }
+        }
+        else
+        {
+            // Exit the previous strip into this one:
+            prev_body->link_append_output(strip_header, entry_fn);
+            std::swap(map, prev_map);
+            prev_body->link_append_output(prev_header, reentry_fn);
+            std::swap(map, prev_map);
+        }
+
+        if(strip_body != strip_header)
+            strip_header->build_append_output(strip_body);
+
+        prev_header = strip_header;
+        prev_body = strip_body;
+        std::swap(map, prev_map);
+    }
+
+    std::swap(map, prev_map); // 'map' now holds the last strip.
+
+    // Fix up uses outside the loop:
+    for(unsigned i = 0; i < orig_map.size(); ++i)
+    {
+        ssa_ht const orig = orig_map[i];
+
+        // In 'do' loops, the exit sees the last iteration's values.
+        // In 'while' loops, it sees what the phis would have looped with.
+        ssa_value_t const exit_value = hd.simple_do ? map[i] : lookup(map, reentry_values[i]);
+
+        for(unsigned j = 0; j < orig->output_size();)
+        {
+            auto const oe = orig->output_edge(j);
+            if(in_loop(oe.handle))
+                ++j;
+            else
+                oe.handle->link_change_input(oe.index, exit_value);
+        }
+    }
+
+    // Exit the last strip:
+    auto const exit_edge = branch_cfg->output_edge(0);
+    prev_body->link_append_output(exit_edge.handle, [&](ssa_ht phi) { return phi->input(exit_edge.index); });
+    prev_body->link_append_output(prev_header, reentry_fn);
+
+    // The original loop is now unreachable:
+    ir.prune_cfg(header);
+    if(body != header)
+        ir.prune_cfg(body);
+
+    return true;
+}
+
+bool initial_loop_processing(log_t* log, ir_t& ir, bool is_byteified, loop_goal_t goal)
 {
     bool updated = false;
 
@@ -1179,6 +1581,14 @@ bool initial_loop_processing(log_t* log, ir_t& ir, bool is_byteified)
                 goto fail;
             fixed_sint_t increment = root->operand.signed_fixed() * root->sign();
 
+            // Loops over large arrays get split into strips, replacing this loop.
+            // The loop data is now stale, so the rest waits until the next pass.
+            if(strip_loop(ir, header, *root, increment, is_byteified, goal))
+            {
+                dprint(log, "STRIPPED", header);
+                return true;
+            }
+
             // First, try to reverse the loop:
             if(reverse_loop(header, *root, init, increment, d.simple_condition, d.simple_condition_iv_i, d.simple_branch->cfg_node()))
             {
@@ -1276,7 +1686,7 @@ bool initial_loop_processing(log_t* log, ir_t& ir, bool is_byteified)
                 }
             }
 
-            if(fixed_sint_t unroll_amount = unroll_loop(header, iterations))
+            if(fixed_sint_t unroll_amount = unroll_loop(header, iterations, goal))
             {
                 dprint(log, "UNROLLED", unroll_amount);
                 iterations /= unroll_amount;
@@ -1334,7 +1744,7 @@ bool initial_loop_processing(log_t* log, ir_t& ir, bool is_byteified)
 // LOOP //
 //////////
 
-bool o_loop(log_t* log, ir_t& ir, bool is_byteified)
+bool o_loop(log_t* log, ir_t& ir, bool is_byteified, loop_goal_t goal)
 {
     build_loops_and_order(ir);
     build_dominators_from_order(ir);
@@ -1350,7 +1760,7 @@ bool o_loop(log_t* log, ir_t& ir, bool is_byteified)
 
     ssa_data_pool::scope_guard_t<ssa_loop_d> ssa_sg(ssa_pool::array_size());
 
-    updated |= initial_loop_processing(log, ir, is_byteified);
+    updated |= initial_loop_processing(log, ir, is_byteified, goal);
 
     return updated;
 }
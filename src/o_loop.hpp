@@ -4,6 +4,15 @@
 #include "debug_print.hpp"
 #include "ir_decl.hpp"
 
-bool o_loop(log_t* log, ir_t& ir, bool is_byteified);
+// How unrolling trades ROM for speed.
+// Fns pick this using the '+speed' and '+size' modifiers.
+enum loop_goal_t
+{
+    LOOP_BALANCED,
+    LOOP_SPEED,
+    LOOP_SIZE,
+};
+
+bool o_loop(log_t* log, ir_t& ir, bool is_byteified, loop_goal_t goal);
 
 #endif
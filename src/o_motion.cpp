@@ -84,6 +84,9 @@ public:
         // Now merge GVN sets:
         for(auto const& pair : m_gvn_sets)
             merge_gvn_set(pair.second);
+
+        // Then handle what's only redundant on some paths:
+        run_pre(ir);
     }
 
     gvn_t to_gvn(ssa_value_t v)
@@ -144,15 +147,210 @@ public:
         updated = true;
     }
 
+    // Partial redundancy elimination, by translating expressions through phis.
+    // Given 'op(phi(a, b))' where 'op(a)' is available in the first predecessor,
+    // 'op(b)' gets computed in the second and the two are joined by a new phi.
+    void run_pre(ir_t& ir)
+    {
+        std::vector<ssa_ht> candidates;
+
+        for(cfg_node_t const& cfg_node : ir)
+        {
+            if(cfg_node.input_size() < 2)
+                continue;
+
+            for(ssa_ht ssa_it = cfg_node.ssa_begin(); ssa_it; ++ssa_it)
+                if(pre_candidate(ssa_it))
+                    candidates.push_back(ssa_it);
+        }
+
+        m_touched.assign(ssa_pool::array_size(), false);
+
+        for(ssa_ht ssa : candidates)
+            pre(ir, ssa);
+    }
+
+    bool pre_candidate(ssa_ht ssa) const
+    {
+        if(ssa->op() == SSA_phi
+           || ssa->in_daisy()
+           || (ssa_flags(ssa->op()) & (SSAF_NO_GVN | SSAF_WRITE_ARRAY | SSAF_IO_IMPURE | SSAF_CONDITIONAL))
+           || (ssa_input0_class(ssa->op()) == INPUT_LINK)
+           || !pure(*ssa))
+        {
+            return false;
+        }
+
+        // Only single bytes are worth keeping live across edges.
+        if(!is_arithmetic(ssa->type().name()) || ssa->type().size_of() != 1)
+            return false;
+
+        // Linked outputs (like carries) can't be moved onto a phi.
+        for(unsigned i = 0; i < ssa->output_size(); ++i)
+            if(ssa_input0_class(ssa->output(i)->op()) == INPUT_LINK)
+                return false;
+
+        cfg_ht const cfg = ssa->cfg_node();
+        bool has_phi = false;
+
+        for(unsigned i = 0; i < ssa->input_size(); ++i)
+        {
+            ssa_value_t const input = ssa->input(i);
+            if(!input.holds_ref())
+                continue;
+            if(input->cfg_node() == cfg)
+            {
+                if(input->op() != SSA_phi)
+                    return false;
+                has_phi = true;
+            }
+            else if(!dominates(input->cfg_node(), cfg))
+                return false;
+        }
+
+        return has_phi;
+    }
+
+    bool touched(ssa_value_t v) const 
+    { 
+        return v.holds_ref() && (v.handle().id >= m_touched.size() || m_touched[v.handle().id]); 
+    }
+
+    void touch(ssa_ht h)
+    {
+        if(h.id >= m_touched.size())
+            m_touched.resize(h.id + 1, false);
+        m_touched[h.id] = true;
+    }
+
+    // Edges split by 'pre' lack dominator info, so use their predecessor instead.
+    cfg_ht dom_cfg(cfg_ht cfg) const
+    {
+        if(cfg.id < m_split.size() && m_split[cfg.id])
+            return cfg->input(0);
+        return cfg;
+    }
+
+    void pre(ir_t& ir, ssa_ht ssa)
+    {
+        if(touched(ssa))
+            return;
+
+        cfg_ht const cfg = ssa->cfg_node();
+        unsigned const input_size = ssa->input_size();
+        unsigned const pred_size = cfg->input_size();
+
+        for(unsigned j = 0; j < input_size; ++j)
+            if(touched(ssa->input(j)))
+                return;
+
+        // The translated inputs, per predecessor:
+        std::vector<ssa_value_t> translated(pred_size * input_size);
+        std::vector<ssa_value_t> available(pred_size);
+        std::vector<gvn_t> args(input_size);
+        unsigned num_available = 0;
+
+        for(unsigned i = 0; i < pred_size; ++i)
+        {
+            cfg_ht const pred = dom_cfg(cfg->input(i));
+
+            // Skip loop headers, as back edges would need a recurrence.
+            if(dominates(cfg, pred))
+                return;
+
+            for(unsigned j = 0; j < input_size; ++j)
+            {
+                ssa_value_t v = ssa->input(j);
+                if(v.holds_ref() && v->cfg_node() == cfg)
+                {
+                    assert(v->op() == SSA_phi);
+                    v = v->input(i);
+                }
+
+                if(touched(v))
+                    return;
+
+                translated[i * input_size + j] = v;
+                args[j] = to_gvn(v);
+            }
+
+            if(ssa_flags(ssa->op()) & SSAF_COMMUTATIVE)
+                if(args[0] > args[1])
+                    std::swap(args[0], args[1]);
+
+            if(gvn_t const* gvn = m_key_map.mapped(gvn_key_t{ ssa->op(), std::uint16_t(input_size), args.data(), ssa->type() }))
+            if(auto const* set = m_gvn_sets.mapped(*gvn))
+            {
+                ssa_ht const def = (*set)[0];
+                if(!touched(def) && dominates(def->cfg_node(), pred))
+                {
+                    available[i] = def;
+                    ++num_available;
+                    continue;
+                }
+            }
+        }
+
+        if(num_available == 0)
+            return;
+
+        // Each phi input can cost a copy into a register or ZP,
+        // so only proceed when the saved computations outweigh them.
+        if(estimate_cost(*ssa) * num_available <= pred_size * ssa->type().size_of())
+            return;
+
+        ssa_ht const phi = cfg->emplace_ssa(SSA_phi, ssa->type());
+        touch(phi);
+        phi->alloc_input(pred_size);
+
+        for(unsigned i = 0; i < pred_size; ++i)
+        {
+            if(!available[i])
+            {
+                // Computations are inserted on the edge, splitting it if critical.
+                // (Code gen splits these edges anyway.)
+                cfg_fwd_edge_t const edge = cfg->input_edge(i);
+                cfg_ht insert_cfg = edge.handle;
+                if(insert_cfg->output_size() != 1)
+                {
+                    insert_cfg = ir.split_edge(edge.output());
+                    if(insert_cfg.id >= m_split.size())
+                        m_split.resize(insert_cfg.id + 1, false);
+                    m_split[insert_cfg.id] = true;
+                    cfg_changed = true;
+                }
+
+                ssa_ht const insert = insert_cfg->emplace_ssa(ssa->op(), ssa->type());
+                touch(insert);
+                insert->alloc_input(input_size);
+                for(unsigned j = 0; j < input_size; ++j)
+                    insert->build_set_input(j, translated[i * input_size + j]);
+                available[i] = insert;
+            }
+
+            phi->build_set_input(i, available[i]);
+        }
+
+        dprint(log, "GVN_PRE", ssa, "with", phi);
+        touch(ssa);
+        ssa->replace_with(phi);
+        ssa->prune();
+
+        updated = true;
+    }
+
     static ssa_gvn_d& data(ssa_ht h) { return h.data<ssa_gvn_d>(); }
 
     bool updated = false;
+    bool cfg_changed = false;
 
 private:
     array_pool_t<gvn_t> m_pool;
     rh::robin_map<gvn_key_t, gvn_t> m_key_map;
     rh::batman_map<gvn_t, std::vector<ssa_ht>> m_gvn_sets;
     gvn_t m_next_gvn = 1ull;
+    std::vector<bool> m_touched;
+    std::vector<bool> m_split;
 
     log_t* log = nullptr;
 };
@@ -267,6 +465,12 @@ bool o_motion(log_t* log, ir_t& ir)
         ssa_data_pool::scope_guard_t<ssa_gvn_d> sg(ssa_pool::array_size());
         run_gvn_t runner(log, ir);
         updated |= runner.updated;
+
+        if(runner.cfg_changed)
+        {
+            build_loops_and_order(ir);
+            build_dominators_from_order(ir);
+        }
     }
 
     updated |= o_hoist(log, ir);
@@ -34,6 +34,11 @@ struct options_t
     bool unsafe_bank_switch = false;
     bool assert_valid = true;
     bool sloppy = false;
+    bool verify_determinism = false;
+    bool avoid_page_cross = false;
+    bool reg_args = false;
+    bool explore_schedules = false;
+    bool outline = false;
 
     // Label files, etc:
     std::string raw_mlb;
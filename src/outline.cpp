@@ -0,0 +1,379 @@
+#include "outline.hpp"
+
+#include <algorithm>
+#include <queue>
+#include <vector>
+
+#include "robin/hash.hpp"
+#include "robin/map.hpp"
+
+#include "asm_proc.hpp"
+#include "globals.hpp"
+#include "mapper.hpp"
+#include "options.hpp"
+#include "ram_alloc.hpp"
+#include "rom.hpp"
+
+rom_proc_ht outline_proc = {};
+
+namespace
+{
+
+constexpr unsigned MIN_LEN = 2;  // In instructions.
+constexpr unsigned MAX_LEN = 24; // In instructions.
+constexpr unsigned CALL_BYTES = 3;   // JSR
+constexpr unsigned RETURN_BYTES = 1; // RTS
+
+bool outlines(fn_t const& fn)
+{
+    // NMIs and IRQs have cycle budgets, so they are never outlined.
+    if(fn.iasm || (fn.fclass != FN_FN && fn.fclass != FN_MODE))
+        return false;
+
+    if(mod_test(fn.mods(), MOD_outline, false))
+        return false;
+
+    return compiler_options().outline || mod_test(fn.mods(), MOD_outline);
+}
+
+// Only locators that link identically from any proc can be moved.
+bool outlinable(locator_t loc)
+{
+    if(loc.is() == IS_BANK)
+        return false;
+
+    switch(loc.lclass())
+    {
+    case LOC_NONE:
+    case LOC_CONST_BYTE:
+    case LOC_ADDR:
+    case LOC_GMEMBER:
+    case LOC_GCONST:
+    case LOC_ROM_ARRAY:
+    case LOC_RUNTIME_RAM:
+    case LOC_RUNTIME_ROM:
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool outlinable(asm_inst_t const& inst)
+{
+    if(!op_size(inst.op) || inst.op == ASM_DATA)
+        return false;
+
+    if(op_flags(inst.op) & (ASMF_FAKE | ASMF_BRANCH | ASMF_JUMP | ASMF_CALL | ASMF_RETURN | ASMF_SWITCH))
+        return false;
+
+    switch(op_name(inst.op))
+    {
+    // These depend on the stack, which the JSR would change:
+    case PHA:
+    case PHP:
+    case PLA:
+    case PLP:
+    case TSX:
+    case TXS:
+    case BRK:
+    case RTI:
+    // These skip over the bytes of the next instruction:
+    case SKB:
+    case IGN:
+        return false;
+    default:
+        break;
+    }
+
+    return outlinable(inst.arg) && outlinable(inst.alt);
+}
+
+// A sequence of outlinable instructions with no labels in between.
+struct run_t
+{
+    unsigned proc; // Index into 'procs'.
+    std::vector<unsigned> code; // Indexes into the proc's code.
+};
+
+struct occurrence_t
+{
+    unsigned run;
+    unsigned pos; // Index into 'run_t::code'.
+};
+
+struct candidate_t
+{
+    unsigned scope;
+    unsigned len; // In instructions.
+    unsigned bytes;
+    std::vector<occurrence_t> occurrences;
+};
+
+// A subroutine to append to the end of a proc.
+struct subroutine_t
+{
+    asm_proc_t* host;
+    unsigned label_id;
+    std::vector<asm_inst_t> body;
+};
+
+} // end anonymous namespace
+
+void create_outline_proc()
+{
+    // Bankswitching mappers could place the shared subroutines in a different bank
+    // than their callers, so their subroutines are kept local to each proc instead.
+    if(mapper().bankswitches())
+        return;
+
+    for(fn_t const& fn : fn_ht::values())
+    {
+        if(outlines(fn))
+        {
+            outline_proc = rom_proc_ht::pool_make(romv_allocs_t{}, ROMVF_IN_MODE, false);
+            return;
+        }
+    }
+}
+
+void outline_procs()
+{
+    // Only the mode version of each proc is outlined,
+    // as NMI and IRQ versions have cycle budgets.
+    std::vector<asm_proc_t*> procs;
+    for(fn_t& fn : fn_ht::values())
+    {
+        if(!outlines(fn) || !fn.rom_proc())
+            continue;
+
+        rom_proc_t& rom_proc = fn.rom_proc().safe();
+        if(!rom_proc.emits() || !(rom_proc.desired_romv() & ROMVF_IN_MODE))
+            continue;
+
+        procs.push_back(&rom_proc.asm_proc(ROMV_MODE));
+    }
+
+    if(procs.empty())
+        return;
+
+    bool const shared = bool(outline_proc);
+    asm_proc_t* const shared_host = shared ? &outline_proc.safe().asm_proc(ROMV_MODE) : nullptr;
+
+    ////////////////////
+    // Build the runs //
+    ////////////////////
+
+    std::vector<run_t> runs;
+
+    for(unsigned p = 0; p < procs.size(); ++p)
+    {
+        asm_proc_t const& proc = *procs[p];
+
+        // Code inside loops is hot, and isn't worth slowing down:
+        std::vector<double> const weights = inst_weights(proc);
+
+        run_t run = { p };
+        bool skipped = false; // If the instruction follows a SKB or IGN.
+
+        auto const end_run = [&]()
+        {
+            if(run.code.size() >= MIN_LEN)
+                runs.push_back(std::move(run));
+            run = { p };
+        };
+
+        for(unsigned i = 0; i < proc.code.size(); ++i)
+        {
+            asm_inst_t const& inst = proc.code[i];
+
+            if(inst.op == ASM_PRUNED)
+                continue;
+
+            if(!skipped && weights[i] <= 1.0 && outlinable(inst))
+                run.code.push_back(i);
+            else
+                end_run();
+
+            if(op_size(inst.op))
+                skipped = op_name(inst.op) == SKB || op_name(inst.op) == IGN;
+        }
+
+        end_run();
+    }
+
+    auto const inst_at = [&](occurrence_t occ, unsigned i) -> asm_inst_t&
+    {
+        run_t const& run = runs[occ.run];
+        return procs[run.proc]->code[run.code[occ.pos + i]];
+    };
+
+    //////////////////////////
+    // Find the repetitions //
+    //////////////////////////
+
+    // Repeated sequences are found by hashing every window of each run.
+
+    std::vector<candidate_t> candidates;
+    rh::batman_map<std::size_t, std::vector<unsigned>> buckets;
+
+    for(unsigned r = 0; r < runs.size(); ++r)
+    {
+        run_t const& run = runs[r];
+        asm_proc_t const& proc = *procs[run.proc];
+        unsigned const scope = shared ? 0 : run.proc + 1;
+
+        for(unsigned pos = 0; pos + MIN_LEN <= run.code.size(); ++pos)
+        {
+            occurrence_t const occ = { r, pos };
+            unsigned const max_len = std::min<unsigned>(MAX_LEN, run.code.size() - pos);
+            std::size_t hash = scope;
+            unsigned bytes = 0;
+
+            for(unsigned len = 1; len <= max_len; ++len)
+            {
+                asm_inst_t const& inst = proc.code[run.code[pos + len - 1]];
+                hash = rh::hash_combine(hash, inst.op);
+                hash = rh::hash_combine(hash, inst.arg.to_uint());
+                hash = rh::hash_combine(hash, inst.alt.to_uint());
+                bytes += op_size(inst.op);
+
+                // Sequences no larger than a call can never save space:
+                if(len < MIN_LEN || bytes <= CALL_BYTES)
+                    continue;
+
+                std::vector<unsigned>& bucket = buckets[rh::hash_combine(hash, len)];
+
+                auto const match = [&](unsigned c)
+                {
+                    candidate_t const& cand = candidates[c];
+                    if(cand.scope != scope || cand.len != len)
+                        return false;
+                    for(unsigned i = 0; i < len; ++i)
+                        if(inst_at(cand.occurrences[0], i) != inst_at(occ, i))
+                            return false;
+                    return true;
+                };
+
+                auto it = std::find_if(bucket.begin(), bucket.end(), match);
+                if(it != bucket.end())
+                    candidates[*it].occurrences.push_back(occ);
+                else
+                {
+                    bucket.push_back(candidates.size());
+                    candidates.push_back({ .scope = scope, .len = len, .bytes = bytes, .occurrences = { occ } });
+                }
+            }
+        }
+    }
+
+    /////////////////////////////
+    // Pick the best, greedily //
+    /////////////////////////////
+
+    std::vector<std::vector<bool>> used(runs.size());
+    for(unsigned r = 0; r < runs.size(); ++r)
+        used[r].resize(runs[r].code.size(), false);
+
+    // Finds the occurrences that can still be replaced.
+    auto const available = [&](candidate_t const& cand, std::vector<occurrence_t>& chosen)
+    {
+        chosen.clear();
+        for(occurrence_t occ : cand.occurrences)
+        {
+            // Occurrences are in order, so only the last chosen one can overlap:
+            if(!chosen.empty() && chosen.back().run == occ.run && occ.pos < chosen.back().pos + cand.len)
+                continue;
+
+            auto const begin = used[occ.run].begin() + occ.pos;
+            if(std::find(begin, begin + cand.len, true) == begin + cand.len)
+                chosen.push_back(occ);
+        }
+    };
+
+    auto const savings = [&](candidate_t const& cand, std::vector<occurrence_t> const& chosen) -> int
+    {
+        int const k = chosen.size();
+        return k * int(cand.bytes) - (k * int(CALL_BYTES) + int(cand.bytes + RETURN_BYTES));
+    };
+
+    // Ordered by savings, then by the earliest candidate, for determinism.
+    std::priority_queue<std::pair<int, int>> queue;
+    std::vector<occurrence_t> chosen;
+
+    for(unsigned c = 0; c < candidates.size(); ++c)
+    {
+        if(candidates[c].occurrences.size() < 2)
+            continue;
+        available(candidates[c], chosen);
+        if(int const s = savings(candidates[c], chosen); s > 0)
+            queue.push({ s, -int(c) });
+    }
+
+    std::vector<subroutine_t> subroutines;
+    rh::batman_map<asm_proc_t*, unsigned> next_label_ids;
+
+    while(!queue.empty())
+    {
+        auto const [prev_savings, neg_c] = queue.top();
+        queue.pop();
+
+        candidate_t const& cand = candidates[-neg_c];
+
+        // Savings only shrink as other candidates get picked,
+        // so re-queue the candidate if it's no longer the best.
+        available(cand, chosen);
+        int const s = savings(cand, chosen);
+        if(s <= 0)
+            continue;
+        if(s < prev_savings)
+        {
+            queue.push({ s, neg_c });
+            continue;
+        }
+
+        asm_proc_t* const host = shared ? shared_host : procs[runs[chosen[0].run].proc];
+        auto const label_id = next_label_ids.insert({ host, host->next_label_id() }).first->second++;
+        locator_t const target = shared ? locator_t::outline(label_id) : locator_t::minor_label(label_id);
+
+        subroutine_t& sub = subroutines.emplace_back(subroutine_t{ host, label_id });
+        for(unsigned i = 0; i < cand.len; ++i)
+            sub.body.push_back(inst_at(chosen[0], i));
+
+        for(occurrence_t occ : chosen)
+        {
+            for(unsigned i = 0; i < cand.len; ++i)
+            {
+                used[occ.run][occ.pos + i] = true;
+                inst_at(occ, i) = { .op = i ? ASM_PRUNED : JSR_ABSOLUTE, .arg = i ? locator_t{} : target };
+            }
+        }
+    }
+
+    ////////////////////////////
+    // Append the subroutines //
+    ////////////////////////////
+
+    for(subroutine_t const& sub : subroutines)
+    {
+        sub.host->push_label(sub.label_id);
+        for(asm_inst_t const& inst : sub.body)
+            sub.host->push_inst(inst);
+        sub.host->push_inst(RTS);
+    }
+
+    // Code only shrank, so existing branches remain in range.
+    for(asm_proc_t* proc : procs)
+    {
+        proc->build_label_offsets();
+        proc->cache_size();
+    }
+
+    if(shared_host)
+    {
+        shared_host->build_label_offsets();
+        shared_host->cache_size();
+
+        if(!shared_host->code.empty())
+            outline_proc.safe().mark_emits();
+    }
+}
@@ -0,0 +1,21 @@
+#ifndef OUTLINE_HPP
+#define OUTLINE_HPP
+
+// Outlining (procedural abstraction) factors instruction sequences that repeat
+// across fns into subroutines, replacing each copy with a JSR.
+// This trades speed for size, so it's only done when requested.
+
+#include "rom_decl.hpp"
+
+// Holds the subroutines shared between fns.
+// Only exists for mappers that don't bankswitch,
+// otherwise subroutines are placed inside the proc that uses them.
+extern rom_proc_ht outline_proc;
+
+// Called at PHASE_INITIAL_VALUES, as procs can't be created later.
+void create_outline_proc();
+
+// Called after 'link_variables_optimize', before ROM is allocated.
+void outline_procs();
+
+#endif
@@ -1302,8 +1302,21 @@ bool parser_t<P>::parse_byte_block(pstring_t decl, int block_indent, global_t& g
                     compiler_error(file_pstring, "Expecting filename.");
 
                 string_literal_t const filename = args[0].filename();
+                std::string_view const script_name = script.view(source());
 
-                conversion_t c = convert_file(source(), script, preferred_dir, filename, mods.get(),
+                if(convert_async(script_name))
+                {
+                    children.push_back({ 
+                        .token = token_t::make_ptr(
+                            TOK_byte_block_pending_array, filename.pstring, 
+                            eternal_emplace<pending_conversion_t>(
+                                convert_file_async(script_name, script, preferred_dir, filename, 
+                                                   std::move(mods), std::move(args))))
+                    });
+                    return;
+                }
+
+                conversion_t c = convert_file(script_name, script, preferred_dir, filename, mods.get(),
                                               args.data() + 1, args.size() - 1);
 
                 if(auto* vec = std::get_if<std::vector<std::uint8_t>>(&c.data))
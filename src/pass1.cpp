@@ -62,6 +62,8 @@ void pass1_t::convert_ast(ast_node_t& ast, idep_class_t calc, idep_class_t depen
             global_t& g = lookup_global(ast.token.pstring);
             if(depends_on)
                 add_idep(ideps, &g, { .calc = calc, .depends_on = depends_on });
+            else // Weak references (i.e. addresses) don't order, but are tracked for reachability.
+                ideps.emplace(&g, idep_pair_t{ .calc = IDEP_VALUE, .depends_on = BAD_IDEP });
             ast.token.type = TOK_global_ident;
             ast.token.set_ptr(&g);
         }
@@ -43,6 +43,8 @@ void pbqp_t::solve(std::vector<pbqp_node_t*> order)
     std::vector<pbqp_node_t*> next_order;
     next_order.reserve(order.size());
 
+    bool exact_failed = false;
+
     // Continuously reduce nodes until no remain.
     while(true)
     {
@@ -67,9 +69,17 @@ void pbqp_t::solve(std::vector<pbqp_node_t*> order)
 
         assert(!order.empty());
 
-        // If nothing was reduced optimally, reduce 1 node suboptimally.
+        // If nothing was reduced optimally, try solving what remains exactly.
+        // Failing that, reduce 1 node suboptimally.
         if(optimal_reductions == 0)
         {
+            if(!exact_failed && order.size() <= MAX_EXACT_NODES)
+            {
+                if(exact_reduction(order))
+                    break;
+                exact_failed = true;
+            }
+
             unsigned best_i = 0;
 
             // We'll reduce the node with the highest degree.
@@ -323,5 +333,214 @@ void pbqp_t::heuristic_reduction(pbqp_node_t& node)
 
     node.sel = best_i;
     assert(node.sel >= 0);
+    pbqp_stats.heuristic_reductions += 1;
+}
+
+// Assigns every node in 'core' its optimal selection using branch-and-bound.
+// The nodes of 'core' are those that couldn't be reduced optimally,
+// and their costs already include the nodes that were.
+// Returns false if the search gave up.
+bool pbqp_t::exact_reduction(std::vector<pbqp_node_t*> const& core)
+{
+    unsigned const n = core.size();
+    assert(n > 0);
+    dprint(log, "-PBQP EXACT", n);
+
+    auto const core_index = [&](pbqp_node_t const* node) -> int
+    {
+        auto it = std::find(core.begin(), core.end(), node);
+        return it == core.end() ? -1 : it - core.begin();
+    };
+
+    // Order the nodes so that each one connects to many of the nodes before it,
+    // which tightens the bounds early on.
+    std::vector<unsigned> var_order;
+    std::vector<int> pos(n, -1);
+    std::vector<unsigned> connections(n, 0);
+    var_order.reserve(n);
+
+    while(var_order.size() < n)
+    {
+        int best = -1;
+        for(unsigned i = 0; i < n; ++i)
+        {
+            if(pos[i] >= 0)
+                continue;
+            if(best < 0 || connections[i] > connections[best]
+               || (connections[i] == connections[best] && core[i]->degree > core[best]->degree))
+            {
+                best = i;
+            }
+        }
+
+        pos[best] = var_order.size();
+        var_order.push_back(best);
+
+        pbqp_node_t const& node = *core[best];
+        for(unsigned e = 0; e < node.degree; ++e)
+        {
+            pbqp_edge_t const* edge = node.edges[e];
+            int const other = core_index(edge->nodes[edge->nodes[0] == &node]);
+            if(other >= 0 && pos[other] < 0)
+                connections[other] += 1;
+        }
+    }
+
+    // Each edge gets attributed to whichever of its nodes is decided last.
+    // Edges to nodes outside of 'core' have been decided already.
+    struct back_edge_t
+    {
+        pbqp_edge_t* edge;
+        bool node_i;
+        unsigned var;
+        std::vector<pbqp_cost_t> min_cost; // The cheapest cost for each of our sels.
+    };
+
+    struct var_t
+    {
+        pbqp_node_t* node;
+        std::vector<back_edge_t> back_edges;
+        std::vector<std::pair<unsigned, unsigned>> forward_edges; // (var, back_edge index)
+
+        // The cost of each sel, given the vars decided so far.
+        // Undecided vars contribute their cheapest edge cost.
+        std::vector<pbqp_cost_t> partial;
+
+        std::vector<std::pair<pbqp_cost_t, unsigned>> choices;
+    };
+
+    std::vector<var_t> vars(n);
+
+    for(unsigned p = 0; p < n; ++p)
+    {
+        var_t& var = vars[p];
+        var.node = core[var_order[p]];
+        var.partial = var.node->cost_vector;
+
+        pbqp_node_t& node = *var.node;
+        for(unsigned e = 0; e < node.degree; ++e)
+        {
+            pbqp_edge_t* edge = node.edges[e];
+            bool const node_i = edge->index(node);
+            pbqp_node_t& other = *edge->nodes[!node_i];
+            int const other_i = core_index(&other);
+
+            if(other_i < 0)
+            {
+                passert(other.sel >= 0, other.sel);
+                for(unsigned i = 0; i < node.num_sels(); ++i)
+                    var.partial[i] += edge->cost(i, other.sel, node_i);
+            }
+            else if(unsigned(pos[other_i]) < p)
+            {
+                unsigned const other_p = pos[other_i];
+                back_edge_t back = { edge, node_i, other_p, std::vector<pbqp_cost_t>(node.num_sels(), ~0ull) };
+
+                for(unsigned i = 0; i < node.num_sels(); ++i)
+                {
+                    for(unsigned j = 0; j < other.num_sels(); ++j)
+                        back.min_cost[i] = std::min(back.min_cost[i], edge->cost(i, j, node_i));
+                    var.partial[i] += back.min_cost[i];
+                }
+
+                vars[other_p].forward_edges.push_back({ p, var.back_edges.size() });
+                var.back_edges.push_back(std::move(back));
+            }
+        }
+    }
+
+    // Adds or removes the edge costs of deciding 'sel' for the var at 'p'.
+    auto const decide = [&](unsigned p, unsigned sel, bool undo)
+    {
+        for(auto const& pair : vars[p].forward_edges)
+        {
+            var_t& var = vars[pair.first];
+            back_edge_t& back = var.back_edges[pair.second];
+            assert(back.var == p);
+
+            for(unsigned i = 0; i < var.node->num_sels(); ++i)
+            {
+                pbqp_cost_t const delta = back.edge->cost(i, sel, back.node_i) - back.min_cost[i];
+                if(undo)
+                    var.partial[i] -= delta;
+                else
+                    var.partial[i] += delta;
+            }
+        }
+    };
+
+    // A lower bound on the cost of the vars starting at 'p':
+    auto const bound = [&](unsigned p) -> pbqp_cost_t
+    {
+        pbqp_cost_t sum = 0;
+        for(; p < n; ++p)
+            sum += *std::min_element(vars[p].partial.begin(), vars[p].partial.end());
+        return sum;
+    };
+
+    std::vector<unsigned> sels(n);
+    std::vector<unsigned> best_sels;
+    pbqp_cost_t best_cost = ~0ull;
+    unsigned steps = 0;
+
+    // Depth-first search, visiting the cheapest choices first:
+    auto const search = [&](auto const& self, unsigned p, pbqp_cost_t cost) -> bool
+    {
+        if(p == n)
+        {
+            best_cost = cost;
+            best_sels = sels;
+            return true;
+        }
+
+        if(++steps > MAX_EXACT_STEPS)
+            return false;
+
+        var_t& var = vars[p];
+        var.choices.clear();
+        for(unsigned i = 0; i < var.node->num_sels(); ++i)
+            var.choices.push_back({ var.partial[i], i });
+        std::sort(var.choices.begin(), var.choices.end());
+
+        pbqp_cost_t const rest_bound = bound(p + 1);
+
+        for(unsigned k = 0; k < var.choices.size(); ++k)
+        {
+            auto const [c, i] = var.choices[k];
+
+            if(cost + c + rest_bound >= best_cost)
+                break;
+
+            sels[p] = i;
+            decide(p, i, false);
+
+            bool const ok = (cost + c + bound(p + 1) >= best_cost) || self(self, p + 1, cost + c);
+
+            decide(p, i, true);
+
+            if(!ok)
+                return false;
+        }
+
+        return true;
+    };
+
+    bool const solved = search(search, 0, 0);
+    pbqp_stats.exact_steps += steps;
+
+    if(!solved)
+    {
+        dprint(log, "-PBQP EXACT FAILED", steps);
+        pbqp_stats.exact_fallbacks += 1;
+        return false;
+    }
+
+    assert(best_sels.size() == n);
+    for(unsigned p = 0; p < n; ++p)
+        vars[p].node->sel = best_sels[p];
+
+    dprint(log, "-PBQP EXACT SOLVED", best_cost, steps);
+    pbqp_stats.exact_solves += 1;
+    return true;
 }
 
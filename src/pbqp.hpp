@@ -12,6 +12,7 @@
 #include <cstdint>
 #include <array>
 #include <algorithm>
+#include <atomic>
 #include <vector>
 #include <deque>
 
@@ -20,6 +21,17 @@
 
 using pbqp_cost_t = std::uint64_t;
 
+// Counters for profiling the solver, summed across every thread.
+struct pbqp_stats_t
+{
+    std::atomic<std::uint64_t> exact_solves = 0;
+    std::atomic<std::uint64_t> exact_fallbacks = 0;
+    std::atomic<std::uint64_t> exact_steps = 0;
+    std::atomic<std::uint64_t> heuristic_reductions = 0;
+};
+
+inline pbqp_stats_t pbqp_stats;
+
 struct pbqp_edge_t;
 class pbqp_node_t;
 class pbqp_t;
@@ -105,6 +117,12 @@ private:
     void reduce(pbqp_node_t& node);
     bool optimal_reduction(pbqp_node_t& node);
     void heuristic_reduction(pbqp_node_t& node);
+    bool exact_reduction(std::vector<pbqp_node_t*> const& core);
+
+    // Limits on the branch-and-bound search of 'exact_reduction'.
+    // Steps are counted instead of time to keep the output deterministic.
+    static constexpr unsigned MAX_EXACT_NODES = 48;
+    static constexpr unsigned MAX_EXACT_STEPS = 1 << 16;
 
     std::deque<pbqp_edge_t> edge_pool;
     std::vector<pbqp_node_t*> bp_stack; // back propagation stack
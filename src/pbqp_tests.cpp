@@ -0,0 +1,86 @@
+#include "catch/catch.hpp"
+#include "pbqp.hpp"
+
+#include <cstdlib>
+#include <deque>
+#include <vector>
+
+constexpr unsigned TEST_ITER = 200;
+
+// Builds random graphs dense enough that they can't be reduced optimally,
+// then compares the solver against brute force.
+TEST_CASE("pbqp_exact", "[pbqp]")
+{
+    for(unsigned iter = 0; iter < TEST_ITER; ++iter)
+    {
+        unsigned const num_nodes = 4 + rand() % 3;
+
+        std::deque<pbqp_node_t> nodes;
+        std::vector<std::vector<pbqp_cost_t>> vectors;
+        std::vector<std::vector<pbqp_cost_t>> matrices;
+        pbqp_t pbqp(nullptr);
+
+        for(unsigned i = 0; i < num_nodes; ++i)
+        {
+            auto& vec = vectors.emplace_back(1 + rand() % 4);
+            for(auto& cost : vec)
+                cost = rand() % 64;
+            nodes.emplace_back().cost_vector = vec;
+        }
+
+        for(unsigned a = 0; a < num_nodes; ++a)
+        for(unsigned b = a + 1; b < num_nodes; ++b)
+        {
+            auto& matrix = matrices.emplace_back(vectors[a].size() * vectors[b].size());
+            for(auto& cost : matrix)
+                cost = rand() % 64;
+            pbqp.add_edge(nodes[a], nodes[b], matrix);
+        }
+
+        auto const total_cost = [&](std::vector<unsigned> const& sels)
+        {
+            pbqp_cost_t cost = 0;
+            unsigned m = 0;
+            for(unsigned a = 0; a < num_nodes; ++a)
+            {
+                cost += vectors[a][sels[a]];
+                for(unsigned b = a + 1; b < num_nodes; ++b)
+                    cost += matrices[m++][sels[a] + sels[b] * vectors[a].size()];
+            }
+            return cost;
+        };
+
+        // Brute force:
+        pbqp_cost_t best_cost = ~0ull;
+        std::vector<unsigned> sels(num_nodes, 0);
+        while(true)
+        {
+            best_cost = std::min(best_cost, total_cost(sels));
+
+            unsigned i = 0;
+            for(; i < num_nodes; ++i)
+            {
+                if(++sels[i] < vectors[i].size())
+                    break;
+                sels[i] = 0;
+            }
+
+            if(i == num_nodes)
+                break;
+        }
+
+        std::vector<pbqp_node_t*> order;
+        for(auto& node : nodes)
+            order.push_back(&node);
+        pbqp.solve(order);
+
+        for(unsigned i = 0; i < num_nodes; ++i)
+        {
+            REQUIRE(nodes[i].sel >= 0);
+            REQUIRE(unsigned(nodes[i].sel) < vectors[i].size());
+            sels[i] = nodes[i].sel;
+        }
+
+        REQUIRE(total_cost(sels) == best_cost);
+    }
+}
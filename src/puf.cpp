@@ -104,7 +104,7 @@ struct track_t
     std::vector<std::vector<row_t>> patterns;
 
     int pattern_size = 0;
-    unsigned num_columns = 0;
+    unsigned columns_size = 0; // In bytes
     const_ht gconst = {};
 };
 
@@ -301,6 +301,273 @@ macro_t combine_vol_duty(macro_t volume, macro_t duty)
     return combined;
 }
 
+// A run of bytes holding one or more patterns.
+// Patterns are addressed by labels placed at offsets into 'data'.
+struct pattern_string_t
+{
+    std::vector<std::uint8_t> data;
+    std::vector<std::pair<unsigned, int>> labels; // (offset, pattern id)
+};
+
+// Packs a track's patterns into as few bytes as possible,
+// without changing the bytes the player reads from each pattern start.
+// - Patterns occurring inside other patterns become labels into them.
+//   (Found using a suffix array over all patterns.)
+// - The remaining patterns are chained together by overlapping
+//   suffixes with prefixes.
+// Each resulting string fits in a page, as the player only increments
+// the low byte of its pattern pointers.
+static std::vector<pattern_string_t> compress_patterns(std::map<penguin_pattern_t, int> const& pattern_map)
+{
+    std::vector<penguin_pattern_t const*> patterns(pattern_map.size());
+    for(auto const& pair : pattern_map)
+        patterns.at(pair.second) = &pair.first;
+
+    unsigned const n = patterns.size();
+
+    // Concatenate every pattern, each followed by a unique separator:
+    std::vector<int> text;
+    std::vector<unsigned> text_pattern; // Maps text positions back to patterns.
+    std::vector<unsigned> pattern_begin(n);
+    for(unsigned i = 0; i < n; ++i)
+    {
+        pattern_begin[i] = text.size();
+        for(std::uint8_t byte : *patterns[i])
+        {
+            text.push_back(byte);
+            text_pattern.push_back(i);
+        }
+        text.push_back(256 + i);
+        text_pattern.push_back(i);
+    }
+
+    auto const suffix_less = [&](unsigned a, unsigned b)
+    {
+        return std::lexicographical_compare(text.begin() + a, text.end(), text.begin() + b, text.end());
+    };
+
+    std::vector<unsigned> sa(text.size());
+    for(unsigned i = 0; i < sa.size(); ++i)
+        sa[i] = i;
+    std::sort(sa.begin(), sa.end(), suffix_less);
+
+    // Maps each pattern to the kept pattern containing it:
+    std::vector<std::pair<unsigned, unsigned>> host(n); // (host, offset)
+    std::vector<bool> kept(n, true);
+
+    // Longest first, so that hosts are resolved before their substrings:
+    std::vector<unsigned> order(n);
+    for(unsigned i = 0; i < n; ++i)
+        order[i] = i;
+    std::stable_sort(order.begin(), order.end(), [&](unsigned a, unsigned b)
+        { return patterns[a]->size() > patterns[b]->size(); });
+
+    for(unsigned p : order)
+    {
+        host[p] = { p, 0 };
+
+        penguin_pattern_t const& pattern = *patterns[p];
+        auto const prefix_less = [&](unsigned suffix, int)
+        {
+            return std::lexicographical_compare(
+                text.begin() + suffix, text.begin() + std::min<std::size_t>(suffix + pattern.size(), text.size()),
+                pattern.begin(), pattern.end());
+        };
+
+        // Find the first occurrence inside a different pattern:
+        for(auto it = std::lower_bound(sa.begin(), sa.end(), 0, prefix_less); it != sa.end(); ++it)
+        {
+            if(*it + pattern.size() > text.size()
+               || !std::equal(pattern.begin(), pattern.end(), text.begin() + *it))
+            {
+                break;
+            }
+
+            unsigned const q = text_pattern[*it];
+            if(q == p)
+                continue;
+
+            passert(patterns[q]->size() > pattern.size(), patterns[q]->size(), pattern.size());
+            host[p] = { host[q].first, host[q].second + (*it - pattern_begin[q]) };
+            kept[p] = false;
+            break;
+        }
+    }
+
+    // Greedily chain the kept patterns by their largest overlaps:
+    struct overlap_t
+    {
+        unsigned size;
+        unsigned a;
+        unsigned b;
+    };
+
+    std::vector<overlap_t> overlaps;
+    for(unsigned a = 0; a < n; ++a)
+    for(unsigned b = 0; b < n; ++b)
+    {
+        if(a == b || !kept[a] || !kept[b])
+            continue;
+
+        penguin_pattern_t const& pa = *patterns[a];
+        penguin_pattern_t const& pb = *patterns[b];
+
+        for(unsigned size = std::min(pa.size(), pb.size()) - 1; size > 0; --size)
+        {
+            if(std::equal(pa.end() - size, pa.end(), pb.begin()))
+            {
+                overlaps.push_back({ size, a, b });
+                break;
+            }
+        }
+    }
+
+    std::stable_sort(overlaps.begin(), overlaps.end(), [](overlap_t const& l, overlap_t const& r)
+        { return l.size > r.size; });
+
+    constexpr unsigned NONE = ~0u;
+    std::vector<unsigned> next(n, NONE);
+    std::vector<unsigned> next_overlap(n, 0);
+    std::vector<bool> has_prev(n, false);
+    std::vector<unsigned> chain_head(n);
+    std::vector<unsigned> chain_tail(n);
+    std::vector<unsigned> chain_size(n);
+    for(unsigned i = 0; i < n; ++i)
+    {
+        chain_head[i] = chain_tail[i] = i;
+        chain_size[i] = patterns[i]->size();
+    }
+
+    for(overlap_t const& o : overlaps)
+    {
+        // 'a' must end a chain and 'b' must begin a different chain:
+        if(next[o.a] != NONE || has_prev[o.b])
+            continue;
+
+        unsigned const head = chain_head[o.a];
+        if(head == o.b)
+            continue;
+
+        unsigned const size = chain_size[head] + chain_size[o.b] - o.size;
+        if(size > 256)
+            continue;
+
+        next[o.a] = o.b;
+        next_overlap[o.a] = o.size;
+        has_prev[o.b] = true;
+
+        unsigned const tail = chain_tail[o.b];
+        chain_tail[head] = tail;
+        chain_head[tail] = head;
+        chain_size[head] = size;
+    }
+
+    // Build the strings:
+    std::vector<pattern_string_t> strings;
+    std::vector<unsigned> offset(n);
+    std::vector<unsigned> string_of(n);
+
+    for(unsigned i = 0; i < n; ++i)
+    {
+        if(!kept[i] || has_prev[i])
+            continue;
+
+        pattern_string_t& str = strings.emplace_back();
+        unsigned skip = 0;
+        for(unsigned p = i; p != NONE; p = next[p])
+        {
+            offset[p] = str.data.size() - skip;
+            string_of[p] = strings.size() - 1;
+            str.data.insert(str.data.end(), patterns[p]->begin() + skip, patterns[p]->end());
+            skip = next_overlap[p];
+        }
+        assert(str.data.size() <= 256);
+    }
+
+    // Place the labels:
+    for(unsigned p = 0; p < n; ++p)
+    {
+        unsigned const h = host[p].first;
+        assert(kept[h]);
+        strings[string_of[h]].labels.emplace_back(offset[h] + host[p].second, p);
+    }
+
+    for(pattern_string_t& str : strings)
+        std::sort(str.labels.begin(), str.labels.end());
+
+    return strings;
+}
+
+// Each column holds one pattern per channel.
+using column_t = std::array<int, NUM_CHAN>;
+
+constexpr unsigned COLUMN_SIZE = NUM_CHAN * 2;
+constexpr unsigned COLUMN_REF_SIZE = 4;
+constexpr unsigned MAX_COLUMN_REF = 255;
+
+struct column_entry_t
+{
+    unsigned column; // Index into the uncompressed columns.
+    unsigned count;  // Non-zero for references, holding the number of columns.
+};
+
+struct column_entries_t
+{
+    std::vector<column_entry_t> entries;
+    std::vector<bool> targets; // Which columns are referenced.
+};
+
+// Replaces runs of repeated columns with references to earlier runs.
+// References are encoded as (count, $00, lo, hi), which the player
+// distinguishes from regular columns as ROM pointers never have a zero high byte.
+// References never nest, which keeps the player's per-frame cost bounded.
+static column_entries_t compress_columns(std::vector<column_t> const& columns)
+{
+    column_entries_t ret;
+    ret.targets.resize(columns.size());
+
+    // Only runs of literal columns can be referenced.
+    std::vector<bool> literal(columns.size());
+
+    for(unsigned i = 0; i < columns.size();)
+    {
+        unsigned best_size = 0;
+        unsigned best_column = 0;
+
+        for(unsigned j = 0; j < i; ++j)
+        {
+            unsigned size = 0;
+            while(size < MAX_COLUMN_REF && i + size < columns.size() && j + size < i
+                  && literal[j + size] && columns[j + size] == columns[i + size])
+            {
+                ++size;
+            }
+
+            if(size > best_size)
+            {
+                best_size = size;
+                best_column = j;
+            }
+        }
+
+        static_assert(COLUMN_REF_SIZE < COLUMN_SIZE);
+        if(best_size)
+        {
+            ret.entries.push_back({ best_column, best_size });
+            ret.targets[best_column] = true;
+            i += best_size;
+        }
+        else
+        {
+            ret.entries.push_back({ i, 0 });
+            literal[i] = true;
+            ++i;
+        }
+    }
+
+    return ret;
+}
+
 void convert_puf_music(char const* const begin, std::size_t size, pstring_t at)
 {
     using namespace std::literals;
@@ -643,7 +910,17 @@ void convert_puf_music(char const* const begin, std::size_t size, pstring_t at)
                 }
             }
 
-            track.num_columns = penguin_channels[0].size();
+            for(std::size_t k = 0; k < NUM_CHAN; ++k)
+                if(penguin_channels[k].size() != penguin_channels[0].size())
+                   throw std::runtime_error("Channels are not the same length.");
+
+            std::vector<column_t> columns(penguin_channels[0].size());
+            for(std::size_t i = 0; i < columns.size(); ++i)
+            for(std::size_t k = 0; k < NUM_CHAN; ++k)
+            {
+                assert(penguin_channels[k][i] >= 0);
+                columns[i][k] = penguin_channels[k][i];
+            }
 
             allocated.clear();
             buckets.clear();
@@ -652,35 +929,57 @@ void convert_puf_music(char const* const begin, std::size_t size, pstring_t at)
                 bucket_t bucket = {};
                 asm_vec_t& code = bucket.code.emplace_back();
 
-                for(std::size_t i = 0; i < penguin_channels[0].size(); ++i)
-                for(std::size_t k = 0; k < NUM_CHAN; ++k)
+                // Column labels are numbered after the pattern labels:
+                unsigned const column_label = penguin_pattern_maps[t].size();
+                column_entries_t const entries = compress_columns(columns);
+
+                for(column_entry_t const& entry : entries.entries)
                 {
-                    if(penguin_channels[k].size() != penguin_channels[0].size())
-                       throw std::runtime_error("Channels are not the same length.");
+                    if(entry.count)
+                    {
+                        // A reference to an earlier run of columns:
+                        locator_t const label = locator_t::minor_label(column_label + entry.column);
+                        push_byte(code, entry.count);
+                        push_byte(code, 0);
+                        code.push_back({ .op = ASM_DATA, .arg = label.with_is(IS_PTR) });
+                        code.push_back({ .op = ASM_DATA, .arg = label.with_is(IS_PTR_HI) });
+                        bucket.size += COLUMN_REF_SIZE;
+                        continue;
+                    }
 
-                    assert(penguin_channels[k][i] >= 0);
-                    locator_t const label = locator_t::minor_label(penguin_channels[k][i]);
+                    if(entries.targets[entry.column])
+                        code.push_back({ .op = ASM_LABEL, .arg = locator_t::minor_label(column_label + entry.column) });
 
-                    code.push_back({ .op = ASM_DATA, .arg = label.with_is(IS_PTR) });
-                    code.push_back({ .op = ASM_DATA, .arg = label.with_is(IS_PTR_HI) });
-                    bucket.size += 2;
+                    for(std::size_t k = 0; k < NUM_CHAN; ++k)
+                    {
+                        locator_t const label = locator_t::minor_label(columns[entry.column][k]);
+                        code.push_back({ .op = ASM_DATA, .arg = label.with_is(IS_PTR) });
+                        code.push_back({ .op = ASM_DATA, .arg = label.with_is(IS_PTR_HI) });
+                    }
+                    bucket.size += COLUMN_SIZE;
                 }
 
+                track.columns_size = bucket.size;
                 allocated.push_back(std::move(bucket));
             }
 
-            for(auto const& pair : penguin_pattern_maps[t])
+            for(pattern_string_t const& str : compress_patterns(penguin_pattern_maps[t]))
             {
                 bucket_t bucket = {};
                 asm_vec_t& code = bucket.code.emplace_back();
 
-                code.push_back({ .op = ASM_LABEL, .arg = locator_t::minor_label(pair.second) });
-                for(auto byte : pair.first)
-                    push_byte(code, byte);
+                auto label_it = str.labels.begin();
+                for(unsigned i = 0; i < str.data.size(); ++i)
+                {
+                    for(; label_it != str.labels.end() && label_it->first == i; ++label_it)
+                        code.push_back({ .op = ASM_LABEL, .arg = locator_t::minor_label(label_it->second) });
+                    push_byte(code, str.data[i]);
+                }
+                assert(label_it == str.labels.end());
 
-                bucket.size = pair.first.size();
-                buckets.push_back(std::move(bucket));
+                bucket.size = str.data.size();
                 assert(bucket.size <= 256);
+                buckets.push_back(std::move(bucket));
             }
 
             std::sort(
@@ -696,7 +995,8 @@ void convert_puf_music(char const* const begin, std::size_t size, pstring_t at)
 
                 for(bucket_t& a : allocated)
                 {
-                    if(bucket.size + a.size <= 256)
+                    // Patterns can't cross pages, but can fill the last page of a bucket:
+                    if((a.size % 256) + bucket.size <= 256)
                     {
                         a.size += bucket.size;
                         a.code.splice(a.code.end(), bucket.code);
@@ -876,7 +1176,7 @@ void convert_puf_music(char const* const begin, std::size_t size, pstring_t at)
         asm_proc_t proc;
         for(unsigned i = 0; i < tracks.size(); ++i)
             proc.code.push_back({ .op = ASM_DATA, .arg
-                = locator_t::gconst(tracks[i].gconst).with_is(IS_PTR).with_offset(tracks[i].num_columns * 2 * NUM_CHAN) });
+                = locator_t::gconst(tracks[i].gconst).with_is(IS_PTR).with_offset(tracks[i].columns_size) });
         define_const(at, "puf_tracks_end_lo"sv, std::move(proc), omni_group_pair, true, 0);
     }
 
@@ -885,7 +1185,7 @@ void convert_puf_music(char const* const begin, std::size_t size, pstring_t at)
         asm_proc_t proc;
         for(unsigned i = 0; i < tracks.size(); ++i)
             proc.code.push_back({ .op = ASM_DATA, .arg
-                = locator_t::gconst(tracks[i].gconst).with_is(IS_PTR_HI).with_offset(tracks[i].num_columns * 2 * NUM_CHAN) });
+                = locator_t::gconst(tracks[i].gconst).with_is(IS_PTR_HI).with_offset(tracks[i].columns_size) });
         define_const(at, "puf_tracks_end_hi"sv, std::move(proc), omni_group_pair, true, 0);
     }
 
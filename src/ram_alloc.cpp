@@ -1,10 +1,15 @@
 #include "ram_alloc.hpp"
 
+#include <cmath>
+#include <functional>
+#include <numeric>
+
 #include "flat/small_set.hpp"
 
 #include "decl.hpp"
 #include "globals.hpp"
 #include "group.hpp"
+#include "asm_proc.hpp"
 #include "compiler_error.hpp"
 #include "options.hpp"
 #include "ram.hpp"
@@ -123,8 +128,9 @@ static span_t alloc_ram(ram_sets_t const& usable_ram, std::size_t size,
         }
     };
 
-    // Align, when possible
-    if(size > 1 && (insist_alignment || size <= 256))
+    // Align, when possible.
+    // Arrays larger than a page get walked in page strips, which stay within a page when aligned.
+    if(size > 1 && (insist_alignment || size <= 256 || compiler_options().avoid_page_cross))
     {
         page_bitset_t page = page_bitset_t::filled(0, (size > 256) ? 1 : (257 - size));
 
@@ -186,6 +192,51 @@ static span_t alloc_ram(ram_sets_t const& usable_ram, std::size_t size,
     return {};
 }
 
+} // end anonymous namespace
+
+// When estimating how hot code is, loops are assumed to iterate this many times:
+constexpr double LOOP_WEIGHT = 8.0;
+constexpr int MAX_LOOP_DEPTH = 4;
+
+// Estimates how many times each instruction of 'proc' runs per call.
+// Loops are found by looking for branches and jumps to earlier labels.
+std::vector<double> inst_weights(asm_proc_t const& proc)
+{
+    rh::batman_map<locator_t, unsigned> labels;
+    rh::batman_map<unsigned, unsigned> loop_ends; // Maps loop starts to loop ends.
+
+    for(unsigned i = 0; i < proc.code.size(); ++i)
+    {
+        asm_inst_t const& inst = proc.code[i];
+
+        if(inst.op == ASM_LABEL)
+            labels.insert({ inst.arg.mem_head(), i });
+        else if(op_flags(inst.op) & (ASMF_BRANCH | ASMF_JUMP))
+            if(unsigned const* start = labels.mapped(inst.arg.mem_head()))
+                loop_ends[*start] = i;
+    }
+
+    std::vector<int> depth_change(proc.code.size() + 1, 0);
+    for(auto const& pair : loop_ends)
+    {
+        depth_change[pair.first] += 1;
+        depth_change[pair.second + 1] -= 1;
+    }
+
+    std::vector<double> weights(proc.code.size());
+    int depth = 0;
+    for(unsigned i = 0; i < proc.code.size(); ++i)
+    {
+        depth += depth_change[i];
+        weights[i] = std::pow(LOOP_WEIGHT, std::min(depth, MAX_LOOP_DEPTH));
+    }
+
+    return weights;
+}
+
+namespace  // anonymous namespace
+{
+
 class ram_allocator_t
 {
 public:
@@ -197,12 +248,15 @@ private:
         UNALLOCATED,
         BUILD_ORDER,
         ZP_ONLY_ALLOC,
+        ZP_HOT_ALLOC,
         FULL_ALLOC,
     };
 
     void build_order(romv_t romv, std::vector<fn_ht>& fn_order, std::vector<fn_ht>& input_fns);
     void build_order(romv_t romv, std::vector<fn_ht>& fn_order, fn_ht fn);
 
+    void calc_heat();
+
     template<step_t Step>
     void alloc_locals(romv_t romv, fn_ht h);
 
@@ -230,6 +284,12 @@ private:
         // Addresses that can be used to allocate lvars.
         std::array<ram_sets_t, NUM_ROMV> usable_ram;
 
+        // Estimates how often the fn runs, relative to its mode or interrupt.
+        double weight = 0.0;
+
+        // Weighted access counts of 'this_lvars'.
+        std::vector<double> lvar_heat;
+
         // Ram allocated by lvars in this fn.
         std::array<ram_sets_t, NUM_ROMV> lvar_ram = {};
 
@@ -258,6 +318,13 @@ private:
     // Handles static allocations:
     ram_sets_t static_usable_ram;
 
+    // Weighted access counts of gmembers, used to prioritize zero page.
+    // Each access to a hot variable saves a cycle when it's in zero page.
+    rh::batman_map<locator_t, double> gmember_heat;
+
+    // Lvars at least this hot get zero page before colder ones.
+    double zp_heat_threshold = 0.0;
+
     log_t* log = nullptr;
 };
 
@@ -270,17 +337,57 @@ ram_allocator_t::ram_allocator_t(log_t* log, ram_bitset_t const& initial_usable_
     if(static_usable_ram.sram)
         static_usable_ram.sram->set_all();
 
+    group_vars_data.resize(group_vars_ht::pool().size());
+    fn_data.resize(fn_ht::pool().size());
+
+    calc_heat();
+
     // Amount of bytes free in zero page
     int const zp_free = (static_usable_ram.ram & zp_bitset).popcount();
 
-    // Amount of bytes in zp dedicated to locals
-    int const max_local_zp = 32;
+    // Zero page is split between locals and gvars by how hot each is.
+    double gvar_heat = 0.0;
+    int gvar_zp_only = 0;
+    for(auto const& pair : gmember_heat)
+    {
+        if(pair.first.mem_zp_only())
+            gvar_zp_only += pair.first.mem_size();
+        else if(pair.first.mem_zp_valid() && pair.first.mem_size() == 1)
+            gvar_heat += pair.second;
+    }
+
+    std::vector<double> lvar_heats;
+    for(fn_t const& fn : fn_ht::values())
+    {
+        if(fn.fclass == FN_CT)
+            continue;
+
+        for(unsigned i = 0; i < fn.lvars().num_this_lvars(); ++i)
+        {
+            auto const& info = fn.lvars().this_lvar_info(i);
+            if(!info.zp_only && info.zp_valid && info.size == 1)
+                lvar_heats.push_back(data(fn.handle()).lvar_heat[i]);
+        }
+    }
+
+    double const lvar_heat = std::accumulate(lvar_heats.begin(), lvar_heats.end(), 0.0);
+    double const local_share = (lvar_heat + gvar_heat) > 0.0 ? lvar_heat / (lvar_heat + gvar_heat) : 0.0;
+
+    // Amount of bytes in zp dedicated to locals.
+    // (Always leave some room for pointers, which must go in zp)
+    int const max_local_zp = std::max(32, int(std::lround(zp_free * local_share)));
 
     // Amount of bytes in zp dedicated to gvars
-    int const max_gvar_zp = std::max(zp_free - max_local_zp, zp_free / 2);
+    int const max_gvar_zp = std::max(zp_free - max_local_zp, gvar_zp_only);
 
-    group_vars_data.resize(group_vars_ht::pool().size());
-    fn_data.resize(fn_ht::pool().size());
+    // Only the hottest lvars that fit in the local zp get allocated there first:
+    if(lvar_heats.size() > unsigned(max_local_zp))
+    {
+        std::nth_element(lvar_heats.begin(), lvar_heats.begin() + max_local_zp, lvar_heats.end(), std::greater<double>{});
+        zp_heat_threshold = lvar_heats[max_local_zp];
+    }
+
+    dprint(log, "-RAM_ALLOC_ZP_SPLIT", zp_free, max_local_zp, max_gvar_zp, zp_heat_threshold);
 
     ///////////////////
     // ALLOC GLOBALS //
@@ -462,7 +569,8 @@ ram_allocator_t::ram_allocator_t(log_t* log, ram_bitset_t const& initial_usable_
 
         rh::batman_map<locator_t, unsigned> gmember_count;
         for(gvar_t const& gvar : gvar_ht::values())
-            gvar.for_each_locator([&](locator_t loc){ gmember_count.insert({ loc.mem_head(), 0 }); });
+            if(gvar.global.reachable())
+                gvar.for_each_locator([&](locator_t loc){ gmember_count.insert({ loc.mem_head(), 0 }); });
 
         for(fn_t const& fn : fn_ht::values())
         {
@@ -484,7 +592,8 @@ ram_allocator_t::ram_allocator_t(log_t* log, ram_bitset_t const& initial_usable_
                 continue;
 
             unsigned count = 0;
-            gvar.for_each_locator([&](locator_t loc) { count += gmember_count[loc]; });
+            if(gvar.global.reachable())
+                gvar.for_each_locator([&](locator_t loc) { count += gmember_count[loc]; });
 
             if(count == 0)
                 compiler_warning(gvar.global.pstring(), "Global variable is unused.");
@@ -588,15 +697,24 @@ ram_allocator_t::ram_allocator_t(log_t* log, ram_bitset_t const& initial_usable_
             }
         };
 
-        for(rank_t const& rank : ordered_gmembers_zp)
-            estimate_gmember_loc(rank.loc);
-
+        // Zero page saves a cycle per access, so estimate the hottest bytes first:
+        std::vector<locator_t> ordered_by_heat;
         for(rank_t const& rank : ordered_gmembers)
-            estimate_gmember_loc(rank.loc);
-
+            ordered_by_heat.push_back(rank.loc);
         for(rank_t const& rank : ordered_gmembers_aligned)
+            ordered_by_heat.push_back(rank.loc);
+
+        std::stable_sort(ordered_by_heat.begin(), ordered_by_heat.end(), [&](locator_t lhs, locator_t rhs)
+        {
+            return gmember_heat[lhs] / lhs.mem_size() > gmember_heat[rhs] / rhs.mem_size();
+        });
+
+        for(rank_t const& rank : ordered_gmembers_zp)
             estimate_gmember_loc(rank.loc);
 
+        for(locator_t loc : ordered_by_heat)
+            estimate_gmember_loc(loc);
+
         // For global vars that have init expressions,
         // we want to allocate their group to be contiguous,
         // as this means we can more efficiently init them.
@@ -614,7 +732,7 @@ ram_allocator_t::ram_allocator_t(log_t* log, ram_bitset_t const& initial_usable_
 
         auto const check_init = [&](gvar_ht v, group_inits_t& zero_inits, group_inits_t& value_inits)
         {
-            if(v->init_expr)
+            if(v->init_expr && v->global.reachable())
             {
                 v->for_each_locator([&](locator_t loc)
                 { 
@@ -852,12 +970,99 @@ ram_allocator_t::ram_allocator_t(log_t* log, ram_bitset_t const& initial_usable_
             for(fn_ht fn : fn_orders[romv])
                 alloc_locals<ZP_ONLY_ALLOC>(romv_t(romv), fn);
 
+        for(int romv = NUM_ROMV - 1; romv >= 0; --romv)
+            for(fn_ht fn : fn_orders[romv])
+                alloc_locals<ZP_HOT_ALLOC>(romv_t(romv), fn);
+
         for(int romv = NUM_ROMV - 1; romv >= 0; --romv)
             for(fn_ht fn : fn_orders[romv])
                 alloc_locals<FULL_ALLOC>(romv_t(romv), fn);
     }
 }
 
+void ram_allocator_t::calc_heat()
+{
+    for(gvar_t const& gvar : gvar_ht::values())
+        if(gvar.global.reachable())
+            gvar.for_each_locator([&](locator_t loc){ gmember_heat.insert({ loc.mem_head(), 0.0 }); });
+
+    std::vector<std::vector<double>> weights(fn_ht::pool().size());
+    std::vector<std::vector<std::pair<fn_ht, double>>> callers(fn_ht::pool().size());
+
+    for(fn_t const& fn : fn_ht::values())
+    {
+        if(fn.fclass == FN_CT)
+            continue;
+
+        asm_proc_t const& proc = fn.rom_proc().safe().asm_proc();
+        auto const& code = proc.code;
+        auto& fn_weights = weights[fn.handle().id] = inst_weights(proc);
+
+        for(unsigned i = 0; i < code.size(); ++i)
+            if((op_flags(code[i].op) & ASMF_CALL) && code[i].arg.lclass() == LOC_FN)
+                callers[code[i].arg.fn().id].push_back({ fn.handle(), fn_weights[i] });
+
+        data(fn.handle()).lvar_heat.assign(fn.lvars().num_this_lvars(), 0.0);
+    }
+
+    // Fns can't recurse, so this terminates.
+    std::function<double(fn_ht)> const calc_weight = [&](fn_ht fn) -> double
+    {
+        fn_d& d = data(fn);
+        if(d.weight > 0.0)
+            return d.weight;
+
+        double weight = (fn->fclass == FN_NMI || fn->fclass == FN_IRQ) ? LOOP_WEIGHT : 0.0;
+        for(auto const& pair : callers[fn.id])
+            weight += calc_weight(pair.first) * pair.second;
+
+        // Fns called through pointers have no known callers.
+        return d.weight = std::max(weight, 1.0);
+    };
+
+    for(fn_t const& fn : fn_ht::values())
+    {
+        if(fn.fclass == FN_CT)
+            continue;
+
+        double const weight = calc_weight(fn.handle());
+        auto const& code = fn.rom_proc().safe().asm_proc().code;
+        auto const& fn_weights = weights[fn.handle().id];
+
+        auto const add_heat = [&](locator_t loc, double heat)
+        {
+            if(loc.lclass() == LOC_GMEMBER)
+            {
+                if(double* h = gmember_heat.mapped(loc.mem_head()))
+                    *h += heat;
+                return;
+            }
+
+            int const i = fn.lvars().index(loc);
+            if(i < 0)
+                return;
+
+            if(unsigned(i) < fn.lvars().num_this_lvars())
+                data(fn.handle()).lvar_heat[i] += heat;
+            else if(has_fn(loc.lclass()))
+            {
+                // Accesses to the args and returns of called fns:
+                int const j = loc.fn()->lvars().index(loc);
+                if(j >= 0 && unsigned(j) < data(loc.fn()).lvar_heat.size())
+                    data(loc.fn()).lvar_heat[j] += heat;
+            }
+        };
+
+        for(unsigned i = 0; i < code.size(); ++i)
+        {
+            double const heat = weight * fn_weights[i];
+            add_heat(code[i].arg, heat);
+            if(code[i].alt)
+                add_heat(code[i].alt, heat);
+        }
+    }
+}
+
 void ram_allocator_t::build_order(romv_t romv, std::vector<fn_ht>& fn_order, std::vector<fn_ht>& input_fns)
 {
     std::sort(input_fns.begin(), input_fns.end(), [&](fn_ht a, fn_ht b)
@@ -993,6 +1198,12 @@ void ram_allocator_t::alloc_locals(romv_t const romv, fn_ht h)
             continue;
         }
 
+        if(Step == ZP_HOT_ALLOC && (!info.zp_valid || info.size != 1 || d.lvar_heat[i] < zp_heat_threshold))
+        {
+            dprint(log, "-SKIP LVAR COLD", fn.global.name, i);
+            continue;
+        }
+
         if(info.ptr_hi) // We'll allocate lo only, then assign to hi.
         {
             dprint(log, "-SKIP LVAR 2", fn.global.name, i);
@@ -1005,6 +1216,13 @@ void ram_allocator_t::alloc_locals(romv_t const romv, fn_ht h)
             continue;
         }
 
+        if(Step == ZP_HOT_ALLOC)
+        {
+            // Hottest first:
+            ordered_lvars.push_back({ float(-d.lvar_heat[i]), i });
+            continue;
+        }
+
         int const usable = lvar_usable_ram[i].popcount();
         int const interferences = bitset_popcount(fn.lvars().bitset_size(), fn.lvars().lvar_interferences(i));
         float const score = float(usable - int(info.size)) / interferences;
@@ -1033,7 +1251,7 @@ void ram_allocator_t::alloc_locals(romv_t const romv, fn_ht h)
 
         assert(lvar_i < lvar_usable_ram.size());
 
-        zp_request_t const zp = zp_request(info.zp_valid, info.zp_only);
+        zp_request_t const zp = Step == ZP_HOT_ALLOC ? ZP_ONLY : zp_request(info.zp_valid, info.zp_only);
         sram_request_t const sram = SRAM_MAYBE;
 
         // First try to allocate in 'freebie_ram'.
@@ -1043,6 +1261,10 @@ void ram_allocator_t::alloc_locals(romv_t const romv, fn_ht h)
         if(!span)
             span = alloc_ram(lvar_usable_ram[lvar_i], info.size, zp, sram);
 
+        // Hot lvars that don't fit in zero page get allocated later.
+        if(!span && Step == ZP_HOT_ALLOC)
+            continue;
+
         // If that fails, we're fucked.
         if(!span)
             throw std::runtime_error("Unable to allocate local variable (out of RAM).");
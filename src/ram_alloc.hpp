@@ -2,13 +2,19 @@
 #define RAM_ALLOC_HPP
 
 #include <ostream>
+#include <vector>
 
 #include "debug_print.hpp"
 #include "ram.hpp"
 
+struct asm_proc_t;
+
 void alloc_ram(log_t* log, ram_bitset_t const& initial);
 
 void print_ram(std::ostream& o);
 void print_mlb_ram(std::ostream& o);
 
+// Estimates how many times each instruction of 'proc' runs per call.
+std::vector<double> inst_weights(asm_proc_t const& proc);
+
 #endif
@@ -9,17 +9,39 @@
 // rom_array_t //
 /////////////////
 
-rom_array_t::rom_array_t(loc_vec_t&& vec, romv_allocs_t const& a, rom_key_t const&, bool align)
+rom_array_t::rom_array_t(loc_vec_t&& vec, std::size_t hash, romv_allocs_t const& a, rom_key_t const&, bool align)
 : rom_data_t(a, ROMVF_IN_MODE, align)
+, m_hash(hash)
 , m_used_in_group_data(group_data_ht::bitset_size())
 {
     assert(compiler_phase() <= rom_array_ht::phase);
 
-    // Just to be safe, we'll strip byteify information:
-    for(locator_t& loc : vec)
-        loc.set_byteified(false);
+    // Most arrays are plain tables of bytes. 
+    // These get stored compactly, at 1/8th the size of the locators.
+    if(std::all_of(vec.begin(), vec.end(), [](locator_t loc) { return loc.lclass() == LOC_CONST_BYTE && loc == locator_t::const_byte(loc.data()); }))
+    {
+        m_bytes.resize(vec.size());
+        for(std::size_t i = 0; i < vec.size(); ++i)
+            m_bytes[i] = vec[i].data();
+    }
+    else
+        m_locs = std::move(vec);
+}
+
+bool rom_array_t::equals(loc_vec_t const& vec) const
+{
+    if(vec.size() != size())
+        return false;
 
-    m_data = std::move(vec);
+    if(is_bytes())
+    {
+        for(std::size_t i = 0; i < vec.size(); ++i)
+            if(vec[i] != locator_t::const_byte(m_bytes[i]))
+                return false;
+        return true;
+    }
+
+    return std::equal(m_locs.begin(), m_locs.end(), vec.begin(), vec.end());
 }
 
 void rom_array_t::mark_used_by(group_data_ht gd)
@@ -33,12 +55,21 @@ void rom_array_t::mark_used_by(group_data_ht gd)
 
 void rom_array_t::for_each_locator(std::function<void(locator_t)> const& fn) const
 {
-    for(locator_t loc : data())
+    if(is_bytes())
+    {
+        for(std::uint8_t byte : m_bytes)
+            fn(locator_t::const_byte(byte));
+    }
+    else for(locator_t loc : m_locs)
         fn(loc);
 }
 
 rom_array_ht rom_array_t::make(loc_vec_t&& vec, bool align, bool omni, rom_rule_t rule, group_data_ht gd, romv_allocs_t const& a)
 {
+    // Just to be safe, we'll strip byteify information:
+    for(locator_t& loc : vec)
+        loc.set_byteified(false);
+
     std::hash<loc_vec_t> hasher;
     auto const hash = hasher(vec);
 
@@ -47,13 +78,13 @@ rom_array_ht rom_array_t::make(loc_vec_t&& vec, bool align, bool omni, rom_rule_
         rh::apair<rom_array_ht*, bool> result = m_pool_map.emplace(hash,
             [&](rom_array_ht h) -> bool
             {
-                return std::equal(pool[h.id].m_data.begin(), pool[h.id].m_data.end(), 
-                                  vec.begin(), vec.end());
+                rom_array_t const& array = pool[h.id];
+                return array.m_hash == hash && array.equals(vec);
             },
             [&]()
             { 
                 rom_array_ht const ret = { pool.size() };
-                pool.emplace_back(std::move(vec), a, rom_key_t(), align);
+                pool.emplace_back(std::move(vec), hash, a, rom_key_t(), align);
                 return ret;
             });
 
@@ -238,8 +269,8 @@ unsigned rom_data_ht::max_size(romv_t romv) const
     default: 
         return 0;
     case ROMD_ARRAY:
-        assert(rom_array_ht{ handle() }->data().size() < 1 << 16);
-        return rom_array_ht{ handle() }->data().size();
+        assert(rom_array_ht{ handle() }->size() < 1 << 16);
+        return rom_array_ht{ handle() }->size();
     case ROMD_PROC:
         return rom_proc_ht{ handle() }->max_size(romv);
     }
@@ -88,15 +88,25 @@ protected:
 
 // Tracks a non-code segment of data that is represented as a loc_vec_t,
 // which will end up in ROM.
+// Arrays consisting solely of constant bytes are stored compactly as bytes,
+// while arrays containing relocations keep their locators.
 class rom_array_t : public rom_data_t
 {
 public:
-    rom_array_t(loc_vec_t&& vec, romv_allocs_t const& a, rom_key_t const&, bool align);
+    rom_array_t(loc_vec_t&& vec, std::size_t hash, romv_allocs_t const& a, rom_key_t const&, bool align);
 
     void mark_used_by(group_data_ht group);
     void mark_omni() { m_omni = true; }
 
-    auto const& data() const { return m_data; } // 'data' is immutable.
+    // 'data' is immutable.
+    std::size_t size() const { return is_bytes() ? m_bytes.size() : m_locs.size(); }
+    bool is_bytes() const { return m_locs.empty(); }
+    std::vector<std::uint8_t> const& bytes() const { assert(is_bytes()); return m_bytes; }
+    loc_vec_t const& locs() const { assert(!is_bytes()); return m_locs; }
+    locator_t operator[](std::size_t i) const 
+        { return is_bytes() ? locator_t::const_byte(m_bytes[i]) : m_locs[i]; }
+    std::size_t hash() const { return m_hash; }
+
     bool omni() const { return m_omni; }
 
     // Don't have to lock the mutex if we're in PHASE_ALLOC_ROM.
@@ -107,7 +117,11 @@ public:
 
     void for_each_locator(std::function<void(locator_t)> const& fn) const;
 private:
-    std::vector<locator_t> m_data;
+    bool equals(loc_vec_t const& vec) const;
+
+    std::vector<std::uint8_t> m_bytes; // Used when every element is a 'const_byte'.
+    loc_vec_t m_locs; // Used otherwise.
+    std::size_t const m_hash;
     std::atomic<bool> m_omni = false;
 
     std::mutex m_mutex; // Protects the members below
@@ -204,6 +218,10 @@ struct rom_alloc_t
     span_t span = {};
     rom_data_ht data = {};
 
+    // Sub-spans (relative to 'span') that run faster when they don't cross a page.
+    // Only set by '--avoid-page-cross', and only honored when there's room.
+    std::vector<span_t> keep_in_page;
+
     unsigned max_size() const { return data.max_size(romv); }
 }; 
 
@@ -1,6 +1,8 @@
 #include "rom_alloc.hpp"
 
+#include <algorithm>
 #include <cmath>
+#include <cstdio>
 #include <vector>
 
 #include "rom.hpp"
@@ -76,8 +78,98 @@ private:
 
     // Allocate a DPCM span
     span_t alloc_dpcm(unsigned size);
+
+    // Prints how many 'keep_in_page' spans ended up not crossing a page.
+    void report_page_crosses() const;
 };
 
+// Calls 'fn(target, branch)' with the instruction indexes of each relative 
+// branch that jumps backwards, i.e. the branches which form loops.
+// Also passes the span from the target to the branch's fall-through address,
+// as taking the branch costs an extra cycle when that span crosses a page.
+template<typename Fn>
+static void for_each_loop_branch(asm_proc_t const& proc, Fn const& fn)
+{
+    rh::batman_map<locator_t, std::pair<unsigned, unsigned>> labels;
+
+    unsigned offset = 0;
+    for(unsigned i = 0; i < proc.code.size(); ++i)
+    {
+        asm_inst_t const& inst = proc.code[i];
+
+        if(inst.op == ASM_LABEL)
+            labels.insert({ inst.arg.mem_head(), { i, offset }});
+        else if(is_relative_branch(inst.op))
+        {
+            if(auto const* target = labels.mapped(inst.arg.mem_head()))
+            {
+                span_t const span = { target->second, offset + op_size(inst.op) + 1 - target->second };
+                fn(target->first, i, span);
+            }
+        }
+
+        offset += op_size(inst.op);
+    }
+}
+
+// Handles created while compiling in parallel are numbered by thread timing.
+// To keep the output independent of that, ROM data is allocated in an order
+// found by walking references from globals, which are numbered deterministically.
+static void canonical_rom_order(std::vector<rom_array_ht>& arrays, std::vector<rom_proc_ht>& procs)
+{
+    std::vector<bool> array_seen(rom_array_ht::pool().size());
+    std::vector<bool> proc_seen(rom_proc_ht::pool().size());
+
+    std::function<void(rom_data_ht)> visit_data;
+
+    std::function<void(locator_t)> const visit_loc = [&](locator_t loc)
+    {
+        if(rom_data_ht data = loc.rom_data())
+            visit_data(data);
+        else if(loc.lclass() == LOC_LT_EXPR)
+            loc.lt()->for_each_locator(visit_loc);
+    };
+
+    visit_data = [&](rom_data_ht data)
+    {
+        data.visit([&](rom_array_ht rom_array)
+        {
+            if(array_seen[rom_array.id])
+                return;
+            array_seen[rom_array.id] = true;
+            arrays.push_back(rom_array);
+            rom_array->for_each_locator(visit_loc);
+        },
+        [&](rom_proc_ht rom_proc)
+        {
+            if(proc_seen[rom_proc.id])
+                return;
+            proc_seen[rom_proc.id] = true;
+            procs.push_back(rom_proc);
+            for(asm_inst_t const& inst : rom_proc->asm_proc().code)
+            {
+                visit_loc(inst.arg);
+                visit_loc(inst.alt);
+            }
+        });
+    };
+
+    for(const_t const& c : const_ht::values())
+        if(c.rom_array())
+            visit_data(c.rom_array());
+
+    for(fn_t const& fn : fn_ht::values())
+        if(fn.rom_proc())
+            visit_data(fn.rom_proc());
+
+    // Anything left over wasn't created by parallel code, or isn't referenced.
+    for(rom_proc_ht rom_proc : rom_proc_ht::handles())
+        visit_data(rom_proc);
+
+    for(rom_array_ht rom_array : rom_array_ht::handles())
+        visit_data(rom_array);
+}
+
 rom_allocator_t::rom_allocator_t(log_t* log, span_allocator_t& allocator)
 : switched_span(mapper().switched_rom_span())
 , log(log)
@@ -123,11 +215,48 @@ rom_allocator_t::rom_allocator_t(log_t* log, span_allocator_t& allocator)
         }
     }
 
+    /////////////////////////////////////////
+    // Find arrays indexed inside of loops //
+    /////////////////////////////////////////
+
+    // Indexed reads cost an extra cycle when they cross a page.
+    // Keeping the whole array inside a page prevents this.
+    std::vector<unsigned> rom_array_loop_reads;
+
+    if(compiler_options().avoid_page_cross)
+    {
+        rom_array_loop_reads.resize(rom_array_ht::pool().size());
+
+        for(rom_proc_ht proc : rom_proc_ht::handles())
+        {
+            if(!proc->emits())
+                continue;
+
+            auto const& code = proc->asm_proc().code;
+            for_each_loop_branch(proc->asm_proc(), [&](unsigned target, unsigned branch, span_t)
+            {
+                for(unsigned i = target; i < branch; ++i)
+                {
+                    auto const mode = op_addr_mode(code[i].op);
+                    if((mode != MODE_ABSOLUTE_X && mode != MODE_ABSOLUTE_Y) || !(op_input_regs(code[i].op) & REGF_M))
+                        continue;
+                    if(rom_data_ht data = code[i].arg.rom_data())
+                        if(data.rclass() == ROMD_ARRAY)
+                            rom_array_loop_reads[data.handle()] += 1;
+                }
+            });
+        }
+    }
+
     //////////////////////////
     // Convert 'rom_array's //
     //////////////////////////
 
-    for(rom_array_ht rom_array_h : rom_array_ht::handles())
+    std::vector<rom_array_ht> canon_arrays;
+    std::vector<rom_proc_ht> canon_procs;
+    canonical_rom_order(canon_arrays, canon_procs);
+
+    for(rom_array_ht rom_array_h : canon_arrays)
     {
         dprint(log, "-PREP_ALLOC_ROM_ARRAY", rom_array_h);
         rom_array_t& rom_array = *rom_array_h;
@@ -158,7 +287,7 @@ rom_allocator_t::rom_allocator_t(log_t* log, span_allocator_t& allocator)
                 }
             }
 
-            once = (float(summed_size) / float(proc_count)) < float(rom_array.data().size());
+            once = (float(summed_size) / float(proc_count)) < float(rom_array.size());
         }
 
         if(rom_array.get_alloc(ROMV_MODE))
@@ -169,11 +298,11 @@ rom_allocator_t::rom_allocator_t(log_t* log, span_allocator_t& allocator)
 
         unsigned alignment = 1;
         if(rom_array.align())
-            alignment = std::min<unsigned>(256, std::bit_ceil(rom_array.data().size()));
+            alignment = std::min<unsigned>(256, std::bit_ceil(rom_array.size()));
 
         if(rom_array.rule() == ROMR_DPCM)
         {
-            span_allocation_t const spans = allocator.alloc_linear(rom_array.data().size(), 64, 0xC000);
+            span_allocation_t const spans = allocator.alloc_linear(rom_array.size(), 64, 0xC000);
             if(!spans)
                 throw std::runtime_error("Unable to allocate DPCM address (out of ROM space).");
             rom_array.set_alloc(ROMV_MODE, rom_static_ht::pool_make(ROMV_MODE, spans.object, rom_array_h), rom_key_t());
@@ -181,7 +310,7 @@ rom_allocator_t::rom_allocator_t(log_t* log, span_allocator_t& allocator)
         }
         else if(rom_array.rule() == ROMR_STATIC)
         {
-            span_allocation_t const spans = allocator.alloc(rom_array.data().size(), alignment);
+            span_allocation_t const spans = allocator.alloc(rom_array.size(), alignment);
             assert(spans.object.addr % alignment == 0);
             if(!spans)
                 throw std::runtime_error("Unable to allocate ROM (out of ROM space).");
@@ -190,19 +319,36 @@ rom_allocator_t::rom_allocator_t(log_t* log, span_allocator_t& allocator)
         }
 
         dprint(log, "--PREPPED", rom_array_h);
+        rom_alloc_t* rom_alloc;
         if(once)
-            rom_array.set_alloc(ROMV_MODE, rom_once_ht::pool_make(ROMV_MODE, rom_array_h, alignment), rom_key_t());
+        {
+            rom_once_ht h = rom_once_ht::pool_make(ROMV_MODE, rom_array_h, alignment);
+            rom_alloc = &h.safe();
+            rom_array.set_alloc(ROMV_MODE, h, rom_key_t());
+        }
         else
-            rom_array.set_alloc(ROMV_MODE, rom_many_ht::pool_make(ROMV_MODE, rom_array_h, alignment), rom_key_t());
+        {
+            rom_many_ht h = rom_many_ht::pool_make(ROMV_MODE, rom_array_h, alignment);
+            rom_alloc = &h.safe();
+            rom_array.set_alloc(ROMV_MODE, h, rom_key_t());
+        }
         assert(rom_array.get_alloc(ROMV_MODE));
         assert(rom_array.get_alloc(ROMV_MODE).rclass());
+
+        // Arrays larger than a page get read in page strips,
+        // which stay within pages when the array starts on one.
+        if(!rom_array_loop_reads.empty())
+        {
+            std::uint16_t const keep_size = std::min<std::size_t>(rom_array.size(), 256);
+            rom_alloc->keep_in_page.assign(rom_array_loop_reads[rom_array_h.id], span_t{ 0, keep_size });
+        }
     }
 
     ///////////////////////////
     // Convert 'rom_proc_t's //
     ///////////////////////////
 
-    for(rom_proc_ht rom_proc_h : rom_proc_ht::handles())
+    for(rom_proc_ht rom_proc_h : canon_procs)
     {
         dprint(log, "-PREP_ALLOC_ROM_PROC", rom_proc_h);
         rom_proc_t& rom_proc = *rom_proc_h;
@@ -267,10 +413,28 @@ rom_allocator_t::rom_allocator_t(log_t* log, span_allocator_t& allocator)
                 return;
             }
 
+            rom_alloc_t* rom_alloc;
             if(once)
-                rom_proc.set_alloc(romv, rom_once_ht::pool_make(romv, rom_proc_h, alignment), rom_key_t());
+            {
+                rom_once_ht h = rom_once_ht::pool_make(romv, rom_proc_h, alignment);
+                rom_alloc = &h.safe();
+                rom_proc.set_alloc(romv, h, rom_key_t());
+            }
             else
-                rom_proc.set_alloc(romv, rom_many_ht::pool_make(romv, rom_proc_h, alignment), rom_key_t());
+            {
+                rom_many_ht h = rom_many_ht::pool_make(romv, rom_proc_h, alignment);
+                rom_alloc = &h.safe();
+                rom_proc.set_alloc(romv, h, rom_key_t());
+            }
+
+            if(compiler_options().avoid_page_cross)
+            {
+                for_each_loop_branch(rom_proc.asm_proc(romv), [&](unsigned, unsigned, span_t span)
+                {
+                    if(span.size <= 256)
+                        rom_alloc->keep_in_page.push_back(span);
+                });
+            }
         });
     }
 
@@ -445,6 +609,38 @@ rom_allocator_t::rom_allocator_t(log_t* log, span_allocator_t& allocator)
     // Allocate onces (this also allocates their required_manys)
     for(once_rank_t const& rank : ordered_onces)
         alloc(rank.once);
+
+    if(compiler_options().avoid_page_cross)
+        report_page_crosses();
+}
+
+void rom_allocator_t::report_page_crosses() const
+{
+    // Index 0 tracks loop branches, index 1 tracks indexed array reads.
+    unsigned kept[2] = {};
+    unsigned total[2] = {};
+
+    auto const count = [&](rom_alloc_t const& a)
+    {
+        if(!a.span)
+            return;
+        unsigned const i = a.data.rclass() == ROMD_ARRAY;
+        for(span_t keep : a.keep_in_page)
+        {
+            total[i] += 1;
+            kept[i] += !crosses_page(offset_span(keep, a.span.addr));
+        }
+    };
+
+    for(rom_once_t const& once : rom_once_ht::values())
+        count(once);
+    for(rom_many_t const& many : rom_many_ht::values())
+        count(many);
+
+    // Each one kept inside a page saves a cycle every time it executes.
+    std::printf("page cross: %u of %u loop branches and %u of %u indexed reads kept within a page "
+                "(up to %u cycles saved per iteration)\n", 
+                kept[0], total[0], kept[1], total[1], kept[0] + kept[1]);
 }
 
 float rom_allocator_t::once_rank(rom_once_t const& once)
@@ -550,7 +746,7 @@ void rom_allocator_t::alloc(rom_once_ht once_h)
         
         // If we succeeded in allocating manys, try to allocate 'once's span:
         // (conditional has side effect assignment)
-        if(!allocated_manys || !(once.span = bank.allocator.alloc(once.max_size(), once.desired_alignment).object))
+        if(!allocated_manys || !(once.span = bank.allocator.alloc(once.max_size(), once.desired_alignment, once.keep_in_page).object))
         {
             // If we fail, free allocated 'many' memory.
             for(rom_many_ht many_h : realloced_manys)
@@ -661,8 +857,11 @@ bool rom_allocator_t::realloc_many(rom_many_ht many_h, bank_bitset_t in_banks)
     span_t const range = { max_start, min_end - max_start };
     span_t alloc_at;
 
-    if(!(alloc_at = aligned(range, many.max_size(), many.desired_alignment)))
+    if(!(alloc_at = aligned_in_pages(range, many.max_size(), many.desired_alignment, many.keep_in_page))
+       && !(alloc_at = aligned(range, many.max_size(), many.desired_alignment)))
+    {
         return false;
+    }
 
     // Now allocate in each bank:
     in_banks.for_each([&](unsigned bank_i)
@@ -733,8 +932,7 @@ void print_rom(std::ostream& o)
             if(auto a = c.rom_array()->get_alloc(romv_t(romv)))
             {
                 o << romv << ' ' << a.get()->span << ' ' << a.first_bank() << std::endl;
-                for(auto const& d : c.rom_array()->data())
-                    o << d << std::endl;
+                c.rom_array()->for_each_locator([&](locator_t d){ o << d << std::endl; });
             }
             else
                 o << romv << " PRUNED\n";
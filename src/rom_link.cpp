@@ -1,6 +1,7 @@
 #include "rom_link.hpp"
 
 #include <stdexcept>
+#include <sstream>
 
 #include "rom.hpp"
 #include "format.hpp"
@@ -10,6 +11,7 @@
 #include "runtime.hpp"
 #include "globals.hpp"
 #include "compiler_error.hpp"
+#include "thread.hpp"
 
 void link_variables_optimize()
 {
@@ -30,18 +32,35 @@ void link_variables_optimize()
 }
 
 static void write_linked(
-    std::vector<locator_t> const& vec, romv_t romv, int bank, 
+    rom_array_t const& array, romv_t romv, int bank, 
     std::uint8_t* const start)
 {
     passert(bank < mapper().num_banks, bank);
-    std::uint8_t* at = start;
 
+    // Byte arrays need no linking:
+    if(array.is_bytes())
+    {
+        std::copy(array.bytes().begin(), array.bytes().end(), start);
+        return;
+    }
+
+    std::uint8_t* at = start;
+    loc_vec_t const& vec = array.locs();
     std::size_t const size = vec.size();
 
     for(std::size_t i = 0; i < size; ++i)
         *at++ = linked_to_rom(vec[i].link(romv, {}, bank));
 }
 
+// Resolves the LT expressions that 'loc' depends on.
+static void resolve_lt(locator_t loc, romv_t romv)
+{
+    if(loc.lclass() == LOC_LT_EXPR)
+        loc.link(romv);
+    else if(loc.lclass() == LOC_FN && loc.is() == IS_BANK && loc.fn()->first_bank_switch())
+        resolve_lt(loc.fn()->first_bank_switch(), romv);
+}
+
 std::vector<std::uint8_t> write_rom(std::uint8_t default_fill)
 {
     std::size_t const header_size = mapper().ines_header_size();
@@ -63,46 +82,110 @@ std::vector<std::uint8_t> write_rom(std::uint8_t default_fill)
         return rom.data() + prg_rom_start + bank * mapper().bank_size() + span.addr - mapper().bank_span(bank).addr;
     };
 
-    auto const write = [&](auto const& alloc, bool stat = false)
+    // Each allocation is linked independently, writing to its own span of the ROM.
+    // This lets us link in parallel, with the output not depending on thread timing.
+    struct link_job_t
     {
-        alloc.data.visit([&](rom_array_ht rom_array)
+        rom_data_ht data;
+        romv_t romv;
+        span_t span;
+        int only_bank;
+        std::vector<unsigned> banks;
+        std::string info; // Assembly listing, for '--info'.
+        std::exception_ptr exception;
+    };
+
+    std::vector<link_job_t> jobs;
+
+    auto const add_jobs = [&](auto const& allocs)
+    {
+        for(auto const& alloc : allocs)
         {
-            alloc.for_each_bank([&](unsigned bank)
+            if(!alloc.data)
+                continue;
+
+            link_job_t& job = jobs.emplace_back();
+            job.data = alloc.data;
+            job.romv = alloc.romv;
+            job.span = alloc.span;
+            job.only_bank = alloc.only_bank();
+            alloc.for_each_bank([&](unsigned bank){ job.banks.push_back(bank); });
+        }
+    };
+
+    add_jobs(rom_static_ht::values());
+    add_jobs(rom_once_ht::values());
+    add_jobs(rom_many_ht::values());
+
+    // LT expressions are resolved lazily by the interpreter, which isn't thread-safe.
+    // Resolve them up front, so that the parallel link only reads cached values.
+    for(link_job_t const& job : jobs)
+    {
+        job.data.visit([&](rom_array_ht rom_array)
+        {
+            rom_array->for_each_locator([&](locator_t loc){ resolve_lt(loc, job.romv); });
+        }, 
+        [&](rom_proc_ht rom_proc)
+        {
+            for(asm_inst_t const& inst : rom_proc->asm_proc(job.romv).code)
             {
-                write_linked(rom_array->data(), alloc.romv, bank, file_addr(alloc.span, bank));
-            });
+                resolve_lt(inst.arg, job.romv);
+                resolve_lt(inst.alt, job.romv);
+            }
+        });
+    }
+
+    auto const link = [&](link_job_t& job)
+    {
+        job.data.visit([&](rom_array_ht rom_array)
+        {
+            for(unsigned bank : job.banks)
+                write_linked(*rom_array, job.romv, bank, file_addr(job.span, bank));
         }, 
         [&](rom_proc_ht rom_proc)
         {
-            // We're copying the proc here.
-            // This is slower than necessary, but safer to code.
-            auto& asm_proc = rom_proc->asm_proc(alloc.romv);
+            // We're copying the proc here, as other jobs may share it.
+            asm_proc_t asm_proc = rom_proc->asm_proc(job.romv);
 
-            asm_proc.link(alloc.romv, alloc.only_bank());
-            asm_proc.relocate(locator_t::addr(alloc.span.addr));
+            asm_proc.link(job.romv, job.only_bank);
+            asm_proc.relocate(locator_t::addr(job.span.addr));
 
-            if(asm_proc.fn)
+            if(asm_proc.fn && asm_proc.fn->info_stream())
             {
-                if(auto* os = asm_proc.fn->info_stream())
-                {
-                    *os << "\nLINK:\n";
-                    asm_proc.write_assembly(*os, alloc.romv);
-                }
+                std::ostringstream ss;
+                ss << "\nLINK:\n";
+                asm_proc.write_assembly(ss, job.romv);
+                job.info = ss.str();
             }
 
-            alloc.for_each_bank([&](unsigned bank)
-            {
-                asm_proc.write_bytes(file_addr(alloc.span, bank), alloc.romv, bank);
-            });
+            for(unsigned bank : job.banks)
+                asm_proc.write_bytes(file_addr(job.span, bank), job.romv, bank);
         });
     };
 
-    for(rom_static_t const& static_ : rom_static_ht::values())
-        write(static_, true);
-    for(rom_once_t const& once : rom_once_ht::values())
-        write(once);
-    for(rom_many_t const& many : rom_many_ht::values())
-        write(many);
+    std::atomic<unsigned> next_job_i = 0;
+    parallelize(compiler_options().num_threads,
+    [&](std::atomic<bool>&)
+    {
+        // Errors are saved and reported in job order, not by which thread failed first.
+        for(unsigned i; (i = next_job_i++) < jobs.size();)
+        {
+            try { link(jobs[i]); }
+            catch(...) { jobs[i].exception = std::current_exception(); }
+        }
+    }, []{});
+
+    for(link_job_t const& job : jobs)
+    {
+        if(job.exception)
+            std::rethrow_exception(job.exception);
+
+        if(!job.info.empty())
+        {
+            rom_proc_ht const rom_proc = { job.data.handle() };
+            *rom_proc->asm_proc(job.romv).fn->info_stream() << job.info;
+        }
+    }
 
     if(auto addr = mapper().this_bank_addr())
     {
@@ -119,7 +202,7 @@ std::vector<std::uint8_t> write_rom(std::uint8_t default_fill)
             const_t const& chrrom = global_t::chrrom()->impl<const_t>();
             rom_array_ht const rom_array = chrrom.rom_array();
             assert(rom_array);
-            std::size_t const size = rom_array->data().size();
+            std::size_t const size = rom_array->size();
 
             if(size > chr_rom_size)
             {
@@ -134,7 +217,7 @@ std::vector<std::uint8_t> write_rom(std::uint8_t default_fill)
                         size, chr_rom_size));
             }
 
-            write_linked(rom_array->data(), ROMV_MODE, 0, rom.data() + chr_rom_start);
+            write_linked(*rom_array, ROMV_MODE, 0, rom.data() + chr_rom_start);
         }
     }
     else if(global_t::chrrom())
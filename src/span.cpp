@@ -39,3 +39,28 @@ span_t aligned_reverse(span_t span, std::uint16_t size, std::uint16_t alignment)
     return span.contains(ret) ? ret : span_t{};
 }
 
+
+span_t aligned_in_pages(span_t span, std::uint16_t size, std::uint16_t alignment, 
+                        std::vector<span_t> const& keep_in_page)
+{
+    if(!alignment)
+        alignment = 1;
+
+    span_t ret = aligned(span, size, alignment);
+
+    // Page crossings repeat every 256 bytes, so there's no need to look further.
+    for(unsigned tries = 0; ret && tries < 256; tries += alignment)
+    {
+        if(std::none_of(keep_in_page.begin(), keep_in_page.end(), [&](span_t keep) 
+            { return crosses_page(offset_span(keep, ret.addr)); }))
+        {
+            return ret;
+        }
+
+        ret.addr += alignment;
+        if(!span.contains(ret))
+            break;
+    }
+
+    return {};
+}
@@ -28,4 +28,11 @@ std::ostream& operator<<(std::ostream& o, span_t span);
 span_t aligned(span_t span, std::uint16_t size, std::uint16_t alignment);
 span_t aligned_reverse(span_t span, std::uint16_t size, std::uint16_t alignment);
 
+// Like 'aligned', but also requires each span in 'keep_in_page' 
+// (relative to the result) to not cross a 256-byte page.
+span_t aligned_in_pages(span_t span, std::uint16_t size, std::uint16_t alignment, 
+                        std::vector<span_t> const& keep_in_page);
+
+constexpr bool crosses_page(span_t span) { return span.size && (span.addr >> 8) != ((span.end() - 1) >> 8); }
+
 #endif
@@ -42,6 +42,28 @@ span_allocation_t span_allocator_t::alloc(std::uint16_t size, std::uint16_t alig
     return did_alloc(it, alloc);
 }
 
+span_allocation_t span_allocator_t::alloc(std::uint16_t size, std::uint16_t alignment, 
+                                          std::vector<span_t> const& keep_in_page)
+{
+    if(treap.empty() || keep_in_page.empty())
+        return alloc(size, alignment);
+
+    if(!size)
+        size = 1;
+
+    auto it = treap.top(); // Select the node with the largest size.
+    if(it->span.size < size)
+        return {};
+
+    if(span_t alloc = aligned_in_pages(it->span, size, alignment, keep_in_page))
+    {
+        assert(it->span.contains(alloc));
+        return did_alloc(it, alloc);
+    }
+
+    return alloc(size, alignment);
+}
+
 span_allocation_t span_allocator_t::alloc_linear(std::uint16_t size, std::uint16_t alignment, unsigned after)
 {
     if(!after)
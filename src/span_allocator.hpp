@@ -91,6 +91,10 @@ public:
 
     span_allocation_t alloc(std::uint16_t size, std::uint16_t alignment = 1, bool insist_alignment = true);
 
+    // Prefers an allocation where no span of 'keep_in_page' crosses a page,
+    // but falls back to 'alloc' otherwise.
+    span_allocation_t alloc(std::uint16_t size, std::uint16_t alignment, std::vector<span_t> const& keep_in_page);
+
     span_allocation_t alloc_linear(std::uint16_t size, std::uint16_t alignment = 1, unsigned after = 0);
 
     void free(span_t span);
@@ -0,0 +1,26 @@
+#ifndef SUPEROPT_HPP
+#define SUPEROPT_HPP
+
+// Rewrite rules found by the superoptimizer in 'superopt_gen.cpp'.
+// These are applied by 'o_superopt'.
+
+#include "asm.hpp"
+
+struct superopt_op_t
+{
+    op_name_t name;
+    bool mem; // If true, the op operates on memory. Otherwise, it's implied.
+};
+
+struct superopt_rule_t
+{
+    // Unused entries have a 'name' of 'BAD_OP_NAME'.
+    // Every memory op refers to the same memory location.
+    superopt_op_t window[3];
+    superopt_op_t replacement[2];
+};
+
+extern superopt_rule_t const superopt_rules[];
+extern unsigned const num_superopt_rules;
+
+#endif
@@ -0,0 +1,350 @@
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+// An enumerative superoptimizer for short, straight-line windows of 6502 code.
+// It finds every window of up to 3 instructions that is equivalent to a
+// cheaper sequence, and writes the results as a table to 'superopt_rules.cpp'.
+// That table is applied by 'o_superopt' in 'asm_proc.cpp'.
+//
+// Instructions are either implied, or operate on a single memory location 'M'.
+// (Immediate operands aren't handled.)
+// Equivalence is verified exhaustively over every input the sequences depend on,
+// comparing A, X, Y, M and the C, Z, N, V flags.
+
+struct state_t
+{
+    std::uint8_t a, x, y, m;
+    bool c, z, n, v;
+
+    bool operator==(state_t const& o) const
+    {
+        return a == o.a && x == o.x && y == o.y && m == o.m
+            && c == o.c && z == o.z && n == o.n && v == o.v;
+    }
+};
+
+// Components of 'state_t':
+enum : unsigned
+{
+    S_A = 1 << 0,
+    S_X = 1 << 1,
+    S_Y = 1 << 2,
+    S_M = 1 << 3,
+    S_C = 1 << 4,
+    S_Z = 1 << 5,
+    S_N = 1 << 6,
+    S_V = 1 << 7,
+    S_NZ = S_N | S_Z,
+};
+
+void nz(state_t& s, std::uint8_t r) { s.n = r & 0x80; s.z = r == 0; }
+
+void adc(state_t& s, std::uint8_t m)
+{
+    unsigned const t = s.a + m + s.c;
+    s.v = ~(s.a ^ m) & (s.a ^ t) & 0x80;
+    s.c = t > 0xFF;
+    s.a = t;
+    nz(s, s.a);
+}
+
+void cmp(state_t& s, std::uint8_t r, std::uint8_t m)
+{
+    s.c = r >= m;
+    nz(s, r - m);
+}
+
+std::uint8_t asl(state_t& s, std::uint8_t r) { s.c = r & 0x80; r <<= 1; nz(s, r); return r; }
+std::uint8_t lsr(state_t& s, std::uint8_t r) { s.c = r & 1; r >>= 1; nz(s, r); return r; }
+std::uint8_t rol(state_t& s, std::uint8_t r) { bool c = s.c; s.c = r & 0x80; r = (r << 1) | c; nz(s, r); return r; }
+std::uint8_t ror(state_t& s, std::uint8_t r) { bool c = s.c; s.c = r & 1; r = (r >> 1) | (c << 7); nz(s, r); return r; }
+
+struct op_t
+{
+    char const* name;
+    bool mem;
+    unsigned reads;
+    unsigned writes;
+    unsigned cycles;
+    void(*fn)(state_t&);
+
+    unsigned size() const { return mem ? 2 : 1; } // Assumes zero page.
+};
+
+op_t const ops[] =
+{
+    { "TAX", false, S_A, S_X | S_NZ, 2, [](state_t& s){ s.x = s.a; nz(s, s.x); } },
+    { "TAY", false, S_A, S_Y | S_NZ, 2, [](state_t& s){ s.y = s.a; nz(s, s.y); } },
+    { "TXA", false, S_X, S_A | S_NZ, 2, [](state_t& s){ s.a = s.x; nz(s, s.a); } },
+    { "TYA", false, S_Y, S_A | S_NZ, 2, [](state_t& s){ s.a = s.y; nz(s, s.a); } },
+    { "INX", false, S_X, S_X | S_NZ, 2, [](state_t& s){ nz(s, ++s.x); } },
+    { "INY", false, S_Y, S_Y | S_NZ, 2, [](state_t& s){ nz(s, ++s.y); } },
+    { "DEX", false, S_X, S_X | S_NZ, 2, [](state_t& s){ nz(s, --s.x); } },
+    { "DEY", false, S_Y, S_Y | S_NZ, 2, [](state_t& s){ nz(s, --s.y); } },
+    { "CLC", false, 0, S_C, 2, [](state_t& s){ s.c = false; } },
+    { "SEC", false, 0, S_C, 2, [](state_t& s){ s.c = true; } },
+    { "CLV", false, 0, S_V, 2, [](state_t& s){ s.v = false; } },
+    { "ASL", false, S_A, S_A | S_C | S_NZ, 2, [](state_t& s){ s.a = asl(s, s.a); } },
+    { "LSR", false, S_A, S_A | S_C | S_NZ, 2, [](state_t& s){ s.a = lsr(s, s.a); } },
+    { "ROL", false, S_A | S_C, S_A | S_C | S_NZ, 2, [](state_t& s){ s.a = rol(s, s.a); } },
+    { "ROR", false, S_A | S_C, S_A | S_C | S_NZ, 2, [](state_t& s){ s.a = ror(s, s.a); } },
+
+    { "LDA", true, S_M, S_A | S_NZ, 3, [](state_t& s){ s.a = s.m; nz(s, s.a); } },
+    { "LDX", true, S_M, S_X | S_NZ, 3, [](state_t& s){ s.x = s.m; nz(s, s.x); } },
+    { "LDY", true, S_M, S_Y | S_NZ, 3, [](state_t& s){ s.y = s.m; nz(s, s.y); } },
+    { "LAX", true, S_M, S_A | S_X | S_NZ, 3, [](state_t& s){ s.a = s.x = s.m; nz(s, s.a); } },
+    { "STA", true, S_A, S_M, 3, [](state_t& s){ s.m = s.a; } },
+    { "STX", true, S_X, S_M, 3, [](state_t& s){ s.m = s.x; } },
+    { "STY", true, S_Y, S_M, 3, [](state_t& s){ s.m = s.y; } },
+    { "SAX", true, S_A | S_X, S_M, 3, [](state_t& s){ s.m = s.a & s.x; } },
+    { "INC", true, S_M, S_M | S_NZ, 5, [](state_t& s){ nz(s, ++s.m); } },
+    { "DEC", true, S_M, S_M | S_NZ, 5, [](state_t& s){ nz(s, --s.m); } },
+    { "ASL", true, S_M, S_M | S_C | S_NZ, 5, [](state_t& s){ s.m = asl(s, s.m); } },
+    { "LSR", true, S_M, S_M | S_C | S_NZ, 5, [](state_t& s){ s.m = lsr(s, s.m); } },
+    { "ROL", true, S_M | S_C, S_M | S_C | S_NZ, 5, [](state_t& s){ s.m = rol(s, s.m); } },
+    { "ROR", true, S_M | S_C, S_M | S_C | S_NZ, 5, [](state_t& s){ s.m = ror(s, s.m); } },
+    { "ADC", true, S_A | S_M | S_C, S_A | S_C | S_V | S_NZ, 3, [](state_t& s){ adc(s, s.m); } },
+    { "SBC", true, S_A | S_M | S_C, S_A | S_C | S_V | S_NZ, 3, [](state_t& s){ adc(s, ~s.m); } },
+    { "AND", true, S_A | S_M, S_A | S_NZ, 3, [](state_t& s){ s.a &= s.m; nz(s, s.a); } },
+    { "ORA", true, S_A | S_M, S_A | S_NZ, 3, [](state_t& s){ s.a |= s.m; nz(s, s.a); } },
+    { "EOR", true, S_A | S_M, S_A | S_NZ, 3, [](state_t& s){ s.a ^= s.m; nz(s, s.a); } },
+    { "CMP", true, S_A | S_M, S_C | S_NZ, 3, [](state_t& s){ cmp(s, s.a, s.m); } },
+    { "CPX", true, S_X | S_M, S_C | S_NZ, 3, [](state_t& s){ cmp(s, s.x, s.m); } },
+    { "CPY", true, S_Y | S_M, S_C | S_NZ, 3, [](state_t& s){ cmp(s, s.y, s.m); } },
+    { "BIT", true, S_A | S_M, S_V | S_NZ, 3, [](state_t& s){ s.z = !(s.a & s.m); s.n = s.m & 0x80; s.v = s.m & 0x40; } },
+    { "DCP", true, S_A | S_M, S_M | S_C | S_NZ, 5, [](state_t& s){ --s.m; cmp(s, s.a, s.m); } },
+    { "ISC", true, S_A | S_M | S_C, S_M | S_A | S_C | S_V | S_NZ, 5, [](state_t& s){ ++s.m; adc(s, ~s.m); } },
+    { "SLO", true, S_A | S_M, S_M | S_A | S_C | S_NZ, 5, [](state_t& s){ s.m = asl(s, s.m); s.a |= s.m; nz(s, s.a); } },
+    { "RLA", true, S_A | S_M | S_C, S_M | S_A | S_C | S_NZ, 5, [](state_t& s){ s.m = rol(s, s.m); s.a &= s.m; nz(s, s.a); } },
+    { "SRE", true, S_A | S_M, S_M | S_A | S_C | S_NZ, 5, [](state_t& s){ s.m = lsr(s, s.m); s.a ^= s.m; nz(s, s.a); } },
+    { "RRA", true, S_A | S_M | S_C, S_M | S_A | S_C | S_V | S_NZ, 5, [](state_t& s){ s.m = ror(s, s.m); adc(s, s.m); } },
+};
+
+constexpr unsigned NUM_OPS = sizeof(ops) / sizeof(ops[0]);
+constexpr unsigned MAX_WINDOW = 3;
+constexpr unsigned MAX_REPLACEMENT = 2;
+constexpr unsigned NUM_SAMPLES = 64;
+
+// Exhaustive verification is limited to this many bits of input:
+constexpr unsigned MAX_VERIFY_BITS = 22;
+
+using seq_t = std::vector<unsigned>; // Indexes into 'ops'.
+
+struct cost_t
+{
+    unsigned size;
+    unsigned cycles;
+
+    auto operator<=>(cost_t const&) const = default;
+};
+
+cost_t cost(seq_t const& seq)
+{
+    cost_t ret = {};
+    for(unsigned i : seq)
+    {
+        ret.size += ops[i].size();
+        ret.cycles += ops[i].cycles;
+    }
+    return ret;
+}
+
+state_t run(seq_t const& seq, state_t s)
+{
+    for(unsigned i : seq)
+        ops[i].fn(s);
+    return s;
+}
+
+unsigned reads(seq_t const& seq)
+{
+    unsigned ret = 0;
+    for(unsigned i : seq)
+        ret |= ops[i].reads;
+    return ret;
+}
+
+unsigned writes(seq_t const& seq)
+{
+    unsigned ret = 0;
+    for(unsigned i : seq)
+        ret |= ops[i].writes;
+    return ret;
+}
+
+std::vector<state_t> samples;
+
+std::uint64_t fingerprint(seq_t const& seq)
+{
+    std::uint64_t h = 0xcbf29ce484222325ull;
+    auto const hash = [&](unsigned v) { h = (h ^ v) * 0x100000001b3ull; };
+
+    for(state_t const& s : samples)
+    {
+        state_t const r = run(seq, s);
+        hash(r.a);
+        hash(r.x);
+        hash(r.y);
+        hash(r.m);
+        hash(r.c | (r.z << 1) | (r.n << 2) | (r.v << 3));
+    }
+
+    return h;
+}
+
+// Checks equivalence over every value of the inputs 'a' and 'b' depend on.
+// Components neither sequence reads can't affect the outputs,
+// except when one sequence passes them through unchanged while the other writes them.
+bool verify(seq_t const& a, seq_t const& b)
+{
+    unsigned const inputs = reads(a) | reads(b) | (writes(a) ^ writes(b));
+
+    unsigned bits = 0;
+    for(unsigned i = 0; i < 8; ++i)
+        if(inputs & (1 << i))
+            bits += (i < 4) ? 8 : 1;
+
+    if(bits > MAX_VERIFY_BITS)
+        return false;
+
+    for(std::uint32_t i = 0; i < (1u << bits); ++i)
+    {
+        state_t s = { 0x5A, 0xA5, 0x3C, 0xC3, false, false, false, false };
+        std::uint32_t v = i;
+
+        auto const take = [&](unsigned n) { std::uint32_t r = v & ((1 << n) - 1); v >>= n; return r; };
+
+        if(inputs & S_A) s.a = take(8);
+        if(inputs & S_X) s.x = take(8);
+        if(inputs & S_Y) s.y = take(8);
+        if(inputs & S_M) s.m = take(8);
+        if(inputs & S_C) s.c = take(1);
+        if(inputs & S_Z) s.z = take(1);
+        if(inputs & S_N) s.n = take(1);
+        if(inputs & S_V) s.v = take(1);
+
+        if(!(run(a, s) == run(b, s)))
+            return false;
+    }
+
+    return true;
+}
+
+void enumerate(unsigned length, seq_t& seq, std::vector<seq_t>& out)
+{
+    if(seq.size() == length)
+    {
+        out.push_back(seq);
+        return;
+    }
+
+    for(unsigned i = 0; i < NUM_OPS; ++i)
+    {
+        seq.push_back(i);
+        enumerate(length, seq, out);
+        seq.pop_back();
+    }
+}
+
+int main()
+{
+    std::mt19937 rng(0x6502);
+    for(unsigned i = 0; i < NUM_SAMPLES; ++i)
+    {
+        samples.push_back({
+            std::uint8_t(rng()), std::uint8_t(rng()), std::uint8_t(rng()), std::uint8_t(rng()),
+            bool(rng() & 1), bool(rng() & 1), bool(rng() & 1), bool(rng() & 1) });
+    }
+
+    // Bucket every candidate replacement by its behavior on the samples:
+    std::map<std::uint64_t, std::vector<seq_t>> candidates;
+    for(unsigned length = 0; length <= MAX_REPLACEMENT; ++length)
+    {
+        std::vector<seq_t> seqs;
+        seq_t seq;
+        enumerate(length, seq, seqs);
+
+        for(seq_t const& seq : seqs)
+            candidates[fingerprint(seq)].push_back(seq);
+    }
+
+    for(auto& pair : candidates)
+        std::stable_sort(pair.second.begin(), pair.second.end(), [](seq_t const& a, seq_t const& b)
+            { return cost(a) < cost(b); });
+
+    std::map<seq_t, seq_t> rules;
+
+    auto const has_rule = [&](seq_t const& seq, unsigned begin, unsigned end)
+    {
+        return rules.count(seq_t(seq.begin() + begin, seq.begin() + end));
+    };
+
+    for(unsigned length = 2; length <= MAX_WINDOW; ++length)
+    {
+        std::vector<seq_t> windows;
+        seq_t seq;
+        enumerate(length, seq, windows);
+
+        for(seq_t const& window : windows)
+        {
+            // Skip windows that contain a smaller window we've already optimized:
+            bool contained = false;
+            for(unsigned i = 2; i < length && !contained; ++i)
+                for(unsigned j = 0; j + i <= length && !contained; ++j)
+                    contained = has_rule(window, j, j + i);
+            if(contained)
+                continue;
+
+            auto it = candidates.find(fingerprint(window));
+            if(it == candidates.end())
+                continue;
+
+            cost_t const window_cost = cost(window);
+
+            for(seq_t const& candidate : it->second)
+            {
+                if(cost(candidate) >= window_cost)
+                    break;
+
+                if(verify(window, candidate))
+                {
+                    rules.emplace(window, candidate);
+                    break;
+                }
+            }
+        }
+    }
+
+    auto const print_seq = [](seq_t const& seq, unsigned max)
+    {
+        std::printf("{ ");
+        for(unsigned i = 0; i < max; ++i)
+        {
+            if(i < seq.size())
+                std::printf("{ %s, %s }, ", ops[seq[i]].name, ops[seq[i]].mem ? "true" : "false");
+            else
+                std::printf("{}, ");
+        }
+        std::printf("}");
+    };
+
+    std::printf("// Generated by 'superopt_gen.cpp'. Do not edit.\n");
+    std::printf("#include \"superopt.hpp\"\n");
+    std::printf("extern superopt_rule_t const superopt_rules[%u] =\n{\n", unsigned(rules.size()));
+    for(auto const& pair : rules)
+    {
+        std::printf("    { ");
+        print_seq(pair.first, MAX_WINDOW);
+        std::printf(", ");
+        print_seq(pair.second, MAX_REPLACEMENT);
+        std::printf(" },\n");
+    }
+    std::printf("};\n");
+    std::printf("extern unsigned const num_superopt_rules = %u;\n", unsigned(rules.size()));
+}
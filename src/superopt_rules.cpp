@@ -0,0 +1,3831 @@
+// Generated by 'superopt_gen.cpp'. Do not edit.
+#include "superopt.hpp"
+extern superopt_rule_t const superopt_rules[3825] =
+{
+    { { { TAX, false }, { TAX, false }, {}, }, { { TAX, false }, {}, } },
+    { { { TAX, false }, { TAY, false }, { TAX, false }, }, { { TAX, false }, { TAY, false }, } },
+    { { { TAX, false }, { TAY, false }, { TXA, false }, }, { { TAX, false }, { TAY, false }, } },
+    { { { TAX, false }, { TAY, false }, { LDX, true }, }, { { TAY, false }, { LDX, true }, } },
+    { { { TAX, false }, { TAY, false }, { LAX, true }, }, { { TAY, false }, { LAX, true }, } },
+    { { { TAX, false }, { TXA, false }, {}, }, { { TAX, false }, {}, } },
+    { { { TAX, false }, { TYA, false }, { TAX, false }, }, { { TYA, false }, { TAX, false }, } },
+    { { { TAX, false }, { INX, false }, { DEX, false }, }, { { TAX, false }, {}, } },
+    { { { TAX, false }, { INY, false }, { TAX, false }, }, { { INY, false }, { TAX, false }, } },
+    { { { TAX, false }, { DEX, false }, { INX, false }, }, { { TAX, false }, {}, } },
+    { { { TAX, false }, { DEY, false }, { TAX, false }, }, { { DEY, false }, { TAX, false }, } },
+    { { { TAX, false }, { CLC, false }, { TAX, false }, }, { { TAX, false }, { CLC, false }, } },
+    { { { TAX, false }, { CLC, false }, { TXA, false }, }, { { TAX, false }, { CLC, false }, } },
+    { { { TAX, false }, { CLC, false }, { LDX, true }, }, { { CLC, false }, { LDX, true }, } },
+    { { { TAX, false }, { CLC, false }, { LAX, true }, }, { { CLC, false }, { LAX, true }, } },
+    { { { TAX, false }, { SEC, false }, { TAX, false }, }, { { TAX, false }, { SEC, false }, } },
+    { { { TAX, false }, { SEC, false }, { TXA, false }, }, { { TAX, false }, { SEC, false }, } },
+    { { { TAX, false }, { SEC, false }, { LDX, true }, }, { { SEC, false }, { LDX, true }, } },
+    { { { TAX, false }, { SEC, false }, { LAX, true }, }, { { SEC, false }, { LAX, true }, } },
+    { { { TAX, false }, { CLV, false }, { TAX, false }, }, { { TAX, false }, { CLV, false }, } },
+    { { { TAX, false }, { CLV, false }, { TXA, false }, }, { { TAX, false }, { CLV, false }, } },
+    { { { TAX, false }, { CLV, false }, { LDX, true }, }, { { CLV, false }, { LDX, true }, } },
+    { { { TAX, false }, { CLV, false }, { LAX, true }, }, { { CLV, false }, { LAX, true }, } },
+    { { { TAX, false }, { ASL, false }, { TAX, false }, }, { { ASL, false }, { TAX, false }, } },
+    { { { TAX, false }, { ASL, false }, { ROR, false }, }, { { TAX, false }, { CLC, false }, } },
+    { { { TAX, false }, { ASL, false }, { LDX, true }, }, { { ASL, false }, { LDX, true }, } },
+    { { { TAX, false }, { ASL, false }, { LAX, true }, }, { { ASL, false }, { LAX, true }, } },
+    { { { TAX, false }, { LSR, false }, { TAX, false }, }, { { LSR, false }, { TAX, false }, } },
+    { { { TAX, false }, { LSR, false }, { ROL, false }, }, { { TAX, false }, { CLC, false }, } },
+    { { { TAX, false }, { LSR, false }, { LDX, true }, }, { { LSR, false }, { LDX, true }, } },
+    { { { TAX, false }, { LSR, false }, { LAX, true }, }, { { LSR, false }, { LAX, true }, } },
+    { { { TAX, false }, { ROL, false }, { TAX, false }, }, { { ROL, false }, { TAX, false }, } },
+    { { { TAX, false }, { ROL, false }, { ROR, false }, }, { { TAX, false }, {}, } },
+    { { { TAX, false }, { ROL, false }, { LDX, true }, }, { { ROL, false }, { LDX, true }, } },
+    { { { TAX, false }, { ROL, false }, { LAX, true }, }, { { ASL, false }, { LAX, true }, } },
+    { { { TAX, false }, { ROR, false }, { TAX, false }, }, { { ROR, false }, { TAX, false }, } },
+    { { { TAX, false }, { ROR, false }, { ROL, false }, }, { { TAX, false }, {}, } },
+    { { { TAX, false }, { ROR, false }, { LDX, true }, }, { { ROR, false }, { LDX, true }, } },
+    { { { TAX, false }, { ROR, false }, { LAX, true }, }, { { LSR, false }, { LAX, true }, } },
+    { { { TAX, false }, { LDX, true }, {}, }, { { LDX, true }, {}, } },
+    { { { TAX, false }, { LDY, true }, { TAX, false }, }, { { LDY, true }, { TAX, false }, } },
+    { { { TAX, false }, { LDY, true }, { LDX, true }, }, { { LDX, true }, { LDY, true }, } },
+    { { { TAX, false }, { LAX, true }, {}, }, { { LAX, true }, {}, } },
+    { { { TAX, false }, { STA, true }, { TAX, false }, }, { { TAX, false }, { STA, true }, } },
+    { { { TAX, false }, { STA, true }, { TXA, false }, }, { { TAX, false }, { STA, true }, } },
+    { { { TAX, false }, { STA, true }, { LDA, true }, }, { { TAX, false }, { STA, true }, } },
+    { { { TAX, false }, { STA, true }, { AND, true }, }, { { TAX, false }, { STA, true }, } },
+    { { { TAX, false }, { STA, true }, { ORA, true }, }, { { TAX, false }, { STA, true }, } },
+    { { { TAX, false }, { STX, true }, { TAX, false }, }, { { TAX, false }, { STA, true }, } },
+    { { { TAX, false }, { STX, true }, { TXA, false }, }, { { TAX, false }, { STA, true }, } },
+    { { { TAX, false }, { STY, true }, { TAX, false }, }, { { TAX, false }, { STY, true }, } },
+    { { { TAX, false }, { SAX, true }, { TAX, false }, }, { { TAX, false }, { STA, true }, } },
+    { { { TAX, false }, { SAX, true }, { TXA, false }, }, { { TAX, false }, { STA, true }, } },
+    { { { TAX, false }, { INC, true }, { TAX, false }, }, { { INC, true }, { TAX, false }, } },
+    { { { TAX, false }, { INC, true }, { LDX, true }, }, { { INC, true }, { LDX, true }, } },
+    { { { TAX, false }, { INC, true }, { LAX, true }, }, { { INC, true }, { LAX, true }, } },
+    { { { TAX, false }, { DEC, true }, { TAX, false }, }, { { DEC, true }, { TAX, false }, } },
+    { { { TAX, false }, { DEC, true }, { LDX, true }, }, { { DEC, true }, { LDX, true }, } },
+    { { { TAX, false }, { DEC, true }, { LAX, true }, }, { { DEC, true }, { LAX, true }, } },
+    { { { TAX, false }, { ASL, true }, { TAX, false }, }, { { ASL, true }, { TAX, false }, } },
+    { { { TAX, false }, { ASL, true }, { LDX, true }, }, { { ASL, true }, { LDX, true }, } },
+    { { { TAX, false }, { ASL, true }, { LAX, true }, }, { { ASL, true }, { LAX, true }, } },
+    { { { TAX, false }, { LSR, true }, { TAX, false }, }, { { LSR, true }, { TAX, false }, } },
+    { { { TAX, false }, { LSR, true }, { LDX, true }, }, { { LSR, true }, { LDX, true }, } },
+    { { { TAX, false }, { LSR, true }, { LAX, true }, }, { { LSR, true }, { LAX, true }, } },
+    { { { TAX, false }, { ROL, true }, { TAX, false }, }, { { ROL, true }, { TAX, false }, } },
+    { { { TAX, false }, { ROL, true }, { LDX, true }, }, { { ROL, true }, { LDX, true }, } },
+    { { { TAX, false }, { ROL, true }, { LAX, true }, }, { { ROL, true }, { LAX, true }, } },
+    { { { TAX, false }, { ROR, true }, { TAX, false }, }, { { ROR, true }, { TAX, false }, } },
+    { { { TAX, false }, { ROR, true }, { LDX, true }, }, { { ROR, true }, { LDX, true }, } },
+    { { { TAX, false }, { ROR, true }, { LAX, true }, }, { { ROR, true }, { LAX, true }, } },
+    { { { TAX, false }, { ADC, true }, { TAX, false }, }, { { ADC, true }, { TAX, false }, } },
+    { { { TAX, false }, { ADC, true }, { LDX, true }, }, { { ADC, true }, { LDX, true }, } },
+    { { { TAX, false }, { ADC, true }, { LAX, true }, }, { { ADC, true }, { LAX, true }, } },
+    { { { TAX, false }, { SBC, true }, { TAX, false }, }, { { SBC, true }, { TAX, false }, } },
+    { { { TAX, false }, { SBC, true }, { LDX, true }, }, { { SBC, true }, { LDX, true }, } },
+    { { { TAX, false }, { SBC, true }, { LAX, true }, }, { { SBC, true }, { LAX, true }, } },
+    { { { TAX, false }, { AND, true }, { TAX, false }, }, { { AND, true }, { TAX, false }, } },
+    { { { TAX, false }, { AND, true }, { LDX, true }, }, { { AND, true }, { LDX, true }, } },
+    { { { TAX, false }, { ORA, true }, { TAX, false }, }, { { ORA, true }, { TAX, false }, } },
+    { { { TAX, false }, { ORA, true }, { LDX, true }, }, { { ORA, true }, { LDX, true }, } },
+    { { { TAX, false }, { EOR, true }, { TAX, false }, }, { { EOR, true }, { TAX, false }, } },
+    { { { TAX, false }, { EOR, true }, { LDX, true }, }, { { EOR, true }, { LDX, true }, } },
+    { { { TAX, false }, { CMP, true }, { TAX, false }, }, { { CMP, true }, { TAX, false }, } },
+    { { { TAX, false }, { CMP, true }, { LDX, true }, }, { { CMP, true }, { LDX, true }, } },
+    { { { TAX, false }, { CMP, true }, { LAX, true }, }, { { CMP, true }, { LAX, true }, } },
+    { { { TAX, false }, { BIT, true }, { TAX, false }, }, { { BIT, true }, { TAX, false }, } },
+    { { { TAX, false }, { BIT, true }, { LDX, true }, }, { { BIT, true }, { LDX, true }, } },
+    { { { TAX, false }, { BIT, true }, { LAX, true }, }, { { LAX, true }, { BIT, true }, } },
+    { { { TAX, false }, { DCP, true }, { TAX, false }, }, { { DCP, true }, { TAX, false }, } },
+    { { { TAX, false }, { DCP, true }, { LDX, true }, }, { { DCP, true }, { LDX, true }, } },
+    { { { TAX, false }, { DCP, true }, { LAX, true }, }, { { DCP, true }, { LAX, true }, } },
+    { { { TAX, false }, { ISC, true }, { TAX, false }, }, { { ISC, true }, { TAX, false }, } },
+    { { { TAX, false }, { ISC, true }, { LDX, true }, }, { { ISC, true }, { LDX, true }, } },
+    { { { TAX, false }, { ISC, true }, { LAX, true }, }, { { ISC, true }, { LAX, true }, } },
+    { { { TAX, false }, { SLO, true }, { TAX, false }, }, { { SLO, true }, { TAX, false }, } },
+    { { { TAX, false }, { SLO, true }, { LDX, true }, }, { { SLO, true }, { LDX, true }, } },
+    { { { TAX, false }, { SLO, true }, { LAX, true }, }, { { ASL, true }, { LAX, true }, } },
+    { { { TAX, false }, { RLA, true }, { TAX, false }, }, { { RLA, true }, { TAX, false }, } },
+    { { { TAX, false }, { RLA, true }, { LDX, true }, }, { { RLA, true }, { LDX, true }, } },
+    { { { TAX, false }, { RLA, true }, { LAX, true }, }, { { ROL, true }, { LAX, true }, } },
+    { { { TAX, false }, { SRE, true }, { TAX, false }, }, { { SRE, true }, { TAX, false }, } },
+    { { { TAX, false }, { SRE, true }, { LDX, true }, }, { { SRE, true }, { LDX, true }, } },
+    { { { TAX, false }, { SRE, true }, { LAX, true }, }, { { LSR, true }, { LAX, true }, } },
+    { { { TAX, false }, { SRE, true }, { EOR, true }, }, { { LSR, true }, { TAX, false }, } },
+    { { { TAX, false }, { RRA, true }, { TAX, false }, }, { { RRA, true }, { TAX, false }, } },
+    { { { TAX, false }, { RRA, true }, { LDX, true }, }, { { RRA, true }, { LDX, true }, } },
+    { { { TAX, false }, { RRA, true }, { LAX, true }, }, { { RRA, true }, { LAX, true }, } },
+    { { { TAY, false }, { TAX, false }, { TAY, false }, }, { { TAX, false }, { TAY, false }, } },
+    { { { TAY, false }, { TAX, false }, { TYA, false }, }, { { TAX, false }, { TAY, false }, } },
+    { { { TAY, false }, { TAX, false }, { LDY, true }, }, { { TAX, false }, { LDY, true }, } },
+    { { { TAY, false }, { TAY, false }, {}, }, { { TAY, false }, {}, } },
+    { { { TAY, false }, { TXA, false }, { TAY, false }, }, { { TXA, false }, { TAY, false }, } },
+    { { { TAY, false }, { TYA, false }, {}, }, { { TAY, false }, {}, } },
+    { { { TAY, false }, { INX, false }, { TAY, false }, }, { { INX, false }, { TAY, false }, } },
+    { { { TAY, false }, { INY, false }, { DEY, false }, }, { { TAY, false }, {}, } },
+    { { { TAY, false }, { DEX, false }, { TAY, false }, }, { { DEX, false }, { TAY, false }, } },
+    { { { TAY, false }, { DEY, false }, { INY, false }, }, { { TAY, false }, {}, } },
+    { { { TAY, false }, { CLC, false }, { TAY, false }, }, { { TAY, false }, { CLC, false }, } },
+    { { { TAY, false }, { CLC, false }, { TYA, false }, }, { { TAY, false }, { CLC, false }, } },
+    { { { TAY, false }, { CLC, false }, { LDY, true }, }, { { CLC, false }, { LDY, true }, } },
+    { { { TAY, false }, { SEC, false }, { TAY, false }, }, { { TAY, false }, { SEC, false }, } },
+    { { { TAY, false }, { SEC, false }, { TYA, false }, }, { { TAY, false }, { SEC, false }, } },
+    { { { TAY, false }, { SEC, false }, { LDY, true }, }, { { SEC, false }, { LDY, true }, } },
+    { { { TAY, false }, { CLV, false }, { TAY, false }, }, { { TAY, false }, { CLV, false }, } },
+    { { { TAY, false }, { CLV, false }, { TYA, false }, }, { { TAY, false }, { CLV, false }, } },
+    { { { TAY, false }, { CLV, false }, { LDY, true }, }, { { CLV, false }, { LDY, true }, } },
+    { { { TAY, false }, { ASL, false }, { TAY, false }, }, { { ASL, false }, { TAY, false }, } },
+    { { { TAY, false }, { ASL, false }, { ROR, false }, }, { { TAY, false }, { CLC, false }, } },
+    { { { TAY, false }, { ASL, false }, { LDY, true }, }, { { ASL, false }, { LDY, true }, } },
+    { { { TAY, false }, { LSR, false }, { TAY, false }, }, { { LSR, false }, { TAY, false }, } },
+    { { { TAY, false }, { LSR, false }, { ROL, false }, }, { { TAY, false }, { CLC, false }, } },
+    { { { TAY, false }, { LSR, false }, { LDY, true }, }, { { LSR, false }, { LDY, true }, } },
+    { { { TAY, false }, { ROL, false }, { TAY, false }, }, { { ROL, false }, { TAY, false }, } },
+    { { { TAY, false }, { ROL, false }, { ROR, false }, }, { { TAY, false }, {}, } },
+    { { { TAY, false }, { ROL, false }, { LDY, true }, }, { { ROL, false }, { LDY, true }, } },
+    { { { TAY, false }, { ROR, false }, { TAY, false }, }, { { ROR, false }, { TAY, false }, } },
+    { { { TAY, false }, { ROR, false }, { ROL, false }, }, { { TAY, false }, {}, } },
+    { { { TAY, false }, { ROR, false }, { LDY, true }, }, { { ROR, false }, { LDY, true }, } },
+    { { { TAY, false }, { LDA, true }, { TAY, false }, }, { { LDA, true }, { TAY, false }, } },
+    { { { TAY, false }, { LDX, true }, { TAY, false }, }, { { LDX, true }, { TAY, false }, } },
+    { { { TAY, false }, { LDX, true }, { LDY, true }, }, { { LDX, true }, { LDY, true }, } },
+    { { { TAY, false }, { LDY, true }, {}, }, { { LDY, true }, {}, } },
+    { { { TAY, false }, { LAX, true }, { TAY, false }, }, { { LAX, true }, { TAY, false }, } },
+    { { { TAY, false }, { STA, true }, { TAY, false }, }, { { TAY, false }, { STA, true }, } },
+    { { { TAY, false }, { STA, true }, { TYA, false }, }, { { TAY, false }, { STA, true }, } },
+    { { { TAY, false }, { STA, true }, { LDA, true }, }, { { TAY, false }, { STA, true }, } },
+    { { { TAY, false }, { STA, true }, { AND, true }, }, { { TAY, false }, { STA, true }, } },
+    { { { TAY, false }, { STA, true }, { ORA, true }, }, { { TAY, false }, { STA, true }, } },
+    { { { TAY, false }, { STX, true }, { TAY, false }, }, { { TAY, false }, { STX, true }, } },
+    { { { TAY, false }, { STY, true }, { TAY, false }, }, { { TAY, false }, { STA, true }, } },
+    { { { TAY, false }, { STY, true }, { TYA, false }, }, { { TAY, false }, { STA, true }, } },
+    { { { TAY, false }, { SAX, true }, { TAY, false }, }, { { TAY, false }, { SAX, true }, } },
+    { { { TAY, false }, { INC, true }, { TAY, false }, }, { { INC, true }, { TAY, false }, } },
+    { { { TAY, false }, { INC, true }, { LDY, true }, }, { { INC, true }, { LDY, true }, } },
+    { { { TAY, false }, { DEC, true }, { TAY, false }, }, { { DEC, true }, { TAY, false }, } },
+    { { { TAY, false }, { DEC, true }, { LDY, true }, }, { { DEC, true }, { LDY, true }, } },
+    { { { TAY, false }, { ASL, true }, { TAY, false }, }, { { ASL, true }, { TAY, false }, } },
+    { { { TAY, false }, { ASL, true }, { LDY, true }, }, { { ASL, true }, { LDY, true }, } },
+    { { { TAY, false }, { LSR, true }, { TAY, false }, }, { { LSR, true }, { TAY, false }, } },
+    { { { TAY, false }, { LSR, true }, { LDY, true }, }, { { LSR, true }, { LDY, true }, } },
+    { { { TAY, false }, { ROL, true }, { TAY, false }, }, { { ROL, true }, { TAY, false }, } },
+    { { { TAY, false }, { ROL, true }, { LDY, true }, }, { { ROL, true }, { LDY, true }, } },
+    { { { TAY, false }, { ROR, true }, { TAY, false }, }, { { ROR, true }, { TAY, false }, } },
+    { { { TAY, false }, { ROR, true }, { LDY, true }, }, { { ROR, true }, { LDY, true }, } },
+    { { { TAY, false }, { ADC, true }, { TAY, false }, }, { { ADC, true }, { TAY, false }, } },
+    { { { TAY, false }, { ADC, true }, { LDY, true }, }, { { ADC, true }, { LDY, true }, } },
+    { { { TAY, false }, { SBC, true }, { TAY, false }, }, { { SBC, true }, { TAY, false }, } },
+    { { { TAY, false }, { SBC, true }, { LDY, true }, }, { { SBC, true }, { LDY, true }, } },
+    { { { TAY, false }, { AND, true }, { TAY, false }, }, { { AND, true }, { TAY, false }, } },
+    { { { TAY, false }, { AND, true }, { LDY, true }, }, { { AND, true }, { LDY, true }, } },
+    { { { TAY, false }, { ORA, true }, { TAY, false }, }, { { ORA, true }, { TAY, false }, } },
+    { { { TAY, false }, { ORA, true }, { LDY, true }, }, { { ORA, true }, { LDY, true }, } },
+    { { { TAY, false }, { EOR, true }, { TAY, false }, }, { { EOR, true }, { TAY, false }, } },
+    { { { TAY, false }, { EOR, true }, { LDY, true }, }, { { EOR, true }, { LDY, true }, } },
+    { { { TAY, false }, { CMP, true }, { TAY, false }, }, { { CMP, true }, { TAY, false }, } },
+    { { { TAY, false }, { CMP, true }, { LDY, true }, }, { { CMP, true }, { LDY, true }, } },
+    { { { TAY, false }, { BIT, true }, { TAY, false }, }, { { BIT, true }, { TAY, false }, } },
+    { { { TAY, false }, { BIT, true }, { LDY, true }, }, { { BIT, true }, { LDY, true }, } },
+    { { { TAY, false }, { DCP, true }, { TAY, false }, }, { { DCP, true }, { TAY, false }, } },
+    { { { TAY, false }, { DCP, true }, { LDY, true }, }, { { DCP, true }, { LDY, true }, } },
+    { { { TAY, false }, { ISC, true }, { TAY, false }, }, { { ISC, true }, { TAY, false }, } },
+    { { { TAY, false }, { ISC, true }, { LDY, true }, }, { { ISC, true }, { LDY, true }, } },
+    { { { TAY, false }, { SLO, true }, { TAY, false }, }, { { SLO, true }, { TAY, false }, } },
+    { { { TAY, false }, { SLO, true }, { LDY, true }, }, { { SLO, true }, { LDY, true }, } },
+    { { { TAY, false }, { RLA, true }, { TAY, false }, }, { { RLA, true }, { TAY, false }, } },
+    { { { TAY, false }, { RLA, true }, { LDY, true }, }, { { RLA, true }, { LDY, true }, } },
+    { { { TAY, false }, { SRE, true }, { TAY, false }, }, { { SRE, true }, { TAY, false }, } },
+    { { { TAY, false }, { SRE, true }, { LDY, true }, }, { { SRE, true }, { LDY, true }, } },
+    { { { TAY, false }, { SRE, true }, { EOR, true }, }, { { LSR, true }, { TAY, false }, } },
+    { { { TAY, false }, { RRA, true }, { TAY, false }, }, { { RRA, true }, { TAY, false }, } },
+    { { { TAY, false }, { RRA, true }, { LDY, true }, }, { { RRA, true }, { LDY, true }, } },
+    { { { TXA, false }, { TAX, false }, {}, }, { { TXA, false }, {}, } },
+    { { { TXA, false }, { TAY, false }, { TAX, false }, }, { { TXA, false }, { TAY, false }, } },
+    { { { TXA, false }, { TAY, false }, { TXA, false }, }, { { TXA, false }, { TAY, false }, } },
+    { { { TXA, false }, { TXA, false }, {}, }, { { TXA, false }, {}, } },
+    { { { TXA, false }, { TYA, false }, {}, }, { { TYA, false }, {}, } },
+    { { { TXA, false }, { INX, false }, { TXA, false }, }, { { INX, false }, { TXA, false }, } },
+    { { { TXA, false }, { INX, false }, { TYA, false }, }, { { INX, false }, { TYA, false }, } },
+    { { { TXA, false }, { INX, false }, { DEX, false }, }, { { TXA, false }, {}, } },
+    { { { TXA, false }, { INX, false }, { LDA, true }, }, { { INX, false }, { LDA, true }, } },
+    { { { TXA, false }, { INY, false }, { TXA, false }, }, { { INY, false }, { TXA, false }, } },
+    { { { TXA, false }, { INY, false }, { TYA, false }, }, { { INY, false }, { TYA, false }, } },
+    { { { TXA, false }, { DEX, false }, { TXA, false }, }, { { DEX, false }, { TXA, false }, } },
+    { { { TXA, false }, { DEX, false }, { TYA, false }, }, { { DEX, false }, { TYA, false }, } },
+    { { { TXA, false }, { DEX, false }, { INX, false }, }, { { TXA, false }, {}, } },
+    { { { TXA, false }, { DEX, false }, { LDA, true }, }, { { DEX, false }, { LDA, true }, } },
+    { { { TXA, false }, { DEY, false }, { TXA, false }, }, { { DEY, false }, { TXA, false }, } },
+    { { { TXA, false }, { DEY, false }, { TYA, false }, }, { { DEY, false }, { TYA, false }, } },
+    { { { TXA, false }, { CLC, false }, { TAX, false }, }, { { TXA, false }, { CLC, false }, } },
+    { { { TXA, false }, { CLC, false }, { TXA, false }, }, { { TXA, false }, { CLC, false }, } },
+    { { { TXA, false }, { CLC, false }, { TYA, false }, }, { { TYA, false }, { CLC, false }, } },
+    { { { TXA, false }, { CLC, false }, { LDA, true }, }, { { CLC, false }, { LDA, true }, } },
+    { { { TXA, false }, { CLC, false }, { LAX, true }, }, { { CLC, false }, { LAX, true }, } },
+    { { { TXA, false }, { SEC, false }, { TAX, false }, }, { { TXA, false }, { SEC, false }, } },
+    { { { TXA, false }, { SEC, false }, { TXA, false }, }, { { TXA, false }, { SEC, false }, } },
+    { { { TXA, false }, { SEC, false }, { TYA, false }, }, { { TYA, false }, { SEC, false }, } },
+    { { { TXA, false }, { SEC, false }, { LDA, true }, }, { { SEC, false }, { LDA, true }, } },
+    { { { TXA, false }, { SEC, false }, { LAX, true }, }, { { SEC, false }, { LAX, true }, } },
+    { { { TXA, false }, { CLV, false }, { TAX, false }, }, { { TXA, false }, { CLV, false }, } },
+    { { { TXA, false }, { CLV, false }, { TXA, false }, }, { { TXA, false }, { CLV, false }, } },
+    { { { TXA, false }, { CLV, false }, { TYA, false }, }, { { TYA, false }, { CLV, false }, } },
+    { { { TXA, false }, { CLV, false }, { LDA, true }, }, { { CLV, false }, { LDA, true }, } },
+    { { { TXA, false }, { CLV, false }, { LAX, true }, }, { { CLV, false }, { LAX, true }, } },
+    { { { TXA, false }, { ASL, false }, { ROR, false }, }, { { TXA, false }, { CLC, false }, } },
+    { { { TXA, false }, { LSR, false }, { ROL, false }, }, { { TXA, false }, { CLC, false }, } },
+    { { { TXA, false }, { ROL, false }, { ROR, false }, }, { { TXA, false }, {}, } },
+    { { { TXA, false }, { ROR, false }, { ROL, false }, }, { { TXA, false }, {}, } },
+    { { { TXA, false }, { LDA, true }, {}, }, { { LDA, true }, {}, } },
+    { { { TXA, false }, { LDY, true }, { TXA, false }, }, { { LDY, true }, { TXA, false }, } },
+    { { { TXA, false }, { LAX, true }, {}, }, { { LAX, true }, {}, } },
+    { { { TXA, false }, { STA, true }, { TAX, false }, }, { { TXA, false }, { STA, true }, } },
+    { { { TXA, false }, { STA, true }, { TXA, false }, }, { { TXA, false }, { STA, true }, } },
+    { { { TXA, false }, { STX, true }, { TAX, false }, }, { { TXA, false }, { STA, true }, } },
+    { { { TXA, false }, { STX, true }, { TXA, false }, }, { { TXA, false }, { STA, true }, } },
+    { { { TXA, false }, { STX, true }, { TYA, false }, }, { { TYA, false }, { STX, true }, } },
+    { { { TXA, false }, { STX, true }, { LDX, true }, }, { { TXA, false }, { STX, true }, } },
+    { { { TXA, false }, { STY, true }, { TXA, false }, }, { { TXA, false }, { STY, true }, } },
+    { { { TXA, false }, { STY, true }, { TYA, false }, }, { { TYA, false }, { STY, true }, } },
+    { { { TXA, false }, { SAX, true }, { TAX, false }, }, { { TXA, false }, { STA, true }, } },
+    { { { TXA, false }, { SAX, true }, { TXA, false }, }, { { TXA, false }, { STA, true }, } },
+    { { { TXA, false }, { INC, true }, { TXA, false }, }, { { INC, true }, { TXA, false }, } },
+    { { { TXA, false }, { INC, true }, { LDA, true }, }, { { INC, true }, { LDA, true }, } },
+    { { { TXA, false }, { INC, true }, { LAX, true }, }, { { INC, true }, { LAX, true }, } },
+    { { { TXA, false }, { DEC, true }, { TXA, false }, }, { { DEC, true }, { TXA, false }, } },
+    { { { TXA, false }, { DEC, true }, { LDA, true }, }, { { DEC, true }, { LDA, true }, } },
+    { { { TXA, false }, { DEC, true }, { LAX, true }, }, { { DEC, true }, { LAX, true }, } },
+    { { { TXA, false }, { ASL, true }, { TXA, false }, }, { { ASL, true }, { TXA, false }, } },
+    { { { TXA, false }, { ASL, true }, { LDA, true }, }, { { ASL, true }, { LDA, true }, } },
+    { { { TXA, false }, { ASL, true }, { LAX, true }, }, { { ASL, true }, { LAX, true }, } },
+    { { { TXA, false }, { LSR, true }, { TXA, false }, }, { { LSR, true }, { TXA, false }, } },
+    { { { TXA, false }, { LSR, true }, { LDA, true }, }, { { LSR, true }, { LDA, true }, } },
+    { { { TXA, false }, { LSR, true }, { LAX, true }, }, { { LSR, true }, { LAX, true }, } },
+    { { { TXA, false }, { ROL, true }, { TXA, false }, }, { { ROL, true }, { TXA, false }, } },
+    { { { TXA, false }, { ROL, true }, { LDA, true }, }, { { ROL, true }, { LDA, true }, } },
+    { { { TXA, false }, { ROL, true }, { LAX, true }, }, { { ROL, true }, { LAX, true }, } },
+    { { { TXA, false }, { ROR, true }, { TXA, false }, }, { { ROR, true }, { TXA, false }, } },
+    { { { TXA, false }, { ROR, true }, { LDA, true }, }, { { ROR, true }, { LDA, true }, } },
+    { { { TXA, false }, { ROR, true }, { LAX, true }, }, { { ROR, true }, { LAX, true }, } },
+    { { { TXA, false }, { CPX, true }, { TXA, false }, }, { { CPX, true }, { TXA, false }, } },
+    { { { TXA, false }, { CPX, true }, { LDA, true }, }, { { CPX, true }, { LDA, true }, } },
+    { { { TXA, false }, { CPX, true }, { LAX, true }, }, { { CPX, true }, { LAX, true }, } },
+    { { { TYA, false }, { TAX, false }, { TAY, false }, }, { { TYA, false }, { TAX, false }, } },
+    { { { TYA, false }, { TAX, false }, { TYA, false }, }, { { TYA, false }, { TAX, false }, } },
+    { { { TYA, false }, { TAY, false }, {}, }, { { TYA, false }, {}, } },
+    { { { TYA, false }, { TXA, false }, {}, }, { { TXA, false }, {}, } },
+    { { { TYA, false }, { TYA, false }, {}, }, { { TYA, false }, {}, } },
+    { { { TYA, false }, { INX, false }, { TXA, false }, }, { { INX, false }, { TXA, false }, } },
+    { { { TYA, false }, { INX, false }, { TYA, false }, }, { { INX, false }, { TYA, false }, } },
+    { { { TYA, false }, { INY, false }, { TXA, false }, }, { { INY, false }, { TXA, false }, } },
+    { { { TYA, false }, { INY, false }, { TYA, false }, }, { { INY, false }, { TYA, false }, } },
+    { { { TYA, false }, { INY, false }, { DEY, false }, }, { { TYA, false }, {}, } },
+    { { { TYA, false }, { INY, false }, { LDA, true }, }, { { INY, false }, { LDA, true }, } },
+    { { { TYA, false }, { INY, false }, { LAX, true }, }, { { INY, false }, { LAX, true }, } },
+    { { { TYA, false }, { DEX, false }, { TXA, false }, }, { { DEX, false }, { TXA, false }, } },
+    { { { TYA, false }, { DEX, false }, { TYA, false }, }, { { DEX, false }, { TYA, false }, } },
+    { { { TYA, false }, { DEY, false }, { TXA, false }, }, { { DEY, false }, { TXA, false }, } },
+    { { { TYA, false }, { DEY, false }, { TYA, false }, }, { { DEY, false }, { TYA, false }, } },
+    { { { TYA, false }, { DEY, false }, { INY, false }, }, { { TYA, false }, {}, } },
+    { { { TYA, false }, { DEY, false }, { LDA, true }, }, { { DEY, false }, { LDA, true }, } },
+    { { { TYA, false }, { DEY, false }, { LAX, true }, }, { { DEY, false }, { LAX, true }, } },
+    { { { TYA, false }, { CLC, false }, { TAY, false }, }, { { TYA, false }, { CLC, false }, } },
+    { { { TYA, false }, { CLC, false }, { TXA, false }, }, { { TXA, false }, { CLC, false }, } },
+    { { { TYA, false }, { CLC, false }, { TYA, false }, }, { { TYA, false }, { CLC, false }, } },
+    { { { TYA, false }, { CLC, false }, { LDA, true }, }, { { CLC, false }, { LDA, true }, } },
+    { { { TYA, false }, { CLC, false }, { LAX, true }, }, { { CLC, false }, { LAX, true }, } },
+    { { { TYA, false }, { SEC, false }, { TAY, false }, }, { { TYA, false }, { SEC, false }, } },
+    { { { TYA, false }, { SEC, false }, { TXA, false }, }, { { TXA, false }, { SEC, false }, } },
+    { { { TYA, false }, { SEC, false }, { TYA, false }, }, { { TYA, false }, { SEC, false }, } },
+    { { { TYA, false }, { SEC, false }, { LDA, true }, }, { { SEC, false }, { LDA, true }, } },
+    { { { TYA, false }, { SEC, false }, { LAX, true }, }, { { SEC, false }, { LAX, true }, } },
+    { { { TYA, false }, { CLV, false }, { TAY, false }, }, { { TYA, false }, { CLV, false }, } },
+    { { { TYA, false }, { CLV, false }, { TXA, false }, }, { { TXA, false }, { CLV, false }, } },
+    { { { TYA, false }, { CLV, false }, { TYA, false }, }, { { TYA, false }, { CLV, false }, } },
+    { { { TYA, false }, { CLV, false }, { LDA, true }, }, { { CLV, false }, { LDA, true }, } },
+    { { { TYA, false }, { CLV, false }, { LAX, true }, }, { { CLV, false }, { LAX, true }, } },
+    { { { TYA, false }, { ASL, false }, { ROR, false }, }, { { TYA, false }, { CLC, false }, } },
+    { { { TYA, false }, { LSR, false }, { ROL, false }, }, { { TYA, false }, { CLC, false }, } },
+    { { { TYA, false }, { ROL, false }, { ROR, false }, }, { { TYA, false }, {}, } },
+    { { { TYA, false }, { ROR, false }, { ROL, false }, }, { { TYA, false }, {}, } },
+    { { { TYA, false }, { LDA, true }, {}, }, { { LDA, true }, {}, } },
+    { { { TYA, false }, { LDX, true }, { TYA, false }, }, { { LDX, true }, { TYA, false }, } },
+    { { { TYA, false }, { LDY, true }, { TYA, false }, }, { { LDY, true }, { TYA, false }, } },
+    { { { TYA, false }, { LAX, true }, {}, }, { { LAX, true }, {}, } },
+    { { { TYA, false }, { STA, true }, { TAY, false }, }, { { TYA, false }, { STA, true }, } },
+    { { { TYA, false }, { STA, true }, { TYA, false }, }, { { TYA, false }, { STA, true }, } },
+    { { { TYA, false }, { STX, true }, { TXA, false }, }, { { TXA, false }, { STX, true }, } },
+    { { { TYA, false }, { STX, true }, { TYA, false }, }, { { TYA, false }, { STX, true }, } },
+    { { { TYA, false }, { STY, true }, { TAY, false }, }, { { TYA, false }, { STA, true }, } },
+    { { { TYA, false }, { STY, true }, { TXA, false }, }, { { TXA, false }, { STY, true }, } },
+    { { { TYA, false }, { STY, true }, { TYA, false }, }, { { TYA, false }, { STA, true }, } },
+    { { { TYA, false }, { STY, true }, { LDX, true }, }, { { STY, true }, { LAX, true }, } },
+    { { { TYA, false }, { STY, true }, { LDY, true }, }, { { TYA, false }, { STY, true }, } },
+    { { { TYA, false }, { STY, true }, { LAX, true }, }, { { STY, true }, { LAX, true }, } },
+    { { { TYA, false }, { INC, true }, { TYA, false }, }, { { INC, true }, { TYA, false }, } },
+    { { { TYA, false }, { INC, true }, { LDA, true }, }, { { INC, true }, { LDA, true }, } },
+    { { { TYA, false }, { INC, true }, { LAX, true }, }, { { INC, true }, { LAX, true }, } },
+    { { { TYA, false }, { DEC, true }, { TYA, false }, }, { { DEC, true }, { TYA, false }, } },
+    { { { TYA, false }, { DEC, true }, { LDA, true }, }, { { DEC, true }, { LDA, true }, } },
+    { { { TYA, false }, { DEC, true }, { LAX, true }, }, { { DEC, true }, { LAX, true }, } },
+    { { { TYA, false }, { ASL, true }, { TYA, false }, }, { { ASL, true }, { TYA, false }, } },
+    { { { TYA, false }, { ASL, true }, { LDA, true }, }, { { ASL, true }, { LDA, true }, } },
+    { { { TYA, false }, { ASL, true }, { LAX, true }, }, { { ASL, true }, { LAX, true }, } },
+    { { { TYA, false }, { LSR, true }, { TYA, false }, }, { { LSR, true }, { TYA, false }, } },
+    { { { TYA, false }, { LSR, true }, { LDA, true }, }, { { LSR, true }, { LDA, true }, } },
+    { { { TYA, false }, { LSR, true }, { LAX, true }, }, { { LSR, true }, { LAX, true }, } },
+    { { { TYA, false }, { ROL, true }, { TYA, false }, }, { { ROL, true }, { TYA, false }, } },
+    { { { TYA, false }, { ROL, true }, { LDA, true }, }, { { ROL, true }, { LDA, true }, } },
+    { { { TYA, false }, { ROL, true }, { LAX, true }, }, { { ROL, true }, { LAX, true }, } },
+    { { { TYA, false }, { ROR, true }, { TYA, false }, }, { { ROR, true }, { TYA, false }, } },
+    { { { TYA, false }, { ROR, true }, { LDA, true }, }, { { ROR, true }, { LDA, true }, } },
+    { { { TYA, false }, { ROR, true }, { LAX, true }, }, { { ROR, true }, { LAX, true }, } },
+    { { { TYA, false }, { CPY, true }, { TYA, false }, }, { { CPY, true }, { TYA, false }, } },
+    { { { TYA, false }, { CPY, true }, { LDA, true }, }, { { CPY, true }, { LDA, true }, } },
+    { { { TYA, false }, { CPY, true }, { LAX, true }, }, { { CPY, true }, { LAX, true }, } },
+    { { { INX, false }, { TAX, false }, {}, }, { { TAX, false }, {}, } },
+    { { { INX, false }, { TAY, false }, { TAX, false }, }, { { TAX, false }, { TAY, false }, } },
+    { { { INX, false }, { INX, false }, { DEX, false }, }, { { INX, false }, {}, } },
+    { { { INX, false }, { DEX, false }, { TAY, false }, }, { { TAY, false }, {}, } },
+    { { { INX, false }, { DEX, false }, { TXA, false }, }, { { TXA, false }, {}, } },
+    { { { INX, false }, { DEX, false }, { TYA, false }, }, { { TYA, false }, {}, } },
+    { { { INX, false }, { DEX, false }, { INX, false }, }, { { INX, false }, {}, } },
+    { { { INX, false }, { DEX, false }, { INY, false }, }, { { INY, false }, {}, } },
+    { { { INX, false }, { DEX, false }, { DEX, false }, }, { { DEX, false }, {}, } },
+    { { { INX, false }, { DEX, false }, { DEY, false }, }, { { DEY, false }, {}, } },
+    { { { INX, false }, { DEX, false }, { ASL, false }, }, { { ASL, false }, {}, } },
+    { { { INX, false }, { DEX, false }, { LSR, false }, }, { { LSR, false }, {}, } },
+    { { { INX, false }, { DEX, false }, { ROL, false }, }, { { ROL, false }, {}, } },
+    { { { INX, false }, { DEX, false }, { ROR, false }, }, { { ROR, false }, {}, } },
+    { { { INX, false }, { DEX, false }, { LDA, true }, }, { { LDA, true }, {}, } },
+    { { { INX, false }, { DEX, false }, { LDY, true }, }, { { LDY, true }, {}, } },
+    { { { INX, false }, { DEX, false }, { STX, true }, }, { { STX, true }, { LDX, true }, } },
+    { { { INX, false }, { DEX, false }, { INC, true }, }, { { INC, true }, {}, } },
+    { { { INX, false }, { DEX, false }, { DEC, true }, }, { { DEC, true }, {}, } },
+    { { { INX, false }, { DEX, false }, { ASL, true }, }, { { ASL, true }, {}, } },
+    { { { INX, false }, { DEX, false }, { LSR, true }, }, { { LSR, true }, {}, } },
+    { { { INX, false }, { DEX, false }, { ROL, true }, }, { { ROL, true }, {}, } },
+    { { { INX, false }, { DEX, false }, { ROR, true }, }, { { ROR, true }, {}, } },
+    { { { INX, false }, { DEX, false }, { CPX, true }, }, { { CPX, true }, {}, } },
+    { { { INX, false }, { CLC, false }, { TAX, false }, }, { { TAX, false }, { CLC, false }, } },
+    { { { INX, false }, { CLC, false }, { LDX, true }, }, { { CLC, false }, { LDX, true }, } },
+    { { { INX, false }, { CLC, false }, { LAX, true }, }, { { CLC, false }, { LAX, true }, } },
+    { { { INX, false }, { SEC, false }, { TAX, false }, }, { { TAX, false }, { SEC, false }, } },
+    { { { INX, false }, { SEC, false }, { LDX, true }, }, { { SEC, false }, { LDX, true }, } },
+    { { { INX, false }, { SEC, false }, { LAX, true }, }, { { SEC, false }, { LAX, true }, } },
+    { { { INX, false }, { CLV, false }, { TAX, false }, }, { { TAX, false }, { CLV, false }, } },
+    { { { INX, false }, { CLV, false }, { LDX, true }, }, { { CLV, false }, { LDX, true }, } },
+    { { { INX, false }, { CLV, false }, { LAX, true }, }, { { CLV, false }, { LAX, true }, } },
+    { { { INX, false }, { ASL, false }, { TAX, false }, }, { { ASL, false }, { TAX, false }, } },
+    { { { INX, false }, { LSR, false }, { TAX, false }, }, { { LSR, false }, { TAX, false }, } },
+    { { { INX, false }, { ROL, false }, { TAX, false }, }, { { ROL, false }, { TAX, false }, } },
+    { { { INX, false }, { ROR, false }, { TAX, false }, }, { { ROR, false }, { TAX, false }, } },
+    { { { INX, false }, { LDX, true }, {}, }, { { LDX, true }, {}, } },
+    { { { INX, false }, { LDY, true }, { LDX, true }, }, { { LDX, true }, { LDY, true }, } },
+    { { { INX, false }, { LAX, true }, {}, }, { { LAX, true }, {}, } },
+    { { { INX, false }, { STA, true }, { TAX, false }, }, { { TAX, false }, { STA, true }, } },
+    { { { INX, false }, { STX, true }, { LDX, true }, }, { { INX, false }, { STX, true }, } },
+    { { { INX, false }, { INC, true }, { LDX, true }, }, { { INC, true }, { LDX, true }, } },
+    { { { INX, false }, { INC, true }, { LAX, true }, }, { { INC, true }, { LAX, true }, } },
+    { { { INX, false }, { DEC, true }, { LDX, true }, }, { { DEC, true }, { LDX, true }, } },
+    { { { INX, false }, { DEC, true }, { LAX, true }, }, { { DEC, true }, { LAX, true }, } },
+    { { { INX, false }, { ASL, true }, { LDX, true }, }, { { ASL, true }, { LDX, true }, } },
+    { { { INX, false }, { ASL, true }, { LAX, true }, }, { { ASL, true }, { LAX, true }, } },
+    { { { INX, false }, { LSR, true }, { LDX, true }, }, { { LSR, true }, { LDX, true }, } },
+    { { { INX, false }, { LSR, true }, { LAX, true }, }, { { LSR, true }, { LAX, true }, } },
+    { { { INX, false }, { ROL, true }, { LDX, true }, }, { { ROL, true }, { LDX, true }, } },
+    { { { INX, false }, { ROL, true }, { LAX, true }, }, { { ROL, true }, { LAX, true }, } },
+    { { { INX, false }, { ROR, true }, { LDX, true }, }, { { ROR, true }, { LDX, true }, } },
+    { { { INX, false }, { ROR, true }, { LAX, true }, }, { { ROR, true }, { LAX, true }, } },
+    { { { INY, false }, { TAX, false }, { TAY, false }, }, { { TAX, false }, { TAY, false }, } },
+    { { { INY, false }, { TAY, false }, {}, }, { { TAY, false }, {}, } },
+    { { { INY, false }, { INY, false }, { DEY, false }, }, { { INY, false }, {}, } },
+    { { { INY, false }, { DEY, false }, { TAX, false }, }, { { TAX, false }, {}, } },
+    { { { INY, false }, { DEY, false }, { TXA, false }, }, { { TXA, false }, {}, } },
+    { { { INY, false }, { DEY, false }, { TYA, false }, }, { { TYA, false }, {}, } },
+    { { { INY, false }, { DEY, false }, { INX, false }, }, { { INX, false }, {}, } },
+    { { { INY, false }, { DEY, false }, { INY, false }, }, { { INY, false }, {}, } },
+    { { { INY, false }, { DEY, false }, { DEX, false }, }, { { DEX, false }, {}, } },
+    { { { INY, false }, { DEY, false }, { DEY, false }, }, { { DEY, false }, {}, } },
+    { { { INY, false }, { DEY, false }, { ASL, false }, }, { { ASL, false }, {}, } },
+    { { { INY, false }, { DEY, false }, { LSR, false }, }, { { LSR, false }, {}, } },
+    { { { INY, false }, { DEY, false }, { ROL, false }, }, { { ROL, false }, {}, } },
+    { { { INY, false }, { DEY, false }, { ROR, false }, }, { { ROR, false }, {}, } },
+    { { { INY, false }, { DEY, false }, { LDA, true }, }, { { LDA, true }, {}, } },
+    { { { INY, false }, { DEY, false }, { LDX, true }, }, { { LDX, true }, {}, } },
+    { { { INY, false }, { DEY, false }, { LAX, true }, }, { { LAX, true }, {}, } },
+    { { { INY, false }, { DEY, false }, { STY, true }, }, { { STY, true }, { LDY, true }, } },
+    { { { INY, false }, { DEY, false }, { INC, true }, }, { { INC, true }, {}, } },
+    { { { INY, false }, { DEY, false }, { DEC, true }, }, { { DEC, true }, {}, } },
+    { { { INY, false }, { DEY, false }, { ASL, true }, }, { { ASL, true }, {}, } },
+    { { { INY, false }, { DEY, false }, { LSR, true }, }, { { LSR, true }, {}, } },
+    { { { INY, false }, { DEY, false }, { ROL, true }, }, { { ROL, true }, {}, } },
+    { { { INY, false }, { DEY, false }, { ROR, true }, }, { { ROR, true }, {}, } },
+    { { { INY, false }, { DEY, false }, { CPY, true }, }, { { CPY, true }, {}, } },
+    { { { INY, false }, { CLC, false }, { TAY, false }, }, { { TAY, false }, { CLC, false }, } },
+    { { { INY, false }, { CLC, false }, { LDY, true }, }, { { CLC, false }, { LDY, true }, } },
+    { { { INY, false }, { SEC, false }, { TAY, false }, }, { { TAY, false }, { SEC, false }, } },
+    { { { INY, false }, { SEC, false }, { LDY, true }, }, { { SEC, false }, { LDY, true }, } },
+    { { { INY, false }, { CLV, false }, { TAY, false }, }, { { TAY, false }, { CLV, false }, } },
+    { { { INY, false }, { CLV, false }, { LDY, true }, }, { { CLV, false }, { LDY, true }, } },
+    { { { INY, false }, { ASL, false }, { TAY, false }, }, { { ASL, false }, { TAY, false }, } },
+    { { { INY, false }, { LSR, false }, { TAY, false }, }, { { LSR, false }, { TAY, false }, } },
+    { { { INY, false }, { ROL, false }, { TAY, false }, }, { { ROL, false }, { TAY, false }, } },
+    { { { INY, false }, { ROR, false }, { TAY, false }, }, { { ROR, false }, { TAY, false }, } },
+    { { { INY, false }, { LDX, true }, { LDY, true }, }, { { LDX, true }, { LDY, true }, } },
+    { { { INY, false }, { LDY, true }, {}, }, { { LDY, true }, {}, } },
+    { { { INY, false }, { STA, true }, { TAY, false }, }, { { TAY, false }, { STA, true }, } },
+    { { { INY, false }, { STY, true }, { LDY, true }, }, { { INY, false }, { STY, true }, } },
+    { { { INY, false }, { INC, true }, { LDY, true }, }, { { INC, true }, { LDY, true }, } },
+    { { { INY, false }, { DEC, true }, { LDY, true }, }, { { DEC, true }, { LDY, true }, } },
+    { { { INY, false }, { ASL, true }, { LDY, true }, }, { { ASL, true }, { LDY, true }, } },
+    { { { INY, false }, { LSR, true }, { LDY, true }, }, { { LSR, true }, { LDY, true }, } },
+    { { { INY, false }, { ROL, true }, { LDY, true }, }, { { ROL, true }, { LDY, true }, } },
+    { { { INY, false }, { ROR, true }, { LDY, true }, }, { { ROR, true }, { LDY, true }, } },
+    { { { DEX, false }, { TAX, false }, {}, }, { { TAX, false }, {}, } },
+    { { { DEX, false }, { TAY, false }, { TAX, false }, }, { { TAX, false }, { TAY, false }, } },
+    { { { DEX, false }, { INX, false }, { TAY, false }, }, { { TAY, false }, {}, } },
+    { { { DEX, false }, { INX, false }, { TXA, false }, }, { { TXA, false }, {}, } },
+    { { { DEX, false }, { INX, false }, { TYA, false }, }, { { TYA, false }, {}, } },
+    { { { DEX, false }, { INX, false }, { INX, false }, }, { { INX, false }, {}, } },
+    { { { DEX, false }, { INX, false }, { INY, false }, }, { { INY, false }, {}, } },
+    { { { DEX, false }, { INX, false }, { DEX, false }, }, { { DEX, false }, {}, } },
+    { { { DEX, false }, { INX, false }, { DEY, false }, }, { { DEY, false }, {}, } },
+    { { { DEX, false }, { INX, false }, { ASL, false }, }, { { ASL, false }, {}, } },
+    { { { DEX, false }, { INX, false }, { LSR, false }, }, { { LSR, false }, {}, } },
+    { { { DEX, false }, { INX, false }, { ROL, false }, }, { { ROL, false }, {}, } },
+    { { { DEX, false }, { INX, false }, { ROR, false }, }, { { ROR, false }, {}, } },
+    { { { DEX, false }, { INX, false }, { LDA, true }, }, { { LDA, true }, {}, } },
+    { { { DEX, false }, { INX, false }, { LDY, true }, }, { { LDY, true }, {}, } },
+    { { { DEX, false }, { INX, false }, { STX, true }, }, { { STX, true }, { LDX, true }, } },
+    { { { DEX, false }, { INX, false }, { INC, true }, }, { { INC, true }, {}, } },
+    { { { DEX, false }, { INX, false }, { DEC, true }, }, { { DEC, true }, {}, } },
+    { { { DEX, false }, { INX, false }, { ASL, true }, }, { { ASL, true }, {}, } },
+    { { { DEX, false }, { INX, false }, { LSR, true }, }, { { LSR, true }, {}, } },
+    { { { DEX, false }, { INX, false }, { ROL, true }, }, { { ROL, true }, {}, } },
+    { { { DEX, false }, { INX, false }, { ROR, true }, }, { { ROR, true }, {}, } },
+    { { { DEX, false }, { INX, false }, { CPX, true }, }, { { CPX, true }, {}, } },
+    { { { DEX, false }, { DEX, false }, { INX, false }, }, { { DEX, false }, {}, } },
+    { { { DEX, false }, { CLC, false }, { TAX, false }, }, { { TAX, false }, { CLC, false }, } },
+    { { { DEX, false }, { CLC, false }, { LDX, true }, }, { { CLC, false }, { LDX, true }, } },
+    { { { DEX, false }, { CLC, false }, { LAX, true }, }, { { CLC, false }, { LAX, true }, } },
+    { { { DEX, false }, { SEC, false }, { TAX, false }, }, { { TAX, false }, { SEC, false }, } },
+    { { { DEX, false }, { SEC, false }, { LDX, true }, }, { { SEC, false }, { LDX, true }, } },
+    { { { DEX, false }, { SEC, false }, { LAX, true }, }, { { SEC, false }, { LAX, true }, } },
+    { { { DEX, false }, { CLV, false }, { TAX, false }, }, { { TAX, false }, { CLV, false }, } },
+    { { { DEX, false }, { CLV, false }, { LDX, true }, }, { { CLV, false }, { LDX, true }, } },
+    { { { DEX, false }, { CLV, false }, { LAX, true }, }, { { CLV, false }, { LAX, true }, } },
+    { { { DEX, false }, { ASL, false }, { TAX, false }, }, { { ASL, false }, { TAX, false }, } },
+    { { { DEX, false }, { LSR, false }, { TAX, false }, }, { { LSR, false }, { TAX, false }, } },
+    { { { DEX, false }, { ROL, false }, { TAX, false }, }, { { ROL, false }, { TAX, false }, } },
+    { { { DEX, false }, { ROR, false }, { TAX, false }, }, { { ROR, false }, { TAX, false }, } },
+    { { { DEX, false }, { LDX, true }, {}, }, { { LDX, true }, {}, } },
+    { { { DEX, false }, { LDY, true }, { LDX, true }, }, { { LDX, true }, { LDY, true }, } },
+    { { { DEX, false }, { LAX, true }, {}, }, { { LAX, true }, {}, } },
+    { { { DEX, false }, { STA, true }, { TAX, false }, }, { { TAX, false }, { STA, true }, } },
+    { { { DEX, false }, { STX, true }, { LDX, true }, }, { { DEX, false }, { STX, true }, } },
+    { { { DEX, false }, { INC, true }, { LDX, true }, }, { { INC, true }, { LDX, true }, } },
+    { { { DEX, false }, { INC, true }, { LAX, true }, }, { { INC, true }, { LAX, true }, } },
+    { { { DEX, false }, { DEC, true }, { LDX, true }, }, { { DEC, true }, { LDX, true }, } },
+    { { { DEX, false }, { DEC, true }, { LAX, true }, }, { { DEC, true }, { LAX, true }, } },
+    { { { DEX, false }, { ASL, true }, { LDX, true }, }, { { ASL, true }, { LDX, true }, } },
+    { { { DEX, false }, { ASL, true }, { LAX, true }, }, { { ASL, true }, { LAX, true }, } },
+    { { { DEX, false }, { LSR, true }, { LDX, true }, }, { { LSR, true }, { LDX, true }, } },
+    { { { DEX, false }, { LSR, true }, { LAX, true }, }, { { LSR, true }, { LAX, true }, } },
+    { { { DEX, false }, { ROL, true }, { LDX, true }, }, { { ROL, true }, { LDX, true }, } },
+    { { { DEX, false }, { ROL, true }, { LAX, true }, }, { { ROL, true }, { LAX, true }, } },
+    { { { DEX, false }, { ROR, true }, { LDX, true }, }, { { ROR, true }, { LDX, true }, } },
+    { { { DEX, false }, { ROR, true }, { LAX, true }, }, { { ROR, true }, { LAX, true }, } },
+    { { { DEY, false }, { TAX, false }, { TAY, false }, }, { { TAX, false }, { TAY, false }, } },
+    { { { DEY, false }, { TAY, false }, {}, }, { { TAY, false }, {}, } },
+    { { { DEY, false }, { INY, false }, { TAX, false }, }, { { TAX, false }, {}, } },
+    { { { DEY, false }, { INY, false }, { TXA, false }, }, { { TXA, false }, {}, } },
+    { { { DEY, false }, { INY, false }, { TYA, false }, }, { { TYA, false }, {}, } },
+    { { { DEY, false }, { INY, false }, { INX, false }, }, { { INX, false }, {}, } },
+    { { { DEY, false }, { INY, false }, { INY, false }, }, { { INY, false }, {}, } },
+    { { { DEY, false }, { INY, false }, { DEX, false }, }, { { DEX, false }, {}, } },
+    { { { DEY, false }, { INY, false }, { DEY, false }, }, { { DEY, false }, {}, } },
+    { { { DEY, false }, { INY, false }, { ASL, false }, }, { { ASL, false }, {}, } },
+    { { { DEY, false }, { INY, false }, { LSR, false }, }, { { LSR, false }, {}, } },
+    { { { DEY, false }, { INY, false }, { ROL, false }, }, { { ROL, false }, {}, } },
+    { { { DEY, false }, { INY, false }, { ROR, false }, }, { { ROR, false }, {}, } },
+    { { { DEY, false }, { INY, false }, { LDA, true }, }, { { LDA, true }, {}, } },
+    { { { DEY, false }, { INY, false }, { LDX, true }, }, { { LDX, true }, {}, } },
+    { { { DEY, false }, { INY, false }, { LAX, true }, }, { { LAX, true }, {}, } },
+    { { { DEY, false }, { INY, false }, { STY, true }, }, { { STY, true }, { LDY, true }, } },
+    { { { DEY, false }, { INY, false }, { INC, true }, }, { { INC, true }, {}, } },
+    { { { DEY, false }, { INY, false }, { DEC, true }, }, { { DEC, true }, {}, } },
+    { { { DEY, false }, { INY, false }, { ASL, true }, }, { { ASL, true }, {}, } },
+    { { { DEY, false }, { INY, false }, { LSR, true }, }, { { LSR, true }, {}, } },
+    { { { DEY, false }, { INY, false }, { ROL, true }, }, { { ROL, true }, {}, } },
+    { { { DEY, false }, { INY, false }, { ROR, true }, }, { { ROR, true }, {}, } },
+    { { { DEY, false }, { INY, false }, { CPY, true }, }, { { CPY, true }, {}, } },
+    { { { DEY, false }, { DEY, false }, { INY, false }, }, { { DEY, false }, {}, } },
+    { { { DEY, false }, { CLC, false }, { TAY, false }, }, { { TAY, false }, { CLC, false }, } },
+    { { { DEY, false }, { CLC, false }, { LDY, true }, }, { { CLC, false }, { LDY, true }, } },
+    { { { DEY, false }, { SEC, false }, { TAY, false }, }, { { TAY, false }, { SEC, false }, } },
+    { { { DEY, false }, { SEC, false }, { LDY, true }, }, { { SEC, false }, { LDY, true }, } },
+    { { { DEY, false }, { CLV, false }, { TAY, false }, }, { { TAY, false }, { CLV, false }, } },
+    { { { DEY, false }, { CLV, false }, { LDY, true }, }, { { CLV, false }, { LDY, true }, } },
+    { { { DEY, false }, { ASL, false }, { TAY, false }, }, { { ASL, false }, { TAY, false }, } },
+    { { { DEY, false }, { LSR, false }, { TAY, false }, }, { { LSR, false }, { TAY, false }, } },
+    { { { DEY, false }, { ROL, false }, { TAY, false }, }, { { ROL, false }, { TAY, false }, } },
+    { { { DEY, false }, { ROR, false }, { TAY, false }, }, { { ROR, false }, { TAY, false }, } },
+    { { { DEY, false }, { LDX, true }, { LDY, true }, }, { { LDX, true }, { LDY, true }, } },
+    { { { DEY, false }, { LDY, true }, {}, }, { { LDY, true }, {}, } },
+    { { { DEY, false }, { STA, true }, { TAY, false }, }, { { TAY, false }, { STA, true }, } },
+    { { { DEY, false }, { STY, true }, { LDY, true }, }, { { DEY, false }, { STY, true }, } },
+    { { { DEY, false }, { INC, true }, { LDY, true }, }, { { INC, true }, { LDY, true }, } },
+    { { { DEY, false }, { DEC, true }, { LDY, true }, }, { { DEC, true }, { LDY, true }, } },
+    { { { DEY, false }, { ASL, true }, { LDY, true }, }, { { ASL, true }, { LDY, true }, } },
+    { { { DEY, false }, { LSR, true }, { LDY, true }, }, { { LSR, true }, { LDY, true }, } },
+    { { { DEY, false }, { ROL, true }, { LDY, true }, }, { { ROL, true }, { LDY, true }, } },
+    { { { DEY, false }, { ROR, true }, { LDY, true }, }, { { ROR, true }, { LDY, true }, } },
+    { { { CLC, false }, { TAX, false }, { CLC, false }, }, { { TAX, false }, { CLC, false }, } },
+    { { { CLC, false }, { TAX, false }, { SEC, false }, }, { { TAX, false }, { SEC, false }, } },
+    { { { CLC, false }, { TAX, false }, { ASL, false }, }, { { TAX, false }, { ASL, false }, } },
+    { { { CLC, false }, { TAX, false }, { LSR, false }, }, { { TAX, false }, { LSR, false }, } },
+    { { { CLC, false }, { TAX, false }, { ROL, false }, }, { { TAX, false }, { ASL, false }, } },
+    { { { CLC, false }, { TAX, false }, { ROR, false }, }, { { TAX, false }, { LSR, false }, } },
+    { { { CLC, false }, { TAX, false }, { ASL, true }, }, { { TAX, false }, { ASL, true }, } },
+    { { { CLC, false }, { TAX, false }, { LSR, true }, }, { { TAX, false }, { LSR, true }, } },
+    { { { CLC, false }, { TAX, false }, { ROL, true }, }, { { TAX, false }, { ASL, true }, } },
+    { { { CLC, false }, { TAX, false }, { ROR, true }, }, { { TAX, false }, { LSR, true }, } },
+    { { { CLC, false }, { TAX, false }, { CMP, true }, }, { { TAX, false }, { CMP, true }, } },
+    { { { CLC, false }, { TAX, false }, { DCP, true }, }, { { TAX, false }, { DCP, true }, } },
+    { { { CLC, false }, { TAX, false }, { SLO, true }, }, { { TAX, false }, { SLO, true }, } },
+    { { { CLC, false }, { TAX, false }, { SRE, true }, }, { { TAX, false }, { SRE, true }, } },
+    { { { CLC, false }, { TAY, false }, { CLC, false }, }, { { TAY, false }, { CLC, false }, } },
+    { { { CLC, false }, { TAY, false }, { SEC, false }, }, { { TAY, false }, { SEC, false }, } },
+    { { { CLC, false }, { TAY, false }, { ASL, false }, }, { { TAY, false }, { ASL, false }, } },
+    { { { CLC, false }, { TAY, false }, { LSR, false }, }, { { TAY, false }, { LSR, false }, } },
+    { { { CLC, false }, { TAY, false }, { ROL, false }, }, { { TAY, false }, { ASL, false }, } },
+    { { { CLC, false }, { TAY, false }, { ROR, false }, }, { { TAY, false }, { LSR, false }, } },
+    { { { CLC, false }, { TAY, false }, { ASL, true }, }, { { TAY, false }, { ASL, true }, } },
+    { { { CLC, false }, { TAY, false }, { LSR, true }, }, { { TAY, false }, { LSR, true }, } },
+    { { { CLC, false }, { TAY, false }, { ROL, true }, }, { { TAY, false }, { ASL, true }, } },
+    { { { CLC, false }, { TAY, false }, { ROR, true }, }, { { TAY, false }, { LSR, true }, } },
+    { { { CLC, false }, { TAY, false }, { CMP, true }, }, { { TAY, false }, { CMP, true }, } },
+    { { { CLC, false }, { TAY, false }, { DCP, true }, }, { { TAY, false }, { DCP, true }, } },
+    { { { CLC, false }, { TAY, false }, { SLO, true }, }, { { TAY, false }, { SLO, true }, } },
+    { { { CLC, false }, { TAY, false }, { SRE, true }, }, { { TAY, false }, { SRE, true }, } },
+    { { { CLC, false }, { TXA, false }, { CLC, false }, }, { { TXA, false }, { CLC, false }, } },
+    { { { CLC, false }, { TXA, false }, { SEC, false }, }, { { TXA, false }, { SEC, false }, } },
+    { { { CLC, false }, { TXA, false }, { ASL, false }, }, { { TXA, false }, { ASL, false }, } },
+    { { { CLC, false }, { TXA, false }, { LSR, false }, }, { { TXA, false }, { LSR, false }, } },
+    { { { CLC, false }, { TXA, false }, { ROL, false }, }, { { TXA, false }, { ASL, false }, } },
+    { { { CLC, false }, { TXA, false }, { ROR, false }, }, { { TXA, false }, { LSR, false }, } },
+    { { { CLC, false }, { TXA, false }, { ASL, true }, }, { { TXA, false }, { ASL, true }, } },
+    { { { CLC, false }, { TXA, false }, { LSR, true }, }, { { TXA, false }, { LSR, true }, } },
+    { { { CLC, false }, { TXA, false }, { ROL, true }, }, { { TXA, false }, { ASL, true }, } },
+    { { { CLC, false }, { TXA, false }, { ROR, true }, }, { { TXA, false }, { LSR, true }, } },
+    { { { CLC, false }, { TXA, false }, { CPX, true }, }, { { TXA, false }, { CPX, true }, } },
+    { { { CLC, false }, { TYA, false }, { CLC, false }, }, { { TYA, false }, { CLC, false }, } },
+    { { { CLC, false }, { TYA, false }, { SEC, false }, }, { { TYA, false }, { SEC, false }, } },
+    { { { CLC, false }, { TYA, false }, { ASL, false }, }, { { TYA, false }, { ASL, false }, } },
+    { { { CLC, false }, { TYA, false }, { LSR, false }, }, { { TYA, false }, { LSR, false }, } },
+    { { { CLC, false }, { TYA, false }, { ROL, false }, }, { { TYA, false }, { ASL, false }, } },
+    { { { CLC, false }, { TYA, false }, { ROR, false }, }, { { TYA, false }, { LSR, false }, } },
+    { { { CLC, false }, { TYA, false }, { ASL, true }, }, { { TYA, false }, { ASL, true }, } },
+    { { { CLC, false }, { TYA, false }, { LSR, true }, }, { { TYA, false }, { LSR, true }, } },
+    { { { CLC, false }, { TYA, false }, { ROL, true }, }, { { TYA, false }, { ASL, true }, } },
+    { { { CLC, false }, { TYA, false }, { ROR, true }, }, { { TYA, false }, { LSR, true }, } },
+    { { { CLC, false }, { TYA, false }, { CPY, true }, }, { { TYA, false }, { CPY, true }, } },
+    { { { CLC, false }, { INX, false }, { CLC, false }, }, { { INX, false }, { CLC, false }, } },
+    { { { CLC, false }, { INX, false }, { SEC, false }, }, { { INX, false }, { SEC, false }, } },
+    { { { CLC, false }, { INX, false }, { ASL, false }, }, { { INX, false }, { ASL, false }, } },
+    { { { CLC, false }, { INX, false }, { LSR, false }, }, { { INX, false }, { LSR, false }, } },
+    { { { CLC, false }, { INX, false }, { ROL, false }, }, { { INX, false }, { ASL, false }, } },
+    { { { CLC, false }, { INX, false }, { ROR, false }, }, { { INX, false }, { LSR, false }, } },
+    { { { CLC, false }, { INX, false }, { ASL, true }, }, { { INX, false }, { ASL, true }, } },
+    { { { CLC, false }, { INX, false }, { LSR, true }, }, { { INX, false }, { LSR, true }, } },
+    { { { CLC, false }, { INX, false }, { ROL, true }, }, { { INX, false }, { ASL, true }, } },
+    { { { CLC, false }, { INX, false }, { ROR, true }, }, { { INX, false }, { LSR, true }, } },
+    { { { CLC, false }, { INX, false }, { CPX, true }, }, { { INX, false }, { CPX, true }, } },
+    { { { CLC, false }, { INY, false }, { CLC, false }, }, { { INY, false }, { CLC, false }, } },
+    { { { CLC, false }, { INY, false }, { SEC, false }, }, { { INY, false }, { SEC, false }, } },
+    { { { CLC, false }, { INY, false }, { ASL, false }, }, { { INY, false }, { ASL, false }, } },
+    { { { CLC, false }, { INY, false }, { LSR, false }, }, { { INY, false }, { LSR, false }, } },
+    { { { CLC, false }, { INY, false }, { ROL, false }, }, { { INY, false }, { ASL, false }, } },
+    { { { CLC, false }, { INY, false }, { ROR, false }, }, { { INY, false }, { LSR, false }, } },
+    { { { CLC, false }, { INY, false }, { ASL, true }, }, { { INY, false }, { ASL, true }, } },
+    { { { CLC, false }, { INY, false }, { LSR, true }, }, { { INY, false }, { LSR, true }, } },
+    { { { CLC, false }, { INY, false }, { ROL, true }, }, { { INY, false }, { ASL, true }, } },
+    { { { CLC, false }, { INY, false }, { ROR, true }, }, { { INY, false }, { LSR, true }, } },
+    { { { CLC, false }, { INY, false }, { CPY, true }, }, { { INY, false }, { CPY, true }, } },
+    { { { CLC, false }, { DEX, false }, { CLC, false }, }, { { DEX, false }, { CLC, false }, } },
+    { { { CLC, false }, { DEX, false }, { SEC, false }, }, { { DEX, false }, { SEC, false }, } },
+    { { { CLC, false }, { DEX, false }, { ASL, false }, }, { { DEX, false }, { ASL, false }, } },
+    { { { CLC, false }, { DEX, false }, { LSR, false }, }, { { DEX, false }, { LSR, false }, } },
+    { { { CLC, false }, { DEX, false }, { ROL, false }, }, { { DEX, false }, { ASL, false }, } },
+    { { { CLC, false }, { DEX, false }, { ROR, false }, }, { { DEX, false }, { LSR, false }, } },
+    { { { CLC, false }, { DEX, false }, { ASL, true }, }, { { DEX, false }, { ASL, true }, } },
+    { { { CLC, false }, { DEX, false }, { LSR, true }, }, { { DEX, false }, { LSR, true }, } },
+    { { { CLC, false }, { DEX, false }, { ROL, true }, }, { { DEX, false }, { ASL, true }, } },
+    { { { CLC, false }, { DEX, false }, { ROR, true }, }, { { DEX, false }, { LSR, true }, } },
+    { { { CLC, false }, { DEX, false }, { CPX, true }, }, { { DEX, false }, { CPX, true }, } },
+    { { { CLC, false }, { DEY, false }, { CLC, false }, }, { { DEY, false }, { CLC, false }, } },
+    { { { CLC, false }, { DEY, false }, { SEC, false }, }, { { DEY, false }, { SEC, false }, } },
+    { { { CLC, false }, { DEY, false }, { ASL, false }, }, { { DEY, false }, { ASL, false }, } },
+    { { { CLC, false }, { DEY, false }, { LSR, false }, }, { { DEY, false }, { LSR, false }, } },
+    { { { CLC, false }, { DEY, false }, { ROL, false }, }, { { DEY, false }, { ASL, false }, } },
+    { { { CLC, false }, { DEY, false }, { ROR, false }, }, { { DEY, false }, { LSR, false }, } },
+    { { { CLC, false }, { DEY, false }, { ASL, true }, }, { { DEY, false }, { ASL, true }, } },
+    { { { CLC, false }, { DEY, false }, { LSR, true }, }, { { DEY, false }, { LSR, true }, } },
+    { { { CLC, false }, { DEY, false }, { ROL, true }, }, { { DEY, false }, { ASL, true }, } },
+    { { { CLC, false }, { DEY, false }, { ROR, true }, }, { { DEY, false }, { LSR, true }, } },
+    { { { CLC, false }, { DEY, false }, { CPY, true }, }, { { DEY, false }, { CPY, true }, } },
+    { { { CLC, false }, { CLC, false }, {}, }, { { CLC, false }, {}, } },
+    { { { CLC, false }, { SEC, false }, {}, }, { { SEC, false }, {}, } },
+    { { { CLC, false }, { CLV, false }, { CLC, false }, }, { { CLC, false }, { CLV, false }, } },
+    { { { CLC, false }, { CLV, false }, { SEC, false }, }, { { SEC, false }, { CLV, false }, } },
+    { { { CLC, false }, { CLV, false }, { ASL, false }, }, { { CLV, false }, { ASL, false }, } },
+    { { { CLC, false }, { CLV, false }, { LSR, false }, }, { { CLV, false }, { LSR, false }, } },
+    { { { CLC, false }, { CLV, false }, { ROL, false }, }, { { CLV, false }, { ASL, false }, } },
+    { { { CLC, false }, { CLV, false }, { ROR, false }, }, { { CLV, false }, { LSR, false }, } },
+    { { { CLC, false }, { CLV, false }, { ASL, true }, }, { { CLV, false }, { ASL, true }, } },
+    { { { CLC, false }, { CLV, false }, { LSR, true }, }, { { CLV, false }, { LSR, true }, } },
+    { { { CLC, false }, { CLV, false }, { ROL, true }, }, { { CLV, false }, { ASL, true }, } },
+    { { { CLC, false }, { CLV, false }, { ROR, true }, }, { { CLV, false }, { LSR, true }, } },
+    { { { CLC, false }, { CLV, false }, { CMP, true }, }, { { CLV, false }, { CMP, true }, } },
+    { { { CLC, false }, { CLV, false }, { CPX, true }, }, { { CLV, false }, { CPX, true }, } },
+    { { { CLC, false }, { CLV, false }, { CPY, true }, }, { { CLV, false }, { CPY, true }, } },
+    { { { CLC, false }, { CLV, false }, { DCP, true }, }, { { CLV, false }, { DCP, true }, } },
+    { { { CLC, false }, { CLV, false }, { SLO, true }, }, { { CLV, false }, { SLO, true }, } },
+    { { { CLC, false }, { CLV, false }, { SRE, true }, }, { { CLV, false }, { SRE, true }, } },
+    { { { CLC, false }, { ASL, false }, {}, }, { { ASL, false }, {}, } },
+    { { { CLC, false }, { LSR, false }, {}, }, { { LSR, false }, {}, } },
+    { { { CLC, false }, { ROL, false }, {}, }, { { ASL, false }, {}, } },
+    { { { CLC, false }, { ROR, false }, {}, }, { { LSR, false }, {}, } },
+    { { { CLC, false }, { LDA, true }, { CLC, false }, }, { { CLC, false }, { LDA, true }, } },
+    { { { CLC, false }, { LDA, true }, { SEC, false }, }, { { SEC, false }, { LDA, true }, } },
+    { { { CLC, false }, { LDA, true }, { ASL, false }, }, { { LDA, true }, { ASL, false }, } },
+    { { { CLC, false }, { LDA, true }, { LSR, false }, }, { { LDA, true }, { LSR, false }, } },
+    { { { CLC, false }, { LDA, true }, { ROL, false }, }, { { LDA, true }, { ASL, false }, } },
+    { { { CLC, false }, { LDA, true }, { ROR, false }, }, { { LDA, true }, { LSR, false }, } },
+    { { { CLC, false }, { LDA, true }, { ASL, true }, }, { { LDA, true }, { ASL, true }, } },
+    { { { CLC, false }, { LDA, true }, { LSR, true }, }, { { LDA, true }, { LSR, true }, } },
+    { { { CLC, false }, { LDA, true }, { ROL, true }, }, { { LDA, true }, { ASL, true }, } },
+    { { { CLC, false }, { LDA, true }, { ROR, true }, }, { { LDA, true }, { LSR, true }, } },
+    { { { CLC, false }, { LDA, true }, { CMP, true }, }, { { LDA, true }, { CMP, true }, } },
+    { { { CLC, false }, { LDA, true }, { CPX, true }, }, { { LDA, true }, { CPX, true }, } },
+    { { { CLC, false }, { LDA, true }, { CPY, true }, }, { { LDA, true }, { CPY, true }, } },
+    { { { CLC, false }, { LDA, true }, { DCP, true }, }, { { LDA, true }, { DCP, true }, } },
+    { { { CLC, false }, { LDA, true }, { SLO, true }, }, { { LDA, true }, { SLO, true }, } },
+    { { { CLC, false }, { LDA, true }, { SRE, true }, }, { { LDA, true }, { SRE, true }, } },
+    { { { CLC, false }, { LDX, true }, { CLC, false }, }, { { CLC, false }, { LDX, true }, } },
+    { { { CLC, false }, { LDX, true }, { SEC, false }, }, { { SEC, false }, { LDX, true }, } },
+    { { { CLC, false }, { LDX, true }, { ASL, false }, }, { { LDX, true }, { ASL, false }, } },
+    { { { CLC, false }, { LDX, true }, { LSR, false }, }, { { LDX, true }, { LSR, false }, } },
+    { { { CLC, false }, { LDX, true }, { ROL, false }, }, { { LDX, true }, { ASL, false }, } },
+    { { { CLC, false }, { LDX, true }, { ROR, false }, }, { { LDX, true }, { LSR, false }, } },
+    { { { CLC, false }, { LDX, true }, { ASL, true }, }, { { LDX, true }, { ASL, true }, } },
+    { { { CLC, false }, { LDX, true }, { LSR, true }, }, { { LDX, true }, { LSR, true }, } },
+    { { { CLC, false }, { LDX, true }, { ROL, true }, }, { { LDX, true }, { ASL, true }, } },
+    { { { CLC, false }, { LDX, true }, { ROR, true }, }, { { LDX, true }, { LSR, true }, } },
+    { { { CLC, false }, { LDX, true }, { CMP, true }, }, { { LDX, true }, { CMP, true }, } },
+    { { { CLC, false }, { LDX, true }, { CPX, true }, }, { { LDX, true }, { CPX, true }, } },
+    { { { CLC, false }, { LDX, true }, { CPY, true }, }, { { LDX, true }, { CPY, true }, } },
+    { { { CLC, false }, { LDX, true }, { DCP, true }, }, { { LDX, true }, { DCP, true }, } },
+    { { { CLC, false }, { LDX, true }, { SLO, true }, }, { { LDX, true }, { SLO, true }, } },
+    { { { CLC, false }, { LDX, true }, { SRE, true }, }, { { LDX, true }, { SRE, true }, } },
+    { { { CLC, false }, { LDY, true }, { CLC, false }, }, { { CLC, false }, { LDY, true }, } },
+    { { { CLC, false }, { LDY, true }, { SEC, false }, }, { { SEC, false }, { LDY, true }, } },
+    { { { CLC, false }, { LDY, true }, { ASL, false }, }, { { LDY, true }, { ASL, false }, } },
+    { { { CLC, false }, { LDY, true }, { LSR, false }, }, { { LDY, true }, { LSR, false }, } },
+    { { { CLC, false }, { LDY, true }, { ROL, false }, }, { { LDY, true }, { ASL, false }, } },
+    { { { CLC, false }, { LDY, true }, { ROR, false }, }, { { LDY, true }, { LSR, false }, } },
+    { { { CLC, false }, { LDY, true }, { ASL, true }, }, { { LDY, true }, { ASL, true }, } },
+    { { { CLC, false }, { LDY, true }, { LSR, true }, }, { { LDY, true }, { LSR, true }, } },
+    { { { CLC, false }, { LDY, true }, { ROL, true }, }, { { LDY, true }, { ASL, true }, } },
+    { { { CLC, false }, { LDY, true }, { ROR, true }, }, { { LDY, true }, { LSR, true }, } },
+    { { { CLC, false }, { LDY, true }, { CMP, true }, }, { { LDY, true }, { CMP, true }, } },
+    { { { CLC, false }, { LDY, true }, { CPX, true }, }, { { LDY, true }, { CPX, true }, } },
+    { { { CLC, false }, { LDY, true }, { CPY, true }, }, { { LDY, true }, { CPY, true }, } },
+    { { { CLC, false }, { LDY, true }, { DCP, true }, }, { { LDY, true }, { DCP, true }, } },
+    { { { CLC, false }, { LDY, true }, { SLO, true }, }, { { LDY, true }, { SLO, true }, } },
+    { { { CLC, false }, { LDY, true }, { SRE, true }, }, { { LDY, true }, { SRE, true }, } },
+    { { { CLC, false }, { LAX, true }, { CLC, false }, }, { { CLC, false }, { LAX, true }, } },
+    { { { CLC, false }, { LAX, true }, { SEC, false }, }, { { SEC, false }, { LAX, true }, } },
+    { { { CLC, false }, { LAX, true }, { ASL, false }, }, { { LAX, true }, { ASL, false }, } },
+    { { { CLC, false }, { LAX, true }, { LSR, false }, }, { { LAX, true }, { LSR, false }, } },
+    { { { CLC, false }, { LAX, true }, { ROL, false }, }, { { LAX, true }, { ASL, false }, } },
+    { { { CLC, false }, { LAX, true }, { ROR, false }, }, { { LAX, true }, { LSR, false }, } },
+    { { { CLC, false }, { LAX, true }, { ASL, true }, }, { { LAX, true }, { ASL, true }, } },
+    { { { CLC, false }, { LAX, true }, { LSR, true }, }, { { LAX, true }, { LSR, true }, } },
+    { { { CLC, false }, { LAX, true }, { ROL, true }, }, { { LAX, true }, { ASL, true }, } },
+    { { { CLC, false }, { LAX, true }, { ROR, true }, }, { { LAX, true }, { LSR, true }, } },
+    { { { CLC, false }, { LAX, true }, { CMP, true }, }, { { LAX, true }, { CMP, true }, } },
+    { { { CLC, false }, { LAX, true }, { CPX, true }, }, { { LAX, true }, { CPX, true }, } },
+    { { { CLC, false }, { LAX, true }, { CPY, true }, }, { { LAX, true }, { CPY, true }, } },
+    { { { CLC, false }, { LAX, true }, { DCP, true }, }, { { LAX, true }, { DCP, true }, } },
+    { { { CLC, false }, { LAX, true }, { SLO, true }, }, { { LAX, true }, { SLO, true }, } },
+    { { { CLC, false }, { LAX, true }, { SRE, true }, }, { { LAX, true }, { SRE, true }, } },
+    { { { CLC, false }, { STA, true }, { CLC, false }, }, { { CLC, false }, { STA, true }, } },
+    { { { CLC, false }, { STA, true }, { SEC, false }, }, { { SEC, false }, { STA, true }, } },
+    { { { CLC, false }, { STA, true }, { ASL, false }, }, { { STA, true }, { ASL, false }, } },
+    { { { CLC, false }, { STA, true }, { LSR, false }, }, { { STA, true }, { LSR, false }, } },
+    { { { CLC, false }, { STA, true }, { ROL, false }, }, { { STA, true }, { ASL, false }, } },
+    { { { CLC, false }, { STA, true }, { ROR, false }, }, { { STA, true }, { LSR, false }, } },
+    { { { CLC, false }, { STA, true }, { ASL, true }, }, { { STA, true }, { ASL, true }, } },
+    { { { CLC, false }, { STA, true }, { LSR, true }, }, { { STA, true }, { LSR, true }, } },
+    { { { CLC, false }, { STA, true }, { ROL, true }, }, { { STA, true }, { ASL, true }, } },
+    { { { CLC, false }, { STA, true }, { ROR, true }, }, { { STA, true }, { LSR, true }, } },
+    { { { CLC, false }, { STA, true }, { CMP, true }, }, { { STA, true }, { CMP, true }, } },
+    { { { CLC, false }, { STA, true }, { DCP, true }, }, { { STA, true }, { DCP, true }, } },
+    { { { CLC, false }, { STA, true }, { SLO, true }, }, { { STA, true }, { SLO, true }, } },
+    { { { CLC, false }, { STA, true }, { SRE, true }, }, { { STA, true }, { SRE, true }, } },
+    { { { CLC, false }, { STX, true }, { CLC, false }, }, { { CLC, false }, { STX, true }, } },
+    { { { CLC, false }, { STX, true }, { SEC, false }, }, { { SEC, false }, { STX, true }, } },
+    { { { CLC, false }, { STX, true }, { ASL, false }, }, { { ASL, false }, { STX, true }, } },
+    { { { CLC, false }, { STX, true }, { LSR, false }, }, { { LSR, false }, { STX, true }, } },
+    { { { CLC, false }, { STX, true }, { ROL, false }, }, { { ASL, false }, { STX, true }, } },
+    { { { CLC, false }, { STX, true }, { ROR, false }, }, { { LSR, false }, { STX, true }, } },
+    { { { CLC, false }, { STX, true }, { ASL, true }, }, { { STX, true }, { ASL, true }, } },
+    { { { CLC, false }, { STX, true }, { LSR, true }, }, { { STX, true }, { LSR, true }, } },
+    { { { CLC, false }, { STX, true }, { ROL, true }, }, { { STX, true }, { ASL, true }, } },
+    { { { CLC, false }, { STX, true }, { ROR, true }, }, { { STX, true }, { LSR, true }, } },
+    { { { CLC, false }, { STX, true }, { CPX, true }, }, { { STX, true }, { CPX, true }, } },
+    { { { CLC, false }, { STY, true }, { CLC, false }, }, { { CLC, false }, { STY, true }, } },
+    { { { CLC, false }, { STY, true }, { SEC, false }, }, { { SEC, false }, { STY, true }, } },
+    { { { CLC, false }, { STY, true }, { ASL, false }, }, { { ASL, false }, { STY, true }, } },
+    { { { CLC, false }, { STY, true }, { LSR, false }, }, { { LSR, false }, { STY, true }, } },
+    { { { CLC, false }, { STY, true }, { ROL, false }, }, { { ASL, false }, { STY, true }, } },
+    { { { CLC, false }, { STY, true }, { ROR, false }, }, { { LSR, false }, { STY, true }, } },
+    { { { CLC, false }, { STY, true }, { ASL, true }, }, { { STY, true }, { ASL, true }, } },
+    { { { CLC, false }, { STY, true }, { LSR, true }, }, { { STY, true }, { LSR, true }, } },
+    { { { CLC, false }, { STY, true }, { ROL, true }, }, { { STY, true }, { ASL, true }, } },
+    { { { CLC, false }, { STY, true }, { ROR, true }, }, { { STY, true }, { LSR, true }, } },
+    { { { CLC, false }, { STY, true }, { CPY, true }, }, { { STY, true }, { CPY, true }, } },
+    { { { CLC, false }, { SAX, true }, { CLC, false }, }, { { CLC, false }, { SAX, true }, } },
+    { { { CLC, false }, { SAX, true }, { SEC, false }, }, { { SEC, false }, { SAX, true }, } },
+    { { { CLC, false }, { SAX, true }, { ASL, false }, }, { { SAX, true }, { ASL, false }, } },
+    { { { CLC, false }, { SAX, true }, { LSR, false }, }, { { SAX, true }, { LSR, false }, } },
+    { { { CLC, false }, { SAX, true }, { ROL, false }, }, { { SAX, true }, { ASL, false }, } },
+    { { { CLC, false }, { SAX, true }, { ROR, false }, }, { { SAX, true }, { LSR, false }, } },
+    { { { CLC, false }, { INC, true }, { CLC, false }, }, { { CLC, false }, { INC, true }, } },
+    { { { CLC, false }, { INC, true }, { SEC, false }, }, { { SEC, false }, { INC, true }, } },
+    { { { CLC, false }, { INC, true }, { ASL, false }, }, { { INC, true }, { ASL, false }, } },
+    { { { CLC, false }, { INC, true }, { LSR, false }, }, { { INC, true }, { LSR, false }, } },
+    { { { CLC, false }, { INC, true }, { ROL, false }, }, { { INC, true }, { ASL, false }, } },
+    { { { CLC, false }, { INC, true }, { ROR, false }, }, { { INC, true }, { LSR, false }, } },
+    { { { CLC, false }, { INC, true }, { DEC, true }, }, { { ASL, true }, { ROR, true }, } },
+    { { { CLC, false }, { INC, true }, { ASL, true }, }, { { INC, true }, { ASL, true }, } },
+    { { { CLC, false }, { INC, true }, { LSR, true }, }, { { INC, true }, { LSR, true }, } },
+    { { { CLC, false }, { INC, true }, { ROL, true }, }, { { INC, true }, { ASL, true }, } },
+    { { { CLC, false }, { INC, true }, { ROR, true }, }, { { INC, true }, { LSR, true }, } },
+    { { { CLC, false }, { INC, true }, { CMP, true }, }, { { INC, true }, { CMP, true }, } },
+    { { { CLC, false }, { INC, true }, { CPX, true }, }, { { INC, true }, { CPX, true }, } },
+    { { { CLC, false }, { INC, true }, { CPY, true }, }, { { INC, true }, { CPY, true }, } },
+    { { { CLC, false }, { INC, true }, { SLO, true }, }, { { INC, true }, { SLO, true }, } },
+    { { { CLC, false }, { INC, true }, { SRE, true }, }, { { INC, true }, { SRE, true }, } },
+    { { { CLC, false }, { DEC, true }, { CLC, false }, }, { { CLC, false }, { DEC, true }, } },
+    { { { CLC, false }, { DEC, true }, { SEC, false }, }, { { SEC, false }, { DEC, true }, } },
+    { { { CLC, false }, { DEC, true }, { ASL, false }, }, { { DEC, true }, { ASL, false }, } },
+    { { { CLC, false }, { DEC, true }, { LSR, false }, }, { { DEC, true }, { LSR, false }, } },
+    { { { CLC, false }, { DEC, true }, { ROL, false }, }, { { DEC, true }, { ASL, false }, } },
+    { { { CLC, false }, { DEC, true }, { ROR, false }, }, { { DEC, true }, { LSR, false }, } },
+    { { { CLC, false }, { DEC, true }, { INC, true }, }, { { ASL, true }, { ROR, true }, } },
+    { { { CLC, false }, { DEC, true }, { ASL, true }, }, { { DEC, true }, { ASL, true }, } },
+    { { { CLC, false }, { DEC, true }, { LSR, true }, }, { { DEC, true }, { LSR, true }, } },
+    { { { CLC, false }, { DEC, true }, { ROL, true }, }, { { DEC, true }, { ASL, true }, } },
+    { { { CLC, false }, { DEC, true }, { ROR, true }, }, { { DEC, true }, { LSR, true }, } },
+    { { { CLC, false }, { DEC, true }, { CPX, true }, }, { { DEC, true }, { CPX, true }, } },
+    { { { CLC, false }, { DEC, true }, { CPY, true }, }, { { DEC, true }, { CPY, true }, } },
+    { { { CLC, false }, { DEC, true }, { DCP, true }, }, { { DEC, true }, { DCP, true }, } },
+    { { { CLC, false }, { DEC, true }, { SLO, true }, }, { { DEC, true }, { SLO, true }, } },
+    { { { CLC, false }, { DEC, true }, { SRE, true }, }, { { DEC, true }, { SRE, true }, } },
+    { { { CLC, false }, { ASL, true }, {}, }, { { ASL, true }, {}, } },
+    { { { CLC, false }, { LSR, true }, {}, }, { { LSR, true }, {}, } },
+    { { { CLC, false }, { ROL, true }, {}, }, { { ASL, true }, {}, } },
+    { { { CLC, false }, { ROR, true }, {}, }, { { LSR, true }, {}, } },
+    { { { CLC, false }, { AND, true }, { CLC, false }, }, { { CLC, false }, { AND, true }, } },
+    { { { CLC, false }, { AND, true }, { SEC, false }, }, { { SEC, false }, { AND, true }, } },
+    { { { CLC, false }, { AND, true }, { ASL, false }, }, { { AND, true }, { ASL, false }, } },
+    { { { CLC, false }, { AND, true }, { LSR, false }, }, { { AND, true }, { LSR, false }, } },
+    { { { CLC, false }, { AND, true }, { ROL, false }, }, { { AND, true }, { ASL, false }, } },
+    { { { CLC, false }, { AND, true }, { ROR, false }, }, { { AND, true }, { LSR, false }, } },
+    { { { CLC, false }, { AND, true }, { ASL, true }, }, { { AND, true }, { ASL, true }, } },
+    { { { CLC, false }, { AND, true }, { LSR, true }, }, { { AND, true }, { LSR, true }, } },
+    { { { CLC, false }, { AND, true }, { ROL, true }, }, { { AND, true }, { ASL, true }, } },
+    { { { CLC, false }, { AND, true }, { ROR, true }, }, { { AND, true }, { LSR, true }, } },
+    { { { CLC, false }, { AND, true }, { CMP, true }, }, { { AND, true }, { CMP, true }, } },
+    { { { CLC, false }, { AND, true }, { DCP, true }, }, { { AND, true }, { DCP, true }, } },
+    { { { CLC, false }, { AND, true }, { SLO, true }, }, { { AND, true }, { SLO, true }, } },
+    { { { CLC, false }, { AND, true }, { SRE, true }, }, { { AND, true }, { SRE, true }, } },
+    { { { CLC, false }, { ORA, true }, { CLC, false }, }, { { CLC, false }, { ORA, true }, } },
+    { { { CLC, false }, { ORA, true }, { SEC, false }, }, { { SEC, false }, { ORA, true }, } },
+    { { { CLC, false }, { ORA, true }, { ASL, false }, }, { { ORA, true }, { ASL, false }, } },
+    { { { CLC, false }, { ORA, true }, { LSR, false }, }, { { ORA, true }, { LSR, false }, } },
+    { { { CLC, false }, { ORA, true }, { ROL, false }, }, { { ORA, true }, { ASL, false }, } },
+    { { { CLC, false }, { ORA, true }, { ROR, false }, }, { { ORA, true }, { LSR, false }, } },
+    { { { CLC, false }, { ORA, true }, { ASL, true }, }, { { ORA, true }, { ASL, true }, } },
+    { { { CLC, false }, { ORA, true }, { LSR, true }, }, { { ORA, true }, { LSR, true }, } },
+    { { { CLC, false }, { ORA, true }, { ROL, true }, }, { { ORA, true }, { ASL, true }, } },
+    { { { CLC, false }, { ORA, true }, { ROR, true }, }, { { ORA, true }, { LSR, true }, } },
+    { { { CLC, false }, { ORA, true }, { CMP, true }, }, { { ORA, true }, { CMP, true }, } },
+    { { { CLC, false }, { ORA, true }, { DCP, true }, }, { { ORA, true }, { DCP, true }, } },
+    { { { CLC, false }, { ORA, true }, { SLO, true }, }, { { ORA, true }, { SLO, true }, } },
+    { { { CLC, false }, { ORA, true }, { SRE, true }, }, { { ORA, true }, { SRE, true }, } },
+    { { { CLC, false }, { EOR, true }, { CLC, false }, }, { { CLC, false }, { EOR, true }, } },
+    { { { CLC, false }, { EOR, true }, { SEC, false }, }, { { SEC, false }, { EOR, true }, } },
+    { { { CLC, false }, { EOR, true }, { ASL, false }, }, { { EOR, true }, { ASL, false }, } },
+    { { { CLC, false }, { EOR, true }, { LSR, false }, }, { { EOR, true }, { LSR, false }, } },
+    { { { CLC, false }, { EOR, true }, { ROL, false }, }, { { EOR, true }, { ASL, false }, } },
+    { { { CLC, false }, { EOR, true }, { ROR, false }, }, { { EOR, true }, { LSR, false }, } },
+    { { { CLC, false }, { EOR, true }, { ASL, true }, }, { { EOR, true }, { ASL, true }, } },
+    { { { CLC, false }, { EOR, true }, { LSR, true }, }, { { EOR, true }, { LSR, true }, } },
+    { { { CLC, false }, { EOR, true }, { ROL, true }, }, { { EOR, true }, { ASL, true }, } },
+    { { { CLC, false }, { EOR, true }, { ROR, true }, }, { { EOR, true }, { LSR, true }, } },
+    { { { CLC, false }, { EOR, true }, { CMP, true }, }, { { EOR, true }, { CMP, true }, } },
+    { { { CLC, false }, { EOR, true }, { DCP, true }, }, { { EOR, true }, { DCP, true }, } },
+    { { { CLC, false }, { EOR, true }, { SLO, true }, }, { { EOR, true }, { SLO, true }, } },
+    { { { CLC, false }, { EOR, true }, { SRE, true }, }, { { EOR, true }, { SRE, true }, } },
+    { { { CLC, false }, { CMP, true }, {}, }, { { CMP, true }, {}, } },
+    { { { CLC, false }, { CPX, true }, {}, }, { { CPX, true }, {}, } },
+    { { { CLC, false }, { CPY, true }, {}, }, { { CPY, true }, {}, } },
+    { { { CLC, false }, { BIT, true }, { CLC, false }, }, { { CLC, false }, { BIT, true }, } },
+    { { { CLC, false }, { BIT, true }, { SEC, false }, }, { { SEC, false }, { BIT, true }, } },
+    { { { CLC, false }, { BIT, true }, { ASL, false }, }, { { BIT, true }, { ASL, false }, } },
+    { { { CLC, false }, { BIT, true }, { LSR, false }, }, { { BIT, true }, { LSR, false }, } },
+    { { { CLC, false }, { BIT, true }, { ROL, false }, }, { { BIT, true }, { ASL, false }, } },
+    { { { CLC, false }, { BIT, true }, { ROR, false }, }, { { BIT, true }, { LSR, false }, } },
+    { { { CLC, false }, { BIT, true }, { ASL, true }, }, { { BIT, true }, { ASL, true }, } },
+    { { { CLC, false }, { BIT, true }, { LSR, true }, }, { { BIT, true }, { LSR, true }, } },
+    { { { CLC, false }, { BIT, true }, { ROL, true }, }, { { BIT, true }, { ASL, true }, } },
+    { { { CLC, false }, { BIT, true }, { ROR, true }, }, { { BIT, true }, { LSR, true }, } },
+    { { { CLC, false }, { BIT, true }, { CMP, true }, }, { { BIT, true }, { CMP, true }, } },
+    { { { CLC, false }, { BIT, true }, { DCP, true }, }, { { BIT, true }, { DCP, true }, } },
+    { { { CLC, false }, { BIT, true }, { SLO, true }, }, { { BIT, true }, { SLO, true }, } },
+    { { { CLC, false }, { BIT, true }, { SRE, true }, }, { { BIT, true }, { SRE, true }, } },
+    { { { CLC, false }, { DCP, true }, {}, }, { { DCP, true }, {}, } },
+    { { { CLC, false }, { SLO, true }, {}, }, { { SLO, true }, {}, } },
+    { { { CLC, false }, { RLA, true }, { LDA, true }, }, { { ASL, true }, { LDA, true }, } },
+    { { { CLC, false }, { RLA, true }, { LAX, true }, }, { { ASL, true }, { LAX, true }, } },
+    { { { CLC, false }, { RLA, true }, { ORA, true }, }, { { ASL, true }, { LDA, true }, } },
+    { { { CLC, false }, { SRE, true }, {}, }, { { SRE, true }, {}, } },
+    { { { SEC, false }, { TAX, false }, { CLC, false }, }, { { TAX, false }, { CLC, false }, } },
+    { { { SEC, false }, { TAX, false }, { SEC, false }, }, { { TAX, false }, { SEC, false }, } },
+    { { { SEC, false }, { TAX, false }, { ASL, false }, }, { { TAX, false }, { ASL, false }, } },
+    { { { SEC, false }, { TAX, false }, { LSR, false }, }, { { TAX, false }, { LSR, false }, } },
+    { { { SEC, false }, { TAX, false }, { ASL, true }, }, { { TAX, false }, { ASL, true }, } },
+    { { { SEC, false }, { TAX, false }, { LSR, true }, }, { { TAX, false }, { LSR, true }, } },
+    { { { SEC, false }, { TAX, false }, { CMP, true }, }, { { TAX, false }, { CMP, true }, } },
+    { { { SEC, false }, { TAX, false }, { DCP, true }, }, { { TAX, false }, { DCP, true }, } },
+    { { { SEC, false }, { TAX, false }, { SLO, true }, }, { { TAX, false }, { SLO, true }, } },
+    { { { SEC, false }, { TAX, false }, { SRE, true }, }, { { TAX, false }, { SRE, true }, } },
+    { { { SEC, false }, { TAY, false }, { CLC, false }, }, { { TAY, false }, { CLC, false }, } },
+    { { { SEC, false }, { TAY, false }, { SEC, false }, }, { { TAY, false }, { SEC, false }, } },
+    { { { SEC, false }, { TAY, false }, { ASL, false }, }, { { TAY, false }, { ASL, false }, } },
+    { { { SEC, false }, { TAY, false }, { LSR, false }, }, { { TAY, false }, { LSR, false }, } },
+    { { { SEC, false }, { TAY, false }, { ASL, true }, }, { { TAY, false }, { ASL, true }, } },
+    { { { SEC, false }, { TAY, false }, { LSR, true }, }, { { TAY, false }, { LSR, true }, } },
+    { { { SEC, false }, { TAY, false }, { CMP, true }, }, { { TAY, false }, { CMP, true }, } },
+    { { { SEC, false }, { TAY, false }, { DCP, true }, }, { { TAY, false }, { DCP, true }, } },
+    { { { SEC, false }, { TAY, false }, { SLO, true }, }, { { TAY, false }, { SLO, true }, } },
+    { { { SEC, false }, { TAY, false }, { SRE, true }, }, { { TAY, false }, { SRE, true }, } },
+    { { { SEC, false }, { TXA, false }, { CLC, false }, }, { { TXA, false }, { CLC, false }, } },
+    { { { SEC, false }, { TXA, false }, { SEC, false }, }, { { TXA, false }, { SEC, false }, } },
+    { { { SEC, false }, { TXA, false }, { ASL, false }, }, { { TXA, false }, { ASL, false }, } },
+    { { { SEC, false }, { TXA, false }, { LSR, false }, }, { { TXA, false }, { LSR, false }, } },
+    { { { SEC, false }, { TXA, false }, { ASL, true }, }, { { TXA, false }, { ASL, true }, } },
+    { { { SEC, false }, { TXA, false }, { LSR, true }, }, { { TXA, false }, { LSR, true }, } },
+    { { { SEC, false }, { TXA, false }, { CPX, true }, }, { { TXA, false }, { CPX, true }, } },
+    { { { SEC, false }, { TYA, false }, { CLC, false }, }, { { TYA, false }, { CLC, false }, } },
+    { { { SEC, false }, { TYA, false }, { SEC, false }, }, { { TYA, false }, { SEC, false }, } },
+    { { { SEC, false }, { TYA, false }, { ASL, false }, }, { { TYA, false }, { ASL, false }, } },
+    { { { SEC, false }, { TYA, false }, { LSR, false }, }, { { TYA, false }, { LSR, false }, } },
+    { { { SEC, false }, { TYA, false }, { ASL, true }, }, { { TYA, false }, { ASL, true }, } },
+    { { { SEC, false }, { TYA, false }, { LSR, true }, }, { { TYA, false }, { LSR, true }, } },
+    { { { SEC, false }, { TYA, false }, { CPY, true }, }, { { TYA, false }, { CPY, true }, } },
+    { { { SEC, false }, { INX, false }, { CLC, false }, }, { { INX, false }, { CLC, false }, } },
+    { { { SEC, false }, { INX, false }, { SEC, false }, }, { { INX, false }, { SEC, false }, } },
+    { { { SEC, false }, { INX, false }, { ASL, false }, }, { { INX, false }, { ASL, false }, } },
+    { { { SEC, false }, { INX, false }, { LSR, false }, }, { { INX, false }, { LSR, false }, } },
+    { { { SEC, false }, { INX, false }, { ASL, true }, }, { { INX, false }, { ASL, true }, } },
+    { { { SEC, false }, { INX, false }, { LSR, true }, }, { { INX, false }, { LSR, true }, } },
+    { { { SEC, false }, { INX, false }, { CPX, true }, }, { { INX, false }, { CPX, true }, } },
+    { { { SEC, false }, { INY, false }, { CLC, false }, }, { { INY, false }, { CLC, false }, } },
+    { { { SEC, false }, { INY, false }, { SEC, false }, }, { { INY, false }, { SEC, false }, } },
+    { { { SEC, false }, { INY, false }, { ASL, false }, }, { { INY, false }, { ASL, false }, } },
+    { { { SEC, false }, { INY, false }, { LSR, false }, }, { { INY, false }, { LSR, false }, } },
+    { { { SEC, false }, { INY, false }, { ASL, true }, }, { { INY, false }, { ASL, true }, } },
+    { { { SEC, false }, { INY, false }, { LSR, true }, }, { { INY, false }, { LSR, true }, } },
+    { { { SEC, false }, { INY, false }, { CPY, true }, }, { { INY, false }, { CPY, true }, } },
+    { { { SEC, false }, { DEX, false }, { CLC, false }, }, { { DEX, false }, { CLC, false }, } },
+    { { { SEC, false }, { DEX, false }, { SEC, false }, }, { { DEX, false }, { SEC, false }, } },
+    { { { SEC, false }, { DEX, false }, { ASL, false }, }, { { DEX, false }, { ASL, false }, } },
+    { { { SEC, false }, { DEX, false }, { LSR, false }, }, { { DEX, false }, { LSR, false }, } },
+    { { { SEC, false }, { DEX, false }, { ASL, true }, }, { { DEX, false }, { ASL, true }, } },
+    { { { SEC, false }, { DEX, false }, { LSR, true }, }, { { DEX, false }, { LSR, true }, } },
+    { { { SEC, false }, { DEX, false }, { CPX, true }, }, { { DEX, false }, { CPX, true }, } },
+    { { { SEC, false }, { DEY, false }, { CLC, false }, }, { { DEY, false }, { CLC, false }, } },
+    { { { SEC, false }, { DEY, false }, { SEC, false }, }, { { DEY, false }, { SEC, false }, } },
+    { { { SEC, false }, { DEY, false }, { ASL, false }, }, { { DEY, false }, { ASL, false }, } },
+    { { { SEC, false }, { DEY, false }, { LSR, false }, }, { { DEY, false }, { LSR, false }, } },
+    { { { SEC, false }, { DEY, false }, { ASL, true }, }, { { DEY, false }, { ASL, true }, } },
+    { { { SEC, false }, { DEY, false }, { LSR, true }, }, { { DEY, false }, { LSR, true }, } },
+    { { { SEC, false }, { DEY, false }, { CPY, true }, }, { { DEY, false }, { CPY, true }, } },
+    { { { SEC, false }, { CLC, false }, {}, }, { { CLC, false }, {}, } },
+    { { { SEC, false }, { SEC, false }, {}, }, { { SEC, false }, {}, } },
+    { { { SEC, false }, { CLV, false }, { CLC, false }, }, { { CLC, false }, { CLV, false }, } },
+    { { { SEC, false }, { CLV, false }, { SEC, false }, }, { { SEC, false }, { CLV, false }, } },
+    { { { SEC, false }, { CLV, false }, { ASL, false }, }, { { CLV, false }, { ASL, false }, } },
+    { { { SEC, false }, { CLV, false }, { LSR, false }, }, { { CLV, false }, { LSR, false }, } },
+    { { { SEC, false }, { CLV, false }, { ASL, true }, }, { { CLV, false }, { ASL, true }, } },
+    { { { SEC, false }, { CLV, false }, { LSR, true }, }, { { CLV, false }, { LSR, true }, } },
+    { { { SEC, false }, { CLV, false }, { CMP, true }, }, { { CLV, false }, { CMP, true }, } },
+    { { { SEC, false }, { CLV, false }, { CPX, true }, }, { { CLV, false }, { CPX, true }, } },
+    { { { SEC, false }, { CLV, false }, { CPY, true }, }, { { CLV, false }, { CPY, true }, } },
+    { { { SEC, false }, { CLV, false }, { DCP, true }, }, { { CLV, false }, { DCP, true }, } },
+    { { { SEC, false }, { CLV, false }, { SLO, true }, }, { { CLV, false }, { SLO, true }, } },
+    { { { SEC, false }, { CLV, false }, { SRE, true }, }, { { CLV, false }, { SRE, true }, } },
+    { { { SEC, false }, { ASL, false }, {}, }, { { ASL, false }, {}, } },
+    { { { SEC, false }, { LSR, false }, {}, }, { { LSR, false }, {}, } },
+    { { { SEC, false }, { ROL, false }, { TXA, false }, }, { { ASL, false }, { TXA, false }, } },
+    { { { SEC, false }, { ROL, false }, { TYA, false }, }, { { ASL, false }, { TYA, false }, } },
+    { { { SEC, false }, { ROL, false }, { LDA, true }, }, { { ASL, false }, { LDA, true }, } },
+    { { { SEC, false }, { ROL, false }, { LAX, true }, }, { { ASL, false }, { LAX, true }, } },
+    { { { SEC, false }, { ROR, false }, { TXA, false }, }, { { LSR, false }, { TXA, false }, } },
+    { { { SEC, false }, { ROR, false }, { TYA, false }, }, { { LSR, false }, { TYA, false }, } },
+    { { { SEC, false }, { ROR, false }, { LDA, true }, }, { { LSR, false }, { LDA, true }, } },
+    { { { SEC, false }, { ROR, false }, { LAX, true }, }, { { LSR, false }, { LAX, true }, } },
+    { { { SEC, false }, { LDA, true }, { CLC, false }, }, { { CLC, false }, { LDA, true }, } },
+    { { { SEC, false }, { LDA, true }, { SEC, false }, }, { { SEC, false }, { LDA, true }, } },
+    { { { SEC, false }, { LDA, true }, { ASL, false }, }, { { LDA, true }, { ASL, false }, } },
+    { { { SEC, false }, { LDA, true }, { LSR, false }, }, { { LDA, true }, { LSR, false }, } },
+    { { { SEC, false }, { LDA, true }, { ASL, true }, }, { { LDA, true }, { ASL, true }, } },
+    { { { SEC, false }, { LDA, true }, { LSR, true }, }, { { LDA, true }, { LSR, true }, } },
+    { { { SEC, false }, { LDA, true }, { CMP, true }, }, { { LDA, true }, { CMP, true }, } },
+    { { { SEC, false }, { LDA, true }, { CPX, true }, }, { { LDA, true }, { CPX, true }, } },
+    { { { SEC, false }, { LDA, true }, { CPY, true }, }, { { LDA, true }, { CPY, true }, } },
+    { { { SEC, false }, { LDA, true }, { DCP, true }, }, { { LDA, true }, { DCP, true }, } },
+    { { { SEC, false }, { LDA, true }, { SLO, true }, }, { { LDA, true }, { SLO, true }, } },
+    { { { SEC, false }, { LDA, true }, { SRE, true }, }, { { LDA, true }, { SRE, true }, } },
+    { { { SEC, false }, { LDX, true }, { CLC, false }, }, { { CLC, false }, { LDX, true }, } },
+    { { { SEC, false }, { LDX, true }, { SEC, false }, }, { { SEC, false }, { LDX, true }, } },
+    { { { SEC, false }, { LDX, true }, { ASL, false }, }, { { LDX, true }, { ASL, false }, } },
+    { { { SEC, false }, { LDX, true }, { LSR, false }, }, { { LDX, true }, { LSR, false }, } },
+    { { { SEC, false }, { LDX, true }, { ASL, true }, }, { { LDX, true }, { ASL, true }, } },
+    { { { SEC, false }, { LDX, true }, { LSR, true }, }, { { LDX, true }, { LSR, true }, } },
+    { { { SEC, false }, { LDX, true }, { CMP, true }, }, { { LDX, true }, { CMP, true }, } },
+    { { { SEC, false }, { LDX, true }, { CPX, true }, }, { { LDX, true }, { CPX, true }, } },
+    { { { SEC, false }, { LDX, true }, { CPY, true }, }, { { LDX, true }, { CPY, true }, } },
+    { { { SEC, false }, { LDX, true }, { DCP, true }, }, { { LDX, true }, { DCP, true }, } },
+    { { { SEC, false }, { LDX, true }, { SLO, true }, }, { { LDX, true }, { SLO, true }, } },
+    { { { SEC, false }, { LDX, true }, { SRE, true }, }, { { LDX, true }, { SRE, true }, } },
+    { { { SEC, false }, { LDY, true }, { CLC, false }, }, { { CLC, false }, { LDY, true }, } },
+    { { { SEC, false }, { LDY, true }, { SEC, false }, }, { { SEC, false }, { LDY, true }, } },
+    { { { SEC, false }, { LDY, true }, { ASL, false }, }, { { LDY, true }, { ASL, false }, } },
+    { { { SEC, false }, { LDY, true }, { LSR, false }, }, { { LDY, true }, { LSR, false }, } },
+    { { { SEC, false }, { LDY, true }, { ASL, true }, }, { { LDY, true }, { ASL, true }, } },
+    { { { SEC, false }, { LDY, true }, { LSR, true }, }, { { LDY, true }, { LSR, true }, } },
+    { { { SEC, false }, { LDY, true }, { CMP, true }, }, { { LDY, true }, { CMP, true }, } },
+    { { { SEC, false }, { LDY, true }, { CPX, true }, }, { { LDY, true }, { CPX, true }, } },
+    { { { SEC, false }, { LDY, true }, { CPY, true }, }, { { LDY, true }, { CPY, true }, } },
+    { { { SEC, false }, { LDY, true }, { DCP, true }, }, { { LDY, true }, { DCP, true }, } },
+    { { { SEC, false }, { LDY, true }, { SLO, true }, }, { { LDY, true }, { SLO, true }, } },
+    { { { SEC, false }, { LDY, true }, { SRE, true }, }, { { LDY, true }, { SRE, true }, } },
+    { { { SEC, false }, { LAX, true }, { CLC, false }, }, { { CLC, false }, { LAX, true }, } },
+    { { { SEC, false }, { LAX, true }, { SEC, false }, }, { { SEC, false }, { LAX, true }, } },
+    { { { SEC, false }, { LAX, true }, { ASL, false }, }, { { LAX, true }, { ASL, false }, } },
+    { { { SEC, false }, { LAX, true }, { LSR, false }, }, { { LAX, true }, { LSR, false }, } },
+    { { { SEC, false }, { LAX, true }, { ASL, true }, }, { { LAX, true }, { ASL, true }, } },
+    { { { SEC, false }, { LAX, true }, { LSR, true }, }, { { LAX, true }, { LSR, true }, } },
+    { { { SEC, false }, { LAX, true }, { CMP, true }, }, { { LAX, true }, { CMP, true }, } },
+    { { { SEC, false }, { LAX, true }, { CPX, true }, }, { { LAX, true }, { CPX, true }, } },
+    { { { SEC, false }, { LAX, true }, { CPY, true }, }, { { LAX, true }, { CPY, true }, } },
+    { { { SEC, false }, { LAX, true }, { DCP, true }, }, { { LAX, true }, { DCP, true }, } },
+    { { { SEC, false }, { LAX, true }, { SLO, true }, }, { { LAX, true }, { SLO, true }, } },
+    { { { SEC, false }, { LAX, true }, { SRE, true }, }, { { LAX, true }, { SRE, true }, } },
+    { { { SEC, false }, { STA, true }, { CLC, false }, }, { { CLC, false }, { STA, true }, } },
+    { { { SEC, false }, { STA, true }, { SEC, false }, }, { { SEC, false }, { STA, true }, } },
+    { { { SEC, false }, { STA, true }, { ASL, false }, }, { { STA, true }, { ASL, false }, } },
+    { { { SEC, false }, { STA, true }, { LSR, false }, }, { { STA, true }, { LSR, false }, } },
+    { { { SEC, false }, { STA, true }, { ASL, true }, }, { { STA, true }, { ASL, true }, } },
+    { { { SEC, false }, { STA, true }, { LSR, true }, }, { { STA, true }, { LSR, true }, } },
+    { { { SEC, false }, { STA, true }, { CMP, true }, }, { { STA, true }, { CMP, true }, } },
+    { { { SEC, false }, { STA, true }, { DCP, true }, }, { { STA, true }, { DCP, true }, } },
+    { { { SEC, false }, { STA, true }, { SLO, true }, }, { { STA, true }, { SLO, true }, } },
+    { { { SEC, false }, { STA, true }, { SRE, true }, }, { { STA, true }, { SRE, true }, } },
+    { { { SEC, false }, { STX, true }, { CLC, false }, }, { { CLC, false }, { STX, true }, } },
+    { { { SEC, false }, { STX, true }, { SEC, false }, }, { { SEC, false }, { STX, true }, } },
+    { { { SEC, false }, { STX, true }, { ASL, false }, }, { { ASL, false }, { STX, true }, } },
+    { { { SEC, false }, { STX, true }, { LSR, false }, }, { { LSR, false }, { STX, true }, } },
+    { { { SEC, false }, { STX, true }, { ASL, true }, }, { { STX, true }, { ASL, true }, } },
+    { { { SEC, false }, { STX, true }, { LSR, true }, }, { { STX, true }, { LSR, true }, } },
+    { { { SEC, false }, { STX, true }, { CPX, true }, }, { { STX, true }, { CPX, true }, } },
+    { { { SEC, false }, { STY, true }, { CLC, false }, }, { { CLC, false }, { STY, true }, } },
+    { { { SEC, false }, { STY, true }, { SEC, false }, }, { { SEC, false }, { STY, true }, } },
+    { { { SEC, false }, { STY, true }, { ASL, false }, }, { { ASL, false }, { STY, true }, } },
+    { { { SEC, false }, { STY, true }, { LSR, false }, }, { { LSR, false }, { STY, true }, } },
+    { { { SEC, false }, { STY, true }, { ASL, true }, }, { { STY, true }, { ASL, true }, } },
+    { { { SEC, false }, { STY, true }, { LSR, true }, }, { { STY, true }, { LSR, true }, } },
+    { { { SEC, false }, { STY, true }, { CPY, true }, }, { { STY, true }, { CPY, true }, } },
+    { { { SEC, false }, { SAX, true }, { CLC, false }, }, { { CLC, false }, { SAX, true }, } },
+    { { { SEC, false }, { SAX, true }, { SEC, false }, }, { { SEC, false }, { SAX, true }, } },
+    { { { SEC, false }, { SAX, true }, { ASL, false }, }, { { SAX, true }, { ASL, false }, } },
+    { { { SEC, false }, { SAX, true }, { LSR, false }, }, { { SAX, true }, { LSR, false }, } },
+    { { { SEC, false }, { INC, true }, { CLC, false }, }, { { CLC, false }, { INC, true }, } },
+    { { { SEC, false }, { INC, true }, { SEC, false }, }, { { SEC, false }, { INC, true }, } },
+    { { { SEC, false }, { INC, true }, { ASL, false }, }, { { INC, true }, { ASL, false }, } },
+    { { { SEC, false }, { INC, true }, { LSR, false }, }, { { INC, true }, { LSR, false }, } },
+    { { { SEC, false }, { INC, true }, { ASL, true }, }, { { INC, true }, { ASL, true }, } },
+    { { { SEC, false }, { INC, true }, { LSR, true }, }, { { INC, true }, { LSR, true }, } },
+    { { { SEC, false }, { INC, true }, { CMP, true }, }, { { INC, true }, { CMP, true }, } },
+    { { { SEC, false }, { INC, true }, { CPX, true }, }, { { INC, true }, { CPX, true }, } },
+    { { { SEC, false }, { INC, true }, { CPY, true }, }, { { INC, true }, { CPY, true }, } },
+    { { { SEC, false }, { INC, true }, { SLO, true }, }, { { INC, true }, { SLO, true }, } },
+    { { { SEC, false }, { INC, true }, { SRE, true }, }, { { INC, true }, { SRE, true }, } },
+    { { { SEC, false }, { DEC, true }, { CLC, false }, }, { { CLC, false }, { DEC, true }, } },
+    { { { SEC, false }, { DEC, true }, { SEC, false }, }, { { SEC, false }, { DEC, true }, } },
+    { { { SEC, false }, { DEC, true }, { ASL, false }, }, { { DEC, true }, { ASL, false }, } },
+    { { { SEC, false }, { DEC, true }, { LSR, false }, }, { { DEC, true }, { LSR, false }, } },
+    { { { SEC, false }, { DEC, true }, { ASL, true }, }, { { DEC, true }, { ASL, true }, } },
+    { { { SEC, false }, { DEC, true }, { LSR, true }, }, { { DEC, true }, { LSR, true }, } },
+    { { { SEC, false }, { DEC, true }, { CPX, true }, }, { { DEC, true }, { CPX, true }, } },
+    { { { SEC, false }, { DEC, true }, { CPY, true }, }, { { DEC, true }, { CPY, true }, } },
+    { { { SEC, false }, { DEC, true }, { DCP, true }, }, { { DEC, true }, { DCP, true }, } },
+    { { { SEC, false }, { DEC, true }, { SLO, true }, }, { { DEC, true }, { SLO, true }, } },
+    { { { SEC, false }, { DEC, true }, { SRE, true }, }, { { DEC, true }, { SRE, true }, } },
+    { { { SEC, false }, { ASL, true }, {}, }, { { ASL, true }, {}, } },
+    { { { SEC, false }, { LSR, true }, {}, }, { { LSR, true }, {}, } },
+    { { { SEC, false }, { ROL, true }, { DEC, true }, }, { { ASL, true }, {}, } },
+    { { { SEC, false }, { ROL, true }, { SBC, true }, }, { { ASL, true }, { ISC, true }, } },
+    { { { SEC, false }, { ROL, true }, { DCP, true }, }, { { ASL, true }, { CMP, true }, } },
+    { { { SEC, false }, { AND, true }, { CLC, false }, }, { { CLC, false }, { AND, true }, } },
+    { { { SEC, false }, { AND, true }, { SEC, false }, }, { { SEC, false }, { AND, true }, } },
+    { { { SEC, false }, { AND, true }, { ASL, false }, }, { { AND, true }, { ASL, false }, } },
+    { { { SEC, false }, { AND, true }, { LSR, false }, }, { { AND, true }, { LSR, false }, } },
+    { { { SEC, false }, { AND, true }, { ASL, true }, }, { { AND, true }, { ASL, true }, } },
+    { { { SEC, false }, { AND, true }, { LSR, true }, }, { { AND, true }, { LSR, true }, } },
+    { { { SEC, false }, { AND, true }, { CMP, true }, }, { { AND, true }, { CMP, true }, } },
+    { { { SEC, false }, { AND, true }, { DCP, true }, }, { { AND, true }, { DCP, true }, } },
+    { { { SEC, false }, { AND, true }, { SLO, true }, }, { { AND, true }, { SLO, true }, } },
+    { { { SEC, false }, { AND, true }, { SRE, true }, }, { { AND, true }, { SRE, true }, } },
+    { { { SEC, false }, { ORA, true }, { CLC, false }, }, { { CLC, false }, { ORA, true }, } },
+    { { { SEC, false }, { ORA, true }, { SEC, false }, }, { { SEC, false }, { ORA, true }, } },
+    { { { SEC, false }, { ORA, true }, { ASL, false }, }, { { ORA, true }, { ASL, false }, } },
+    { { { SEC, false }, { ORA, true }, { LSR, false }, }, { { ORA, true }, { LSR, false }, } },
+    { { { SEC, false }, { ORA, true }, { ASL, true }, }, { { ORA, true }, { ASL, true }, } },
+    { { { SEC, false }, { ORA, true }, { LSR, true }, }, { { ORA, true }, { LSR, true }, } },
+    { { { SEC, false }, { ORA, true }, { CMP, true }, }, { { ORA, true }, { CMP, true }, } },
+    { { { SEC, false }, { ORA, true }, { DCP, true }, }, { { ORA, true }, { DCP, true }, } },
+    { { { SEC, false }, { ORA, true }, { SLO, true }, }, { { ORA, true }, { SLO, true }, } },
+    { { { SEC, false }, { ORA, true }, { SRE, true }, }, { { ORA, true }, { SRE, true }, } },
+    { { { SEC, false }, { EOR, true }, { CLC, false }, }, { { CLC, false }, { EOR, true }, } },
+    { { { SEC, false }, { EOR, true }, { SEC, false }, }, { { SEC, false }, { EOR, true }, } },
+    { { { SEC, false }, { EOR, true }, { ASL, false }, }, { { EOR, true }, { ASL, false }, } },
+    { { { SEC, false }, { EOR, true }, { LSR, false }, }, { { EOR, true }, { LSR, false }, } },
+    { { { SEC, false }, { EOR, true }, { ASL, true }, }, { { EOR, true }, { ASL, true }, } },
+    { { { SEC, false }, { EOR, true }, { LSR, true }, }, { { EOR, true }, { LSR, true }, } },
+    { { { SEC, false }, { EOR, true }, { CMP, true }, }, { { EOR, true }, { CMP, true }, } },
+    { { { SEC, false }, { EOR, true }, { DCP, true }, }, { { EOR, true }, { DCP, true }, } },
+    { { { SEC, false }, { EOR, true }, { SLO, true }, }, { { EOR, true }, { SLO, true }, } },
+    { { { SEC, false }, { EOR, true }, { SRE, true }, }, { { EOR, true }, { SRE, true }, } },
+    { { { SEC, false }, { CMP, true }, {}, }, { { CMP, true }, {}, } },
+    { { { SEC, false }, { CPX, true }, {}, }, { { CPX, true }, {}, } },
+    { { { SEC, false }, { CPY, true }, {}, }, { { CPY, true }, {}, } },
+    { { { SEC, false }, { BIT, true }, { CLC, false }, }, { { CLC, false }, { BIT, true }, } },
+    { { { SEC, false }, { BIT, true }, { SEC, false }, }, { { SEC, false }, { BIT, true }, } },
+    { { { SEC, false }, { BIT, true }, { ASL, false }, }, { { BIT, true }, { ASL, false }, } },
+    { { { SEC, false }, { BIT, true }, { LSR, false }, }, { { BIT, true }, { LSR, false }, } },
+    { { { SEC, false }, { BIT, true }, { ASL, true }, }, { { BIT, true }, { ASL, true }, } },
+    { { { SEC, false }, { BIT, true }, { LSR, true }, }, { { BIT, true }, { LSR, true }, } },
+    { { { SEC, false }, { BIT, true }, { CMP, true }, }, { { BIT, true }, { CMP, true }, } },
+    { { { SEC, false }, { BIT, true }, { DCP, true }, }, { { BIT, true }, { DCP, true }, } },
+    { { { SEC, false }, { BIT, true }, { SLO, true }, }, { { BIT, true }, { SLO, true }, } },
+    { { { SEC, false }, { BIT, true }, { SRE, true }, }, { { BIT, true }, { SRE, true }, } },
+    { { { SEC, false }, { DCP, true }, {}, }, { { DCP, true }, {}, } },
+    { { { SEC, false }, { SLO, true }, {}, }, { { SLO, true }, {}, } },
+    { { { SEC, false }, { SRE, true }, {}, }, { { SRE, true }, {}, } },
+    { { { CLV, false }, { TAX, false }, { CLV, false }, }, { { TAX, false }, { CLV, false }, } },
+    { { { CLV, false }, { TAX, false }, { ADC, true }, }, { { TAX, false }, { ADC, true }, } },
+    { { { CLV, false }, { TAX, false }, { SBC, true }, }, { { TAX, false }, { SBC, true }, } },
+    { { { CLV, false }, { TAX, false }, { BIT, true }, }, { { TAX, false }, { BIT, true }, } },
+    { { { CLV, false }, { TAX, false }, { ISC, true }, }, { { TAX, false }, { ISC, true }, } },
+    { { { CLV, false }, { TAX, false }, { RRA, true }, }, { { TAX, false }, { RRA, true }, } },
+    { { { CLV, false }, { TAY, false }, { CLV, false }, }, { { TAY, false }, { CLV, false }, } },
+    { { { CLV, false }, { TAY, false }, { ADC, true }, }, { { TAY, false }, { ADC, true }, } },
+    { { { CLV, false }, { TAY, false }, { SBC, true }, }, { { TAY, false }, { SBC, true }, } },
+    { { { CLV, false }, { TAY, false }, { BIT, true }, }, { { TAY, false }, { BIT, true }, } },
+    { { { CLV, false }, { TAY, false }, { ISC, true }, }, { { TAY, false }, { ISC, true }, } },
+    { { { CLV, false }, { TAY, false }, { RRA, true }, }, { { TAY, false }, { RRA, true }, } },
+    { { { CLV, false }, { TXA, false }, { CLV, false }, }, { { TXA, false }, { CLV, false }, } },
+    { { { CLV, false }, { TYA, false }, { CLV, false }, }, { { TYA, false }, { CLV, false }, } },
+    { { { CLV, false }, { INX, false }, { CLV, false }, }, { { INX, false }, { CLV, false }, } },
+    { { { CLV, false }, { INY, false }, { CLV, false }, }, { { INY, false }, { CLV, false }, } },
+    { { { CLV, false }, { DEX, false }, { CLV, false }, }, { { DEX, false }, { CLV, false }, } },
+    { { { CLV, false }, { DEY, false }, { CLV, false }, }, { { DEY, false }, { CLV, false }, } },
+    { { { CLV, false }, { CLC, false }, { CLV, false }, }, { { CLC, false }, { CLV, false }, } },
+    { { { CLV, false }, { CLC, false }, { ADC, true }, }, { { CLC, false }, { ADC, true }, } },
+    { { { CLV, false }, { CLC, false }, { SBC, true }, }, { { CLC, false }, { SBC, true }, } },
+    { { { CLV, false }, { CLC, false }, { BIT, true }, }, { { CLC, false }, { BIT, true }, } },
+    { { { CLV, false }, { CLC, false }, { ISC, true }, }, { { CLC, false }, { ISC, true }, } },
+    { { { CLV, false }, { CLC, false }, { RRA, true }, }, { { CLC, false }, { RRA, true }, } },
+    { { { CLV, false }, { SEC, false }, { CLV, false }, }, { { SEC, false }, { CLV, false }, } },
+    { { { CLV, false }, { SEC, false }, { ADC, true }, }, { { SEC, false }, { ADC, true }, } },
+    { { { CLV, false }, { SEC, false }, { SBC, true }, }, { { SEC, false }, { SBC, true }, } },
+    { { { CLV, false }, { SEC, false }, { BIT, true }, }, { { SEC, false }, { BIT, true }, } },
+    { { { CLV, false }, { SEC, false }, { ISC, true }, }, { { SEC, false }, { ISC, true }, } },
+    { { { CLV, false }, { SEC, false }, { RRA, true }, }, { { SEC, false }, { RRA, true }, } },
+    { { { CLV, false }, { CLV, false }, {}, }, { { CLV, false }, {}, } },
+    { { { CLV, false }, { ASL, false }, { CLV, false }, }, { { CLV, false }, { ASL, false }, } },
+    { { { CLV, false }, { ASL, false }, { ADC, true }, }, { { ASL, false }, { ADC, true }, } },
+    { { { CLV, false }, { ASL, false }, { SBC, true }, }, { { ASL, false }, { SBC, true }, } },
+    { { { CLV, false }, { ASL, false }, { BIT, true }, }, { { ASL, false }, { BIT, true }, } },
+    { { { CLV, false }, { ASL, false }, { ISC, true }, }, { { ASL, false }, { ISC, true }, } },
+    { { { CLV, false }, { ASL, false }, { RRA, true }, }, { { ASL, false }, { RRA, true }, } },
+    { { { CLV, false }, { LSR, false }, { CLV, false }, }, { { CLV, false }, { LSR, false }, } },
+    { { { CLV, false }, { LSR, false }, { ADC, true }, }, { { LSR, false }, { ADC, true }, } },
+    { { { CLV, false }, { LSR, false }, { SBC, true }, }, { { LSR, false }, { SBC, true }, } },
+    { { { CLV, false }, { LSR, false }, { BIT, true }, }, { { LSR, false }, { BIT, true }, } },
+    { { { CLV, false }, { LSR, false }, { ISC, true }, }, { { LSR, false }, { ISC, true }, } },
+    { { { CLV, false }, { LSR, false }, { RRA, true }, }, { { LSR, false }, { RRA, true }, } },
+    { { { CLV, false }, { ROL, false }, { CLV, false }, }, { { CLV, false }, { ROL, false }, } },
+    { { { CLV, false }, { ROL, false }, { ADC, true }, }, { { ROL, false }, { ADC, true }, } },
+    { { { CLV, false }, { ROL, false }, { SBC, true }, }, { { ROL, false }, { SBC, true }, } },
+    { { { CLV, false }, { ROL, false }, { BIT, true }, }, { { ROL, false }, { BIT, true }, } },
+    { { { CLV, false }, { ROL, false }, { ISC, true }, }, { { ROL, false }, { ISC, true }, } },
+    { { { CLV, false }, { ROL, false }, { RRA, true }, }, { { ROL, false }, { RRA, true }, } },
+    { { { CLV, false }, { ROR, false }, { CLV, false }, }, { { CLV, false }, { ROR, false }, } },
+    { { { CLV, false }, { ROR, false }, { ADC, true }, }, { { ROR, false }, { ADC, true }, } },
+    { { { CLV, false }, { ROR, false }, { SBC, true }, }, { { ROR, false }, { SBC, true }, } },
+    { { { CLV, false }, { ROR, false }, { BIT, true }, }, { { ROR, false }, { BIT, true }, } },
+    { { { CLV, false }, { ROR, false }, { ISC, true }, }, { { ROR, false }, { ISC, true }, } },
+    { { { CLV, false }, { ROR, false }, { RRA, true }, }, { { ROR, false }, { RRA, true }, } },
+    { { { CLV, false }, { LDA, true }, { CLV, false }, }, { { CLV, false }, { LDA, true }, } },
+    { { { CLV, false }, { LDA, true }, { ADC, true }, }, { { LDA, true }, { ADC, true }, } },
+    { { { CLV, false }, { LDA, true }, { SBC, true }, }, { { LDA, true }, { SBC, true }, } },
+    { { { CLV, false }, { LDA, true }, { BIT, true }, }, { { LDA, true }, { BIT, true }, } },
+    { { { CLV, false }, { LDA, true }, { ISC, true }, }, { { LDA, true }, { ISC, true }, } },
+    { { { CLV, false }, { LDA, true }, { RRA, true }, }, { { LDA, true }, { RRA, true }, } },
+    { { { CLV, false }, { LDX, true }, { CLV, false }, }, { { CLV, false }, { LDX, true }, } },
+    { { { CLV, false }, { LDX, true }, { ADC, true }, }, { { LDX, true }, { ADC, true }, } },
+    { { { CLV, false }, { LDX, true }, { SBC, true }, }, { { LDX, true }, { SBC, true }, } },
+    { { { CLV, false }, { LDX, true }, { BIT, true }, }, { { LDX, true }, { BIT, true }, } },
+    { { { CLV, false }, { LDX, true }, { ISC, true }, }, { { LDX, true }, { ISC, true }, } },
+    { { { CLV, false }, { LDX, true }, { RRA, true }, }, { { LDX, true }, { RRA, true }, } },
+    { { { CLV, false }, { LDY, true }, { CLV, false }, }, { { CLV, false }, { LDY, true }, } },
+    { { { CLV, false }, { LDY, true }, { ADC, true }, }, { { LDY, true }, { ADC, true }, } },
+    { { { CLV, false }, { LDY, true }, { SBC, true }, }, { { LDY, true }, { SBC, true }, } },
+    { { { CLV, false }, { LDY, true }, { BIT, true }, }, { { LDY, true }, { BIT, true }, } },
+    { { { CLV, false }, { LDY, true }, { ISC, true }, }, { { LDY, true }, { ISC, true }, } },
+    { { { CLV, false }, { LDY, true }, { RRA, true }, }, { { LDY, true }, { RRA, true }, } },
+    { { { CLV, false }, { LAX, true }, { CLV, false }, }, { { CLV, false }, { LAX, true }, } },
+    { { { CLV, false }, { LAX, true }, { ADC, true }, }, { { LAX, true }, { ADC, true }, } },
+    { { { CLV, false }, { LAX, true }, { SBC, true }, }, { { LAX, true }, { SBC, true }, } },
+    { { { CLV, false }, { LAX, true }, { BIT, true }, }, { { LAX, true }, { BIT, true }, } },
+    { { { CLV, false }, { LAX, true }, { ISC, true }, }, { { LAX, true }, { ISC, true }, } },
+    { { { CLV, false }, { LAX, true }, { RRA, true }, }, { { LAX, true }, { RRA, true }, } },
+    { { { CLV, false }, { STA, true }, { CLV, false }, }, { { CLV, false }, { STA, true }, } },
+    { { { CLV, false }, { STA, true }, { ADC, true }, }, { { STA, true }, { ADC, true }, } },
+    { { { CLV, false }, { STA, true }, { SBC, true }, }, { { STA, true }, { SBC, true }, } },
+    { { { CLV, false }, { STA, true }, { BIT, true }, }, { { STA, true }, { BIT, true }, } },
+    { { { CLV, false }, { STA, true }, { ISC, true }, }, { { STA, true }, { ISC, true }, } },
+    { { { CLV, false }, { STA, true }, { RRA, true }, }, { { STA, true }, { RRA, true }, } },
+    { { { CLV, false }, { STX, true }, { CLV, false }, }, { { CLV, false }, { STX, true }, } },
+    { { { CLV, false }, { STY, true }, { CLV, false }, }, { { CLV, false }, { STY, true }, } },
+    { { { CLV, false }, { SAX, true }, { CLV, false }, }, { { CLV, false }, { SAX, true }, } },
+    { { { CLV, false }, { INC, true }, { CLV, false }, }, { { CLV, false }, { INC, true }, } },
+    { { { CLV, false }, { INC, true }, { ADC, true }, }, { { INC, true }, { ADC, true }, } },
+    { { { CLV, false }, { INC, true }, { BIT, true }, }, { { INC, true }, { BIT, true }, } },
+    { { { CLV, false }, { INC, true }, { ISC, true }, }, { { INC, true }, { ISC, true }, } },
+    { { { CLV, false }, { INC, true }, { RRA, true }, }, { { INC, true }, { RRA, true }, } },
+    { { { CLV, false }, { DEC, true }, { CLV, false }, }, { { CLV, false }, { DEC, true }, } },
+    { { { CLV, false }, { DEC, true }, { ADC, true }, }, { { DEC, true }, { ADC, true }, } },
+    { { { CLV, false }, { DEC, true }, { SBC, true }, }, { { DEC, true }, { SBC, true }, } },
+    { { { CLV, false }, { DEC, true }, { BIT, true }, }, { { DEC, true }, { BIT, true }, } },
+    { { { CLV, false }, { DEC, true }, { RRA, true }, }, { { DEC, true }, { RRA, true }, } },
+    { { { CLV, false }, { ASL, true }, { CLV, false }, }, { { CLV, false }, { ASL, true }, } },
+    { { { CLV, false }, { ASL, true }, { ADC, true }, }, { { ASL, true }, { ADC, true }, } },
+    { { { CLV, false }, { ASL, true }, { SBC, true }, }, { { ASL, true }, { SBC, true }, } },
+    { { { CLV, false }, { ASL, true }, { BIT, true }, }, { { ASL, true }, { BIT, true }, } },
+    { { { CLV, false }, { ASL, true }, { ISC, true }, }, { { ASL, true }, { ISC, true }, } },
+    { { { CLV, false }, { LSR, true }, { CLV, false }, }, { { CLV, false }, { LSR, true }, } },
+    { { { CLV, false }, { LSR, true }, { SBC, true }, }, { { LSR, true }, { SBC, true }, } },
+    { { { CLV, false }, { LSR, true }, { BIT, true }, }, { { LSR, true }, { BIT, true }, } },
+    { { { CLV, false }, { LSR, true }, { ISC, true }, }, { { LSR, true }, { ISC, true }, } },
+    { { { CLV, false }, { LSR, true }, { RRA, true }, }, { { LSR, true }, { RRA, true }, } },
+    { { { CLV, false }, { ROL, true }, { CLV, false }, }, { { CLV, false }, { ROL, true }, } },
+    { { { CLV, false }, { ROL, true }, { ADC, true }, }, { { ROL, true }, { ADC, true }, } },
+    { { { CLV, false }, { ROL, true }, { SBC, true }, }, { { ROL, true }, { SBC, true }, } },
+    { { { CLV, false }, { ROL, true }, { BIT, true }, }, { { ROL, true }, { BIT, true }, } },
+    { { { CLV, false }, { ROL, true }, { ISC, true }, }, { { ROL, true }, { ISC, true }, } },
+    { { { CLV, false }, { ROR, true }, { CLV, false }, }, { { CLV, false }, { ROR, true }, } },
+    { { { CLV, false }, { ROR, true }, { SBC, true }, }, { { ROR, true }, { SBC, true }, } },
+    { { { CLV, false }, { ROR, true }, { BIT, true }, }, { { ROR, true }, { BIT, true }, } },
+    { { { CLV, false }, { ROR, true }, { ISC, true }, }, { { ROR, true }, { ISC, true }, } },
+    { { { CLV, false }, { ROR, true }, { RRA, true }, }, { { ROR, true }, { RRA, true }, } },
+    { { { CLV, false }, { ADC, true }, {}, }, { { ADC, true }, {}, } },
+    { { { CLV, false }, { SBC, true }, {}, }, { { SBC, true }, {}, } },
+    { { { CLV, false }, { AND, true }, { CLV, false }, }, { { CLV, false }, { AND, true }, } },
+    { { { CLV, false }, { AND, true }, { ADC, true }, }, { { AND, true }, { ADC, true }, } },
+    { { { CLV, false }, { AND, true }, { SBC, true }, }, { { AND, true }, { SBC, true }, } },
+    { { { CLV, false }, { AND, true }, { BIT, true }, }, { { AND, true }, { BIT, true }, } },
+    { { { CLV, false }, { AND, true }, { ISC, true }, }, { { AND, true }, { ISC, true }, } },
+    { { { CLV, false }, { AND, true }, { RRA, true }, }, { { AND, true }, { RRA, true }, } },
+    { { { CLV, false }, { ORA, true }, { CLV, false }, }, { { CLV, false }, { ORA, true }, } },
+    { { { CLV, false }, { ORA, true }, { ADC, true }, }, { { ORA, true }, { ADC, true }, } },
+    { { { CLV, false }, { ORA, true }, { SBC, true }, }, { { ORA, true }, { SBC, true }, } },
+    { { { CLV, false }, { ORA, true }, { BIT, true }, }, { { ORA, true }, { BIT, true }, } },
+    { { { CLV, false }, { ORA, true }, { ISC, true }, }, { { ORA, true }, { ISC, true }, } },
+    { { { CLV, false }, { ORA, true }, { RRA, true }, }, { { ORA, true }, { RRA, true }, } },
+    { { { CLV, false }, { EOR, true }, { CLV, false }, }, { { CLV, false }, { EOR, true }, } },
+    { { { CLV, false }, { EOR, true }, { ADC, true }, }, { { EOR, true }, { ADC, true }, } },
+    { { { CLV, false }, { EOR, true }, { SBC, true }, }, { { EOR, true }, { SBC, true }, } },
+    { { { CLV, false }, { EOR, true }, { BIT, true }, }, { { EOR, true }, { BIT, true }, } },
+    { { { CLV, false }, { EOR, true }, { ISC, true }, }, { { EOR, true }, { ISC, true }, } },
+    { { { CLV, false }, { EOR, true }, { RRA, true }, }, { { EOR, true }, { RRA, true }, } },
+    { { { CLV, false }, { CMP, true }, { CLV, false }, }, { { CLV, false }, { CMP, true }, } },
+    { { { CLV, false }, { CMP, true }, { ADC, true }, }, { { CMP, true }, { ADC, true }, } },
+    { { { CLV, false }, { CMP, true }, { SBC, true }, }, { { CMP, true }, { SBC, true }, } },
+    { { { CLV, false }, { CMP, true }, { BIT, true }, }, { { CMP, true }, { BIT, true }, } },
+    { { { CLV, false }, { CMP, true }, { ISC, true }, }, { { CMP, true }, { ISC, true }, } },
+    { { { CLV, false }, { CMP, true }, { RRA, true }, }, { { CMP, true }, { RRA, true }, } },
+    { { { CLV, false }, { CPX, true }, { CLV, false }, }, { { CLV, false }, { CPX, true }, } },
+    { { { CLV, false }, { CPY, true }, { CLV, false }, }, { { CLV, false }, { CPY, true }, } },
+    { { { CLV, false }, { BIT, true }, {}, }, { { BIT, true }, {}, } },
+    { { { CLV, false }, { DCP, true }, { CLV, false }, }, { { CLV, false }, { DCP, true }, } },
+    { { { CLV, false }, { DCP, true }, { ADC, true }, }, { { DCP, true }, { ADC, true }, } },
+    { { { CLV, false }, { DCP, true }, { SBC, true }, }, { { DCP, true }, { SBC, true }, } },
+    { { { CLV, false }, { DCP, true }, { BIT, true }, }, { { DCP, true }, { BIT, true }, } },
+    { { { CLV, false }, { DCP, true }, { ISC, true }, }, { { DCP, true }, { ISC, true }, } },
+    { { { CLV, false }, { DCP, true }, { RRA, true }, }, { { DCP, true }, { RRA, true }, } },
+    { { { CLV, false }, { ISC, true }, {}, }, { { ISC, true }, {}, } },
+    { { { CLV, false }, { SLO, true }, { CLV, false }, }, { { CLV, false }, { SLO, true }, } },
+    { { { CLV, false }, { SLO, true }, { ADC, true }, }, { { SLO, true }, { ADC, true }, } },
+    { { { CLV, false }, { SLO, true }, { SBC, true }, }, { { SLO, true }, { SBC, true }, } },
+    { { { CLV, false }, { SLO, true }, { BIT, true }, }, { { SLO, true }, { BIT, true }, } },
+    { { { CLV, false }, { SLO, true }, { ISC, true }, }, { { SLO, true }, { ISC, true }, } },
+    { { { CLV, false }, { SLO, true }, { RRA, true }, }, { { SLO, true }, { RRA, true }, } },
+    { { { CLV, false }, { RLA, true }, { CLV, false }, }, { { CLV, false }, { RLA, true }, } },
+    { { { CLV, false }, { RLA, true }, { ADC, true }, }, { { RLA, true }, { ADC, true }, } },
+    { { { CLV, false }, { RLA, true }, { SBC, true }, }, { { RLA, true }, { SBC, true }, } },
+    { { { CLV, false }, { RLA, true }, { BIT, true }, }, { { RLA, true }, { BIT, true }, } },
+    { { { CLV, false }, { RLA, true }, { ISC, true }, }, { { RLA, true }, { ISC, true }, } },
+    { { { CLV, false }, { RLA, true }, { RRA, true }, }, { { RLA, true }, { RRA, true }, } },
+    { { { CLV, false }, { SRE, true }, { CLV, false }, }, { { CLV, false }, { SRE, true }, } },
+    { { { CLV, false }, { SRE, true }, { ADC, true }, }, { { SRE, true }, { ADC, true }, } },
+    { { { CLV, false }, { SRE, true }, { SBC, true }, }, { { SRE, true }, { SBC, true }, } },
+    { { { CLV, false }, { SRE, true }, { BIT, true }, }, { { SRE, true }, { BIT, true }, } },
+    { { { CLV, false }, { SRE, true }, { ISC, true }, }, { { SRE, true }, { ISC, true }, } },
+    { { { CLV, false }, { SRE, true }, { RRA, true }, }, { { SRE, true }, { RRA, true }, } },
+    { { { CLV, false }, { RRA, true }, {}, }, { { RRA, true }, {}, } },
+    { { { ASL, false }, { TXA, false }, { CLC, false }, }, { { TXA, false }, { CLC, false }, } },
+    { { { ASL, false }, { TXA, false }, { SEC, false }, }, { { TXA, false }, { SEC, false }, } },
+    { { { ASL, false }, { TXA, false }, { ASL, false }, }, { { TXA, false }, { ASL, false }, } },
+    { { { ASL, false }, { TXA, false }, { LSR, false }, }, { { TXA, false }, { LSR, false }, } },
+    { { { ASL, false }, { TYA, false }, { CLC, false }, }, { { TYA, false }, { CLC, false }, } },
+    { { { ASL, false }, { TYA, false }, { SEC, false }, }, { { TYA, false }, { SEC, false }, } },
+    { { { ASL, false }, { TYA, false }, { ASL, false }, }, { { TYA, false }, { ASL, false }, } },
+    { { { ASL, false }, { TYA, false }, { LSR, false }, }, { { TYA, false }, { LSR, false }, } },
+    { { { ASL, false }, { CLC, false }, { TXA, false }, }, { { TXA, false }, { CLC, false }, } },
+    { { { ASL, false }, { CLC, false }, { TYA, false }, }, { { TYA, false }, { CLC, false }, } },
+    { { { ASL, false }, { CLC, false }, { LDA, true }, }, { { CLC, false }, { LDA, true }, } },
+    { { { ASL, false }, { CLC, false }, { LAX, true }, }, { { CLC, false }, { LAX, true }, } },
+    { { { ASL, false }, { SEC, false }, { TXA, false }, }, { { TXA, false }, { SEC, false }, } },
+    { { { ASL, false }, { SEC, false }, { TYA, false }, }, { { TYA, false }, { SEC, false }, } },
+    { { { ASL, false }, { SEC, false }, { LDA, true }, }, { { SEC, false }, { LDA, true }, } },
+    { { { ASL, false }, { SEC, false }, { LAX, true }, }, { { SEC, false }, { LAX, true }, } },
+    { { { ASL, false }, { ASL, false }, { ROR, false }, }, { { ASL, false }, { CLC, false }, } },
+    { { { ASL, false }, { LSR, false }, { TXA, false }, }, { { TXA, false }, { CLC, false }, } },
+    { { { ASL, false }, { LSR, false }, { TYA, false }, }, { { TYA, false }, { CLC, false }, } },
+    { { { ASL, false }, { LSR, false }, { CLC, false }, }, { { ASL, false }, { LSR, false }, } },
+    { { { ASL, false }, { LSR, false }, { ASL, false }, }, { { ASL, false }, { CLC, false }, } },
+    { { { ASL, false }, { LSR, false }, { ROL, false }, }, { { ASL, false }, { CLC, false }, } },
+    { { { ASL, false }, { LSR, false }, { LDA, true }, }, { { CLC, false }, { LDA, true }, } },
+    { { { ASL, false }, { LSR, false }, { LAX, true }, }, { { CLC, false }, { LAX, true }, } },
+    { { { ASL, false }, { ROL, false }, { ROR, false }, }, { { ASL, false }, {}, } },
+    { { { ASL, false }, { ROR, false }, { TAX, false }, }, { { TAX, false }, { CLC, false }, } },
+    { { { ASL, false }, { ROR, false }, { TAY, false }, }, { { TAY, false }, { CLC, false }, } },
+    { { { ASL, false }, { ROR, false }, { TXA, false }, }, { { TXA, false }, { CLC, false }, } },
+    { { { ASL, false }, { ROR, false }, { TYA, false }, }, { { TYA, false }, { CLC, false }, } },
+    { { { ASL, false }, { ROR, false }, { INX, false }, }, { { INX, false }, { CLC, false }, } },
+    { { { ASL, false }, { ROR, false }, { INY, false }, }, { { INY, false }, { CLC, false }, } },
+    { { { ASL, false }, { ROR, false }, { DEX, false }, }, { { DEX, false }, { CLC, false }, } },
+    { { { ASL, false }, { ROR, false }, { DEY, false }, }, { { DEY, false }, { CLC, false }, } },
+    { { { ASL, false }, { ROR, false }, { CLC, false }, }, { { ASL, false }, { ROR, false }, } },
+    { { { ASL, false }, { ROR, false }, { ASL, false }, }, { { ASL, false }, {}, } },
+    { { { ASL, false }, { ROR, false }, { LSR, false }, }, { { LSR, false }, {}, } },
+    { { { ASL, false }, { ROR, false }, { ROL, false }, }, { { ASL, false }, {}, } },
+    { { { ASL, false }, { ROR, false }, { ROR, false }, }, { { LSR, false }, {}, } },
+    { { { ASL, false }, { ROR, false }, { LDA, true }, }, { { CLC, false }, { LDA, true }, } },
+    { { { ASL, false }, { ROR, false }, { LDX, true }, }, { { CLC, false }, { LDX, true }, } },
+    { { { ASL, false }, { ROR, false }, { LDY, true }, }, { { CLC, false }, { LDY, true }, } },
+    { { { ASL, false }, { ROR, false }, { LAX, true }, }, { { CLC, false }, { LAX, true }, } },
+    { { { ASL, false }, { ROR, false }, { INC, true }, }, { { CLC, false }, { INC, true }, } },
+    { { { ASL, false }, { ROR, false }, { DEC, true }, }, { { CLC, false }, { DEC, true }, } },
+    { { { ASL, false }, { ROR, false }, { ASL, true }, }, { { ASL, true }, {}, } },
+    { { { ASL, false }, { ROR, false }, { LSR, true }, }, { { LSR, true }, {}, } },
+    { { { ASL, false }, { ROR, false }, { ROL, true }, }, { { ASL, true }, {}, } },
+    { { { ASL, false }, { ROR, false }, { ROR, true }, }, { { LSR, true }, {}, } },
+    { { { ASL, false }, { ROR, false }, { ADC, true }, }, { { CLC, false }, { ADC, true }, } },
+    { { { ASL, false }, { ROR, false }, { SBC, true }, }, { { CLC, false }, { SBC, true }, } },
+    { { { ASL, false }, { ROR, false }, { AND, true }, }, { { CLC, false }, { AND, true }, } },
+    { { { ASL, false }, { ROR, false }, { ORA, true }, }, { { CLC, false }, { ORA, true }, } },
+    { { { ASL, false }, { ROR, false }, { EOR, true }, }, { { CLC, false }, { EOR, true }, } },
+    { { { ASL, false }, { ROR, false }, { CMP, true }, }, { { CMP, true }, {}, } },
+    { { { ASL, false }, { ROR, false }, { BIT, true }, }, { { CLC, false }, { BIT, true }, } },
+    { { { ASL, false }, { ROR, false }, { DCP, true }, }, { { DCP, true }, {}, } },
+    { { { ASL, false }, { ROR, false }, { ISC, true }, }, { { CLC, false }, { ISC, true }, } },
+    { { { ASL, false }, { ROR, false }, { SLO, true }, }, { { SLO, true }, {}, } },
+    { { { ASL, false }, { ROR, false }, { RLA, true }, }, { { CLC, false }, { RLA, true }, } },
+    { { { ASL, false }, { ROR, false }, { SRE, true }, }, { { SRE, true }, {}, } },
+    { { { ASL, false }, { ROR, false }, { RRA, true }, }, { { CLC, false }, { RRA, true }, } },
+    { { { ASL, false }, { LDA, true }, { CLC, false }, }, { { CLC, false }, { LDA, true }, } },
+    { { { ASL, false }, { LDA, true }, { SEC, false }, }, { { SEC, false }, { LDA, true }, } },
+    { { { ASL, false }, { LDA, true }, { ASL, false }, }, { { LDA, true }, { ASL, false }, } },
+    { { { ASL, false }, { LDA, true }, { LSR, false }, }, { { LDA, true }, { LSR, false }, } },
+    { { { ASL, false }, { LDA, true }, { ASL, true }, }, { { LDA, true }, { ASL, true }, } },
+    { { { ASL, false }, { LDA, true }, { LSR, true }, }, { { LDA, true }, { LSR, true }, } },
+    { { { ASL, false }, { LDA, true }, { CMP, true }, }, { { LDA, true }, { CMP, true }, } },
+    { { { ASL, false }, { LDA, true }, { DCP, true }, }, { { LDA, true }, { DCP, true }, } },
+    { { { ASL, false }, { LDA, true }, { SLO, true }, }, { { LDA, true }, { SLO, true }, } },
+    { { { ASL, false }, { LDA, true }, { SRE, true }, }, { { LDA, true }, { SRE, true }, } },
+    { { { ASL, false }, { LAX, true }, { CLC, false }, }, { { CLC, false }, { LAX, true }, } },
+    { { { ASL, false }, { LAX, true }, { SEC, false }, }, { { SEC, false }, { LAX, true }, } },
+    { { { ASL, false }, { LAX, true }, { ASL, false }, }, { { LAX, true }, { ASL, false }, } },
+    { { { ASL, false }, { LAX, true }, { LSR, false }, }, { { LAX, true }, { LSR, false }, } },
+    { { { ASL, false }, { LAX, true }, { ASL, true }, }, { { LAX, true }, { ASL, true }, } },
+    { { { ASL, false }, { LAX, true }, { LSR, true }, }, { { LAX, true }, { LSR, true }, } },
+    { { { ASL, false }, { LAX, true }, { CMP, true }, }, { { LAX, true }, { CMP, true }, } },
+    { { { ASL, false }, { LAX, true }, { DCP, true }, }, { { LAX, true }, { DCP, true }, } },
+    { { { ASL, false }, { LAX, true }, { SLO, true }, }, { { LAX, true }, { SLO, true }, } },
+    { { { ASL, false }, { LAX, true }, { SRE, true }, }, { { LAX, true }, { SRE, true }, } },
+    { { { ASL, false }, { STA, true }, { LDA, true }, }, { { ASL, false }, { STA, true }, } },
+    { { { ASL, false }, { STA, true }, { AND, true }, }, { { ASL, false }, { STA, true }, } },
+    { { { ASL, false }, { STA, true }, { ORA, true }, }, { { ASL, false }, { STA, true }, } },
+    { { { ASL, false }, { ASL, true }, { LDA, true }, }, { { ASL, true }, { LDA, true }, } },
+    { { { ASL, false }, { ASL, true }, { LAX, true }, }, { { ASL, true }, { LAX, true }, } },
+    { { { ASL, false }, { LSR, true }, { LDA, true }, }, { { LSR, true }, { LDA, true }, } },
+    { { { ASL, false }, { LSR, true }, { LAX, true }, }, { { LSR, true }, { LAX, true }, } },
+    { { { ASL, false }, { SLO, true }, { LDA, true }, }, { { ASL, true }, { LDA, true }, } },
+    { { { ASL, false }, { SLO, true }, { LAX, true }, }, { { ASL, true }, { LAX, true }, } },
+    { { { ASL, false }, { SLO, true }, { AND, true }, }, { { ASL, true }, { LDA, true }, } },
+    { { { ASL, false }, { SRE, true }, { LDA, true }, }, { { LSR, true }, { LDA, true }, } },
+    { { { ASL, false }, { SRE, true }, { LAX, true }, }, { { LSR, true }, { LAX, true }, } },
+    { { { LSR, false }, { TXA, false }, { CLC, false }, }, { { TXA, false }, { CLC, false }, } },
+    { { { LSR, false }, { TXA, false }, { SEC, false }, }, { { TXA, false }, { SEC, false }, } },
+    { { { LSR, false }, { TXA, false }, { ASL, false }, }, { { TXA, false }, { ASL, false }, } },
+    { { { LSR, false }, { TXA, false }, { LSR, false }, }, { { TXA, false }, { LSR, false }, } },
+    { { { LSR, false }, { TYA, false }, { CLC, false }, }, { { TYA, false }, { CLC, false }, } },
+    { { { LSR, false }, { TYA, false }, { SEC, false }, }, { { TYA, false }, { SEC, false }, } },
+    { { { LSR, false }, { TYA, false }, { ASL, false }, }, { { TYA, false }, { ASL, false }, } },
+    { { { LSR, false }, { TYA, false }, { LSR, false }, }, { { TYA, false }, { LSR, false }, } },
+    { { { LSR, false }, { CLC, false }, { TXA, false }, }, { { TXA, false }, { CLC, false }, } },
+    { { { LSR, false }, { CLC, false }, { TYA, false }, }, { { TYA, false }, { CLC, false }, } },
+    { { { LSR, false }, { CLC, false }, { LDA, true }, }, { { CLC, false }, { LDA, true }, } },
+    { { { LSR, false }, { CLC, false }, { LAX, true }, }, { { CLC, false }, { LAX, true }, } },
+    { { { LSR, false }, { SEC, false }, { TXA, false }, }, { { TXA, false }, { SEC, false }, } },
+    { { { LSR, false }, { SEC, false }, { TYA, false }, }, { { TYA, false }, { SEC, false }, } },
+    { { { LSR, false }, { SEC, false }, { LDA, true }, }, { { SEC, false }, { LDA, true }, } },
+    { { { LSR, false }, { SEC, false }, { LAX, true }, }, { { SEC, false }, { LAX, true }, } },
+    { { { LSR, false }, { ASL, false }, { TXA, false }, }, { { TXA, false }, { CLC, false }, } },
+    { { { LSR, false }, { ASL, false }, { TYA, false }, }, { { TYA, false }, { CLC, false }, } },
+    { { { LSR, false }, { ASL, false }, { CLC, false }, }, { { LSR, false }, { ASL, false }, } },
+    { { { LSR, false }, { ASL, false }, { LSR, false }, }, { { LSR, false }, { CLC, false }, } },
+    { { { LSR, false }, { ASL, false }, { ROR, false }, }, { { LSR, false }, { CLC, false }, } },
+    { { { LSR, false }, { ASL, false }, { LDA, true }, }, { { CLC, false }, { LDA, true }, } },
+    { { { LSR, false }, { ASL, false }, { LAX, true }, }, { { CLC, false }, { LAX, true }, } },
+    { { { LSR, false }, { ASL, false }, { RLA, true }, }, { { CLC, false }, { RLA, true }, } },
+    { { { LSR, false }, { LSR, false }, { ROL, false }, }, { { LSR, false }, { CLC, false }, } },
+    { { { LSR, false }, { ROL, false }, { TAX, false }, }, { { TAX, false }, { CLC, false }, } },
+    { { { LSR, false }, { ROL, false }, { TAY, false }, }, { { TAY, false }, { CLC, false }, } },
+    { { { LSR, false }, { ROL, false }, { TXA, false }, }, { { TXA, false }, { CLC, false }, } },
+    { { { LSR, false }, { ROL, false }, { TYA, false }, }, { { TYA, false }, { CLC, false }, } },
+    { { { LSR, false }, { ROL, false }, { INX, false }, }, { { INX, false }, { CLC, false }, } },
+    { { { LSR, false }, { ROL, false }, { INY, false }, }, { { INY, false }, { CLC, false }, } },
+    { { { LSR, false }, { ROL, false }, { DEX, false }, }, { { DEX, false }, { CLC, false }, } },
+    { { { LSR, false }, { ROL, false }, { DEY, false }, }, { { DEY, false }, { CLC, false }, } },
+    { { { LSR, false }, { ROL, false }, { CLC, false }, }, { { ASL, false }, { ROR, false }, } },
+    { { { LSR, false }, { ROL, false }, { ASL, false }, }, { { ASL, false }, {}, } },
+    { { { LSR, false }, { ROL, false }, { LSR, false }, }, { { LSR, false }, {}, } },
+    { { { LSR, false }, { ROL, false }, { ROL, false }, }, { { ASL, false }, {}, } },
+    { { { LSR, false }, { ROL, false }, { ROR, false }, }, { { LSR, false }, {}, } },
+    { { { LSR, false }, { ROL, false }, { LDA, true }, }, { { CLC, false }, { LDA, true }, } },
+    { { { LSR, false }, { ROL, false }, { LDX, true }, }, { { CLC, false }, { LDX, true }, } },
+    { { { LSR, false }, { ROL, false }, { LDY, true }, }, { { CLC, false }, { LDY, true }, } },
+    { { { LSR, false }, { ROL, false }, { LAX, true }, }, { { CLC, false }, { LAX, true }, } },
+    { { { LSR, false }, { ROL, false }, { INC, true }, }, { { CLC, false }, { INC, true }, } },
+    { { { LSR, false }, { ROL, false }, { DEC, true }, }, { { CLC, false }, { DEC, true }, } },
+    { { { LSR, false }, { ROL, false }, { ASL, true }, }, { { ASL, true }, {}, } },
+    { { { LSR, false }, { ROL, false }, { LSR, true }, }, { { LSR, true }, {}, } },
+    { { { LSR, false }, { ROL, false }, { ROL, true }, }, { { ASL, true }, {}, } },
+    { { { LSR, false }, { ROL, false }, { ROR, true }, }, { { LSR, true }, {}, } },
+    { { { LSR, false }, { ROL, false }, { ADC, true }, }, { { CLC, false }, { ADC, true }, } },
+    { { { LSR, false }, { ROL, false }, { SBC, true }, }, { { CLC, false }, { SBC, true }, } },
+    { { { LSR, false }, { ROL, false }, { AND, true }, }, { { CLC, false }, { AND, true }, } },
+    { { { LSR, false }, { ROL, false }, { ORA, true }, }, { { CLC, false }, { ORA, true }, } },
+    { { { LSR, false }, { ROL, false }, { EOR, true }, }, { { CLC, false }, { EOR, true }, } },
+    { { { LSR, false }, { ROL, false }, { CMP, true }, }, { { CMP, true }, {}, } },
+    { { { LSR, false }, { ROL, false }, { BIT, true }, }, { { CLC, false }, { BIT, true }, } },
+    { { { LSR, false }, { ROL, false }, { DCP, true }, }, { { DCP, true }, {}, } },
+    { { { LSR, false }, { ROL, false }, { ISC, true }, }, { { CLC, false }, { ISC, true }, } },
+    { { { LSR, false }, { ROL, false }, { SLO, true }, }, { { SLO, true }, {}, } },
+    { { { LSR, false }, { ROL, false }, { RLA, true }, }, { { CLC, false }, { RLA, true }, } },
+    { { { LSR, false }, { ROL, false }, { SRE, true }, }, { { SRE, true }, {}, } },
+    { { { LSR, false }, { ROL, false }, { RRA, true }, }, { { CLC, false }, { RRA, true }, } },
+    { { { LSR, false }, { ROR, false }, { ROL, false }, }, { { LSR, false }, {}, } },
+    { { { LSR, false }, { LDA, true }, { CLC, false }, }, { { CLC, false }, { LDA, true }, } },
+    { { { LSR, false }, { LDA, true }, { SEC, false }, }, { { SEC, false }, { LDA, true }, } },
+    { { { LSR, false }, { LDA, true }, { ASL, false }, }, { { LDA, true }, { ASL, false }, } },
+    { { { LSR, false }, { LDA, true }, { LSR, false }, }, { { LDA, true }, { LSR, false }, } },
+    { { { LSR, false }, { LDA, true }, { ASL, true }, }, { { LDA, true }, { ASL, true }, } },
+    { { { LSR, false }, { LDA, true }, { LSR, true }, }, { { LDA, true }, { LSR, true }, } },
+    { { { LSR, false }, { LDA, true }, { CMP, true }, }, { { LDA, true }, { CMP, true }, } },
+    { { { LSR, false }, { LDA, true }, { DCP, true }, }, { { LDA, true }, { DCP, true }, } },
+    { { { LSR, false }, { LDA, true }, { SLO, true }, }, { { LDA, true }, { SLO, true }, } },
+    { { { LSR, false }, { LDA, true }, { SRE, true }, }, { { LDA, true }, { SRE, true }, } },
+    { { { LSR, false }, { LAX, true }, { CLC, false }, }, { { CLC, false }, { LAX, true }, } },
+    { { { LSR, false }, { LAX, true }, { SEC, false }, }, { { SEC, false }, { LAX, true }, } },
+    { { { LSR, false }, { LAX, true }, { ASL, false }, }, { { LAX, true }, { ASL, false }, } },
+    { { { LSR, false }, { LAX, true }, { LSR, false }, }, { { LAX, true }, { LSR, false }, } },
+    { { { LSR, false }, { LAX, true }, { ASL, true }, }, { { LAX, true }, { ASL, true }, } },
+    { { { LSR, false }, { LAX, true }, { LSR, true }, }, { { LAX, true }, { LSR, true }, } },
+    { { { LSR, false }, { LAX, true }, { CMP, true }, }, { { LAX, true }, { CMP, true }, } },
+    { { { LSR, false }, { LAX, true }, { DCP, true }, }, { { LAX, true }, { DCP, true }, } },
+    { { { LSR, false }, { LAX, true }, { SLO, true }, }, { { LAX, true }, { SLO, true }, } },
+    { { { LSR, false }, { LAX, true }, { SRE, true }, }, { { LAX, true }, { SRE, true }, } },
+    { { { LSR, false }, { STA, true }, { LDA, true }, }, { { LSR, false }, { STA, true }, } },
+    { { { LSR, false }, { STA, true }, { AND, true }, }, { { LSR, false }, { STA, true }, } },
+    { { { LSR, false }, { STA, true }, { ORA, true }, }, { { LSR, false }, { STA, true }, } },
+    { { { LSR, false }, { ASL, true }, { LDA, true }, }, { { ASL, true }, { LDA, true }, } },
+    { { { LSR, false }, { ASL, true }, { LAX, true }, }, { { ASL, true }, { LAX, true }, } },
+    { { { LSR, false }, { LSR, true }, { LDA, true }, }, { { LSR, true }, { LDA, true }, } },
+    { { { LSR, false }, { LSR, true }, { LAX, true }, }, { { LSR, true }, { LAX, true }, } },
+    { { { LSR, false }, { SLO, true }, { LDA, true }, }, { { ASL, true }, { LDA, true }, } },
+    { { { LSR, false }, { SLO, true }, { LAX, true }, }, { { ASL, true }, { LAX, true }, } },
+    { { { LSR, false }, { SLO, true }, { AND, true }, }, { { ASL, true }, { LDA, true }, } },
+    { { { LSR, false }, { SRE, true }, { LDA, true }, }, { { LSR, true }, { LDA, true }, } },
+    { { { LSR, false }, { SRE, true }, { LAX, true }, }, { { LSR, true }, { LAX, true }, } },
+    { { { ROL, false }, { TXA, false }, { CLC, false }, }, { { TXA, false }, { CLC, false }, } },
+    { { { ROL, false }, { TXA, false }, { SEC, false }, }, { { TXA, false }, { SEC, false }, } },
+    { { { ROL, false }, { TXA, false }, { ASL, false }, }, { { TXA, false }, { ASL, false }, } },
+    { { { ROL, false }, { TXA, false }, { LSR, false }, }, { { TXA, false }, { LSR, false }, } },
+    { { { ROL, false }, { TYA, false }, { CLC, false }, }, { { TYA, false }, { CLC, false }, } },
+    { { { ROL, false }, { TYA, false }, { SEC, false }, }, { { TYA, false }, { SEC, false }, } },
+    { { { ROL, false }, { TYA, false }, { ASL, false }, }, { { TYA, false }, { ASL, false }, } },
+    { { { ROL, false }, { TYA, false }, { LSR, false }, }, { { TYA, false }, { LSR, false }, } },
+    { { { ROL, false }, { CLC, false }, { TXA, false }, }, { { TXA, false }, { CLC, false }, } },
+    { { { ROL, false }, { CLC, false }, { TYA, false }, }, { { TYA, false }, { CLC, false }, } },
+    { { { ROL, false }, { CLC, false }, { LDA, true }, }, { { CLC, false }, { LDA, true }, } },
+    { { { ROL, false }, { CLC, false }, { LAX, true }, }, { { CLC, false }, { LAX, true }, } },
+    { { { ROL, false }, { SEC, false }, { TXA, false }, }, { { TXA, false }, { SEC, false }, } },
+    { { { ROL, false }, { SEC, false }, { TYA, false }, }, { { TYA, false }, { SEC, false }, } },
+    { { { ROL, false }, { SEC, false }, { LDA, true }, }, { { SEC, false }, { LDA, true }, } },
+    { { { ROL, false }, { SEC, false }, { LAX, true }, }, { { SEC, false }, { LAX, true }, } },
+    { { { ROL, false }, { ASL, false }, { ROR, false }, }, { { ROL, false }, { CLC, false }, } },
+    { { { ROL, false }, { LSR, false }, { TXA, false }, }, { { TXA, false }, {}, } },
+    { { { ROL, false }, { LSR, false }, { TYA, false }, }, { { TYA, false }, {}, } },
+    { { { ROL, false }, { LSR, false }, { CLC, false }, }, { { ASL, false }, { LSR, false }, } },
+    { { { ROL, false }, { LSR, false }, { ASL, false }, }, { { ASL, false }, { CLC, false }, } },
+    { { { ROL, false }, { LSR, false }, { ROL, false }, }, { { ROL, false }, { CLC, false }, } },
+    { { { ROL, false }, { LSR, false }, { LDA, true }, }, { { LDA, true }, {}, } },
+    { { { ROL, false }, { LSR, false }, { LAX, true }, }, { { LAX, true }, {}, } },
+    { { { ROL, false }, { ROL, false }, { ROR, false }, }, { { ROL, false }, {}, } },
+    { { { ROL, false }, { ROR, false }, { TAX, false }, }, { { TAX, false }, {}, } },
+    { { { ROL, false }, { ROR, false }, { TAY, false }, }, { { TAY, false }, {}, } },
+    { { { ROL, false }, { ROR, false }, { TXA, false }, }, { { TXA, false }, {}, } },
+    { { { ROL, false }, { ROR, false }, { TYA, false }, }, { { TYA, false }, {}, } },
+    { { { ROL, false }, { ROR, false }, { INX, false }, }, { { INX, false }, {}, } },
+    { { { ROL, false }, { ROR, false }, { INY, false }, }, { { INY, false }, {}, } },
+    { { { ROL, false }, { ROR, false }, { DEX, false }, }, { { DEX, false }, {}, } },
+    { { { ROL, false }, { ROR, false }, { DEY, false }, }, { { DEY, false }, {}, } },
+    { { { ROL, false }, { ROR, false }, { CLC, false }, }, { { ASL, false }, { ROR, false }, } },
+    { { { ROL, false }, { ROR, false }, { ASL, false }, }, { { ASL, false }, {}, } },
+    { { { ROL, false }, { ROR, false }, { LSR, false }, }, { { LSR, false }, {}, } },
+    { { { ROL, false }, { ROR, false }, { ROL, false }, }, { { ROL, false }, {}, } },
+    { { { ROL, false }, { ROR, false }, { ROR, false }, }, { { ROR, false }, {}, } },
+    { { { ROL, false }, { ROR, false }, { LDA, true }, }, { { LDA, true }, {}, } },
+    { { { ROL, false }, { ROR, false }, { LDX, true }, }, { { LDX, true }, {}, } },
+    { { { ROL, false }, { ROR, false }, { LDY, true }, }, { { LDY, true }, {}, } },
+    { { { ROL, false }, { ROR, false }, { LAX, true }, }, { { LAX, true }, {}, } },
+    { { { ROL, false }, { ROR, false }, { STA, true }, }, { { STA, true }, { LDA, true }, } },
+    { { { ROL, false }, { ROR, false }, { INC, true }, }, { { INC, true }, {}, } },
+    { { { ROL, false }, { ROR, false }, { DEC, true }, }, { { DEC, true }, {}, } },
+    { { { ROL, false }, { ROR, false }, { ASL, true }, }, { { ASL, true }, {}, } },
+    { { { ROL, false }, { ROR, false }, { LSR, true }, }, { { LSR, true }, {}, } },
+    { { { ROL, false }, { ROR, false }, { ROL, true }, }, { { ROL, true }, {}, } },
+    { { { ROL, false }, { ROR, false }, { ROR, true }, }, { { ROR, true }, {}, } },
+    { { { ROL, false }, { ROR, false }, { ADC, true }, }, { { ADC, true }, {}, } },
+    { { { ROL, false }, { ROR, false }, { SBC, true }, }, { { SBC, true }, {}, } },
+    { { { ROL, false }, { ROR, false }, { AND, true }, }, { { AND, true }, {}, } },
+    { { { ROL, false }, { ROR, false }, { ORA, true }, }, { { ORA, true }, {}, } },
+    { { { ROL, false }, { ROR, false }, { EOR, true }, }, { { EOR, true }, {}, } },
+    { { { ROL, false }, { ROR, false }, { CMP, true }, }, { { CMP, true }, {}, } },
+    { { { ROL, false }, { ROR, false }, { BIT, true }, }, { { BIT, true }, {}, } },
+    { { { ROL, false }, { ROR, false }, { DCP, true }, }, { { DCP, true }, {}, } },
+    { { { ROL, false }, { ROR, false }, { ISC, true }, }, { { ISC, true }, {}, } },
+    { { { ROL, false }, { ROR, false }, { SLO, true }, }, { { SLO, true }, {}, } },
+    { { { ROL, false }, { ROR, false }, { RLA, true }, }, { { RLA, true }, {}, } },
+    { { { ROL, false }, { ROR, false }, { SRE, true }, }, { { SRE, true }, {}, } },
+    { { { ROL, false }, { ROR, false }, { RRA, true }, }, { { RRA, true }, {}, } },
+    { { { ROL, false }, { LDA, true }, { CLC, false }, }, { { CLC, false }, { LDA, true }, } },
+    { { { ROL, false }, { LDA, true }, { SEC, false }, }, { { SEC, false }, { LDA, true }, } },
+    { { { ROL, false }, { LDA, true }, { ASL, false }, }, { { LDA, true }, { ASL, false }, } },
+    { { { ROL, false }, { LDA, true }, { LSR, false }, }, { { LDA, true }, { LSR, false }, } },
+    { { { ROL, false }, { LDA, true }, { ASL, true }, }, { { LDA, true }, { ASL, true }, } },
+    { { { ROL, false }, { LDA, true }, { LSR, true }, }, { { LDA, true }, { LSR, true }, } },
+    { { { ROL, false }, { LDA, true }, { CMP, true }, }, { { LDA, true }, { CMP, true }, } },
+    { { { ROL, false }, { LDA, true }, { DCP, true }, }, { { LDA, true }, { DCP, true }, } },
+    { { { ROL, false }, { LDA, true }, { SLO, true }, }, { { LDA, true }, { SLO, true }, } },
+    { { { ROL, false }, { LDA, true }, { SRE, true }, }, { { LDA, true }, { SRE, true }, } },
+    { { { ROL, false }, { LAX, true }, { CLC, false }, }, { { CLC, false }, { LAX, true }, } },
+    { { { ROL, false }, { LAX, true }, { SEC, false }, }, { { SEC, false }, { LAX, true }, } },
+    { { { ROL, false }, { LAX, true }, { ASL, false }, }, { { LAX, true }, { ASL, false }, } },
+    { { { ROL, false }, { LAX, true }, { LSR, false }, }, { { LAX, true }, { LSR, false }, } },
+    { { { ROL, false }, { LAX, true }, { ASL, true }, }, { { LAX, true }, { ASL, true }, } },
+    { { { ROL, false }, { LAX, true }, { LSR, true }, }, { { LAX, true }, { LSR, true }, } },
+    { { { ROL, false }, { LAX, true }, { CMP, true }, }, { { LAX, true }, { CMP, true }, } },
+    { { { ROL, false }, { LAX, true }, { DCP, true }, }, { { LAX, true }, { DCP, true }, } },
+    { { { ROL, false }, { LAX, true }, { SLO, true }, }, { { LAX, true }, { SLO, true }, } },
+    { { { ROL, false }, { LAX, true }, { SRE, true }, }, { { LAX, true }, { SRE, true }, } },
+    { { { ROL, false }, { STA, true }, { LDA, true }, }, { { ROL, false }, { STA, true }, } },
+    { { { ROL, false }, { STA, true }, { AND, true }, }, { { ROL, false }, { STA, true }, } },
+    { { { ROL, false }, { STA, true }, { ORA, true }, }, { { ROL, false }, { STA, true }, } },
+    { { { ROL, false }, { ASL, true }, { LDA, true }, }, { { ASL, true }, { LDA, true }, } },
+    { { { ROL, false }, { ASL, true }, { LAX, true }, }, { { ASL, true }, { LAX, true }, } },
+    { { { ROL, false }, { LSR, true }, { LDA, true }, }, { { LSR, true }, { LDA, true }, } },
+    { { { ROL, false }, { LSR, true }, { LAX, true }, }, { { LSR, true }, { LAX, true }, } },
+    { { { ROL, false }, { SLO, true }, { LDA, true }, }, { { ASL, true }, { LDA, true }, } },
+    { { { ROL, false }, { SLO, true }, { LAX, true }, }, { { ASL, true }, { LAX, true }, } },
+    { { { ROL, false }, { SLO, true }, { AND, true }, }, { { ASL, true }, { LDA, true }, } },
+    { { { ROL, false }, { SRE, true }, { LDA, true }, }, { { LSR, true }, { LDA, true }, } },
+    { { { ROL, false }, { SRE, true }, { LAX, true }, }, { { LSR, true }, { LAX, true }, } },
+    { { { ROR, false }, { TXA, false }, { CLC, false }, }, { { TXA, false }, { CLC, false }, } },
+    { { { ROR, false }, { TXA, false }, { SEC, false }, }, { { TXA, false }, { SEC, false }, } },
+    { { { ROR, false }, { TXA, false }, { ASL, false }, }, { { TXA, false }, { ASL, false }, } },
+    { { { ROR, false }, { TXA, false }, { LSR, false }, }, { { TXA, false }, { LSR, false }, } },
+    { { { ROR, false }, { TYA, false }, { CLC, false }, }, { { TYA, false }, { CLC, false }, } },
+    { { { ROR, false }, { TYA, false }, { SEC, false }, }, { { TYA, false }, { SEC, false }, } },
+    { { { ROR, false }, { TYA, false }, { ASL, false }, }, { { TYA, false }, { ASL, false }, } },
+    { { { ROR, false }, { TYA, false }, { LSR, false }, }, { { TYA, false }, { LSR, false }, } },
+    { { { ROR, false }, { CLC, false }, { TXA, false }, }, { { TXA, false }, { CLC, false }, } },
+    { { { ROR, false }, { CLC, false }, { TYA, false }, }, { { TYA, false }, { CLC, false }, } },
+    { { { ROR, false }, { CLC, false }, { LDA, true }, }, { { CLC, false }, { LDA, true }, } },
+    { { { ROR, false }, { CLC, false }, { LAX, true }, }, { { CLC, false }, { LAX, true }, } },
+    { { { ROR, false }, { SEC, false }, { TXA, false }, }, { { TXA, false }, { SEC, false }, } },
+    { { { ROR, false }, { SEC, false }, { TYA, false }, }, { { TYA, false }, { SEC, false }, } },
+    { { { ROR, false }, { SEC, false }, { LDA, true }, }, { { SEC, false }, { LDA, true }, } },
+    { { { ROR, false }, { SEC, false }, { LAX, true }, }, { { SEC, false }, { LAX, true }, } },
+    { { { ROR, false }, { ASL, false }, { TXA, false }, }, { { TXA, false }, {}, } },
+    { { { ROR, false }, { ASL, false }, { TYA, false }, }, { { TYA, false }, {}, } },
+    { { { ROR, false }, { ASL, false }, { CLC, false }, }, { { LSR, false }, { ASL, false }, } },
+    { { { ROR, false }, { ASL, false }, { LSR, false }, }, { { LSR, false }, { CLC, false }, } },
+    { { { ROR, false }, { ASL, false }, { ROR, false }, }, { { ROR, false }, { CLC, false }, } },
+    { { { ROR, false }, { ASL, false }, { LDA, true }, }, { { LDA, true }, {}, } },
+    { { { ROR, false }, { ASL, false }, { LAX, true }, }, { { LAX, true }, {}, } },
+    { { { ROR, false }, { LSR, false }, { ROL, false }, }, { { ROR, false }, { CLC, false }, } },
+    { { { ROR, false }, { ROL, false }, { TAX, false }, }, { { TAX, false }, {}, } },
+    { { { ROR, false }, { ROL, false }, { TAY, false }, }, { { TAY, false }, {}, } },
+    { { { ROR, false }, { ROL, false }, { TXA, false }, }, { { TXA, false }, {}, } },
+    { { { ROR, false }, { ROL, false }, { TYA, false }, }, { { TYA, false }, {}, } },
+    { { { ROR, false }, { ROL, false }, { INX, false }, }, { { INX, false }, {}, } },
+    { { { ROR, false }, { ROL, false }, { INY, false }, }, { { INY, false }, {}, } },
+    { { { ROR, false }, { ROL, false }, { DEX, false }, }, { { DEX, false }, {}, } },
+    { { { ROR, false }, { ROL, false }, { DEY, false }, }, { { DEY, false }, {}, } },
+    { { { ROR, false }, { ROL, false }, { CLC, false }, }, { { ASL, false }, { ROR, false }, } },
+    { { { ROR, false }, { ROL, false }, { ASL, false }, }, { { ASL, false }, {}, } },
+    { { { ROR, false }, { ROL, false }, { LSR, false }, }, { { LSR, false }, {}, } },
+    { { { ROR, false }, { ROL, false }, { ROL, false }, }, { { ROL, false }, {}, } },
+    { { { ROR, false }, { ROL, false }, { ROR, false }, }, { { ROR, false }, {}, } },
+    { { { ROR, false }, { ROL, false }, { LDA, true }, }, { { LDA, true }, {}, } },
+    { { { ROR, false }, { ROL, false }, { LDX, true }, }, { { LDX, true }, {}, } },
+    { { { ROR, false }, { ROL, false }, { LDY, true }, }, { { LDY, true }, {}, } },
+    { { { ROR, false }, { ROL, false }, { LAX, true }, }, { { LAX, true }, {}, } },
+    { { { ROR, false }, { ROL, false }, { STA, true }, }, { { STA, true }, { LDA, true }, } },
+    { { { ROR, false }, { ROL, false }, { INC, true }, }, { { INC, true }, {}, } },
+    { { { ROR, false }, { ROL, false }, { DEC, true }, }, { { DEC, true }, {}, } },
+    { { { ROR, false }, { ROL, false }, { ASL, true }, }, { { ASL, true }, {}, } },
+    { { { ROR, false }, { ROL, false }, { LSR, true }, }, { { LSR, true }, {}, } },
+    { { { ROR, false }, { ROL, false }, { ROL, true }, }, { { ROL, true }, {}, } },
+    { { { ROR, false }, { ROL, false }, { ROR, true }, }, { { ROR, true }, {}, } },
+    { { { ROR, false }, { ROL, false }, { ADC, true }, }, { { ADC, true }, {}, } },
+    { { { ROR, false }, { ROL, false }, { SBC, true }, }, { { SBC, true }, {}, } },
+    { { { ROR, false }, { ROL, false }, { AND, true }, }, { { AND, true }, {}, } },
+    { { { ROR, false }, { ROL, false }, { ORA, true }, }, { { ORA, true }, {}, } },
+    { { { ROR, false }, { ROL, false }, { EOR, true }, }, { { EOR, true }, {}, } },
+    { { { ROR, false }, { ROL, false }, { CMP, true }, }, { { CMP, true }, {}, } },
+    { { { ROR, false }, { ROL, false }, { BIT, true }, }, { { BIT, true }, {}, } },
+    { { { ROR, false }, { ROL, false }, { DCP, true }, }, { { DCP, true }, {}, } },
+    { { { ROR, false }, { ROL, false }, { ISC, true }, }, { { ISC, true }, {}, } },
+    { { { ROR, false }, { ROL, false }, { SLO, true }, }, { { SLO, true }, {}, } },
+    { { { ROR, false }, { ROL, false }, { RLA, true }, }, { { RLA, true }, {}, } },
+    { { { ROR, false }, { ROL, false }, { SRE, true }, }, { { SRE, true }, {}, } },
+    { { { ROR, false }, { ROL, false }, { RRA, true }, }, { { RRA, true }, {}, } },
+    { { { ROR, false }, { ROR, false }, { ROL, false }, }, { { ROR, false }, {}, } },
+    { { { ROR, false }, { LDA, true }, { CLC, false }, }, { { CLC, false }, { LDA, true }, } },
+    { { { ROR, false }, { LDA, true }, { SEC, false }, }, { { SEC, false }, { LDA, true }, } },
+    { { { ROR, false }, { LDA, true }, { ASL, false }, }, { { LDA, true }, { ASL, false }, } },
+    { { { ROR, false }, { LDA, true }, { LSR, false }, }, { { LDA, true }, { LSR, false }, } },
+    { { { ROR, false }, { LDA, true }, { ASL, true }, }, { { LDA, true }, { ASL, true }, } },
+    { { { ROR, false }, { LDA, true }, { LSR, true }, }, { { LDA, true }, { LSR, true }, } },
+    { { { ROR, false }, { LDA, true }, { CMP, true }, }, { { LDA, true }, { CMP, true }, } },
+    { { { ROR, false }, { LDA, true }, { DCP, true }, }, { { LDA, true }, { DCP, true }, } },
+    { { { ROR, false }, { LDA, true }, { SLO, true }, }, { { LDA, true }, { SLO, true }, } },
+    { { { ROR, false }, { LDA, true }, { SRE, true }, }, { { LDA, true }, { SRE, true }, } },
+    { { { ROR, false }, { LAX, true }, { CLC, false }, }, { { CLC, false }, { LAX, true }, } },
+    { { { ROR, false }, { LAX, true }, { SEC, false }, }, { { SEC, false }, { LAX, true }, } },
+    { { { ROR, false }, { LAX, true }, { ASL, false }, }, { { LAX, true }, { ASL, false }, } },
+    { { { ROR, false }, { LAX, true }, { LSR, false }, }, { { LAX, true }, { LSR, false }, } },
+    { { { ROR, false }, { LAX, true }, { ASL, true }, }, { { LAX, true }, { ASL, true }, } },
+    { { { ROR, false }, { LAX, true }, { LSR, true }, }, { { LAX, true }, { LSR, true }, } },
+    { { { ROR, false }, { LAX, true }, { CMP, true }, }, { { LAX, true }, { CMP, true }, } },
+    { { { ROR, false }, { LAX, true }, { DCP, true }, }, { { LAX, true }, { DCP, true }, } },
+    { { { ROR, false }, { LAX, true }, { SLO, true }, }, { { LAX, true }, { SLO, true }, } },
+    { { { ROR, false }, { LAX, true }, { SRE, true }, }, { { LAX, true }, { SRE, true }, } },
+    { { { ROR, false }, { STA, true }, { LDA, true }, }, { { ROR, false }, { STA, true }, } },
+    { { { ROR, false }, { STA, true }, { AND, true }, }, { { ROR, false }, { STA, true }, } },
+    { { { ROR, false }, { STA, true }, { ORA, true }, }, { { ROR, false }, { STA, true }, } },
+    { { { ROR, false }, { ASL, true }, { LDA, true }, }, { { ASL, true }, { LDA, true }, } },
+    { { { ROR, false }, { ASL, true }, { LAX, true }, }, { { ASL, true }, { LAX, true }, } },
+    { { { ROR, false }, { LSR, true }, { LDA, true }, }, { { LSR, true }, { LDA, true }, } },
+    { { { ROR, false }, { LSR, true }, { LAX, true }, }, { { LSR, true }, { LAX, true }, } },
+    { { { ROR, false }, { SLO, true }, { LDA, true }, }, { { ASL, true }, { LDA, true }, } },
+    { { { ROR, false }, { SLO, true }, { LAX, true }, }, { { ASL, true }, { LAX, true }, } },
+    { { { ROR, false }, { SLO, true }, { AND, true }, }, { { ASL, true }, { LDA, true }, } },
+    { { { ROR, false }, { SRE, true }, { LDA, true }, }, { { LSR, true }, { LDA, true }, } },
+    { { { ROR, false }, { SRE, true }, { LAX, true }, }, { { LSR, true }, { LAX, true }, } },
+    { { { LDA, true }, { TAX, false }, {}, }, { { LAX, true }, {}, } },
+    { { { LDA, true }, { TAY, false }, { TAX, false }, }, { { LAX, true }, { TAY, false }, } },
+    { { { LDA, true }, { TAY, false }, { LDA, true }, }, { { LDA, true }, { TAY, false }, } },
+    { { { LDA, true }, { TAY, false }, { LDX, true }, }, { { LAX, true }, { TAY, false }, } },
+    { { { LDA, true }, { TAY, false }, { LAX, true }, }, { { LAX, true }, { TAY, false }, } },
+    { { { LDA, true }, { TAY, false }, { STA, true }, }, { { LDA, true }, { TAY, false }, } },
+    { { { LDA, true }, { TAY, false }, { AND, true }, }, { { LDA, true }, { TAY, false }, } },
+    { { { LDA, true }, { TAY, false }, { ORA, true }, }, { { LDA, true }, { TAY, false }, } },
+    { { { LDA, true }, { TXA, false }, {}, }, { { TXA, false }, {}, } },
+    { { { LDA, true }, { TYA, false }, {}, }, { { TYA, false }, {}, } },
+    { { { LDA, true }, { INX, false }, { TXA, false }, }, { { INX, false }, { TXA, false }, } },
+    { { { LDA, true }, { INX, false }, { LDA, true }, }, { { INX, false }, { LDA, true }, } },
+    { { { LDA, true }, { INY, false }, { TYA, false }, }, { { INY, false }, { TYA, false }, } },
+    { { { LDA, true }, { INY, false }, { LDA, true }, }, { { INY, false }, { LDA, true }, } },
+    { { { LDA, true }, { INY, false }, { LDX, true }, }, { { INY, false }, { LAX, true }, } },
+    { { { LDA, true }, { INY, false }, { LAX, true }, }, { { INY, false }, { LAX, true }, } },
+    { { { LDA, true }, { DEX, false }, { TXA, false }, }, { { DEX, false }, { TXA, false }, } },
+    { { { LDA, true }, { DEX, false }, { LDA, true }, }, { { DEX, false }, { LDA, true }, } },
+    { { { LDA, true }, { DEY, false }, { TYA, false }, }, { { DEY, false }, { TYA, false }, } },
+    { { { LDA, true }, { DEY, false }, { LDA, true }, }, { { DEY, false }, { LDA, true }, } },
+    { { { LDA, true }, { DEY, false }, { LDX, true }, }, { { DEY, false }, { LAX, true }, } },
+    { { { LDA, true }, { DEY, false }, { LAX, true }, }, { { DEY, false }, { LAX, true }, } },
+    { { { LDA, true }, { CLC, false }, { TAX, false }, }, { { CLC, false }, { LAX, true }, } },
+    { { { LDA, true }, { CLC, false }, { TXA, false }, }, { { TXA, false }, { CLC, false }, } },
+    { { { LDA, true }, { CLC, false }, { TYA, false }, }, { { TYA, false }, { CLC, false }, } },
+    { { { LDA, true }, { CLC, false }, { LDA, true }, }, { { CLC, false }, { LDA, true }, } },
+    { { { LDA, true }, { CLC, false }, { LDX, true }, }, { { CLC, false }, { LAX, true }, } },
+    { { { LDA, true }, { CLC, false }, { LAX, true }, }, { { CLC, false }, { LAX, true }, } },
+    { { { LDA, true }, { CLC, false }, { STA, true }, }, { { CLC, false }, { LDA, true }, } },
+    { { { LDA, true }, { CLC, false }, { AND, true }, }, { { CLC, false }, { LDA, true }, } },
+    { { { LDA, true }, { CLC, false }, { ORA, true }, }, { { CLC, false }, { LDA, true }, } },
+    { { { LDA, true }, { SEC, false }, { TAX, false }, }, { { SEC, false }, { LAX, true }, } },
+    { { { LDA, true }, { SEC, false }, { TXA, false }, }, { { TXA, false }, { SEC, false }, } },
+    { { { LDA, true }, { SEC, false }, { TYA, false }, }, { { TYA, false }, { SEC, false }, } },
+    { { { LDA, true }, { SEC, false }, { LDA, true }, }, { { SEC, false }, { LDA, true }, } },
+    { { { LDA, true }, { SEC, false }, { LDX, true }, }, { { SEC, false }, { LAX, true }, } },
+    { { { LDA, true }, { SEC, false }, { LAX, true }, }, { { SEC, false }, { LAX, true }, } },
+    { { { LDA, true }, { SEC, false }, { STA, true }, }, { { SEC, false }, { LDA, true }, } },
+    { { { LDA, true }, { SEC, false }, { AND, true }, }, { { SEC, false }, { LDA, true }, } },
+    { { { LDA, true }, { SEC, false }, { ORA, true }, }, { { SEC, false }, { LDA, true }, } },
+    { { { LDA, true }, { CLV, false }, { TAX, false }, }, { { CLV, false }, { LAX, true }, } },
+    { { { LDA, true }, { CLV, false }, { TXA, false }, }, { { TXA, false }, { CLV, false }, } },
+    { { { LDA, true }, { CLV, false }, { TYA, false }, }, { { TYA, false }, { CLV, false }, } },
+    { { { LDA, true }, { CLV, false }, { LDA, true }, }, { { CLV, false }, { LDA, true }, } },
+    { { { LDA, true }, { CLV, false }, { LDX, true }, }, { { CLV, false }, { LAX, true }, } },
+    { { { LDA, true }, { CLV, false }, { LAX, true }, }, { { CLV, false }, { LAX, true }, } },
+    { { { LDA, true }, { CLV, false }, { STA, true }, }, { { CLV, false }, { LDA, true }, } },
+    { { { LDA, true }, { CLV, false }, { AND, true }, }, { { CLV, false }, { LDA, true }, } },
+    { { { LDA, true }, { CLV, false }, { ORA, true }, }, { { CLV, false }, { LDA, true }, } },
+    { { { LDA, true }, { ASL, false }, { ROR, false }, }, { { CLC, false }, { LDA, true }, } },
+    { { { LDA, true }, { ASL, false }, { STA, true }, }, { { ASL, true }, { LDA, true }, } },
+    { { { LDA, true }, { ASL, false }, { ASL, true }, }, { { ASL, true }, { LDA, true }, } },
+    { { { LDA, true }, { ASL, false }, { SLO, true }, }, { { ASL, true }, { LDA, true }, } },
+    { { { LDA, true }, { LSR, false }, { ROL, false }, }, { { CLC, false }, { LDA, true }, } },
+    { { { LDA, true }, { LSR, false }, { STA, true }, }, { { LSR, true }, { LDA, true }, } },
+    { { { LDA, true }, { LSR, false }, { LSR, true }, }, { { LSR, true }, { LDA, true }, } },
+    { { { LDA, true }, { ROL, false }, { ROR, false }, }, { { LDA, true }, {}, } },
+    { { { LDA, true }, { ROL, false }, { STA, true }, }, { { ROL, true }, { LDA, true }, } },
+    { { { LDA, true }, { ROR, false }, { ROL, false }, }, { { LDA, true }, {}, } },
+    { { { LDA, true }, { ROR, false }, { STA, true }, }, { { ROR, true }, { LDA, true }, } },
+    { { { LDA, true }, { LDA, true }, {}, }, { { LDA, true }, {}, } },
+    { { { LDA, true }, { LDX, true }, {}, }, { { LAX, true }, {}, } },
+    { { { LDA, true }, { LDY, true }, {}, }, { { LDA, true }, { TAY, false }, } },
+    { { { LDA, true }, { LAX, true }, {}, }, { { LAX, true }, {}, } },
+    { { { LDA, true }, { STA, true }, {}, }, { { LDA, true }, {}, } },
+    { { { LDA, true }, { STX, true }, { TXA, false }, }, { { TXA, false }, { STX, true }, } },
+    { { { LDA, true }, { STY, true }, { TYA, false }, }, { { TYA, false }, { STY, true }, } },
+    { { { LDA, true }, { STY, true }, { LAX, true }, }, { { STY, true }, { LAX, true }, } },
+    { { { LDA, true }, { INC, true }, { TXA, false }, }, { { INC, true }, { TXA, false }, } },
+    { { { LDA, true }, { INC, true }, { TYA, false }, }, { { INC, true }, { TYA, false }, } },
+    { { { LDA, true }, { INC, true }, { LDA, true }, }, { { INC, true }, { LDA, true }, } },
+    { { { LDA, true }, { INC, true }, { LAX, true }, }, { { INC, true }, { LAX, true }, } },
+    { { { LDA, true }, { INC, true }, { DEC, true }, }, { { LDA, true }, {}, } },
+    { { { LDA, true }, { DEC, true }, { TXA, false }, }, { { DEC, true }, { TXA, false }, } },
+    { { { LDA, true }, { DEC, true }, { TYA, false }, }, { { DEC, true }, { TYA, false }, } },
+    { { { LDA, true }, { DEC, true }, { LDA, true }, }, { { DEC, true }, { LDA, true }, } },
+    { { { LDA, true }, { DEC, true }, { LAX, true }, }, { { DEC, true }, { LAX, true }, } },
+    { { { LDA, true }, { DEC, true }, { INC, true }, }, { { LDA, true }, {}, } },
+    { { { LDA, true }, { ASL, true }, { TXA, false }, }, { { ASL, true }, { TXA, false }, } },
+    { { { LDA, true }, { ASL, true }, { TYA, false }, }, { { ASL, true }, { TYA, false }, } },
+    { { { LDA, true }, { ASL, true }, { ASL, false }, }, { { ASL, true }, { LDA, true }, } },
+    { { { LDA, true }, { ASL, true }, { LDA, true }, }, { { ASL, true }, { LDA, true }, } },
+    { { { LDA, true }, { ASL, true }, { LAX, true }, }, { { ASL, true }, { LAX, true }, } },
+    { { { LDA, true }, { ASL, true }, { ROR, true }, }, { { CLC, false }, { LDA, true }, } },
+    { { { LDA, true }, { LSR, true }, { TXA, false }, }, { { LSR, true }, { TXA, false }, } },
+    { { { LDA, true }, { LSR, true }, { TYA, false }, }, { { LSR, true }, { TYA, false }, } },
+    { { { LDA, true }, { LSR, true }, { LSR, false }, }, { { LSR, true }, { LDA, true }, } },
+    { { { LDA, true }, { LSR, true }, { LDA, true }, }, { { LSR, true }, { LDA, true }, } },
+    { { { LDA, true }, { LSR, true }, { LAX, true }, }, { { LSR, true }, { LAX, true }, } },
+    { { { LDA, true }, { LSR, true }, { ROL, true }, }, { { CLC, false }, { LDA, true }, } },
+    { { { LDA, true }, { ROL, true }, { TXA, false }, }, { { ROL, true }, { TXA, false }, } },
+    { { { LDA, true }, { ROL, true }, { TYA, false }, }, { { ROL, true }, { TYA, false }, } },
+    { { { LDA, true }, { ROL, true }, { LDA, true }, }, { { ROL, true }, { LDA, true }, } },
+    { { { LDA, true }, { ROL, true }, { LAX, true }, }, { { ROL, true }, { LAX, true }, } },
+    { { { LDA, true }, { ROL, true }, { ROR, true }, }, { { LDA, true }, {}, } },
+    { { { LDA, true }, { ROR, true }, { TXA, false }, }, { { ROR, true }, { TXA, false }, } },
+    { { { LDA, true }, { ROR, true }, { TYA, false }, }, { { ROR, true }, { TYA, false }, } },
+    { { { LDA, true }, { ROR, true }, { LDA, true }, }, { { ROR, true }, { LDA, true }, } },
+    { { { LDA, true }, { ROR, true }, { LAX, true }, }, { { ROR, true }, { LAX, true }, } },
+    { { { LDA, true }, { ROR, true }, { ROL, true }, }, { { LDA, true }, {}, } },
+    { { { LDA, true }, { SBC, true }, { CLV, false }, }, { { LDA, true }, { SBC, true }, } },
+    { { { LDA, true }, { SBC, true }, { LDA, true }, }, { { CLV, false }, { LDA, true }, } },
+    { { { LDA, true }, { SBC, true }, { LAX, true }, }, { { CLV, false }, { LAX, true }, } },
+    { { { LDA, true }, { AND, true }, {}, }, { { LDA, true }, {}, } },
+    { { { LDA, true }, { ORA, true }, {}, }, { { LDA, true }, {}, } },
+    { { { LDA, true }, { EOR, true }, { AND, true }, }, { { LDA, true }, { EOR, true }, } },
+    { { { LDA, true }, { EOR, true }, { SLO, true }, }, { { ASL, true }, { LDA, true }, } },
+    { { { LDA, true }, { EOR, true }, { SRE, true }, }, { { LSR, true }, { LDA, true }, } },
+    { { { LDA, true }, { CMP, true }, { TAX, false }, }, { { SEC, false }, { LAX, true }, } },
+    { { { LDA, true }, { CMP, true }, { SEC, false }, }, { { LDA, true }, { CMP, true }, } },
+    { { { LDA, true }, { CMP, true }, { LDA, true }, }, { { SEC, false }, { LDA, true }, } },
+    { { { LDA, true }, { CMP, true }, { LDX, true }, }, { { SEC, false }, { LAX, true }, } },
+    { { { LDA, true }, { CMP, true }, { LAX, true }, }, { { SEC, false }, { LAX, true }, } },
+    { { { LDA, true }, { CMP, true }, { STA, true }, }, { { LDA, true }, { CMP, true }, } },
+    { { { LDA, true }, { CMP, true }, { AND, true }, }, { { SEC, false }, { LDA, true }, } },
+    { { { LDA, true }, { CMP, true }, { ORA, true }, }, { { SEC, false }, { LDA, true }, } },
+    { { { LDA, true }, { CPX, true }, { TXA, false }, }, { { CPX, true }, { TXA, false }, } },
+    { { { LDA, true }, { CPX, true }, { LDA, true }, }, { { CPX, true }, { LDA, true }, } },
+    { { { LDA, true }, { CPX, true }, { LDX, true }, }, { { CPX, true }, { LAX, true }, } },
+    { { { LDA, true }, { CPX, true }, { LAX, true }, }, { { CPX, true }, { LAX, true }, } },
+    { { { LDA, true }, { CPY, true }, { TYA, false }, }, { { CPY, true }, { TYA, false }, } },
+    { { { LDA, true }, { CPY, true }, { LDA, true }, }, { { CPY, true }, { LDA, true }, } },
+    { { { LDA, true }, { CPY, true }, { LDX, true }, }, { { CPY, true }, { LAX, true }, } },
+    { { { LDA, true }, { CPY, true }, { LAX, true }, }, { { CPY, true }, { LAX, true }, } },
+    { { { LDA, true }, { BIT, true }, { TAX, false }, }, { { LAX, true }, { BIT, true }, } },
+    { { { LDA, true }, { BIT, true }, { CLV, false }, }, { { CLV, false }, { LDA, true }, } },
+    { { { LDA, true }, { BIT, true }, { LDA, true }, }, { { LDA, true }, { BIT, true }, } },
+    { { { LDA, true }, { BIT, true }, { LDX, true }, }, { { LAX, true }, { BIT, true }, } },
+    { { { LDA, true }, { BIT, true }, { LAX, true }, }, { { LAX, true }, { BIT, true }, } },
+    { { { LDA, true }, { BIT, true }, { STA, true }, }, { { LDA, true }, { BIT, true }, } },
+    { { { LDA, true }, { BIT, true }, { AND, true }, }, { { LDA, true }, { BIT, true }, } },
+    { { { LDA, true }, { BIT, true }, { ORA, true }, }, { { LDA, true }, { BIT, true }, } },
+    { { { LDA, true }, { SLO, true }, { LDA, true }, }, { { ASL, true }, { LDA, true }, } },
+    { { { LDA, true }, { SLO, true }, { LAX, true }, }, { { ASL, true }, { LAX, true }, } },
+    { { { LDA, true }, { SLO, true }, { AND, true }, }, { { ASL, true }, { LDA, true }, } },
+    { { { LDA, true }, { RLA, true }, { LDA, true }, }, { { ROL, true }, { LDA, true }, } },
+    { { { LDA, true }, { RLA, true }, { LAX, true }, }, { { ROL, true }, { LAX, true }, } },
+    { { { LDA, true }, { RLA, true }, { ORA, true }, }, { { ROL, true }, { LDA, true }, } },
+    { { { LDA, true }, { SRE, true }, { LDA, true }, }, { { LSR, true }, { LDA, true }, } },
+    { { { LDA, true }, { SRE, true }, { LAX, true }, }, { { LSR, true }, { LAX, true }, } },
+    { { { LDX, true }, { TAX, false }, {}, }, { { TAX, false }, {}, } },
+    { { { LDX, true }, { TAY, false }, { TAX, false }, }, { { TAX, false }, { TAY, false }, } },
+    { { { LDX, true }, { TAY, false }, { LDA, true }, }, { { TAY, false }, { LAX, true }, } },
+    { { { LDX, true }, { TAY, false }, { LDX, true }, }, { { TAY, false }, { LDX, true }, } },
+    { { { LDX, true }, { TAY, false }, { LAX, true }, }, { { TAY, false }, { LAX, true }, } },
+    { { { LDX, true }, { TXA, false }, {}, }, { { LAX, true }, {}, } },
+    { { { LDX, true }, { TYA, false }, { LDX, true }, }, { { TYA, false }, { LDX, true }, } },
+    { { { LDX, true }, { INX, false }, { DEX, false }, }, { { LDX, true }, {}, } },
+    { { { LDX, true }, { INX, false }, { STX, true }, }, { { INC, true }, { LDX, true }, } },
+    { { { LDX, true }, { INX, false }, { INC, true }, }, { { INC, true }, { LDX, true }, } },
+    { { { LDX, true }, { INY, false }, { LDA, true }, }, { { INY, false }, { LAX, true }, } },
+    { { { LDX, true }, { INY, false }, { LDX, true }, }, { { INY, false }, { LDX, true }, } },
+    { { { LDX, true }, { INY, false }, { LAX, true }, }, { { INY, false }, { LAX, true }, } },
+    { { { LDX, true }, { DEX, false }, { INX, false }, }, { { LDX, true }, {}, } },
+    { { { LDX, true }, { DEX, false }, { STX, true }, }, { { DEC, true }, { LDX, true }, } },
+    { { { LDX, true }, { DEX, false }, { DEC, true }, }, { { DEC, true }, { LDX, true }, } },
+    { { { LDX, true }, { DEY, false }, { LDA, true }, }, { { DEY, false }, { LAX, true }, } },
+    { { { LDX, true }, { DEY, false }, { LDX, true }, }, { { DEY, false }, { LDX, true }, } },
+    { { { LDX, true }, { DEY, false }, { LAX, true }, }, { { DEY, false }, { LAX, true }, } },
+    { { { LDX, true }, { CLC, false }, { TAX, false }, }, { { TAX, false }, { CLC, false }, } },
+    { { { LDX, true }, { CLC, false }, { TXA, false }, }, { { CLC, false }, { LAX, true }, } },
+    { { { LDX, true }, { CLC, false }, { LDA, true }, }, { { CLC, false }, { LAX, true }, } },
+    { { { LDX, true }, { CLC, false }, { LDX, true }, }, { { CLC, false }, { LDX, true }, } },
+    { { { LDX, true }, { CLC, false }, { LAX, true }, }, { { CLC, false }, { LAX, true }, } },
+    { { { LDX, true }, { CLC, false }, { STX, true }, }, { { CLC, false }, { LDX, true }, } },
+    { { { LDX, true }, { SEC, false }, { TAX, false }, }, { { TAX, false }, { SEC, false }, } },
+    { { { LDX, true }, { SEC, false }, { TXA, false }, }, { { SEC, false }, { LAX, true }, } },
+    { { { LDX, true }, { SEC, false }, { LDA, true }, }, { { SEC, false }, { LAX, true }, } },
+    { { { LDX, true }, { SEC, false }, { LDX, true }, }, { { SEC, false }, { LDX, true }, } },
+    { { { LDX, true }, { SEC, false }, { LAX, true }, }, { { SEC, false }, { LAX, true }, } },
+    { { { LDX, true }, { SEC, false }, { STX, true }, }, { { SEC, false }, { LDX, true }, } },
+    { { { LDX, true }, { CLV, false }, { TAX, false }, }, { { TAX, false }, { CLV, false }, } },
+    { { { LDX, true }, { CLV, false }, { TXA, false }, }, { { CLV, false }, { LAX, true }, } },
+    { { { LDX, true }, { CLV, false }, { LDA, true }, }, { { CLV, false }, { LAX, true }, } },
+    { { { LDX, true }, { CLV, false }, { LDX, true }, }, { { CLV, false }, { LDX, true }, } },
+    { { { LDX, true }, { CLV, false }, { LAX, true }, }, { { CLV, false }, { LAX, true }, } },
+    { { { LDX, true }, { CLV, false }, { STX, true }, }, { { CLV, false }, { LDX, true }, } },
+    { { { LDX, true }, { ASL, false }, { TAX, false }, }, { { ASL, false }, { TAX, false }, } },
+    { { { LDX, true }, { ASL, false }, { LDA, true }, }, { { ASL, false }, { LAX, true }, } },
+    { { { LDX, true }, { ASL, false }, { LDX, true }, }, { { ASL, false }, { LDX, true }, } },
+    { { { LDX, true }, { ASL, false }, { LAX, true }, }, { { ASL, false }, { LAX, true }, } },
+    { { { LDX, true }, { LSR, false }, { TAX, false }, }, { { LSR, false }, { TAX, false }, } },
+    { { { LDX, true }, { LSR, false }, { LDA, true }, }, { { LSR, false }, { LAX, true }, } },
+    { { { LDX, true }, { LSR, false }, { LDX, true }, }, { { LSR, false }, { LDX, true }, } },
+    { { { LDX, true }, { LSR, false }, { LAX, true }, }, { { LSR, false }, { LAX, true }, } },
+    { { { LDX, true }, { ROL, false }, { TAX, false }, }, { { ROL, false }, { TAX, false }, } },
+    { { { LDX, true }, { ROL, false }, { LDA, true }, }, { { ASL, false }, { LAX, true }, } },
+    { { { LDX, true }, { ROL, false }, { LDX, true }, }, { { ROL, false }, { LDX, true }, } },
+    { { { LDX, true }, { ROL, false }, { LAX, true }, }, { { ASL, false }, { LAX, true }, } },
+    { { { LDX, true }, { ROR, false }, { TAX, false }, }, { { ROR, false }, { TAX, false }, } },
+    { { { LDX, true }, { ROR, false }, { LDA, true }, }, { { LSR, false }, { LAX, true }, } },
+    { { { LDX, true }, { ROR, false }, { LDX, true }, }, { { ROR, false }, { LDX, true }, } },
+    { { { LDX, true }, { ROR, false }, { LAX, true }, }, { { LSR, false }, { LAX, true }, } },
+    { { { LDX, true }, { LDA, true }, {}, }, { { LAX, true }, {}, } },
+    { { { LDX, true }, { LDX, true }, {}, }, { { LDX, true }, {}, } },
+    { { { LDX, true }, { LDY, true }, { TAX, false }, }, { { LDY, true }, { TAX, false }, } },
+    { { { LDX, true }, { LDY, true }, { TXA, false }, }, { { LDY, true }, { LAX, true }, } },
+    { { { LDX, true }, { LDY, true }, { TYA, false }, }, { { LDY, true }, { LAX, true }, } },
+    { { { LDX, true }, { LDY, true }, { LDX, true }, }, { { LDX, true }, { LDY, true }, } },
+    { { { LDX, true }, { LDY, true }, { STX, true }, }, { { LDX, true }, { LDY, true }, } },
+    { { { LDX, true }, { LAX, true }, {}, }, { { LAX, true }, {}, } },
+    { { { LDX, true }, { STA, true }, { TAX, false }, }, { { TAX, false }, { STA, true }, } },
+    { { { LDX, true }, { STX, true }, {}, }, { { LDX, true }, {}, } },
+    { { { LDX, true }, { STY, true }, { LDX, true }, }, { { STY, true }, { LDX, true }, } },
+    { { { LDX, true }, { STY, true }, { LAX, true }, }, { { STY, true }, { LAX, true }, } },
+    { { { LDX, true }, { INC, true }, { TAX, false }, }, { { INC, true }, { TAX, false }, } },
+    { { { LDX, true }, { INC, true }, { INX, false }, }, { { INC, true }, { LDX, true }, } },
+    { { { LDX, true }, { INC, true }, { LDX, true }, }, { { INC, true }, { LDX, true }, } },
+    { { { LDX, true }, { INC, true }, { LAX, true }, }, { { INC, true }, { LAX, true }, } },
+    { { { LDX, true }, { INC, true }, { DEC, true }, }, { { LDX, true }, {}, } },
+    { { { LDX, true }, { DEC, true }, { TAX, false }, }, { { DEC, true }, { TAX, false }, } },
+    { { { LDX, true }, { DEC, true }, { DEX, false }, }, { { DEC, true }, { LDX, true }, } },
+    { { { LDX, true }, { DEC, true }, { LDX, true }, }, { { DEC, true }, { LDX, true }, } },
+    { { { LDX, true }, { DEC, true }, { LAX, true }, }, { { DEC, true }, { LAX, true }, } },
+    { { { LDX, true }, { DEC, true }, { INC, true }, }, { { LDX, true }, {}, } },
+    { { { LDX, true }, { ASL, true }, { TAX, false }, }, { { ASL, true }, { TAX, false }, } },
+    { { { LDX, true }, { ASL, true }, { LDX, true }, }, { { ASL, true }, { LDX, true }, } },
+    { { { LDX, true }, { ASL, true }, { LAX, true }, }, { { ASL, true }, { LAX, true }, } },
+    { { { LDX, true }, { ASL, true }, { ROR, true }, }, { { CLC, false }, { LDX, true }, } },
+    { { { LDX, true }, { LSR, true }, { TAX, false }, }, { { LSR, true }, { TAX, false }, } },
+    { { { LDX, true }, { LSR, true }, { LDX, true }, }, { { LSR, true }, { LDX, true }, } },
+    { { { LDX, true }, { LSR, true }, { LAX, true }, }, { { LSR, true }, { LAX, true }, } },
+    { { { LDX, true }, { LSR, true }, { ROL, true }, }, { { CLC, false }, { LDX, true }, } },
+    { { { LDX, true }, { ROL, true }, { TAX, false }, }, { { ROL, true }, { TAX, false }, } },
+    { { { LDX, true }, { ROL, true }, { LDX, true }, }, { { ROL, true }, { LDX, true }, } },
+    { { { LDX, true }, { ROL, true }, { LAX, true }, }, { { ROL, true }, { LAX, true }, } },
+    { { { LDX, true }, { ROL, true }, { ROR, true }, }, { { LDX, true }, {}, } },
+    { { { LDX, true }, { ROR, true }, { TAX, false }, }, { { ROR, true }, { TAX, false }, } },
+    { { { LDX, true }, { ROR, true }, { LDX, true }, }, { { ROR, true }, { LDX, true }, } },
+    { { { LDX, true }, { ROR, true }, { LAX, true }, }, { { ROR, true }, { LAX, true }, } },
+    { { { LDX, true }, { ROR, true }, { ROL, true }, }, { { LDX, true }, {}, } },
+    { { { LDX, true }, { ADC, true }, { TAX, false }, }, { { ADC, true }, { TAX, false }, } },
+    { { { LDX, true }, { ADC, true }, { LDA, true }, }, { { ADC, true }, { LAX, true }, } },
+    { { { LDX, true }, { ADC, true }, { LDX, true }, }, { { ADC, true }, { LDX, true }, } },
+    { { { LDX, true }, { ADC, true }, { LAX, true }, }, { { ADC, true }, { LAX, true }, } },
+    { { { LDX, true }, { SBC, true }, { TAX, false }, }, { { SBC, true }, { TAX, false }, } },
+    { { { LDX, true }, { SBC, true }, { LDA, true }, }, { { SBC, true }, { LAX, true }, } },
+    { { { LDX, true }, { SBC, true }, { LDX, true }, }, { { SBC, true }, { LDX, true }, } },
+    { { { LDX, true }, { SBC, true }, { LAX, true }, }, { { SBC, true }, { LAX, true }, } },
+    { { { LDX, true }, { AND, true }, { TAX, false }, }, { { AND, true }, { TAX, false }, } },
+    { { { LDX, true }, { AND, true }, { LDX, true }, }, { { AND, true }, { LDX, true }, } },
+    { { { LDX, true }, { ORA, true }, { TAX, false }, }, { { ORA, true }, { TAX, false }, } },
+    { { { LDX, true }, { ORA, true }, { LDX, true }, }, { { ORA, true }, { LDX, true }, } },
+    { { { LDX, true }, { EOR, true }, { TAX, false }, }, { { EOR, true }, { TAX, false }, } },
+    { { { LDX, true }, { EOR, true }, { LDX, true }, }, { { EOR, true }, { LDX, true }, } },
+    { { { LDX, true }, { CMP, true }, { TAX, false }, }, { { CMP, true }, { TAX, false }, } },
+    { { { LDX, true }, { CMP, true }, { LDA, true }, }, { { CMP, true }, { LAX, true }, } },
+    { { { LDX, true }, { CMP, true }, { LDX, true }, }, { { CMP, true }, { LDX, true }, } },
+    { { { LDX, true }, { CMP, true }, { LAX, true }, }, { { CMP, true }, { LAX, true }, } },
+    { { { LDX, true }, { CPX, true }, { TXA, false }, }, { { SEC, false }, { LAX, true }, } },
+    { { { LDX, true }, { CPX, true }, { SEC, false }, }, { { LDX, true }, { CPX, true }, } },
+    { { { LDX, true }, { CPX, true }, { LDA, true }, }, { { SEC, false }, { LAX, true }, } },
+    { { { LDX, true }, { CPX, true }, { LDX, true }, }, { { SEC, false }, { LDX, true }, } },
+    { { { LDX, true }, { CPX, true }, { LAX, true }, }, { { SEC, false }, { LAX, true }, } },
+    { { { LDX, true }, { CPX, true }, { STX, true }, }, { { LDX, true }, { CPX, true }, } },
+    { { { LDX, true }, { CPY, true }, { LDA, true }, }, { { CPY, true }, { LAX, true }, } },
+    { { { LDX, true }, { CPY, true }, { LDX, true }, }, { { CPY, true }, { LDX, true }, } },
+    { { { LDX, true }, { CPY, true }, { LAX, true }, }, { { CPY, true }, { LAX, true }, } },
+    { { { LDX, true }, { BIT, true }, { TAX, false }, }, { { BIT, true }, { TAX, false }, } },
+    { { { LDX, true }, { BIT, true }, { LDA, true }, }, { { LAX, true }, { BIT, true }, } },
+    { { { LDX, true }, { BIT, true }, { LDX, true }, }, { { BIT, true }, { LDX, true }, } },
+    { { { LDX, true }, { BIT, true }, { LAX, true }, }, { { LAX, true }, { BIT, true }, } },
+    { { { LDX, true }, { DCP, true }, { TAX, false }, }, { { DCP, true }, { TAX, false }, } },
+    { { { LDX, true }, { DCP, true }, { LDX, true }, }, { { DCP, true }, { LDX, true }, } },
+    { { { LDX, true }, { DCP, true }, { LAX, true }, }, { { DCP, true }, { LAX, true }, } },
+    { { { LDX, true }, { ISC, true }, { TAX, false }, }, { { ISC, true }, { TAX, false }, } },
+    { { { LDX, true }, { ISC, true }, { LDX, true }, }, { { ISC, true }, { LDX, true }, } },
+    { { { LDX, true }, { ISC, true }, { LAX, true }, }, { { ISC, true }, { LAX, true }, } },
+    { { { LDX, true }, { SLO, true }, { TAX, false }, }, { { SLO, true }, { TAX, false }, } },
+    { { { LDX, true }, { SLO, true }, { LDX, true }, }, { { SLO, true }, { LDX, true }, } },
+    { { { LDX, true }, { SLO, true }, { LAX, true }, }, { { ASL, true }, { LAX, true }, } },
+    { { { LDX, true }, { RLA, true }, { TAX, false }, }, { { RLA, true }, { TAX, false }, } },
+    { { { LDX, true }, { RLA, true }, { LDX, true }, }, { { RLA, true }, { LDX, true }, } },
+    { { { LDX, true }, { RLA, true }, { LAX, true }, }, { { ROL, true }, { LAX, true }, } },
+    { { { LDX, true }, { SRE, true }, { TAX, false }, }, { { SRE, true }, { TAX, false }, } },
+    { { { LDX, true }, { SRE, true }, { LDX, true }, }, { { SRE, true }, { LDX, true }, } },
+    { { { LDX, true }, { SRE, true }, { LAX, true }, }, { { LSR, true }, { LAX, true }, } },
+    { { { LDX, true }, { RRA, true }, { TAX, false }, }, { { RRA, true }, { TAX, false }, } },
+    { { { LDX, true }, { RRA, true }, { LDX, true }, }, { { RRA, true }, { LDX, true }, } },
+    { { { LDX, true }, { RRA, true }, { LAX, true }, }, { { RRA, true }, { LAX, true }, } },
+    { { { LDY, true }, { TAX, false }, { TAY, false }, }, { { TAX, false }, { TAY, false }, } },
+    { { { LDY, true }, { TAX, false }, { LDY, true }, }, { { TAX, false }, { LDY, true }, } },
+    { { { LDY, true }, { TAY, false }, {}, }, { { TAY, false }, {}, } },
+    { { { LDY, true }, { TXA, false }, { LDY, true }, }, { { TXA, false }, { LDY, true }, } },
+    { { { LDY, true }, { TYA, false }, { LDX, true }, }, { { LDY, true }, { LAX, true }, } },
+    { { { LDY, true }, { TYA, false }, { LDY, true }, }, { { LDY, true }, { TYA, false }, } },
+    { { { LDY, true }, { TYA, false }, { STY, true }, }, { { LDY, true }, { TYA, false }, } },
+    { { { LDY, true }, { INX, false }, { LDY, true }, }, { { INX, false }, { LDY, true }, } },
+    { { { LDY, true }, { INY, false }, { DEY, false }, }, { { LDY, true }, {}, } },
+    { { { LDY, true }, { INY, false }, { STY, true }, }, { { INC, true }, { LDY, true }, } },
+    { { { LDY, true }, { INY, false }, { INC, true }, }, { { INC, true }, { LDY, true }, } },
+    { { { LDY, true }, { DEX, false }, { LDY, true }, }, { { DEX, false }, { LDY, true }, } },
+    { { { LDY, true }, { DEY, false }, { INY, false }, }, { { LDY, true }, {}, } },
+    { { { LDY, true }, { DEY, false }, { STY, true }, }, { { DEC, true }, { LDY, true }, } },
+    { { { LDY, true }, { DEY, false }, { DEC, true }, }, { { DEC, true }, { LDY, true }, } },
+    { { { LDY, true }, { CLC, false }, { TAY, false }, }, { { TAY, false }, { CLC, false }, } },
+    { { { LDY, true }, { CLC, false }, { LDY, true }, }, { { CLC, false }, { LDY, true }, } },
+    { { { LDY, true }, { CLC, false }, { STY, true }, }, { { CLC, false }, { LDY, true }, } },
+    { { { LDY, true }, { SEC, false }, { TAY, false }, }, { { TAY, false }, { SEC, false }, } },
+    { { { LDY, true }, { SEC, false }, { LDY, true }, }, { { SEC, false }, { LDY, true }, } },
+    { { { LDY, true }, { SEC, false }, { STY, true }, }, { { SEC, false }, { LDY, true }, } },
+    { { { LDY, true }, { CLV, false }, { TAY, false }, }, { { TAY, false }, { CLV, false }, } },
+    { { { LDY, true }, { CLV, false }, { LDY, true }, }, { { CLV, false }, { LDY, true }, } },
+    { { { LDY, true }, { CLV, false }, { STY, true }, }, { { CLV, false }, { LDY, true }, } },
+    { { { LDY, true }, { ASL, false }, { TAY, false }, }, { { ASL, false }, { TAY, false }, } },
+    { { { LDY, true }, { ASL, false }, { LDY, true }, }, { { ASL, false }, { LDY, true }, } },
+    { { { LDY, true }, { LSR, false }, { TAY, false }, }, { { LSR, false }, { TAY, false }, } },
+    { { { LDY, true }, { LSR, false }, { LDY, true }, }, { { LSR, false }, { LDY, true }, } },
+    { { { LDY, true }, { ROL, false }, { TAY, false }, }, { { ROL, false }, { TAY, false }, } },
+    { { { LDY, true }, { ROL, false }, { LDY, true }, }, { { ROL, false }, { LDY, true }, } },
+    { { { LDY, true }, { ROR, false }, { TAY, false }, }, { { ROR, false }, { TAY, false }, } },
+    { { { LDY, true }, { ROR, false }, { LDY, true }, }, { { ROR, false }, { LDY, true }, } },
+    { { { LDY, true }, { LDA, true }, {}, }, { { LDA, true }, { TAY, false }, } },
+    { { { LDY, true }, { LDX, true }, { TAY, false }, }, { { LDX, true }, { TAY, false }, } },
+    { { { LDY, true }, { LDX, true }, { TYA, false }, }, { { LDY, true }, { LAX, true }, } },
+    { { { LDY, true }, { LDX, true }, { LDY, true }, }, { { LDX, true }, { LDY, true }, } },
+    { { { LDY, true }, { LDX, true }, { STY, true }, }, { { LDX, true }, { LDY, true }, } },
+    { { { LDY, true }, { LDY, true }, {}, }, { { LDY, true }, {}, } },
+    { { { LDY, true }, { LAX, true }, {}, }, { { LAX, true }, { TAY, false }, } },
+    { { { LDY, true }, { STA, true }, { TAY, false }, }, { { TAY, false }, { STA, true }, } },
+    { { { LDY, true }, { STX, true }, { LDY, true }, }, { { STX, true }, { LDY, true }, } },
+    { { { LDY, true }, { STY, true }, {}, }, { { LDY, true }, {}, } },
+    { { { LDY, true }, { INC, true }, { TAY, false }, }, { { INC, true }, { TAY, false }, } },
+    { { { LDY, true }, { INC, true }, { INY, false }, }, { { INC, true }, { LDY, true }, } },
+    { { { LDY, true }, { INC, true }, { LDY, true }, }, { { INC, true }, { LDY, true }, } },
+    { { { LDY, true }, { INC, true }, { DEC, true }, }, { { LDY, true }, {}, } },
+    { { { LDY, true }, { DEC, true }, { TAY, false }, }, { { DEC, true }, { TAY, false }, } },
+    { { { LDY, true }, { DEC, true }, { DEY, false }, }, { { DEC, true }, { LDY, true }, } },
+    { { { LDY, true }, { DEC, true }, { LDY, true }, }, { { DEC, true }, { LDY, true }, } },
+    { { { LDY, true }, { DEC, true }, { INC, true }, }, { { LDY, true }, {}, } },
+    { { { LDY, true }, { ASL, true }, { TAY, false }, }, { { ASL, true }, { TAY, false }, } },
+    { { { LDY, true }, { ASL, true }, { LDY, true }, }, { { ASL, true }, { LDY, true }, } },
+    { { { LDY, true }, { ASL, true }, { ROR, true }, }, { { CLC, false }, { LDY, true }, } },
+    { { { LDY, true }, { LSR, true }, { TAY, false }, }, { { LSR, true }, { TAY, false }, } },
+    { { { LDY, true }, { LSR, true }, { LDY, true }, }, { { LSR, true }, { LDY, true }, } },
+    { { { LDY, true }, { LSR, true }, { ROL, true }, }, { { CLC, false }, { LDY, true }, } },
+    { { { LDY, true }, { ROL, true }, { TAY, false }, }, { { ROL, true }, { TAY, false }, } },
+    { { { LDY, true }, { ROL, true }, { LDY, true }, }, { { ROL, true }, { LDY, true }, } },
+    { { { LDY, true }, { ROL, true }, { ROR, true }, }, { { LDY, true }, {}, } },
+    { { { LDY, true }, { ROR, true }, { TAY, false }, }, { { ROR, true }, { TAY, false }, } },
+    { { { LDY, true }, { ROR, true }, { LDY, true }, }, { { ROR, true }, { LDY, true }, } },
+    { { { LDY, true }, { ROR, true }, { ROL, true }, }, { { LDY, true }, {}, } },
+    { { { LDY, true }, { ADC, true }, { TAY, false }, }, { { ADC, true }, { TAY, false }, } },
+    { { { LDY, true }, { ADC, true }, { LDY, true }, }, { { ADC, true }, { LDY, true }, } },
+    { { { LDY, true }, { SBC, true }, { TAY, false }, }, { { SBC, true }, { TAY, false }, } },
+    { { { LDY, true }, { SBC, true }, { LDY, true }, }, { { SBC, true }, { LDY, true }, } },
+    { { { LDY, true }, { AND, true }, { TAY, false }, }, { { AND, true }, { TAY, false }, } },
+    { { { LDY, true }, { AND, true }, { LDY, true }, }, { { AND, true }, { LDY, true }, } },
+    { { { LDY, true }, { ORA, true }, { TAY, false }, }, { { ORA, true }, { TAY, false }, } },
+    { { { LDY, true }, { ORA, true }, { LDY, true }, }, { { ORA, true }, { LDY, true }, } },
+    { { { LDY, true }, { EOR, true }, { TAY, false }, }, { { EOR, true }, { TAY, false }, } },
+    { { { LDY, true }, { EOR, true }, { LDY, true }, }, { { EOR, true }, { LDY, true }, } },
+    { { { LDY, true }, { CMP, true }, { TAY, false }, }, { { CMP, true }, { TAY, false }, } },
+    { { { LDY, true }, { CMP, true }, { LDY, true }, }, { { CMP, true }, { LDY, true }, } },
+    { { { LDY, true }, { CPX, true }, { LDY, true }, }, { { CPX, true }, { LDY, true }, } },
+    { { { LDY, true }, { CPY, true }, { SEC, false }, }, { { LDY, true }, { CPY, true }, } },
+    { { { LDY, true }, { CPY, true }, { LDY, true }, }, { { SEC, false }, { LDY, true }, } },
+    { { { LDY, true }, { CPY, true }, { STY, true }, }, { { LDY, true }, { CPY, true }, } },
+    { { { LDY, true }, { BIT, true }, { TAY, false }, }, { { BIT, true }, { TAY, false }, } },
+    { { { LDY, true }, { BIT, true }, { LDY, true }, }, { { BIT, true }, { LDY, true }, } },
+    { { { LDY, true }, { DCP, true }, { TAY, false }, }, { { DCP, true }, { TAY, false }, } },
+    { { { LDY, true }, { DCP, true }, { LDY, true }, }, { { DCP, true }, { LDY, true }, } },
+    { { { LDY, true }, { ISC, true }, { TAY, false }, }, { { ISC, true }, { TAY, false }, } },
+    { { { LDY, true }, { ISC, true }, { LDY, true }, }, { { ISC, true }, { LDY, true }, } },
+    { { { LDY, true }, { SLO, true }, { TAY, false }, }, { { SLO, true }, { TAY, false }, } },
+    { { { LDY, true }, { SLO, true }, { LDY, true }, }, { { SLO, true }, { LDY, true }, } },
+    { { { LDY, true }, { RLA, true }, { TAY, false }, }, { { RLA, true }, { TAY, false }, } },
+    { { { LDY, true }, { RLA, true }, { LDY, true }, }, { { RLA, true }, { LDY, true }, } },
+    { { { LDY, true }, { SRE, true }, { TAY, false }, }, { { SRE, true }, { TAY, false }, } },
+    { { { LDY, true }, { SRE, true }, { LDY, true }, }, { { SRE, true }, { LDY, true }, } },
+    { { { LDY, true }, { RRA, true }, { TAY, false }, }, { { RRA, true }, { TAY, false }, } },
+    { { { LDY, true }, { RRA, true }, { LDY, true }, }, { { RRA, true }, { LDY, true }, } },
+    { { { LAX, true }, { TAX, false }, {}, }, { { LAX, true }, {}, } },
+    { { { LAX, true }, { TAY, false }, { TAX, false }, }, { { LAX, true }, { TAY, false }, } },
+    { { { LAX, true }, { TAY, false }, { LDA, true }, }, { { LAX, true }, { TAY, false }, } },
+    { { { LAX, true }, { TAY, false }, { LDX, true }, }, { { LAX, true }, { TAY, false }, } },
+    { { { LAX, true }, { TAY, false }, { LAX, true }, }, { { LAX, true }, { TAY, false }, } },
+    { { { LAX, true }, { TAY, false }, { STA, true }, }, { { LAX, true }, { TAY, false }, } },
+    { { { LAX, true }, { TAY, false }, { AND, true }, }, { { LAX, true }, { TAY, false }, } },
+    { { { LAX, true }, { TAY, false }, { ORA, true }, }, { { LAX, true }, { TAY, false }, } },
+    { { { LAX, true }, { TXA, false }, {}, }, { { LAX, true }, {}, } },
+    { { { LAX, true }, { TYA, false }, { LDX, true }, }, { { TYA, false }, { LDX, true }, } },
+    { { { LAX, true }, { INX, false }, { DEX, false }, }, { { LAX, true }, {}, } },
+    { { { LAX, true }, { INY, false }, { LDA, true }, }, { { INY, false }, { LAX, true }, } },
+    { { { LAX, true }, { INY, false }, { LDX, true }, }, { { INY, false }, { LAX, true }, } },
+    { { { LAX, true }, { INY, false }, { LAX, true }, }, { { INY, false }, { LAX, true }, } },
+    { { { LAX, true }, { DEX, false }, { INX, false }, }, { { LAX, true }, {}, } },
+    { { { LAX, true }, { DEY, false }, { LDA, true }, }, { { DEY, false }, { LAX, true }, } },
+    { { { LAX, true }, { DEY, false }, { LDX, true }, }, { { DEY, false }, { LAX, true }, } },
+    { { { LAX, true }, { DEY, false }, { LAX, true }, }, { { DEY, false }, { LAX, true }, } },
+    { { { LAX, true }, { CLC, false }, { TAX, false }, }, { { CLC, false }, { LAX, true }, } },
+    { { { LAX, true }, { CLC, false }, { TXA, false }, }, { { CLC, false }, { LAX, true }, } },
+    { { { LAX, true }, { CLC, false }, { LDA, true }, }, { { CLC, false }, { LAX, true }, } },
+    { { { LAX, true }, { CLC, false }, { LDX, true }, }, { { CLC, false }, { LAX, true }, } },
+    { { { LAX, true }, { CLC, false }, { LAX, true }, }, { { CLC, false }, { LAX, true }, } },
+    { { { LAX, true }, { CLC, false }, { STA, true }, }, { { CLC, false }, { LAX, true }, } },
+    { { { LAX, true }, { CLC, false }, { STX, true }, }, { { CLC, false }, { LAX, true }, } },
+    { { { LAX, true }, { CLC, false }, { AND, true }, }, { { CLC, false }, { LAX, true }, } },
+    { { { LAX, true }, { CLC, false }, { ORA, true }, }, { { CLC, false }, { LAX, true }, } },
+    { { { LAX, true }, { SEC, false }, { TAX, false }, }, { { SEC, false }, { LAX, true }, } },
+    { { { LAX, true }, { SEC, false }, { TXA, false }, }, { { SEC, false }, { LAX, true }, } },
+    { { { LAX, true }, { SEC, false }, { LDA, true }, }, { { SEC, false }, { LAX, true }, } },
+    { { { LAX, true }, { SEC, false }, { LDX, true }, }, { { SEC, false }, { LAX, true }, } },
+    { { { LAX, true }, { SEC, false }, { LAX, true }, }, { { SEC, false }, { LAX, true }, } },
+    { { { LAX, true }, { SEC, false }, { STA, true }, }, { { SEC, false }, { LAX, true }, } },
+    { { { LAX, true }, { SEC, false }, { STX, true }, }, { { SEC, false }, { LAX, true }, } },
+    { { { LAX, true }, { SEC, false }, { AND, true }, }, { { SEC, false }, { LAX, true }, } },
+    { { { LAX, true }, { SEC, false }, { ORA, true }, }, { { SEC, false }, { LAX, true }, } },
+    { { { LAX, true }, { CLV, false }, { TAX, false }, }, { { CLV, false }, { LAX, true }, } },
+    { { { LAX, true }, { CLV, false }, { TXA, false }, }, { { CLV, false }, { LAX, true }, } },
+    { { { LAX, true }, { CLV, false }, { LDA, true }, }, { { CLV, false }, { LAX, true }, } },
+    { { { LAX, true }, { CLV, false }, { LDX, true }, }, { { CLV, false }, { LAX, true }, } },
+    { { { LAX, true }, { CLV, false }, { LAX, true }, }, { { CLV, false }, { LAX, true }, } },
+    { { { LAX, true }, { CLV, false }, { STA, true }, }, { { CLV, false }, { LAX, true }, } },
+    { { { LAX, true }, { CLV, false }, { STX, true }, }, { { CLV, false }, { LAX, true }, } },
+    { { { LAX, true }, { CLV, false }, { AND, true }, }, { { CLV, false }, { LAX, true }, } },
+    { { { LAX, true }, { CLV, false }, { ORA, true }, }, { { CLV, false }, { LAX, true }, } },
+    { { { LAX, true }, { ASL, false }, { ROR, false }, }, { { CLC, false }, { LAX, true }, } },
+    { { { LAX, true }, { LSR, false }, { ROL, false }, }, { { CLC, false }, { LAX, true }, } },
+    { { { LAX, true }, { ROL, false }, { ROR, false }, }, { { LAX, true }, {}, } },
+    { { { LAX, true }, { ROR, false }, { ROL, false }, }, { { LAX, true }, {}, } },
+    { { { LAX, true }, { LDA, true }, {}, }, { { LAX, true }, {}, } },
+    { { { LAX, true }, { LDX, true }, {}, }, { { LAX, true }, {}, } },
+    { { { LAX, true }, { LDY, true }, {}, }, { { LAX, true }, { TAY, false }, } },
+    { { { LAX, true }, { LAX, true }, {}, }, { { LAX, true }, {}, } },
+    { { { LAX, true }, { STA, true }, {}, }, { { LAX, true }, {}, } },
+    { { { LAX, true }, { STX, true }, {}, }, { { LAX, true }, {}, } },
+    { { { LAX, true }, { STY, true }, { LAX, true }, }, { { STY, true }, { LAX, true }, } },
+    { { { LAX, true }, { INC, true }, { LAX, true }, }, { { INC, true }, { LAX, true }, } },
+    { { { LAX, true }, { INC, true }, { DEC, true }, }, { { LAX, true }, {}, } },
+    { { { LAX, true }, { DEC, true }, { LAX, true }, }, { { DEC, true }, { LAX, true }, } },
+    { { { LAX, true }, { DEC, true }, { INC, true }, }, { { LAX, true }, {}, } },
+    { { { LAX, true }, { ASL, true }, { LAX, true }, }, { { ASL, true }, { LAX, true }, } },
+    { { { LAX, true }, { ASL, true }, { ROR, true }, }, { { CLC, false }, { LAX, true }, } },
+    { { { LAX, true }, { LSR, true }, { LAX, true }, }, { { LSR, true }, { LAX, true }, } },
+    { { { LAX, true }, { LSR, true }, { ROL, true }, }, { { CLC, false }, { LAX, true }, } },
+    { { { LAX, true }, { ROL, true }, { LAX, true }, }, { { ROL, true }, { LAX, true }, } },
+    { { { LAX, true }, { ROL, true }, { ROR, true }, }, { { LAX, true }, {}, } },
+    { { { LAX, true }, { ROR, true }, { LAX, true }, }, { { ROR, true }, { LAX, true }, } },
+    { { { LAX, true }, { ROR, true }, { ROL, true }, }, { { LAX, true }, {}, } },
+    { { { LAX, true }, { SBC, true }, { CLV, false }, }, { { LAX, true }, { SBC, true }, } },
+    { { { LAX, true }, { SBC, true }, { LDA, true }, }, { { CLV, false }, { LAX, true }, } },
+    { { { LAX, true }, { SBC, true }, { LAX, true }, }, { { CLV, false }, { LAX, true }, } },
+    { { { LAX, true }, { AND, true }, {}, }, { { LAX, true }, {}, } },
+    { { { LAX, true }, { ORA, true }, {}, }, { { LAX, true }, {}, } },
+    { { { LAX, true }, { EOR, true }, { AND, true }, }, { { LAX, true }, { EOR, true }, } },
+    { { { LAX, true }, { CMP, true }, { TAX, false }, }, { { SEC, false }, { LAX, true }, } },
+    { { { LAX, true }, { CMP, true }, { SEC, false }, }, { { LAX, true }, { CMP, true }, } },
+    { { { LAX, true }, { CMP, true }, { LDA, true }, }, { { SEC, false }, { LAX, true }, } },
+    { { { LAX, true }, { CMP, true }, { LDX, true }, }, { { SEC, false }, { LAX, true }, } },
+    { { { LAX, true }, { CMP, true }, { LAX, true }, }, { { SEC, false }, { LAX, true }, } },
+    { { { LAX, true }, { CMP, true }, { STA, true }, }, { { LAX, true }, { CMP, true }, } },
+    { { { LAX, true }, { CMP, true }, { AND, true }, }, { { SEC, false }, { LAX, true }, } },
+    { { { LAX, true }, { CMP, true }, { ORA, true }, }, { { SEC, false }, { LAX, true }, } },
+    { { { LAX, true }, { CPX, true }, { TXA, false }, }, { { SEC, false }, { LAX, true }, } },
+    { { { LAX, true }, { CPX, true }, { SEC, false }, }, { { LAX, true }, { CPX, true }, } },
+    { { { LAX, true }, { CPX, true }, { LDA, true }, }, { { SEC, false }, { LAX, true }, } },
+    { { { LAX, true }, { CPX, true }, { LDX, true }, }, { { SEC, false }, { LAX, true }, } },
+    { { { LAX, true }, { CPX, true }, { LAX, true }, }, { { SEC, false }, { LAX, true }, } },
+    { { { LAX, true }, { CPX, true }, { STX, true }, }, { { LAX, true }, { CPX, true }, } },
+    { { { LAX, true }, { CPY, true }, { LDA, true }, }, { { CPY, true }, { LAX, true }, } },
+    { { { LAX, true }, { CPY, true }, { LDX, true }, }, { { CPY, true }, { LAX, true }, } },
+    { { { LAX, true }, { CPY, true }, { LAX, true }, }, { { CPY, true }, { LAX, true }, } },
+    { { { LAX, true }, { BIT, true }, { TAX, false }, }, { { LAX, true }, { BIT, true }, } },
+    { { { LAX, true }, { BIT, true }, { CLV, false }, }, { { CLV, false }, { LAX, true }, } },
+    { { { LAX, true }, { BIT, true }, { LDA, true }, }, { { LAX, true }, { BIT, true }, } },
+    { { { LAX, true }, { BIT, true }, { LDX, true }, }, { { LAX, true }, { BIT, true }, } },
+    { { { LAX, true }, { BIT, true }, { LAX, true }, }, { { LAX, true }, { BIT, true }, } },
+    { { { LAX, true }, { BIT, true }, { STA, true }, }, { { LAX, true }, { BIT, true }, } },
+    { { { LAX, true }, { BIT, true }, { AND, true }, }, { { LAX, true }, { BIT, true }, } },
+    { { { LAX, true }, { BIT, true }, { ORA, true }, }, { { LAX, true }, { BIT, true }, } },
+    { { { LAX, true }, { SLO, true }, { LAX, true }, }, { { ASL, true }, { LAX, true }, } },
+    { { { LAX, true }, { RLA, true }, { LAX, true }, }, { { ROL, true }, { LAX, true }, } },
+    { { { LAX, true }, { SRE, true }, { LAX, true }, }, { { LSR, true }, { LAX, true }, } },
+    { { { STA, true }, { TAX, false }, { LDA, true }, }, { { TAX, false }, { STA, true }, } },
+    { { { STA, true }, { TAX, false }, { STA, true }, }, { { TAX, false }, { STA, true }, } },
+    { { { STA, true }, { TAX, false }, { STX, true }, }, { { TAX, false }, { STA, true }, } },
+    { { { STA, true }, { TAX, false }, { STY, true }, }, { { TAX, false }, { STY, true }, } },
+    { { { STA, true }, { TAX, false }, { SAX, true }, }, { { TAX, false }, { STA, true }, } },
+    { { { STA, true }, { TAX, false }, { AND, true }, }, { { TAX, false }, { STA, true }, } },
+    { { { STA, true }, { TAX, false }, { ORA, true }, }, { { TAX, false }, { STA, true }, } },
+    { { { STA, true }, { TAY, false }, { LDA, true }, }, { { TAY, false }, { STA, true }, } },
+    { { { STA, true }, { TAY, false }, { STA, true }, }, { { TAY, false }, { STA, true }, } },
+    { { { STA, true }, { TAY, false }, { STX, true }, }, { { TAY, false }, { STX, true }, } },
+    { { { STA, true }, { TAY, false }, { STY, true }, }, { { TAY, false }, { STA, true }, } },
+    { { { STA, true }, { TAY, false }, { SAX, true }, }, { { TAY, false }, { SAX, true }, } },
+    { { { STA, true }, { TAY, false }, { AND, true }, }, { { TAY, false }, { STA, true }, } },
+    { { { STA, true }, { TAY, false }, { ORA, true }, }, { { TAY, false }, { STA, true }, } },
+    { { { STA, true }, { TXA, false }, { STA, true }, }, { { TXA, false }, { STA, true }, } },
+    { { { STA, true }, { TXA, false }, { STX, true }, }, { { TXA, false }, { STA, true }, } },
+    { { { STA, true }, { TXA, false }, { SAX, true }, }, { { TXA, false }, { STA, true }, } },
+    { { { STA, true }, { TYA, false }, { STA, true }, }, { { TYA, false }, { STA, true }, } },
+    { { { STA, true }, { TYA, false }, { STY, true }, }, { { TYA, false }, { STA, true }, } },
+    { { { STA, true }, { INX, false }, { STA, true }, }, { { INX, false }, { STA, true }, } },
+    { { { STA, true }, { INX, false }, { STX, true }, }, { { INX, false }, { STX, true }, } },
+    { { { STA, true }, { INX, false }, { SAX, true }, }, { { INX, false }, { SAX, true }, } },
+    { { { STA, true }, { INY, false }, { STA, true }, }, { { INY, false }, { STA, true }, } },
+    { { { STA, true }, { INY, false }, { STY, true }, }, { { INY, false }, { STY, true }, } },
+    { { { STA, true }, { DEX, false }, { STA, true }, }, { { DEX, false }, { STA, true }, } },
+    { { { STA, true }, { DEX, false }, { STX, true }, }, { { DEX, false }, { STX, true }, } },
+    { { { STA, true }, { DEX, false }, { SAX, true }, }, { { DEX, false }, { SAX, true }, } },
+    { { { STA, true }, { DEY, false }, { STA, true }, }, { { DEY, false }, { STA, true }, } },
+    { { { STA, true }, { DEY, false }, { STY, true }, }, { { DEY, false }, { STY, true }, } },
+    { { { STA, true }, { CLC, false }, { STA, true }, }, { { CLC, false }, { STA, true }, } },
+    { { { STA, true }, { CLC, false }, { STX, true }, }, { { CLC, false }, { STX, true }, } },
+    { { { STA, true }, { CLC, false }, { STY, true }, }, { { CLC, false }, { STY, true }, } },
+    { { { STA, true }, { CLC, false }, { SAX, true }, }, { { CLC, false }, { SAX, true }, } },
+    { { { STA, true }, { SEC, false }, { STA, true }, }, { { SEC, false }, { STA, true }, } },
+    { { { STA, true }, { SEC, false }, { STX, true }, }, { { SEC, false }, { STX, true }, } },
+    { { { STA, true }, { SEC, false }, { STY, true }, }, { { SEC, false }, { STY, true }, } },
+    { { { STA, true }, { SEC, false }, { SAX, true }, }, { { SEC, false }, { SAX, true }, } },
+    { { { STA, true }, { CLV, false }, { STA, true }, }, { { CLV, false }, { STA, true }, } },
+    { { { STA, true }, { CLV, false }, { STX, true }, }, { { CLV, false }, { STX, true }, } },
+    { { { STA, true }, { CLV, false }, { STY, true }, }, { { CLV, false }, { STY, true }, } },
+    { { { STA, true }, { CLV, false }, { SAX, true }, }, { { CLV, false }, { SAX, true }, } },
+    { { { STA, true }, { ASL, false }, { STA, true }, }, { { ASL, false }, { STA, true }, } },
+    { { { STA, true }, { ASL, false }, { STX, true }, }, { { ASL, false }, { STX, true }, } },
+    { { { STA, true }, { ASL, false }, { STY, true }, }, { { ASL, false }, { STY, true }, } },
+    { { { STA, true }, { ASL, false }, { SAX, true }, }, { { ASL, false }, { SAX, true }, } },
+    { { { STA, true }, { ASL, false }, { ASL, true }, }, { { ASL, false }, { STA, true }, } },
+    { { { STA, true }, { ASL, false }, { SLO, true }, }, { { ASL, false }, { STA, true }, } },
+    { { { STA, true }, { LSR, false }, { STA, true }, }, { { LSR, false }, { STA, true }, } },
+    { { { STA, true }, { LSR, false }, { STX, true }, }, { { LSR, false }, { STX, true }, } },
+    { { { STA, true }, { LSR, false }, { STY, true }, }, { { LSR, false }, { STY, true }, } },
+    { { { STA, true }, { LSR, false }, { SAX, true }, }, { { LSR, false }, { SAX, true }, } },
+    { { { STA, true }, { LSR, false }, { LSR, true }, }, { { LSR, false }, { STA, true }, } },
+    { { { STA, true }, { ROL, false }, { ROR, false }, }, { { STA, true }, { LDA, true }, } },
+    { { { STA, true }, { ROL, false }, { STA, true }, }, { { ROL, false }, { STA, true }, } },
+    { { { STA, true }, { ROL, false }, { STX, true }, }, { { ROL, false }, { STX, true }, } },
+    { { { STA, true }, { ROL, false }, { STY, true }, }, { { ROL, false }, { STY, true }, } },
+    { { { STA, true }, { ROL, false }, { SAX, true }, }, { { ROL, false }, { SAX, true }, } },
+    { { { STA, true }, { ROR, false }, { ROL, false }, }, { { STA, true }, { LDA, true }, } },
+    { { { STA, true }, { ROR, false }, { STA, true }, }, { { ROR, false }, { STA, true }, } },
+    { { { STA, true }, { ROR, false }, { STX, true }, }, { { ROR, false }, { STX, true }, } },
+    { { { STA, true }, { ROR, false }, { STY, true }, }, { { ROR, false }, { STY, true }, } },
+    { { { STA, true }, { ROR, false }, { SAX, true }, }, { { ROR, false }, { SAX, true }, } },
+    { { { STA, true }, { LDA, true }, { TAY, false }, }, { { TAY, false }, { STA, true }, } },
+    { { { STA, true }, { LDA, true }, { ASL, false }, }, { { STA, true }, { ASL, false }, } },
+    { { { STA, true }, { LDA, true }, { LSR, false }, }, { { STA, true }, { LSR, false }, } },
+    { { { STA, true }, { LDA, true }, { ROL, false }, }, { { STA, true }, { ROL, false }, } },
+    { { { STA, true }, { LDA, true }, { ROR, false }, }, { { STA, true }, { ROR, false }, } },
+    { { { STA, true }, { LDA, true }, { INC, true }, }, { { STA, true }, { INC, true }, } },
+    { { { STA, true }, { LDA, true }, { DEC, true }, }, { { STA, true }, { DEC, true }, } },
+    { { { STA, true }, { LDA, true }, { ASL, true }, }, { { STA, true }, { ASL, true }, } },
+    { { { STA, true }, { LDA, true }, { LSR, true }, }, { { STA, true }, { LSR, true }, } },
+    { { { STA, true }, { LDA, true }, { ROL, true }, }, { { STA, true }, { ROL, true }, } },
+    { { { STA, true }, { LDA, true }, { ROR, true }, }, { { STA, true }, { ROR, true }, } },
+    { { { STA, true }, { LDA, true }, { ADC, true }, }, { { STA, true }, { ADC, true }, } },
+    { { { STA, true }, { LDA, true }, { SBC, true }, }, { { STA, true }, { SBC, true }, } },
+    { { { STA, true }, { LDA, true }, { EOR, true }, }, { { STA, true }, { EOR, true }, } },
+    { { { STA, true }, { LDA, true }, { CMP, true }, }, { { STA, true }, { CMP, true }, } },
+    { { { STA, true }, { LDA, true }, { BIT, true }, }, { { STA, true }, { BIT, true }, } },
+    { { { STA, true }, { LDA, true }, { DCP, true }, }, { { STA, true }, { DCP, true }, } },
+    { { { STA, true }, { LDA, true }, { ISC, true }, }, { { STA, true }, { ISC, true }, } },
+    { { { STA, true }, { LDA, true }, { SLO, true }, }, { { STA, true }, { SLO, true }, } },
+    { { { STA, true }, { LDA, true }, { RLA, true }, }, { { STA, true }, { RLA, true }, } },
+    { { { STA, true }, { LDA, true }, { SRE, true }, }, { { STA, true }, { SRE, true }, } },
+    { { { STA, true }, { LDA, true }, { RRA, true }, }, { { STA, true }, { RRA, true }, } },
+    { { { STA, true }, { LDX, true }, {}, }, { { TAX, false }, { STA, true }, } },
+    { { { STA, true }, { LDY, true }, {}, }, { { TAY, false }, { STA, true }, } },
+    { { { STA, true }, { LAX, true }, {}, }, { { TAX, false }, { STA, true }, } },
+    { { { STA, true }, { STA, true }, {}, }, { { STA, true }, {}, } },
+    { { { STA, true }, { STX, true }, {}, }, { { STX, true }, {}, } },
+    { { { STA, true }, { STY, true }, {}, }, { { STY, true }, {}, } },
+    { { { STA, true }, { SAX, true }, {}, }, { { SAX, true }, {}, } },
+    { { { STA, true }, { INC, true }, { DEC, true }, }, { { STA, true }, { LDA, true }, } },
+    { { { STA, true }, { DEC, true }, { INC, true }, }, { { STA, true }, { LDA, true }, } },
+    { { { STA, true }, { ASL, true }, { ASL, false }, }, { { ASL, false }, { STA, true }, } },
+    { { { STA, true }, { ASL, true }, { LDA, true }, }, { { ASL, false }, { STA, true }, } },
+    { { { STA, true }, { LSR, true }, { LSR, false }, }, { { LSR, false }, { STA, true }, } },
+    { { { STA, true }, { LSR, true }, { LDA, true }, }, { { LSR, false }, { STA, true }, } },
+    { { { STA, true }, { ROL, true }, { LDA, true }, }, { { ROL, false }, { STA, true }, } },
+    { { { STA, true }, { ROL, true }, { ROR, true }, }, { { STA, true }, { LDA, true }, } },
+    { { { STA, true }, { ROR, true }, { LDA, true }, }, { { ROR, false }, { STA, true }, } },
+    { { { STA, true }, { ROR, true }, { ROL, true }, }, { { STA, true }, { LDA, true }, } },
+    { { { STA, true }, { SBC, true }, { CLV, false }, }, { { STA, true }, { SBC, true }, } },
+    { { { STA, true }, { AND, true }, { TAX, false }, }, { { TAX, false }, { STA, true }, } },
+    { { { STA, true }, { AND, true }, { TAY, false }, }, { { TAY, false }, { STA, true }, } },
+    { { { STA, true }, { AND, true }, { ASL, false }, }, { { STA, true }, { ASL, false }, } },
+    { { { STA, true }, { AND, true }, { LSR, false }, }, { { STA, true }, { LSR, false }, } },
+    { { { STA, true }, { AND, true }, { ROL, false }, }, { { STA, true }, { ROL, false }, } },
+    { { { STA, true }, { AND, true }, { ROR, false }, }, { { STA, true }, { ROR, false }, } },
+    { { { STA, true }, { AND, true }, { LDX, true }, }, { { TAX, false }, { STA, true }, } },
+    { { { STA, true }, { AND, true }, { LDY, true }, }, { { TAY, false }, { STA, true }, } },
+    { { { STA, true }, { AND, true }, { STA, true }, }, { { STA, true }, { LDA, true }, } },
+    { { { STA, true }, { AND, true }, { INC, true }, }, { { STA, true }, { INC, true }, } },
+    { { { STA, true }, { AND, true }, { DEC, true }, }, { { STA, true }, { DEC, true }, } },
+    { { { STA, true }, { AND, true }, { ASL, true }, }, { { STA, true }, { ASL, true }, } },
+    { { { STA, true }, { AND, true }, { LSR, true }, }, { { STA, true }, { LSR, true }, } },
+    { { { STA, true }, { AND, true }, { ROL, true }, }, { { STA, true }, { ROL, true }, } },
+    { { { STA, true }, { AND, true }, { ROR, true }, }, { { STA, true }, { ROR, true }, } },
+    { { { STA, true }, { AND, true }, { ADC, true }, }, { { STA, true }, { ADC, true }, } },
+    { { { STA, true }, { AND, true }, { SBC, true }, }, { { STA, true }, { SBC, true }, } },
+    { { { STA, true }, { AND, true }, { EOR, true }, }, { { STA, true }, { EOR, true }, } },
+    { { { STA, true }, { AND, true }, { CMP, true }, }, { { STA, true }, { CMP, true }, } },
+    { { { STA, true }, { AND, true }, { BIT, true }, }, { { STA, true }, { BIT, true }, } },
+    { { { STA, true }, { AND, true }, { DCP, true }, }, { { STA, true }, { DCP, true }, } },
+    { { { STA, true }, { AND, true }, { ISC, true }, }, { { STA, true }, { ISC, true }, } },
+    { { { STA, true }, { AND, true }, { SLO, true }, }, { { STA, true }, { SLO, true }, } },
+    { { { STA, true }, { AND, true }, { RLA, true }, }, { { STA, true }, { RLA, true }, } },
+    { { { STA, true }, { AND, true }, { SRE, true }, }, { { STA, true }, { SRE, true }, } },
+    { { { STA, true }, { AND, true }, { RRA, true }, }, { { STA, true }, { RRA, true }, } },
+    { { { STA, true }, { ORA, true }, { TAX, false }, }, { { TAX, false }, { STA, true }, } },
+    { { { STA, true }, { ORA, true }, { TAY, false }, }, { { TAY, false }, { STA, true }, } },
+    { { { STA, true }, { ORA, true }, { ASL, false }, }, { { STA, true }, { ASL, false }, } },
+    { { { STA, true }, { ORA, true }, { LSR, false }, }, { { STA, true }, { LSR, false }, } },
+    { { { STA, true }, { ORA, true }, { ROL, false }, }, { { STA, true }, { ROL, false }, } },
+    { { { STA, true }, { ORA, true }, { ROR, false }, }, { { STA, true }, { ROR, false }, } },
+    { { { STA, true }, { ORA, true }, { LDX, true }, }, { { TAX, false }, { STA, true }, } },
+    { { { STA, true }, { ORA, true }, { LDY, true }, }, { { TAY, false }, { STA, true }, } },
+    { { { STA, true }, { ORA, true }, { STA, true }, }, { { STA, true }, { LDA, true }, } },
+    { { { STA, true }, { ORA, true }, { INC, true }, }, { { STA, true }, { INC, true }, } },
+    { { { STA, true }, { ORA, true }, { DEC, true }, }, { { STA, true }, { DEC, true }, } },
+    { { { STA, true }, { ORA, true }, { ASL, true }, }, { { STA, true }, { ASL, true }, } },
+    { { { STA, true }, { ORA, true }, { LSR, true }, }, { { STA, true }, { LSR, true }, } },
+    { { { STA, true }, { ORA, true }, { ROL, true }, }, { { STA, true }, { ROL, true }, } },
+    { { { STA, true }, { ORA, true }, { ROR, true }, }, { { STA, true }, { ROR, true }, } },
+    { { { STA, true }, { ORA, true }, { ADC, true }, }, { { STA, true }, { ADC, true }, } },
+    { { { STA, true }, { ORA, true }, { SBC, true }, }, { { STA, true }, { SBC, true }, } },
+    { { { STA, true }, { ORA, true }, { EOR, true }, }, { { STA, true }, { EOR, true }, } },
+    { { { STA, true }, { ORA, true }, { CMP, true }, }, { { STA, true }, { CMP, true }, } },
+    { { { STA, true }, { ORA, true }, { BIT, true }, }, { { STA, true }, { BIT, true }, } },
+    { { { STA, true }, { ORA, true }, { DCP, true }, }, { { STA, true }, { DCP, true }, } },
+    { { { STA, true }, { ORA, true }, { ISC, true }, }, { { STA, true }, { ISC, true }, } },
+    { { { STA, true }, { ORA, true }, { SLO, true }, }, { { STA, true }, { SLO, true }, } },
+    { { { STA, true }, { ORA, true }, { RLA, true }, }, { { STA, true }, { RLA, true }, } },
+    { { { STA, true }, { ORA, true }, { SRE, true }, }, { { STA, true }, { SRE, true }, } },
+    { { { STA, true }, { ORA, true }, { RRA, true }, }, { { STA, true }, { RRA, true }, } },
+    { { { STA, true }, { EOR, true }, { AND, true }, }, { { STA, true }, { EOR, true }, } },
+    { { { STA, true }, { EOR, true }, { SLO, true }, }, { { ASL, false }, { STA, true }, } },
+    { { { STA, true }, { EOR, true }, { SRE, true }, }, { { LSR, false }, { STA, true }, } },
+    { { { STA, true }, { CMP, true }, { SEC, false }, }, { { STA, true }, { CMP, true }, } },
+    { { { STA, true }, { CMP, true }, { STA, true }, }, { { STA, true }, { CMP, true }, } },
+    { { { STA, true }, { BIT, true }, { LDA, true }, }, { { STA, true }, { BIT, true }, } },
+    { { { STA, true }, { BIT, true }, { STA, true }, }, { { STA, true }, { BIT, true }, } },
+    { { { STA, true }, { BIT, true }, { AND, true }, }, { { STA, true }, { BIT, true }, } },
+    { { { STA, true }, { BIT, true }, { ORA, true }, }, { { STA, true }, { BIT, true }, } },
+    { { { STA, true }, { SLO, true }, { LDA, true }, }, { { ASL, false }, { STA, true }, } },
+    { { { STA, true }, { SLO, true }, { AND, true }, }, { { ASL, false }, { STA, true }, } },
+    { { { STA, true }, { RLA, true }, { LDA, true }, }, { { ROL, false }, { STA, true }, } },
+    { { { STA, true }, { RLA, true }, { ORA, true }, }, { { ROL, false }, { STA, true }, } },
+    { { { STA, true }, { SRE, true }, { LDA, true }, }, { { LSR, false }, { STA, true }, } },
+    { { { STX, true }, { TAX, false }, { STA, true }, }, { { TAX, false }, { STA, true }, } },
+    { { { STX, true }, { TAX, false }, { STX, true }, }, { { TAX, false }, { STA, true }, } },
+    { { { STX, true }, { TAX, false }, { SAX, true }, }, { { TAX, false }, { STA, true }, } },
+    { { { STX, true }, { TAY, false }, { STA, true }, }, { { TAY, false }, { STA, true }, } },
+    { { { STX, true }, { TAY, false }, { STX, true }, }, { { TAY, false }, { STX, true }, } },
+    { { { STX, true }, { TAY, false }, { SAX, true }, }, { { TAY, false }, { SAX, true }, } },
+    { { { STX, true }, { TXA, false }, { LDX, true }, }, { { TXA, false }, { STX, true }, } },
+    { { { STX, true }, { TXA, false }, { STA, true }, }, { { TXA, false }, { STA, true }, } },
+    { { { STX, true }, { TXA, false }, { STX, true }, }, { { TXA, false }, { STA, true }, } },
+    { { { STX, true }, { TXA, false }, { STY, true }, }, { { TXA, false }, { STY, true }, } },
+    { { { STX, true }, { TXA, false }, { SAX, true }, }, { { TXA, false }, { STA, true }, } },
+    { { { STX, true }, { TYA, false }, { STX, true }, }, { { TYA, false }, { STX, true }, } },
+    { { { STX, true }, { TYA, false }, { STY, true }, }, { { TYA, false }, { STY, true }, } },
+    { { { STX, true }, { INX, false }, { DEX, false }, }, { { STX, true }, { LDX, true }, } },
+    { { { STX, true }, { INX, false }, { STA, true }, }, { { INX, false }, { STA, true }, } },
+    { { { STX, true }, { INX, false }, { STX, true }, }, { { INX, false }, { STX, true }, } },
+    { { { STX, true }, { INX, false }, { STY, true }, }, { { INX, false }, { STY, true }, } },
+    { { { STX, true }, { INX, false }, { SAX, true }, }, { { INX, false }, { SAX, true }, } },
+    { { { STX, true }, { INX, false }, { INC, true }, }, { { INX, false }, { STX, true }, } },
+    { { { STX, true }, { INY, false }, { STX, true }, }, { { INY, false }, { STX, true }, } },
+    { { { STX, true }, { INY, false }, { STY, true }, }, { { INY, false }, { STY, true }, } },
+    { { { STX, true }, { DEX, false }, { INX, false }, }, { { STX, true }, { LDX, true }, } },
+    { { { STX, true }, { DEX, false }, { STA, true }, }, { { DEX, false }, { STA, true }, } },
+    { { { STX, true }, { DEX, false }, { STX, true }, }, { { DEX, false }, { STX, true }, } },
+    { { { STX, true }, { DEX, false }, { STY, true }, }, { { DEX, false }, { STY, true }, } },
+    { { { STX, true }, { DEX, false }, { SAX, true }, }, { { DEX, false }, { SAX, true }, } },
+    { { { STX, true }, { DEX, false }, { DEC, true }, }, { { DEX, false }, { STX, true }, } },
+    { { { STX, true }, { DEY, false }, { STX, true }, }, { { DEY, false }, { STX, true }, } },
+    { { { STX, true }, { DEY, false }, { STY, true }, }, { { DEY, false }, { STY, true }, } },
+    { { { STX, true }, { CLC, false }, { STA, true }, }, { { CLC, false }, { STA, true }, } },
+    { { { STX, true }, { CLC, false }, { STX, true }, }, { { CLC, false }, { STX, true }, } },
+    { { { STX, true }, { CLC, false }, { STY, true }, }, { { CLC, false }, { STY, true }, } },
+    { { { STX, true }, { CLC, false }, { SAX, true }, }, { { CLC, false }, { SAX, true }, } },
+    { { { STX, true }, { SEC, false }, { STA, true }, }, { { SEC, false }, { STA, true }, } },
+    { { { STX, true }, { SEC, false }, { STX, true }, }, { { SEC, false }, { STX, true }, } },
+    { { { STX, true }, { SEC, false }, { STY, true }, }, { { SEC, false }, { STY, true }, } },
+    { { { STX, true }, { SEC, false }, { SAX, true }, }, { { SEC, false }, { SAX, true }, } },
+    { { { STX, true }, { CLV, false }, { STA, true }, }, { { CLV, false }, { STA, true }, } },
+    { { { STX, true }, { CLV, false }, { STX, true }, }, { { CLV, false }, { STX, true }, } },
+    { { { STX, true }, { CLV, false }, { STY, true }, }, { { CLV, false }, { STY, true }, } },
+    { { { STX, true }, { CLV, false }, { SAX, true }, }, { { CLV, false }, { SAX, true }, } },
+    { { { STX, true }, { ASL, false }, { STA, true }, }, { { ASL, false }, { STA, true }, } },
+    { { { STX, true }, { ASL, false }, { STX, true }, }, { { ASL, false }, { STX, true }, } },
+    { { { STX, true }, { ASL, false }, { SAX, true }, }, { { ASL, false }, { SAX, true }, } },
+    { { { STX, true }, { LSR, false }, { STA, true }, }, { { LSR, false }, { STA, true }, } },
+    { { { STX, true }, { LSR, false }, { STX, true }, }, { { LSR, false }, { STX, true }, } },
+    { { { STX, true }, { LSR, false }, { SAX, true }, }, { { LSR, false }, { SAX, true }, } },
+    { { { STX, true }, { ROL, false }, { STA, true }, }, { { ROL, false }, { STA, true }, } },
+    { { { STX, true }, { ROL, false }, { STX, true }, }, { { ROL, false }, { STX, true }, } },
+    { { { STX, true }, { ROL, false }, { SAX, true }, }, { { ROL, false }, { SAX, true }, } },
+    { { { STX, true }, { ROR, false }, { STA, true }, }, { { ROR, false }, { STA, true }, } },
+    { { { STX, true }, { ROR, false }, { STX, true }, }, { { ROR, false }, { STX, true }, } },
+    { { { STX, true }, { ROR, false }, { SAX, true }, }, { { ROR, false }, { SAX, true }, } },
+    { { { STX, true }, { LDA, true }, {}, }, { { TXA, false }, { STX, true }, } },
+    { { { STX, true }, { LDX, true }, { INX, false }, }, { { STX, true }, { INX, false }, } },
+    { { { STX, true }, { LDX, true }, { DEX, false }, }, { { STX, true }, { DEX, false }, } },
+    { { { STX, true }, { LDX, true }, { LDY, true }, }, { { STX, true }, { LDY, true }, } },
+    { { { STX, true }, { LDX, true }, { INC, true }, }, { { STX, true }, { INC, true }, } },
+    { { { STX, true }, { LDX, true }, { DEC, true }, }, { { STX, true }, { DEC, true }, } },
+    { { { STX, true }, { LDX, true }, { ASL, true }, }, { { STX, true }, { ASL, true }, } },
+    { { { STX, true }, { LDX, true }, { LSR, true }, }, { { STX, true }, { LSR, true }, } },
+    { { { STX, true }, { LDX, true }, { ROL, true }, }, { { STX, true }, { ROL, true }, } },
+    { { { STX, true }, { LDX, true }, { ROR, true }, }, { { STX, true }, { ROR, true }, } },
+    { { { STX, true }, { LDX, true }, { CPX, true }, }, { { STX, true }, { CPX, true }, } },
+    { { { STX, true }, { LDY, true }, { LDX, true }, }, { { STX, true }, { LDY, true }, } },
+    { { { STX, true }, { LDY, true }, { STX, true }, }, { { STX, true }, { LDY, true }, } },
+    { { { STX, true }, { LAX, true }, {}, }, { { TXA, false }, { STX, true }, } },
+    { { { STX, true }, { STA, true }, {}, }, { { STA, true }, {}, } },
+    { { { STX, true }, { STX, true }, {}, }, { { STX, true }, {}, } },
+    { { { STX, true }, { STY, true }, {}, }, { { STY, true }, {}, } },
+    { { { STX, true }, { SAX, true }, {}, }, { { SAX, true }, {}, } },
+    { { { STX, true }, { INC, true }, { INX, false }, }, { { INX, false }, { STX, true }, } },
+    { { { STX, true }, { INC, true }, { LDX, true }, }, { { INX, false }, { STX, true }, } },
+    { { { STX, true }, { INC, true }, { DEC, true }, }, { { STX, true }, { LDX, true }, } },
+    { { { STX, true }, { DEC, true }, { DEX, false }, }, { { DEX, false }, { STX, true }, } },
+    { { { STX, true }, { DEC, true }, { LDX, true }, }, { { DEX, false }, { STX, true }, } },
+    { { { STX, true }, { DEC, true }, { INC, true }, }, { { STX, true }, { LDX, true }, } },
+    { { { STX, true }, { ROL, true }, { ROR, true }, }, { { STX, true }, { LDX, true }, } },
+    { { { STX, true }, { ROR, true }, { ROL, true }, }, { { STX, true }, { LDX, true }, } },
+    { { { STX, true }, { CPX, true }, { SEC, false }, }, { { STX, true }, { CPX, true }, } },
+    { { { STX, true }, { CPX, true }, { STX, true }, }, { { STX, true }, { CPX, true }, } },
+    { { { STY, true }, { TAX, false }, { STA, true }, }, { { TAX, false }, { STA, true }, } },
+    { { { STY, true }, { TAX, false }, { STY, true }, }, { { TAX, false }, { STY, true }, } },
+    { { { STY, true }, { TAY, false }, { STA, true }, }, { { TAY, false }, { STA, true }, } },
+    { { { STY, true }, { TAY, false }, { STY, true }, }, { { TAY, false }, { STA, true }, } },
+    { { { STY, true }, { TXA, false }, { STX, true }, }, { { TXA, false }, { STX, true }, } },
+    { { { STY, true }, { TXA, false }, { STY, true }, }, { { TXA, false }, { STY, true }, } },
+    { { { STY, true }, { TYA, false }, { LDX, true }, }, { { STY, true }, { LAX, true }, } },
+    { { { STY, true }, { TYA, false }, { LDY, true }, }, { { TYA, false }, { STY, true }, } },
+    { { { STY, true }, { TYA, false }, { STA, true }, }, { { TYA, false }, { STA, true }, } },
+    { { { STY, true }, { TYA, false }, { STX, true }, }, { { TYA, false }, { STX, true }, } },
+    { { { STY, true }, { TYA, false }, { STY, true }, }, { { TYA, false }, { STA, true }, } },
+    { { { STY, true }, { INX, false }, { STX, true }, }, { { INX, false }, { STX, true }, } },
+    { { { STY, true }, { INX, false }, { STY, true }, }, { { INX, false }, { STY, true }, } },
+    { { { STY, true }, { INY, false }, { DEY, false }, }, { { STY, true }, { LDY, true }, } },
+    { { { STY, true }, { INY, false }, { STA, true }, }, { { INY, false }, { STA, true }, } },
+    { { { STY, true }, { INY, false }, { STX, true }, }, { { INY, false }, { STX, true }, } },
+    { { { STY, true }, { INY, false }, { STY, true }, }, { { INY, false }, { STY, true }, } },
+    { { { STY, true }, { INY, false }, { INC, true }, }, { { INY, false }, { STY, true }, } },
+    { { { STY, true }, { DEX, false }, { STX, true }, }, { { DEX, false }, { STX, true }, } },
+    { { { STY, true }, { DEX, false }, { STY, true }, }, { { DEX, false }, { STY, true }, } },
+    { { { STY, true }, { DEY, false }, { INY, false }, }, { { STY, true }, { LDY, true }, } },
+    { { { STY, true }, { DEY, false }, { STA, true }, }, { { DEY, false }, { STA, true }, } },
+    { { { STY, true }, { DEY, false }, { STX, true }, }, { { DEY, false }, { STX, true }, } },
+    { { { STY, true }, { DEY, false }, { STY, true }, }, { { DEY, false }, { STY, true }, } },
+    { { { STY, true }, { DEY, false }, { DEC, true }, }, { { DEY, false }, { STY, true }, } },
+    { { { STY, true }, { CLC, false }, { STA, true }, }, { { CLC, false }, { STA, true }, } },
+    { { { STY, true }, { CLC, false }, { STX, true }, }, { { CLC, false }, { STX, true }, } },
+    { { { STY, true }, { CLC, false }, { STY, true }, }, { { CLC, false }, { STY, true }, } },
+    { { { STY, true }, { SEC, false }, { STA, true }, }, { { SEC, false }, { STA, true }, } },
+    { { { STY, true }, { SEC, false }, { STX, true }, }, { { SEC, false }, { STX, true }, } },
+    { { { STY, true }, { SEC, false }, { STY, true }, }, { { SEC, false }, { STY, true }, } },
+    { { { STY, true }, { CLV, false }, { STA, true }, }, { { CLV, false }, { STA, true }, } },
+    { { { STY, true }, { CLV, false }, { STX, true }, }, { { CLV, false }, { STX, true }, } },
+    { { { STY, true }, { CLV, false }, { STY, true }, }, { { CLV, false }, { STY, true }, } },
+    { { { STY, true }, { ASL, false }, { STA, true }, }, { { ASL, false }, { STA, true }, } },
+    { { { STY, true }, { ASL, false }, { STY, true }, }, { { ASL, false }, { STY, true }, } },
+    { { { STY, true }, { LSR, false }, { STA, true }, }, { { LSR, false }, { STA, true }, } },
+    { { { STY, true }, { LSR, false }, { STY, true }, }, { { LSR, false }, { STY, true }, } },
+    { { { STY, true }, { ROL, false }, { STA, true }, }, { { ROL, false }, { STA, true }, } },
+    { { { STY, true }, { ROL, false }, { STY, true }, }, { { ROL, false }, { STY, true }, } },
+    { { { STY, true }, { ROR, false }, { STA, true }, }, { { ROR, false }, { STA, true }, } },
+    { { { STY, true }, { ROR, false }, { STY, true }, }, { { ROR, false }, { STY, true }, } },
+    { { { STY, true }, { LDA, true }, {}, }, { { TYA, false }, { STY, true }, } },
+    { { { STY, true }, { LDX, true }, { TYA, false }, }, { { STY, true }, { LAX, true }, } },
+    { { { STY, true }, { LDX, true }, { LDY, true }, }, { { STY, true }, { LDX, true }, } },
+    { { { STY, true }, { LDX, true }, { STY, true }, }, { { STY, true }, { LDX, true }, } },
+    { { { STY, true }, { LDY, true }, { TYA, false }, }, { { TYA, false }, { STY, true }, } },
+    { { { STY, true }, { LDY, true }, { INY, false }, }, { { STY, true }, { INY, false }, } },
+    { { { STY, true }, { LDY, true }, { DEY, false }, }, { { STY, true }, { DEY, false }, } },
+    { { { STY, true }, { LDY, true }, { LDX, true }, }, { { STY, true }, { LDX, true }, } },
+    { { { STY, true }, { LDY, true }, { INC, true }, }, { { STY, true }, { INC, true }, } },
+    { { { STY, true }, { LDY, true }, { DEC, true }, }, { { STY, true }, { DEC, true }, } },
+    { { { STY, true }, { LDY, true }, { ASL, true }, }, { { STY, true }, { ASL, true }, } },
+    { { { STY, true }, { LDY, true }, { LSR, true }, }, { { STY, true }, { LSR, true }, } },
+    { { { STY, true }, { LDY, true }, { ROL, true }, }, { { STY, true }, { ROL, true }, } },
+    { { { STY, true }, { LDY, true }, { ROR, true }, }, { { STY, true }, { ROR, true }, } },
+    { { { STY, true }, { LDY, true }, { CPY, true }, }, { { STY, true }, { CPY, true }, } },
+    { { { STY, true }, { LAX, true }, { TYA, false }, }, { { STY, true }, { LAX, true }, } },
+    { { { STY, true }, { LAX, true }, { STY, true }, }, { { STY, true }, { LAX, true }, } },
+    { { { STY, true }, { STA, true }, {}, }, { { STA, true }, {}, } },
+    { { { STY, true }, { STX, true }, {}, }, { { STX, true }, {}, } },
+    { { { STY, true }, { STY, true }, {}, }, { { STY, true }, {}, } },
+    { { { STY, true }, { INC, true }, { INY, false }, }, { { INY, false }, { STY, true }, } },
+    { { { STY, true }, { INC, true }, { LDY, true }, }, { { INY, false }, { STY, true }, } },
+    { { { STY, true }, { INC, true }, { DEC, true }, }, { { STY, true }, { LDY, true }, } },
+    { { { STY, true }, { DEC, true }, { DEY, false }, }, { { DEY, false }, { STY, true }, } },
+    { { { STY, true }, { DEC, true }, { LDY, true }, }, { { DEY, false }, { STY, true }, } },
+    { { { STY, true }, { DEC, true }, { INC, true }, }, { { STY, true }, { LDY, true }, } },
+    { { { STY, true }, { ROL, true }, { ROR, true }, }, { { STY, true }, { LDY, true }, } },
+    { { { STY, true }, { ROR, true }, { ROL, true }, }, { { STY, true }, { LDY, true }, } },
+    { { { STY, true }, { CPY, true }, { SEC, false }, }, { { STY, true }, { CPY, true }, } },
+    { { { STY, true }, { CPY, true }, { STY, true }, }, { { STY, true }, { CPY, true }, } },
+    { { { SAX, true }, { TAX, false }, { STA, true }, }, { { TAX, false }, { STA, true }, } },
+    { { { SAX, true }, { TAX, false }, { STX, true }, }, { { TAX, false }, { STA, true }, } },
+    { { { SAX, true }, { TAX, false }, { SAX, true }, }, { { TAX, false }, { STA, true }, } },
+    { { { SAX, true }, { TAY, false }, { STA, true }, }, { { TAY, false }, { STA, true }, } },
+    { { { SAX, true }, { TAY, false }, { STX, true }, }, { { TAY, false }, { STX, true }, } },
+    { { { SAX, true }, { TAY, false }, { SAX, true }, }, { { TAY, false }, { SAX, true }, } },
+    { { { SAX, true }, { TXA, false }, { STA, true }, }, { { TXA, false }, { STA, true }, } },
+    { { { SAX, true }, { TXA, false }, { STX, true }, }, { { TXA, false }, { STA, true }, } },
+    { { { SAX, true }, { TXA, false }, { SAX, true }, }, { { TXA, false }, { STA, true }, } },
+    { { { SAX, true }, { INX, false }, { STA, true }, }, { { INX, false }, { STA, true }, } },
+    { { { SAX, true }, { INX, false }, { STX, true }, }, { { INX, false }, { STX, true }, } },
+    { { { SAX, true }, { INX, false }, { SAX, true }, }, { { INX, false }, { SAX, true }, } },
+    { { { SAX, true }, { DEX, false }, { STA, true }, }, { { DEX, false }, { STA, true }, } },
+    { { { SAX, true }, { DEX, false }, { STX, true }, }, { { DEX, false }, { STX, true }, } },
+    { { { SAX, true }, { DEX, false }, { SAX, true }, }, { { DEX, false }, { SAX, true }, } },
+    { { { SAX, true }, { CLC, false }, { STA, true }, }, { { CLC, false }, { STA, true }, } },
+    { { { SAX, true }, { CLC, false }, { STX, true }, }, { { CLC, false }, { STX, true }, } },
+    { { { SAX, true }, { CLC, false }, { SAX, true }, }, { { CLC, false }, { SAX, true }, } },
+    { { { SAX, true }, { SEC, false }, { STA, true }, }, { { SEC, false }, { STA, true }, } },
+    { { { SAX, true }, { SEC, false }, { STX, true }, }, { { SEC, false }, { STX, true }, } },
+    { { { SAX, true }, { SEC, false }, { SAX, true }, }, { { SEC, false }, { SAX, true }, } },
+    { { { SAX, true }, { CLV, false }, { STA, true }, }, { { CLV, false }, { STA, true }, } },
+    { { { SAX, true }, { CLV, false }, { STX, true }, }, { { CLV, false }, { STX, true }, } },
+    { { { SAX, true }, { CLV, false }, { SAX, true }, }, { { CLV, false }, { SAX, true }, } },
+    { { { SAX, true }, { ASL, false }, { STA, true }, }, { { ASL, false }, { STA, true }, } },
+    { { { SAX, true }, { ASL, false }, { STX, true }, }, { { ASL, false }, { STX, true }, } },
+    { { { SAX, true }, { ASL, false }, { SAX, true }, }, { { ASL, false }, { SAX, true }, } },
+    { { { SAX, true }, { LSR, false }, { STA, true }, }, { { LSR, false }, { STA, true }, } },
+    { { { SAX, true }, { LSR, false }, { STX, true }, }, { { LSR, false }, { STX, true }, } },
+    { { { SAX, true }, { LSR, false }, { SAX, true }, }, { { LSR, false }, { SAX, true }, } },
+    { { { SAX, true }, { ROL, false }, { STA, true }, }, { { ROL, false }, { STA, true }, } },
+    { { { SAX, true }, { ROL, false }, { STX, true }, }, { { ROL, false }, { STX, true }, } },
+    { { { SAX, true }, { ROL, false }, { SAX, true }, }, { { ROL, false }, { SAX, true }, } },
+    { { { SAX, true }, { ROR, false }, { STA, true }, }, { { ROR, false }, { STA, true }, } },
+    { { { SAX, true }, { ROR, false }, { STX, true }, }, { { ROR, false }, { STX, true }, } },
+    { { { SAX, true }, { ROR, false }, { SAX, true }, }, { { ROR, false }, { SAX, true }, } },
+    { { { SAX, true }, { STA, true }, {}, }, { { STA, true }, {}, } },
+    { { { SAX, true }, { STX, true }, {}, }, { { STX, true }, {}, } },
+    { { { SAX, true }, { SAX, true }, {}, }, { { SAX, true }, {}, } },
+    { { { INC, true }, { TAX, false }, { STA, true }, }, { { TAX, false }, { STA, true }, } },
+    { { { INC, true }, { TAX, false }, { SBC, true }, }, { { TAX, false }, { ISC, true }, } },
+    { { { INC, true }, { TAX, false }, { DCP, true }, }, { { TAX, false }, { CMP, true }, } },
+    { { { INC, true }, { TAY, false }, { STA, true }, }, { { TAY, false }, { STA, true }, } },
+    { { { INC, true }, { TAY, false }, { SBC, true }, }, { { TAY, false }, { ISC, true }, } },
+    { { { INC, true }, { TAY, false }, { DCP, true }, }, { { TAY, false }, { CMP, true }, } },
+    { { { INC, true }, { TXA, false }, { STX, true }, }, { { TXA, false }, { STX, true }, } },
+    { { { INC, true }, { TYA, false }, { STY, true }, }, { { TYA, false }, { STY, true }, } },
+    { { { INC, true }, { INX, false }, { STX, true }, }, { { INX, false }, { STX, true }, } },
+    { { { INC, true }, { INY, false }, { STY, true }, }, { { INY, false }, { STY, true }, } },
+    { { { INC, true }, { DEX, false }, { STX, true }, }, { { DEX, false }, { STX, true }, } },
+    { { { INC, true }, { DEY, false }, { STY, true }, }, { { DEY, false }, { STY, true }, } },
+    { { { INC, true }, { CLC, false }, { DEC, true }, }, { { ASL, true }, { ROR, true }, } },
+    { { { INC, true }, { CLC, false }, { SBC, true }, }, { { CLC, false }, { ISC, true }, } },
+    { { { INC, true }, { SEC, false }, { SBC, true }, }, { { SEC, false }, { ISC, true }, } },
+    { { { INC, true }, { CLV, false }, { DCP, true }, }, { { CLV, false }, { CMP, true }, } },
+    { { { INC, true }, { ASL, false }, { STA, true }, }, { { ASL, false }, { STA, true }, } },
+    { { { INC, true }, { ASL, false }, { SBC, true }, }, { { ASL, false }, { ISC, true }, } },
+    { { { INC, true }, { ASL, false }, { DCP, true }, }, { { ASL, false }, { CMP, true }, } },
+    { { { INC, true }, { LSR, false }, { STA, true }, }, { { LSR, false }, { STA, true }, } },
+    { { { INC, true }, { LSR, false }, { SBC, true }, }, { { LSR, false }, { ISC, true }, } },
+    { { { INC, true }, { LSR, false }, { DCP, true }, }, { { LSR, false }, { CMP, true }, } },
+    { { { INC, true }, { ROL, false }, { STA, true }, }, { { ROL, false }, { STA, true }, } },
+    { { { INC, true }, { ROL, false }, { SBC, true }, }, { { ROL, false }, { ISC, true }, } },
+    { { { INC, true }, { ROL, false }, { DCP, true }, }, { { ROL, false }, { CMP, true }, } },
+    { { { INC, true }, { ROR, false }, { STA, true }, }, { { ROR, false }, { STA, true }, } },
+    { { { INC, true }, { ROR, false }, { SBC, true }, }, { { ROR, false }, { ISC, true }, } },
+    { { { INC, true }, { ROR, false }, { DCP, true }, }, { { ROR, false }, { CMP, true }, } },
+    { { { INC, true }, { STA, true }, { TAX, false }, }, { { TAX, false }, { STA, true }, } },
+    { { { INC, true }, { STA, true }, { TAY, false }, }, { { TAY, false }, { STA, true }, } },
+    { { { INC, true }, { STA, true }, { ASL, false }, }, { { STA, true }, { ASL, false }, } },
+    { { { INC, true }, { STA, true }, { LSR, false }, }, { { STA, true }, { LSR, false }, } },
+    { { { INC, true }, { STA, true }, { ROL, false }, }, { { STA, true }, { ROL, false }, } },
+    { { { INC, true }, { STA, true }, { ROR, false }, }, { { STA, true }, { ROR, false }, } },
+    { { { INC, true }, { STA, true }, { LDA, true }, }, { { STA, true }, { LDA, true }, } },
+    { { { INC, true }, { STA, true }, { INC, true }, }, { { STA, true }, { INC, true }, } },
+    { { { INC, true }, { STA, true }, { DEC, true }, }, { { STA, true }, { DEC, true }, } },
+    { { { INC, true }, { STA, true }, { ASL, true }, }, { { STA, true }, { ASL, true }, } },
+    { { { INC, true }, { STA, true }, { LSR, true }, }, { { STA, true }, { LSR, true }, } },
+    { { { INC, true }, { STA, true }, { ROL, true }, }, { { STA, true }, { ROL, true }, } },
+    { { { INC, true }, { STA, true }, { ROR, true }, }, { { STA, true }, { ROR, true }, } },
+    { { { INC, true }, { STA, true }, { ADC, true }, }, { { STA, true }, { ADC, true }, } },
+    { { { INC, true }, { STA, true }, { SBC, true }, }, { { STA, true }, { SBC, true }, } },
+    { { { INC, true }, { STA, true }, { AND, true }, }, { { STA, true }, { LDA, true }, } },
+    { { { INC, true }, { STA, true }, { ORA, true }, }, { { STA, true }, { LDA, true }, } },
+    { { { INC, true }, { STA, true }, { EOR, true }, }, { { STA, true }, { EOR, true }, } },
+    { { { INC, true }, { STA, true }, { CMP, true }, }, { { STA, true }, { CMP, true }, } },
+    { { { INC, true }, { STA, true }, { BIT, true }, }, { { STA, true }, { BIT, true }, } },
+    { { { INC, true }, { STA, true }, { DCP, true }, }, { { STA, true }, { DCP, true }, } },
+    { { { INC, true }, { STA, true }, { ISC, true }, }, { { STA, true }, { ISC, true }, } },
+    { { { INC, true }, { STA, true }, { SLO, true }, }, { { STA, true }, { SLO, true }, } },
+    { { { INC, true }, { STA, true }, { RLA, true }, }, { { STA, true }, { RLA, true }, } },
+    { { { INC, true }, { STA, true }, { SRE, true }, }, { { STA, true }, { SRE, true }, } },
+    { { { INC, true }, { STA, true }, { RRA, true }, }, { { STA, true }, { RRA, true }, } },
+    { { { INC, true }, { STX, true }, { TXA, false }, }, { { TXA, false }, { STX, true }, } },
+    { { { INC, true }, { STX, true }, { INX, false }, }, { { STX, true }, { INX, false }, } },
+    { { { INC, true }, { STX, true }, { DEX, false }, }, { { STX, true }, { DEX, false }, } },
+    { { { INC, true }, { STX, true }, { LDX, true }, }, { { STX, true }, { LDX, true }, } },
+    { { { INC, true }, { STX, true }, { LDY, true }, }, { { STX, true }, { LDY, true }, } },
+    { { { INC, true }, { STX, true }, { INC, true }, }, { { STX, true }, { INC, true }, } },
+    { { { INC, true }, { STX, true }, { DEC, true }, }, { { STX, true }, { DEC, true }, } },
+    { { { INC, true }, { STX, true }, { ASL, true }, }, { { STX, true }, { ASL, true }, } },
+    { { { INC, true }, { STX, true }, { LSR, true }, }, { { STX, true }, { LSR, true }, } },
+    { { { INC, true }, { STX, true }, { ROL, true }, }, { { STX, true }, { ROL, true }, } },
+    { { { INC, true }, { STX, true }, { ROR, true }, }, { { STX, true }, { ROR, true }, } },
+    { { { INC, true }, { STX, true }, { CPX, true }, }, { { STX, true }, { CPX, true }, } },
+    { { { INC, true }, { STY, true }, { TYA, false }, }, { { TYA, false }, { STY, true }, } },
+    { { { INC, true }, { STY, true }, { INY, false }, }, { { STY, true }, { INY, false }, } },
+    { { { INC, true }, { STY, true }, { DEY, false }, }, { { STY, true }, { DEY, false }, } },
+    { { { INC, true }, { STY, true }, { LDX, true }, }, { { STY, true }, { LDX, true }, } },
+    { { { INC, true }, { STY, true }, { LDY, true }, }, { { STY, true }, { LDY, true }, } },
+    { { { INC, true }, { STY, true }, { LAX, true }, }, { { STY, true }, { LAX, true }, } },
+    { { { INC, true }, { STY, true }, { INC, true }, }, { { STY, true }, { INC, true }, } },
+    { { { INC, true }, { STY, true }, { DEC, true }, }, { { STY, true }, { DEC, true }, } },
+    { { { INC, true }, { STY, true }, { ASL, true }, }, { { STY, true }, { ASL, true }, } },
+    { { { INC, true }, { STY, true }, { LSR, true }, }, { { STY, true }, { LSR, true }, } },
+    { { { INC, true }, { STY, true }, { ROL, true }, }, { { STY, true }, { ROL, true }, } },
+    { { { INC, true }, { STY, true }, { ROR, true }, }, { { STY, true }, { ROR, true }, } },
+    { { { INC, true }, { STY, true }, { CPY, true }, }, { { STY, true }, { CPY, true }, } },
+    { { { INC, true }, { INC, true }, { DEC, true }, }, { { INC, true }, {}, } },
+    { { { INC, true }, { DEC, true }, { TAX, false }, }, { { TAX, false }, {}, } },
+    { { { INC, true }, { DEC, true }, { TAY, false }, }, { { TAY, false }, {}, } },
+    { { { INC, true }, { DEC, true }, { TXA, false }, }, { { TXA, false }, {}, } },
+    { { { INC, true }, { DEC, true }, { TYA, false }, }, { { TYA, false }, {}, } },
+    { { { INC, true }, { DEC, true }, { INX, false }, }, { { INX, false }, {}, } },
+    { { { INC, true }, { DEC, true }, { INY, false }, }, { { INY, false }, {}, } },
+    { { { INC, true }, { DEC, true }, { DEX, false }, }, { { DEX, false }, {}, } },
+    { { { INC, true }, { DEC, true }, { DEY, false }, }, { { DEY, false }, {}, } },
+    { { { INC, true }, { DEC, true }, { CLC, false }, }, { { ASL, true }, { ROR, true }, } },
+    { { { INC, true }, { DEC, true }, { ASL, false }, }, { { ASL, false }, {}, } },
+    { { { INC, true }, { DEC, true }, { LSR, false }, }, { { LSR, false }, {}, } },
+    { { { INC, true }, { DEC, true }, { ROL, false }, }, { { ROL, false }, {}, } },
+    { { { INC, true }, { DEC, true }, { ROR, false }, }, { { ROR, false }, {}, } },
+    { { { INC, true }, { DEC, true }, { LDA, true }, }, { { LDA, true }, {}, } },
+    { { { INC, true }, { DEC, true }, { LDX, true }, }, { { LDX, true }, {}, } },
+    { { { INC, true }, { DEC, true }, { LDY, true }, }, { { LDY, true }, {}, } },
+    { { { INC, true }, { DEC, true }, { LAX, true }, }, { { LAX, true }, {}, } },
+    { { { INC, true }, { DEC, true }, { INC, true }, }, { { INC, true }, {}, } },
+    { { { INC, true }, { DEC, true }, { DEC, true }, }, { { DEC, true }, {}, } },
+    { { { INC, true }, { DEC, true }, { ASL, true }, }, { { ASL, true }, {}, } },
+    { { { INC, true }, { DEC, true }, { LSR, true }, }, { { LSR, true }, {}, } },
+    { { { INC, true }, { DEC, true }, { ROL, true }, }, { { ROL, true }, {}, } },
+    { { { INC, true }, { DEC, true }, { ROR, true }, }, { { ROR, true }, {}, } },
+    { { { INC, true }, { DEC, true }, { ADC, true }, }, { { ADC, true }, {}, } },
+    { { { INC, true }, { DEC, true }, { SBC, true }, }, { { SBC, true }, {}, } },
+    { { { INC, true }, { DEC, true }, { AND, true }, }, { { AND, true }, {}, } },
+    { { { INC, true }, { DEC, true }, { ORA, true }, }, { { ORA, true }, {}, } },
+    { { { INC, true }, { DEC, true }, { EOR, true }, }, { { EOR, true }, {}, } },
+    { { { INC, true }, { DEC, true }, { CPX, true }, }, { { CPX, true }, {}, } },
+    { { { INC, true }, { DEC, true }, { CPY, true }, }, { { CPY, true }, {}, } },
+    { { { INC, true }, { DEC, true }, { BIT, true }, }, { { BIT, true }, {}, } },
+    { { { INC, true }, { DEC, true }, { DCP, true }, }, { { DCP, true }, {}, } },
+    { { { INC, true }, { DEC, true }, { SLO, true }, }, { { SLO, true }, {}, } },
+    { { { INC, true }, { DEC, true }, { RLA, true }, }, { { RLA, true }, {}, } },
+    { { { INC, true }, { DEC, true }, { SRE, true }, }, { { SRE, true }, {}, } },
+    { { { INC, true }, { DEC, true }, { RRA, true }, }, { { RRA, true }, {}, } },
+    { { { INC, true }, { ASL, true }, { ROR, true }, }, { { CLC, false }, { INC, true }, } },
+    { { { INC, true }, { LSR, true }, { ROL, true }, }, { { CLC, false }, { INC, true }, } },
+    { { { INC, true }, { ROL, true }, { ROR, true }, }, { { INC, true }, {}, } },
+    { { { INC, true }, { ROR, true }, { ROL, true }, }, { { INC, true }, {}, } },
+    { { { INC, true }, { SBC, true }, {}, }, { { ISC, true }, {}, } },
+    { { { INC, true }, { DCP, true }, {}, }, { { CMP, true }, {}, } },
+    { { { DEC, true }, { TAX, false }, { STA, true }, }, { { TAX, false }, { STA, true }, } },
+    { { { DEC, true }, { TAX, false }, { CMP, true }, }, { { TAX, false }, { DCP, true }, } },
+    { { { DEC, true }, { TAX, false }, { ISC, true }, }, { { TAX, false }, { SBC, true }, } },
+    { { { DEC, true }, { TAY, false }, { STA, true }, }, { { TAY, false }, { STA, true }, } },
+    { { { DEC, true }, { TAY, false }, { CMP, true }, }, { { TAY, false }, { DCP, true }, } },
+    { { { DEC, true }, { TAY, false }, { ISC, true }, }, { { TAY, false }, { SBC, true }, } },
+    { { { DEC, true }, { TXA, false }, { STX, true }, }, { { TXA, false }, { STX, true }, } },
+    { { { DEC, true }, { TYA, false }, { STY, true }, }, { { TYA, false }, { STY, true }, } },
+    { { { DEC, true }, { INX, false }, { STX, true }, }, { { INX, false }, { STX, true }, } },
+    { { { DEC, true }, { INY, false }, { STY, true }, }, { { INY, false }, { STY, true }, } },
+    { { { DEC, true }, { DEX, false }, { STX, true }, }, { { DEX, false }, { STX, true }, } },
+    { { { DEC, true }, { DEY, false }, { STY, true }, }, { { DEY, false }, { STY, true }, } },
+    { { { DEC, true }, { CLC, false }, { INC, true }, }, { { ASL, true }, { ROR, true }, } },
+    { { { DEC, true }, { CLC, false }, { ISC, true }, }, { { CLC, false }, { SBC, true }, } },
+    { { { DEC, true }, { SEC, false }, { ISC, true }, }, { { SEC, false }, { SBC, true }, } },
+    { { { DEC, true }, { CLV, false }, { CMP, true }, }, { { CLV, false }, { DCP, true }, } },
+    { { { DEC, true }, { ASL, false }, { STA, true }, }, { { ASL, false }, { STA, true }, } },
+    { { { DEC, true }, { ASL, false }, { CMP, true }, }, { { ASL, false }, { DCP, true }, } },
+    { { { DEC, true }, { ASL, false }, { ISC, true }, }, { { ASL, false }, { SBC, true }, } },
+    { { { DEC, true }, { LSR, false }, { STA, true }, }, { { LSR, false }, { STA, true }, } },
+    { { { DEC, true }, { LSR, false }, { CMP, true }, }, { { LSR, false }, { DCP, true }, } },
+    { { { DEC, true }, { LSR, false }, { ISC, true }, }, { { LSR, false }, { SBC, true }, } },
+    { { { DEC, true }, { ROL, false }, { STA, true }, }, { { ROL, false }, { STA, true }, } },
+    { { { DEC, true }, { ROL, false }, { CMP, true }, }, { { ROL, false }, { DCP, true }, } },
+    { { { DEC, true }, { ROL, false }, { ISC, true }, }, { { ROL, false }, { SBC, true }, } },
+    { { { DEC, true }, { ROR, false }, { STA, true }, }, { { ROR, false }, { STA, true }, } },
+    { { { DEC, true }, { ROR, false }, { CMP, true }, }, { { ROR, false }, { DCP, true }, } },
+    { { { DEC, true }, { ROR, false }, { ISC, true }, }, { { ROR, false }, { SBC, true }, } },
+    { { { DEC, true }, { STA, true }, { TAX, false }, }, { { TAX, false }, { STA, true }, } },
+    { { { DEC, true }, { STA, true }, { TAY, false }, }, { { TAY, false }, { STA, true }, } },
+    { { { DEC, true }, { STA, true }, { ASL, false }, }, { { STA, true }, { ASL, false }, } },
+    { { { DEC, true }, { STA, true }, { LSR, false }, }, { { STA, true }, { LSR, false }, } },
+    { { { DEC, true }, { STA, true }, { ROL, false }, }, { { STA, true }, { ROL, false }, } },
+    { { { DEC, true }, { STA, true }, { ROR, false }, }, { { STA, true }, { ROR, false }, } },
+    { { { DEC, true }, { STA, true }, { LDA, true }, }, { { STA, true }, { LDA, true }, } },
+    { { { DEC, true }, { STA, true }, { INC, true }, }, { { STA, true }, { INC, true }, } },
+    { { { DEC, true }, { STA, true }, { DEC, true }, }, { { STA, true }, { DEC, true }, } },
+    { { { DEC, true }, { STA, true }, { ASL, true }, }, { { STA, true }, { ASL, true }, } },
+    { { { DEC, true }, { STA, true }, { LSR, true }, }, { { STA, true }, { LSR, true }, } },
+    { { { DEC, true }, { STA, true }, { ROL, true }, }, { { STA, true }, { ROL, true }, } },
+    { { { DEC, true }, { STA, true }, { ROR, true }, }, { { STA, true }, { ROR, true }, } },
+    { { { DEC, true }, { STA, true }, { ADC, true }, }, { { STA, true }, { ADC, true }, } },
+    { { { DEC, true }, { STA, true }, { SBC, true }, }, { { STA, true }, { SBC, true }, } },
+    { { { DEC, true }, { STA, true }, { AND, true }, }, { { STA, true }, { LDA, true }, } },
+    { { { DEC, true }, { STA, true }, { ORA, true }, }, { { STA, true }, { LDA, true }, } },
+    { { { DEC, true }, { STA, true }, { EOR, true }, }, { { STA, true }, { EOR, true }, } },
+    { { { DEC, true }, { STA, true }, { CMP, true }, }, { { STA, true }, { CMP, true }, } },
+    { { { DEC, true }, { STA, true }, { BIT, true }, }, { { STA, true }, { BIT, true }, } },
+    { { { DEC, true }, { STA, true }, { DCP, true }, }, { { STA, true }, { DCP, true }, } },
+    { { { DEC, true }, { STA, true }, { ISC, true }, }, { { STA, true }, { ISC, true }, } },
+    { { { DEC, true }, { STA, true }, { SLO, true }, }, { { STA, true }, { SLO, true }, } },
+    { { { DEC, true }, { STA, true }, { RLA, true }, }, { { STA, true }, { RLA, true }, } },
+    { { { DEC, true }, { STA, true }, { SRE, true }, }, { { STA, true }, { SRE, true }, } },
+    { { { DEC, true }, { STA, true }, { RRA, true }, }, { { STA, true }, { RRA, true }, } },
+    { { { DEC, true }, { STX, true }, { TXA, false }, }, { { TXA, false }, { STX, true }, } },
+    { { { DEC, true }, { STX, true }, { INX, false }, }, { { STX, true }, { INX, false }, } },
+    { { { DEC, true }, { STX, true }, { DEX, false }, }, { { STX, true }, { DEX, false }, } },
+    { { { DEC, true }, { STX, true }, { LDX, true }, }, { { STX, true }, { LDX, true }, } },
+    { { { DEC, true }, { STX, true }, { LDY, true }, }, { { STX, true }, { LDY, true }, } },
+    { { { DEC, true }, { STX, true }, { INC, true }, }, { { STX, true }, { INC, true }, } },
+    { { { DEC, true }, { STX, true }, { DEC, true }, }, { { STX, true }, { DEC, true }, } },
+    { { { DEC, true }, { STX, true }, { ASL, true }, }, { { STX, true }, { ASL, true }, } },
+    { { { DEC, true }, { STX, true }, { LSR, true }, }, { { STX, true }, { LSR, true }, } },
+    { { { DEC, true }, { STX, true }, { ROL, true }, }, { { STX, true }, { ROL, true }, } },
+    { { { DEC, true }, { STX, true }, { ROR, true }, }, { { STX, true }, { ROR, true }, } },
+    { { { DEC, true }, { STX, true }, { CPX, true }, }, { { STX, true }, { CPX, true }, } },
+    { { { DEC, true }, { STY, true }, { TYA, false }, }, { { TYA, false }, { STY, true }, } },
+    { { { DEC, true }, { STY, true }, { INY, false }, }, { { STY, true }, { INY, false }, } },
+    { { { DEC, true }, { STY, true }, { DEY, false }, }, { { STY, true }, { DEY, false }, } },
+    { { { DEC, true }, { STY, true }, { LDX, true }, }, { { STY, true }, { LDX, true }, } },
+    { { { DEC, true }, { STY, true }, { LDY, true }, }, { { STY, true }, { LDY, true }, } },
+    { { { DEC, true }, { STY, true }, { LAX, true }, }, { { STY, true }, { LAX, true }, } },
+    { { { DEC, true }, { STY, true }, { INC, true }, }, { { STY, true }, { INC, true }, } },
+    { { { DEC, true }, { STY, true }, { DEC, true }, }, { { STY, true }, { DEC, true }, } },
+    { { { DEC, true }, { STY, true }, { ASL, true }, }, { { STY, true }, { ASL, true }, } },
+    { { { DEC, true }, { STY, true }, { LSR, true }, }, { { STY, true }, { LSR, true }, } },
+    { { { DEC, true }, { STY, true }, { ROL, true }, }, { { STY, true }, { ROL, true }, } },
+    { { { DEC, true }, { STY, true }, { ROR, true }, }, { { STY, true }, { ROR, true }, } },
+    { { { DEC, true }, { STY, true }, { CPY, true }, }, { { STY, true }, { CPY, true }, } },
+    { { { DEC, true }, { INC, true }, { TAX, false }, }, { { TAX, false }, {}, } },
+    { { { DEC, true }, { INC, true }, { TAY, false }, }, { { TAY, false }, {}, } },
+    { { { DEC, true }, { INC, true }, { TXA, false }, }, { { TXA, false }, {}, } },
+    { { { DEC, true }, { INC, true }, { TYA, false }, }, { { TYA, false }, {}, } },
+    { { { DEC, true }, { INC, true }, { INX, false }, }, { { INX, false }, {}, } },
+    { { { DEC, true }, { INC, true }, { INY, false }, }, { { INY, false }, {}, } },
+    { { { DEC, true }, { INC, true }, { DEX, false }, }, { { DEX, false }, {}, } },
+    { { { DEC, true }, { INC, true }, { DEY, false }, }, { { DEY, false }, {}, } },
+    { { { DEC, true }, { INC, true }, { CLC, false }, }, { { ASL, true }, { ROR, true }, } },
+    { { { DEC, true }, { INC, true }, { ASL, false }, }, { { ASL, false }, {}, } },
+    { { { DEC, true }, { INC, true }, { LSR, false }, }, { { LSR, false }, {}, } },
+    { { { DEC, true }, { INC, true }, { ROL, false }, }, { { ROL, false }, {}, } },
+    { { { DEC, true }, { INC, true }, { ROR, false }, }, { { ROR, false }, {}, } },
+    { { { DEC, true }, { INC, true }, { LDA, true }, }, { { LDA, true }, {}, } },
+    { { { DEC, true }, { INC, true }, { LDX, true }, }, { { LDX, true }, {}, } },
+    { { { DEC, true }, { INC, true }, { LDY, true }, }, { { LDY, true }, {}, } },
+    { { { DEC, true }, { INC, true }, { LAX, true }, }, { { LAX, true }, {}, } },
+    { { { DEC, true }, { INC, true }, { INC, true }, }, { { INC, true }, {}, } },
+    { { { DEC, true }, { INC, true }, { DEC, true }, }, { { DEC, true }, {}, } },
+    { { { DEC, true }, { INC, true }, { ASL, true }, }, { { ASL, true }, {}, } },
+    { { { DEC, true }, { INC, true }, { LSR, true }, }, { { LSR, true }, {}, } },
+    { { { DEC, true }, { INC, true }, { ROL, true }, }, { { ROL, true }, {}, } },
+    { { { DEC, true }, { INC, true }, { ROR, true }, }, { { ROR, true }, {}, } },
+    { { { DEC, true }, { INC, true }, { ADC, true }, }, { { ADC, true }, {}, } },
+    { { { DEC, true }, { INC, true }, { AND, true }, }, { { AND, true }, {}, } },
+    { { { DEC, true }, { INC, true }, { ORA, true }, }, { { ORA, true }, {}, } },
+    { { { DEC, true }, { INC, true }, { EOR, true }, }, { { EOR, true }, {}, } },
+    { { { DEC, true }, { INC, true }, { CMP, true }, }, { { CMP, true }, {}, } },
+    { { { DEC, true }, { INC, true }, { CPX, true }, }, { { CPX, true }, {}, } },
+    { { { DEC, true }, { INC, true }, { CPY, true }, }, { { CPY, true }, {}, } },
+    { { { DEC, true }, { INC, true }, { BIT, true }, }, { { BIT, true }, {}, } },
+    { { { DEC, true }, { INC, true }, { ISC, true }, }, { { ISC, true }, {}, } },
+    { { { DEC, true }, { INC, true }, { SLO, true }, }, { { SLO, true }, {}, } },
+    { { { DEC, true }, { INC, true }, { RLA, true }, }, { { RLA, true }, {}, } },
+    { { { DEC, true }, { INC, true }, { SRE, true }, }, { { SRE, true }, {}, } },
+    { { { DEC, true }, { INC, true }, { RRA, true }, }, { { RRA, true }, {}, } },
+    { { { DEC, true }, { DEC, true }, { INC, true }, }, { { DEC, true }, {}, } },
+    { { { DEC, true }, { ASL, true }, { ROR, true }, }, { { CLC, false }, { DEC, true }, } },
+    { { { DEC, true }, { LSR, true }, { ROL, true }, }, { { CLC, false }, { DEC, true }, } },
+    { { { DEC, true }, { ROL, true }, { ROR, true }, }, { { DEC, true }, {}, } },
+    { { { DEC, true }, { ROR, true }, { ROL, true }, }, { { DEC, true }, {}, } },
+    { { { DEC, true }, { CMP, true }, {}, }, { { DCP, true }, {}, } },
+    { { { DEC, true }, { ISC, true }, {}, }, { { SBC, true }, {}, } },
+    { { { ASL, true }, { TAX, false }, { ORA, true }, }, { { TAX, false }, { SLO, true }, } },
+    { { { ASL, true }, { TAY, false }, { ORA, true }, }, { { TAY, false }, { SLO, true }, } },
+    { { { ASL, true }, { CLC, false }, { ORA, true }, }, { { SLO, true }, { CLC, false }, } },
+    { { { ASL, true }, { SEC, false }, { ORA, true }, }, { { SLO, true }, { SEC, false }, } },
+    { { { ASL, true }, { CLV, false }, { ORA, true }, }, { { CLV, false }, { SLO, true }, } },
+    { { { ASL, true }, { ASL, false }, { STA, true }, }, { { ASL, false }, { STA, true }, } },
+    { { { ASL, true }, { LSR, false }, { STA, true }, }, { { LSR, false }, { STA, true }, } },
+    { { { ASL, true }, { STA, true }, { ASL, false }, }, { { STA, true }, { ASL, false }, } },
+    { { { ASL, true }, { STA, true }, { LSR, false }, }, { { STA, true }, { LSR, false }, } },
+    { { { ASL, true }, { STA, true }, { ASL, true }, }, { { STA, true }, { ASL, true }, } },
+    { { { ASL, true }, { STA, true }, { LSR, true }, }, { { STA, true }, { LSR, true }, } },
+    { { { ASL, true }, { STA, true }, { CMP, true }, }, { { STA, true }, { CMP, true }, } },
+    { { { ASL, true }, { STA, true }, { DCP, true }, }, { { STA, true }, { DCP, true }, } },
+    { { { ASL, true }, { STA, true }, { SLO, true }, }, { { STA, true }, { SLO, true }, } },
+    { { { ASL, true }, { STA, true }, { SRE, true }, }, { { STA, true }, { SRE, true }, } },
+    { { { ASL, true }, { STX, true }, { ASL, true }, }, { { STX, true }, { ASL, true }, } },
+    { { { ASL, true }, { STX, true }, { LSR, true }, }, { { STX, true }, { LSR, true }, } },
+    { { { ASL, true }, { STX, true }, { CPX, true }, }, { { STX, true }, { CPX, true }, } },
+    { { { ASL, true }, { STY, true }, { ASL, true }, }, { { STY, true }, { ASL, true }, } },
+    { { { ASL, true }, { STY, true }, { LSR, true }, }, { { STY, true }, { LSR, true }, } },
+    { { { ASL, true }, { STY, true }, { CPY, true }, }, { { STY, true }, { CPY, true }, } },
+    { { { ASL, true }, { INC, true }, {}, }, { { SEC, false }, { ROL, true }, } },
+    { { { ASL, true }, { DEC, true }, { INC, true }, }, { { ASL, true }, {}, } },
+    { { { ASL, true }, { ASL, true }, { ROR, true }, }, { { ASL, true }, { CLC, false }, } },
+    { { { ASL, true }, { LSR, true }, { CLC, false }, }, { { ASL, true }, { LSR, true }, } },
+    { { { ASL, true }, { LSR, true }, { ASL, true }, }, { { ASL, true }, { CLC, false }, } },
+    { { { ASL, true }, { LSR, true }, { ROL, true }, }, { { ASL, true }, { CLC, false }, } },
+    { { { ASL, true }, { LSR, true }, { SLO, true }, }, { { SLO, true }, { CLC, false }, } },
+    { { { ASL, true }, { ROL, true }, { ROR, true }, }, { { ASL, true }, {}, } },
+    { { { ASL, true }, { ROR, true }, { TAX, false }, }, { { TAX, false }, { CLC, false }, } },
+    { { { ASL, true }, { ROR, true }, { TAY, false }, }, { { TAY, false }, { CLC, false }, } },
+    { { { ASL, true }, { ROR, true }, { TXA, false }, }, { { TXA, false }, { CLC, false }, } },
+    { { { ASL, true }, { ROR, true }, { TYA, false }, }, { { TYA, false }, { CLC, false }, } },
+    { { { ASL, true }, { ROR, true }, { INX, false }, }, { { INX, false }, { CLC, false }, } },
+    { { { ASL, true }, { ROR, true }, { INY, false }, }, { { INY, false }, { CLC, false }, } },
+    { { { ASL, true }, { ROR, true }, { DEX, false }, }, { { DEX, false }, { CLC, false }, } },
+    { { { ASL, true }, { ROR, true }, { DEY, false }, }, { { DEY, false }, { CLC, false }, } },
+    { { { ASL, true }, { ROR, true }, { CLC, false }, }, { { ASL, true }, { ROR, true }, } },
+    { { { ASL, true }, { ROR, true }, { ASL, false }, }, { { ASL, false }, {}, } },
+    { { { ASL, true }, { ROR, true }, { LSR, false }, }, { { LSR, false }, {}, } },
+    { { { ASL, true }, { ROR, true }, { ROL, false }, }, { { ASL, false }, {}, } },
+    { { { ASL, true }, { ROR, true }, { ROR, false }, }, { { LSR, false }, {}, } },
+    { { { ASL, true }, { ROR, true }, { LDA, true }, }, { { CLC, false }, { LDA, true }, } },
+    { { { ASL, true }, { ROR, true }, { LDX, true }, }, { { CLC, false }, { LDX, true }, } },
+    { { { ASL, true }, { ROR, true }, { LDY, true }, }, { { CLC, false }, { LDY, true }, } },
+    { { { ASL, true }, { ROR, true }, { LAX, true }, }, { { CLC, false }, { LAX, true }, } },
+    { { { ASL, true }, { ROR, true }, { INC, true }, }, { { CLC, false }, { INC, true }, } },
+    { { { ASL, true }, { ROR, true }, { DEC, true }, }, { { CLC, false }, { DEC, true }, } },
+    { { { ASL, true }, { ROR, true }, { ASL, true }, }, { { ASL, true }, {}, } },
+    { { { ASL, true }, { ROR, true }, { LSR, true }, }, { { LSR, true }, {}, } },
+    { { { ASL, true }, { ROR, true }, { ROL, true }, }, { { ASL, true }, {}, } },
+    { { { ASL, true }, { ROR, true }, { ROR, true }, }, { { LSR, true }, {}, } },
+    { { { ASL, true }, { ROR, true }, { SBC, true }, }, { { CLC, false }, { SBC, true }, } },
+    { { { ASL, true }, { ROR, true }, { AND, true }, }, { { CLC, false }, { AND, true }, } },
+    { { { ASL, true }, { ROR, true }, { ORA, true }, }, { { CLC, false }, { ORA, true }, } },
+    { { { ASL, true }, { ROR, true }, { EOR, true }, }, { { CLC, false }, { EOR, true }, } },
+    { { { ASL, true }, { ROR, true }, { CMP, true }, }, { { CMP, true }, {}, } },
+    { { { ASL, true }, { ROR, true }, { CPX, true }, }, { { CPX, true }, {}, } },
+    { { { ASL, true }, { ROR, true }, { CPY, true }, }, { { CPY, true }, {}, } },
+    { { { ASL, true }, { ROR, true }, { BIT, true }, }, { { CLC, false }, { BIT, true }, } },
+    { { { ASL, true }, { ROR, true }, { DCP, true }, }, { { DCP, true }, {}, } },
+    { { { ASL, true }, { ROR, true }, { ISC, true }, }, { { CLC, false }, { ISC, true }, } },
+    { { { ASL, true }, { ROR, true }, { SLO, true }, }, { { SLO, true }, {}, } },
+    { { { ASL, true }, { ROR, true }, { SRE, true }, }, { { SRE, true }, {}, } },
+    { { { ASL, true }, { ROR, true }, { RRA, true }, }, { { CLC, false }, { RRA, true }, } },
+    { { { ASL, true }, { AND, true }, {}, }, { { CLC, false }, { RLA, true }, } },
+    { { { ASL, true }, { ORA, true }, {}, }, { { SLO, true }, {}, } },
+    { { { ASL, true }, { SRE, true }, { CLC, false }, }, { { ASL, true }, { SRE, true }, } },
+    { { { ASL, true }, { RRA, true }, {}, }, { { CLC, false }, { ADC, true }, } },
+    { { { LSR, true }, { TAX, false }, { EOR, true }, }, { { TAX, false }, { SRE, true }, } },
+    { { { LSR, true }, { TAY, false }, { EOR, true }, }, { { TAY, false }, { SRE, true }, } },
+    { { { LSR, true }, { CLC, false }, { EOR, true }, }, { { SRE, true }, { CLC, false }, } },
+    { { { LSR, true }, { SEC, false }, { EOR, true }, }, { { SRE, true }, { SEC, false }, } },
+    { { { LSR, true }, { CLV, false }, { EOR, true }, }, { { CLV, false }, { SRE, true }, } },
+    { { { LSR, true }, { ASL, false }, { STA, true }, }, { { ASL, false }, { STA, true }, } },
+    { { { LSR, true }, { LSR, false }, { STA, true }, }, { { LSR, false }, { STA, true }, } },
+    { { { LSR, true }, { ROL, false }, { ROR, false }, }, { { SRE, true }, { EOR, true }, } },
+    { { { LSR, true }, { ROR, false }, { ROL, false }, }, { { SRE, true }, { EOR, true }, } },
+    { { { LSR, true }, { STA, true }, { ASL, false }, }, { { STA, true }, { ASL, false }, } },
+    { { { LSR, true }, { STA, true }, { LSR, false }, }, { { STA, true }, { LSR, false }, } },
+    { { { LSR, true }, { STA, true }, { ASL, true }, }, { { STA, true }, { ASL, true }, } },
+    { { { LSR, true }, { STA, true }, { LSR, true }, }, { { STA, true }, { LSR, true }, } },
+    { { { LSR, true }, { STA, true }, { CMP, true }, }, { { STA, true }, { CMP, true }, } },
+    { { { LSR, true }, { STA, true }, { DCP, true }, }, { { STA, true }, { DCP, true }, } },
+    { { { LSR, true }, { STA, true }, { SLO, true }, }, { { STA, true }, { SLO, true }, } },
+    { { { LSR, true }, { STA, true }, { SRE, true }, }, { { STA, true }, { SRE, true }, } },
+    { { { LSR, true }, { STX, true }, { ASL, true }, }, { { STX, true }, { ASL, true }, } },
+    { { { LSR, true }, { STX, true }, { LSR, true }, }, { { STX, true }, { LSR, true }, } },
+    { { { LSR, true }, { STX, true }, { CPX, true }, }, { { STX, true }, { CPX, true }, } },
+    { { { LSR, true }, { STY, true }, { ASL, true }, }, { { STY, true }, { ASL, true }, } },
+    { { { LSR, true }, { STY, true }, { LSR, true }, }, { { STY, true }, { LSR, true }, } },
+    { { { LSR, true }, { STY, true }, { CPY, true }, }, { { STY, true }, { CPY, true }, } },
+    { { { LSR, true }, { INC, true }, { DEC, true }, }, { { LSR, true }, {}, } },
+    { { { LSR, true }, { DEC, true }, { INC, true }, }, { { LSR, true }, {}, } },
+    { { { LSR, true }, { ASL, true }, { CLC, false }, }, { { LSR, true }, { ASL, true }, } },
+    { { { LSR, true }, { ASL, true }, { LSR, true }, }, { { LSR, true }, { CLC, false }, } },
+    { { { LSR, true }, { ASL, true }, { ROR, true }, }, { { LSR, true }, { CLC, false }, } },
+    { { { LSR, true }, { ASL, true }, { SRE, true }, }, { { SRE, true }, { CLC, false }, } },
+    { { { LSR, true }, { LSR, true }, { ROL, true }, }, { { LSR, true }, { CLC, false }, } },
+    { { { LSR, true }, { ROL, true }, { TAX, false }, }, { { TAX, false }, { CLC, false }, } },
+    { { { LSR, true }, { ROL, true }, { TAY, false }, }, { { TAY, false }, { CLC, false }, } },
+    { { { LSR, true }, { ROL, true }, { TXA, false }, }, { { TXA, false }, { CLC, false }, } },
+    { { { LSR, true }, { ROL, true }, { TYA, false }, }, { { TYA, false }, { CLC, false }, } },
+    { { { LSR, true }, { ROL, true }, { INX, false }, }, { { INX, false }, { CLC, false }, } },
+    { { { LSR, true }, { ROL, true }, { INY, false }, }, { { INY, false }, { CLC, false }, } },
+    { { { LSR, true }, { ROL, true }, { DEX, false }, }, { { DEX, false }, { CLC, false }, } },
+    { { { LSR, true }, { ROL, true }, { DEY, false }, }, { { DEY, false }, { CLC, false }, } },
+    { { { LSR, true }, { ROL, true }, { CLC, false }, }, { { ASL, true }, { ROR, true }, } },
+    { { { LSR, true }, { ROL, true }, { ASL, false }, }, { { ASL, false }, {}, } },
+    { { { LSR, true }, { ROL, true }, { LSR, false }, }, { { LSR, false }, {}, } },
+    { { { LSR, true }, { ROL, true }, { ROL, false }, }, { { ASL, false }, {}, } },
+    { { { LSR, true }, { ROL, true }, { ROR, false }, }, { { LSR, false }, {}, } },
+    { { { LSR, true }, { ROL, true }, { LDA, true }, }, { { CLC, false }, { LDA, true }, } },
+    { { { LSR, true }, { ROL, true }, { LDX, true }, }, { { CLC, false }, { LDX, true }, } },
+    { { { LSR, true }, { ROL, true }, { LDY, true }, }, { { CLC, false }, { LDY, true }, } },
+    { { { LSR, true }, { ROL, true }, { LAX, true }, }, { { CLC, false }, { LAX, true }, } },
+    { { { LSR, true }, { ROL, true }, { INC, true }, }, { { CLC, false }, { INC, true }, } },
+    { { { LSR, true }, { ROL, true }, { DEC, true }, }, { { CLC, false }, { DEC, true }, } },
+    { { { LSR, true }, { ROL, true }, { ASL, true }, }, { { ASL, true }, {}, } },
+    { { { LSR, true }, { ROL, true }, { LSR, true }, }, { { LSR, true }, {}, } },
+    { { { LSR, true }, { ROL, true }, { ROL, true }, }, { { ASL, true }, {}, } },
+    { { { LSR, true }, { ROL, true }, { ROR, true }, }, { { LSR, true }, {}, } },
+    { { { LSR, true }, { ROL, true }, { ADC, true }, }, { { CLC, false }, { ADC, true }, } },
+    { { { LSR, true }, { ROL, true }, { SBC, true }, }, { { CLC, false }, { SBC, true }, } },
+    { { { LSR, true }, { ROL, true }, { ORA, true }, }, { { CLC, false }, { ORA, true }, } },
+    { { { LSR, true }, { ROL, true }, { EOR, true }, }, { { CLC, false }, { EOR, true }, } },
+    { { { LSR, true }, { ROL, true }, { CMP, true }, }, { { CMP, true }, {}, } },
+    { { { LSR, true }, { ROL, true }, { CPX, true }, }, { { CPX, true }, {}, } },
+    { { { LSR, true }, { ROL, true }, { CPY, true }, }, { { CPY, true }, {}, } },
+    { { { LSR, true }, { ROL, true }, { BIT, true }, }, { { CLC, false }, { BIT, true }, } },
+    { { { LSR, true }, { ROL, true }, { DCP, true }, }, { { DCP, true }, {}, } },
+    { { { LSR, true }, { ROL, true }, { ISC, true }, }, { { CLC, false }, { ISC, true }, } },
+    { { { LSR, true }, { ROL, true }, { SLO, true }, }, { { SLO, true }, {}, } },
+    { { { LSR, true }, { ROL, true }, { RLA, true }, }, { { CLC, false }, { RLA, true }, } },
+    { { { LSR, true }, { ROL, true }, { SRE, true }, }, { { SRE, true }, {}, } },
+    { { { LSR, true }, { ROR, true }, { ROL, true }, }, { { LSR, true }, {}, } },
+    { { { LSR, true }, { ADC, true }, {}, }, { { CLC, false }, { RRA, true }, } },
+    { { { LSR, true }, { AND, true }, { EOR, true }, }, { { SRE, true }, { AND, true }, } },
+    { { { LSR, true }, { EOR, true }, {}, }, { { SRE, true }, {}, } },
+    { { { LSR, true }, { SLO, true }, { CLC, false }, }, { { LSR, true }, { SLO, true }, } },
+    { { { LSR, true }, { RLA, true }, {}, }, { { CLC, false }, { AND, true }, } },
+    { { { ROL, true }, { TAX, false }, { AND, true }, }, { { TAX, false }, { RLA, true }, } },
+    { { { ROL, true }, { TAX, false }, { RRA, true }, }, { { TAX, false }, { ADC, true }, } },
+    { { { ROL, true }, { TAY, false }, { AND, true }, }, { { TAY, false }, { RLA, true }, } },
+    { { { ROL, true }, { TAY, false }, { RRA, true }, }, { { TAY, false }, { ADC, true }, } },
+    { { { ROL, true }, { CLC, false }, { AND, true }, }, { { RLA, true }, { CLC, false }, } },
+    { { { ROL, true }, { SEC, false }, { AND, true }, }, { { RLA, true }, { SEC, false }, } },
+    { { { ROL, true }, { CLV, false }, { AND, true }, }, { { CLV, false }, { RLA, true }, } },
+    { { { ROL, true }, { ASL, false }, { STA, true }, }, { { ASL, false }, { STA, true }, } },
+    { { { ROL, true }, { LSR, false }, { STA, true }, }, { { LSR, false }, { STA, true }, } },
+    { { { ROL, true }, { STA, true }, { ASL, false }, }, { { STA, true }, { ASL, false }, } },
+    { { { ROL, true }, { STA, true }, { LSR, false }, }, { { STA, true }, { LSR, false }, } },
+    { { { ROL, true }, { STA, true }, { ASL, true }, }, { { STA, true }, { ASL, true }, } },
+    { { { ROL, true }, { STA, true }, { LSR, true }, }, { { STA, true }, { LSR, true }, } },
+    { { { ROL, true }, { STA, true }, { CMP, true }, }, { { STA, true }, { CMP, true }, } },
+    { { { ROL, true }, { STA, true }, { DCP, true }, }, { { STA, true }, { DCP, true }, } },
+    { { { ROL, true }, { STA, true }, { SLO, true }, }, { { STA, true }, { SLO, true }, } },
+    { { { ROL, true }, { STA, true }, { SRE, true }, }, { { STA, true }, { SRE, true }, } },
+    { { { ROL, true }, { STX, true }, { ASL, true }, }, { { STX, true }, { ASL, true }, } },
+    { { { ROL, true }, { STX, true }, { LSR, true }, }, { { STX, true }, { LSR, true }, } },
+    { { { ROL, true }, { STX, true }, { CPX, true }, }, { { STX, true }, { CPX, true }, } },
+    { { { ROL, true }, { STY, true }, { ASL, true }, }, { { STY, true }, { ASL, true }, } },
+    { { { ROL, true }, { STY, true }, { LSR, true }, }, { { STY, true }, { LSR, true }, } },
+    { { { ROL, true }, { STY, true }, { CPY, true }, }, { { STY, true }, { CPY, true }, } },
+    { { { ROL, true }, { INC, true }, { DEC, true }, }, { { ROL, true }, {}, } },
+    { { { ROL, true }, { DEC, true }, { INC, true }, }, { { ROL, true }, {}, } },
+    { { { ROL, true }, { ASL, true }, { ROR, true }, }, { { ROL, true }, { CLC, false }, } },
+    { { { ROL, true }, { LSR, true }, { CLC, false }, }, { { ASL, true }, { LSR, true }, } },
+    { { { ROL, true }, { LSR, true }, { ASL, true }, }, { { ASL, true }, { CLC, false }, } },
+    { { { ROL, true }, { LSR, true }, { ROL, true }, }, { { ROL, true }, { CLC, false }, } },
+    { { { ROL, true }, { LSR, true }, { SLO, true }, }, { { SLO, true }, { CLC, false }, } },
+    { { { ROL, true }, { ROL, true }, { ROR, true }, }, { { ROL, true }, {}, } },
+    { { { ROL, true }, { ROR, true }, { TAX, false }, }, { { TAX, false }, {}, } },
+    { { { ROL, true }, { ROR, true }, { TAY, false }, }, { { TAY, false }, {}, } },
+    { { { ROL, true }, { ROR, true }, { TXA, false }, }, { { TXA, false }, {}, } },
+    { { { ROL, true }, { ROR, true }, { TYA, false }, }, { { TYA, false }, {}, } },
+    { { { ROL, true }, { ROR, true }, { INX, false }, }, { { INX, false }, {}, } },
+    { { { ROL, true }, { ROR, true }, { INY, false }, }, { { INY, false }, {}, } },
+    { { { ROL, true }, { ROR, true }, { DEX, false }, }, { { DEX, false }, {}, } },
+    { { { ROL, true }, { ROR, true }, { DEY, false }, }, { { DEY, false }, {}, } },
+    { { { ROL, true }, { ROR, true }, { CLC, false }, }, { { ASL, true }, { ROR, true }, } },
+    { { { ROL, true }, { ROR, true }, { ASL, false }, }, { { ASL, false }, {}, } },
+    { { { ROL, true }, { ROR, true }, { LSR, false }, }, { { LSR, false }, {}, } },
+    { { { ROL, true }, { ROR, true }, { ROL, false }, }, { { ROL, false }, {}, } },
+    { { { ROL, true }, { ROR, true }, { ROR, false }, }, { { ROR, false }, {}, } },
+    { { { ROL, true }, { ROR, true }, { LDA, true }, }, { { LDA, true }, {}, } },
+    { { { ROL, true }, { ROR, true }, { LDX, true }, }, { { LDX, true }, {}, } },
+    { { { ROL, true }, { ROR, true }, { LDY, true }, }, { { LDY, true }, {}, } },
+    { { { ROL, true }, { ROR, true }, { LAX, true }, }, { { LAX, true }, {}, } },
+    { { { ROL, true }, { ROR, true }, { INC, true }, }, { { INC, true }, {}, } },
+    { { { ROL, true }, { ROR, true }, { DEC, true }, }, { { DEC, true }, {}, } },
+    { { { ROL, true }, { ROR, true }, { ASL, true }, }, { { ASL, true }, {}, } },
+    { { { ROL, true }, { ROR, true }, { LSR, true }, }, { { LSR, true }, {}, } },
+    { { { ROL, true }, { ROR, true }, { ROL, true }, }, { { ROL, true }, {}, } },
+    { { { ROL, true }, { ROR, true }, { ROR, true }, }, { { ROR, true }, {}, } },
+    { { { ROL, true }, { ROR, true }, { SBC, true }, }, { { SBC, true }, {}, } },
+    { { { ROL, true }, { ROR, true }, { AND, true }, }, { { AND, true }, {}, } },
+    { { { ROL, true }, { ROR, true }, { ORA, true }, }, { { ORA, true }, {}, } },
+    { { { ROL, true }, { ROR, true }, { EOR, true }, }, { { EOR, true }, {}, } },
+    { { { ROL, true }, { ROR, true }, { CMP, true }, }, { { CMP, true }, {}, } },
+    { { { ROL, true }, { ROR, true }, { CPX, true }, }, { { CPX, true }, {}, } },
+    { { { ROL, true }, { ROR, true }, { CPY, true }, }, { { CPY, true }, {}, } },
+    { { { ROL, true }, { ROR, true }, { BIT, true }, }, { { BIT, true }, {}, } },
+    { { { ROL, true }, { ROR, true }, { DCP, true }, }, { { DCP, true }, {}, } },
+    { { { ROL, true }, { ROR, true }, { ISC, true }, }, { { ISC, true }, {}, } },
+    { { { ROL, true }, { ROR, true }, { SLO, true }, }, { { SLO, true }, {}, } },
+    { { { ROL, true }, { ROR, true }, { SRE, true }, }, { { SRE, true }, {}, } },
+    { { { ROL, true }, { ROR, true }, { RRA, true }, }, { { RRA, true }, {}, } },
+    { { { ROL, true }, { AND, true }, {}, }, { { RLA, true }, {}, } },
+    { { { ROL, true }, { EOR, true }, { AND, true }, }, { { RLA, true }, { EOR, true }, } },
+    { { { ROL, true }, { SRE, true }, { CLC, false }, }, { { ASL, true }, { SRE, true }, } },
+    { { { ROL, true }, { RRA, true }, {}, }, { { ADC, true }, {}, } },
+    { { { ROR, true }, { TAX, false }, { ADC, true }, }, { { TAX, false }, { RRA, true }, } },
+    { { { ROR, true }, { TAX, false }, { RLA, true }, }, { { TAX, false }, { AND, true }, } },
+    { { { ROR, true }, { TAY, false }, { ADC, true }, }, { { TAY, false }, { RRA, true }, } },
+    { { { ROR, true }, { TAY, false }, { RLA, true }, }, { { TAY, false }, { AND, true }, } },
+    { { { ROR, true }, { CLV, false }, { RLA, true }, }, { { CLV, false }, { AND, true }, } },
+    { { { ROR, true }, { ASL, false }, { STA, true }, }, { { ASL, false }, { STA, true }, } },
+    { { { ROR, true }, { LSR, false }, { STA, true }, }, { { LSR, false }, { STA, true }, } },
+    { { { ROR, true }, { STA, true }, { ASL, false }, }, { { STA, true }, { ASL, false }, } },
+    { { { ROR, true }, { STA, true }, { LSR, false }, }, { { STA, true }, { LSR, false }, } },
+    { { { ROR, true }, { STA, true }, { ASL, true }, }, { { STA, true }, { ASL, true }, } },
+    { { { ROR, true }, { STA, true }, { LSR, true }, }, { { STA, true }, { LSR, true }, } },
+    { { { ROR, true }, { STA, true }, { CMP, true }, }, { { STA, true }, { CMP, true }, } },
+    { { { ROR, true }, { STA, true }, { DCP, true }, }, { { STA, true }, { DCP, true }, } },
+    { { { ROR, true }, { STA, true }, { SLO, true }, }, { { STA, true }, { SLO, true }, } },
+    { { { ROR, true }, { STA, true }, { SRE, true }, }, { { STA, true }, { SRE, true }, } },
+    { { { ROR, true }, { STX, true }, { ASL, true }, }, { { STX, true }, { ASL, true }, } },
+    { { { ROR, true }, { STX, true }, { LSR, true }, }, { { STX, true }, { LSR, true }, } },
+    { { { ROR, true }, { STX, true }, { CPX, true }, }, { { STX, true }, { CPX, true }, } },
+    { { { ROR, true }, { STY, true }, { ASL, true }, }, { { STY, true }, { ASL, true }, } },
+    { { { ROR, true }, { STY, true }, { LSR, true }, }, { { STY, true }, { LSR, true }, } },
+    { { { ROR, true }, { STY, true }, { CPY, true }, }, { { STY, true }, { CPY, true }, } },
+    { { { ROR, true }, { INC, true }, { DEC, true }, }, { { ROR, true }, {}, } },
+    { { { ROR, true }, { DEC, true }, { INC, true }, }, { { ROR, true }, {}, } },
+    { { { ROR, true }, { ASL, true }, { CLC, false }, }, { { LSR, true }, { ASL, true }, } },
+    { { { ROR, true }, { ASL, true }, { LSR, true }, }, { { LSR, true }, { CLC, false }, } },
+    { { { ROR, true }, { ASL, true }, { ROR, true }, }, { { ROR, true }, { CLC, false }, } },
+    { { { ROR, true }, { ASL, true }, { SRE, true }, }, { { SRE, true }, { CLC, false }, } },
+    { { { ROR, true }, { LSR, true }, { ROL, true }, }, { { ROR, true }, { CLC, false }, } },
+    { { { ROR, true }, { ROL, true }, { TAX, false }, }, { { TAX, false }, {}, } },
+    { { { ROR, true }, { ROL, true }, { TAY, false }, }, { { TAY, false }, {}, } },
+    { { { ROR, true }, { ROL, true }, { TXA, false }, }, { { TXA, false }, {}, } },
+    { { { ROR, true }, { ROL, true }, { TYA, false }, }, { { TYA, false }, {}, } },
+    { { { ROR, true }, { ROL, true }, { INX, false }, }, { { INX, false }, {}, } },
+    { { { ROR, true }, { ROL, true }, { INY, false }, }, { { INY, false }, {}, } },
+    { { { ROR, true }, { ROL, true }, { DEX, false }, }, { { DEX, false }, {}, } },
+    { { { ROR, true }, { ROL, true }, { DEY, false }, }, { { DEY, false }, {}, } },
+    { { { ROR, true }, { ROL, true }, { CLC, false }, }, { { ASL, true }, { ROR, true }, } },
+    { { { ROR, true }, { ROL, true }, { ASL, false }, }, { { ASL, false }, {}, } },
+    { { { ROR, true }, { ROL, true }, { LSR, false }, }, { { LSR, false }, {}, } },
+    { { { ROR, true }, { ROL, true }, { ROL, false }, }, { { ROL, false }, {}, } },
+    { { { ROR, true }, { ROL, true }, { ROR, false }, }, { { ROR, false }, {}, } },
+    { { { ROR, true }, { ROL, true }, { LDA, true }, }, { { LDA, true }, {}, } },
+    { { { ROR, true }, { ROL, true }, { LDX, true }, }, { { LDX, true }, {}, } },
+    { { { ROR, true }, { ROL, true }, { LDY, true }, }, { { LDY, true }, {}, } },
+    { { { ROR, true }, { ROL, true }, { LAX, true }, }, { { LAX, true }, {}, } },
+    { { { ROR, true }, { ROL, true }, { INC, true }, }, { { INC, true }, {}, } },
+    { { { ROR, true }, { ROL, true }, { DEC, true }, }, { { DEC, true }, {}, } },
+    { { { ROR, true }, { ROL, true }, { ASL, true }, }, { { ASL, true }, {}, } },
+    { { { ROR, true }, { ROL, true }, { LSR, true }, }, { { LSR, true }, {}, } },
+    { { { ROR, true }, { ROL, true }, { ROL, true }, }, { { ROL, true }, {}, } },
+    { { { ROR, true }, { ROL, true }, { ROR, true }, }, { { ROR, true }, {}, } },
+    { { { ROR, true }, { ROL, true }, { ADC, true }, }, { { ADC, true }, {}, } },
+    { { { ROR, true }, { ROL, true }, { SBC, true }, }, { { SBC, true }, {}, } },
+    { { { ROR, true }, { ROL, true }, { ORA, true }, }, { { ORA, true }, {}, } },
+    { { { ROR, true }, { ROL, true }, { EOR, true }, }, { { EOR, true }, {}, } },
+    { { { ROR, true }, { ROL, true }, { CMP, true }, }, { { CMP, true }, {}, } },
+    { { { ROR, true }, { ROL, true }, { CPX, true }, }, { { CPX, true }, {}, } },
+    { { { ROR, true }, { ROL, true }, { CPY, true }, }, { { CPY, true }, {}, } },
+    { { { ROR, true }, { ROL, true }, { BIT, true }, }, { { BIT, true }, {}, } },
+    { { { ROR, true }, { ROL, true }, { DCP, true }, }, { { DCP, true }, {}, } },
+    { { { ROR, true }, { ROL, true }, { ISC, true }, }, { { ISC, true }, {}, } },
+    { { { ROR, true }, { ROL, true }, { SLO, true }, }, { { SLO, true }, {}, } },
+    { { { ROR, true }, { ROL, true }, { RLA, true }, }, { { RLA, true }, {}, } },
+    { { { ROR, true }, { ROL, true }, { SRE, true }, }, { { SRE, true }, {}, } },
+    { { { ROR, true }, { ROR, true }, { ROL, true }, }, { { ROR, true }, {}, } },
+    { { { ROR, true }, { ADC, true }, {}, }, { { RRA, true }, {}, } },
+    { { { ROR, true }, { SLO, true }, { CLC, false }, }, { { LSR, true }, { SLO, true }, } },
+    { { { ROR, true }, { RLA, true }, {}, }, { { AND, true }, {}, } },
+    { { { ADC, true }, { ASL, false }, { ROR, false }, }, { { ADC, true }, { CLC, false }, } },
+    { { { ADC, true }, { LSR, false }, { ROL, false }, }, { { ADC, true }, { CLC, false }, } },
+    { { { ADC, true }, { ROL, false }, { ROR, false }, }, { { ADC, true }, {}, } },
+    { { { ADC, true }, { ROR, false }, { ROL, false }, }, { { ADC, true }, {}, } },
+    { { { ADC, true }, { STA, true }, { LDA, true }, }, { { ADC, true }, { STA, true }, } },
+    { { { ADC, true }, { STA, true }, { AND, true }, }, { { ADC, true }, { STA, true }, } },
+    { { { ADC, true }, { STA, true }, { ORA, true }, }, { { ADC, true }, { STA, true }, } },
+    { { { SBC, true }, { ASL, false }, { ROR, false }, }, { { SBC, true }, { CLC, false }, } },
+    { { { SBC, true }, { LSR, false }, { ROL, false }, }, { { SBC, true }, { CLC, false }, } },
+    { { { SBC, true }, { ROL, false }, { ROR, false }, }, { { SBC, true }, {}, } },
+    { { { SBC, true }, { ROR, false }, { ROL, false }, }, { { SBC, true }, {}, } },
+    { { { SBC, true }, { STA, true }, { LDA, true }, }, { { SBC, true }, { STA, true }, } },
+    { { { SBC, true }, { STA, true }, { AND, true }, }, { { SBC, true }, { STA, true }, } },
+    { { { SBC, true }, { STA, true }, { ORA, true }, }, { { SBC, true }, { STA, true }, } },
+    { { { AND, true }, { TAX, false }, { AND, true }, }, { { AND, true }, { TAX, false }, } },
+    { { { AND, true }, { TAY, false }, { AND, true }, }, { { AND, true }, { TAY, false }, } },
+    { { { AND, true }, { CLC, false }, { LDA, true }, }, { { CLC, false }, { LDA, true }, } },
+    { { { AND, true }, { CLC, false }, { LAX, true }, }, { { CLC, false }, { LAX, true }, } },
+    { { { AND, true }, { CLC, false }, { AND, true }, }, { { CLC, false }, { AND, true }, } },
+    { { { AND, true }, { CLC, false }, { ORA, true }, }, { { CLC, false }, { LDA, true }, } },
+    { { { AND, true }, { SEC, false }, { LDA, true }, }, { { SEC, false }, { LDA, true }, } },
+    { { { AND, true }, { SEC, false }, { LAX, true }, }, { { SEC, false }, { LAX, true }, } },
+    { { { AND, true }, { SEC, false }, { AND, true }, }, { { SEC, false }, { AND, true }, } },
+    { { { AND, true }, { SEC, false }, { ORA, true }, }, { { SEC, false }, { LDA, true }, } },
+    { { { AND, true }, { CLV, false }, { LDA, true }, }, { { CLV, false }, { LDA, true }, } },
+    { { { AND, true }, { CLV, false }, { LAX, true }, }, { { CLV, false }, { LAX, true }, } },
+    { { { AND, true }, { CLV, false }, { AND, true }, }, { { CLV, false }, { AND, true }, } },
+    { { { AND, true }, { CLV, false }, { ORA, true }, }, { { CLV, false }, { LDA, true }, } },
+    { { { AND, true }, { ASL, false }, { ROR, false }, }, { { CLC, false }, { AND, true }, } },
+    { { { AND, true }, { ASL, false }, { SLO, true }, }, { { ASL, true }, { LDA, true }, } },
+    { { { AND, true }, { LSR, false }, { ROL, false }, }, { { CLC, false }, { AND, true }, } },
+    { { { AND, true }, { ROL, false }, { ROR, false }, }, { { AND, true }, {}, } },
+    { { { AND, true }, { ROR, false }, { ROL, false }, }, { { AND, true }, {}, } },
+    { { { AND, true }, { LDA, true }, {}, }, { { LDA, true }, {}, } },
+    { { { AND, true }, { LDX, true }, { AND, true }, }, { { LDX, true }, { AND, true }, } },
+    { { { AND, true }, { LDX, true }, { ORA, true }, }, { { LAX, true }, {}, } },
+    { { { AND, true }, { LDY, true }, { AND, true }, }, { { LDY, true }, { AND, true }, } },
+    { { { AND, true }, { LDY, true }, { ORA, true }, }, { { LDA, true }, { TAY, false }, } },
+    { { { AND, true }, { LAX, true }, {}, }, { { LAX, true }, {}, } },
+    { { { AND, true }, { STA, true }, { LDA, true }, }, { { AND, true }, { STA, true }, } },
+    { { { AND, true }, { STA, true }, { AND, true }, }, { { AND, true }, { STA, true }, } },
+    { { { AND, true }, { STA, true }, { ORA, true }, }, { { AND, true }, { STA, true }, } },
+    { { { AND, true }, { INC, true }, { LDA, true }, }, { { INC, true }, { LDA, true }, } },
+    { { { AND, true }, { INC, true }, { LAX, true }, }, { { INC, true }, { LAX, true }, } },
+    { { { AND, true }, { DEC, true }, { LDA, true }, }, { { DEC, true }, { LDA, true }, } },
+    { { { AND, true }, { DEC, true }, { LAX, true }, }, { { DEC, true }, { LAX, true }, } },
+    { { { AND, true }, { ASL, true }, { LDA, true }, }, { { ASL, true }, { LDA, true }, } },
+    { { { AND, true }, { ASL, true }, { LAX, true }, }, { { ASL, true }, { LAX, true }, } },
+    { { { AND, true }, { LSR, true }, { LDA, true }, }, { { LSR, true }, { LDA, true }, } },
+    { { { AND, true }, { LSR, true }, { LAX, true }, }, { { LSR, true }, { LAX, true }, } },
+    { { { AND, true }, { ROL, true }, { LDA, true }, }, { { ROL, true }, { LDA, true }, } },
+    { { { AND, true }, { ROL, true }, { LAX, true }, }, { { ROL, true }, { LAX, true }, } },
+    { { { AND, true }, { ROR, true }, { LDA, true }, }, { { ROR, true }, { LDA, true }, } },
+    { { { AND, true }, { ROR, true }, { LAX, true }, }, { { ROR, true }, { LAX, true }, } },
+    { { { AND, true }, { AND, true }, {}, }, { { AND, true }, {}, } },
+    { { { AND, true }, { ORA, true }, {}, }, { { LDA, true }, {}, } },
+    { { { AND, true }, { EOR, true }, { AND, true }, }, { { AND, true }, { EOR, true }, } },
+    { { { AND, true }, { BIT, true }, { LDA, true }, }, { { LDA, true }, { BIT, true }, } },
+    { { { AND, true }, { BIT, true }, { LAX, true }, }, { { LAX, true }, { BIT, true }, } },
+    { { { AND, true }, { BIT, true }, { AND, true }, }, { { BIT, true }, { AND, true }, } },
+    { { { AND, true }, { BIT, true }, { ORA, true }, }, { { LDA, true }, { BIT, true }, } },
+    { { { AND, true }, { SLO, true }, { LDA, true }, }, { { ASL, true }, { LDA, true }, } },
+    { { { AND, true }, { SLO, true }, { LAX, true }, }, { { ASL, true }, { LAX, true }, } },
+    { { { AND, true }, { SLO, true }, { AND, true }, }, { { ASL, true }, { LDA, true }, } },
+    { { { AND, true }, { RLA, true }, { LDA, true }, }, { { ROL, true }, { LDA, true }, } },
+    { { { AND, true }, { RLA, true }, { LAX, true }, }, { { ROL, true }, { LAX, true }, } },
+    { { { AND, true }, { RLA, true }, { ORA, true }, }, { { ROL, true }, { LDA, true }, } },
+    { { { AND, true }, { SRE, true }, { LDA, true }, }, { { LSR, true }, { LDA, true }, } },
+    { { { AND, true }, { SRE, true }, { LAX, true }, }, { { LSR, true }, { LAX, true }, } },
+    { { { AND, true }, { SRE, true }, { RLA, true }, }, { { SRE, true }, { RLA, true }, } },
+    { { { ORA, true }, { TAX, false }, { ORA, true }, }, { { ORA, true }, { TAX, false }, } },
+    { { { ORA, true }, { TAY, false }, { ORA, true }, }, { { ORA, true }, { TAY, false }, } },
+    { { { ORA, true }, { CLC, false }, { LDA, true }, }, { { CLC, false }, { LDA, true }, } },
+    { { { ORA, true }, { CLC, false }, { LAX, true }, }, { { CLC, false }, { LAX, true }, } },
+    { { { ORA, true }, { CLC, false }, { AND, true }, }, { { CLC, false }, { LDA, true }, } },
+    { { { ORA, true }, { CLC, false }, { ORA, true }, }, { { CLC, false }, { ORA, true }, } },
+    { { { ORA, true }, { SEC, false }, { LDA, true }, }, { { SEC, false }, { LDA, true }, } },
+    { { { ORA, true }, { SEC, false }, { LAX, true }, }, { { SEC, false }, { LAX, true }, } },
+    { { { ORA, true }, { SEC, false }, { AND, true }, }, { { SEC, false }, { LDA, true }, } },
+    { { { ORA, true }, { SEC, false }, { ORA, true }, }, { { SEC, false }, { ORA, true }, } },
+    { { { ORA, true }, { CLV, false }, { LDA, true }, }, { { CLV, false }, { LDA, true }, } },
+    { { { ORA, true }, { CLV, false }, { LAX, true }, }, { { CLV, false }, { LAX, true }, } },
+    { { { ORA, true }, { CLV, false }, { AND, true }, }, { { CLV, false }, { LDA, true }, } },
+    { { { ORA, true }, { CLV, false }, { ORA, true }, }, { { CLV, false }, { ORA, true }, } },
+    { { { ORA, true }, { ASL, false }, { ROR, false }, }, { { CLC, false }, { ORA, true }, } },
+    { { { ORA, true }, { ASL, false }, { SLO, true }, }, { { ASL, false }, { SLO, true }, } },
+    { { { ORA, true }, { LSR, false }, { ROL, false }, }, { { CLC, false }, { ORA, true }, } },
+    { { { ORA, true }, { ROL, false }, { ROR, false }, }, { { ORA, true }, {}, } },
+    { { { ORA, true }, { ROL, false }, { SLO, true }, }, { { ROL, false }, { SLO, true }, } },
+    { { { ORA, true }, { ROR, false }, { ROL, false }, }, { { ORA, true }, {}, } },
+    { { { ORA, true }, { LDA, true }, {}, }, { { LDA, true }, {}, } },
+    { { { ORA, true }, { LDX, true }, { AND, true }, }, { { LAX, true }, {}, } },
+    { { { ORA, true }, { LDX, true }, { ORA, true }, }, { { LDX, true }, { ORA, true }, } },
+    { { { ORA, true }, { LDY, true }, { AND, true }, }, { { LDA, true }, { TAY, false }, } },
+    { { { ORA, true }, { LDY, true }, { ORA, true }, }, { { LDY, true }, { ORA, true }, } },
+    { { { ORA, true }, { LAX, true }, {}, }, { { LAX, true }, {}, } },
+    { { { ORA, true }, { STA, true }, { LDA, true }, }, { { ORA, true }, { STA, true }, } },
+    { { { ORA, true }, { STA, true }, { AND, true }, }, { { ORA, true }, { STA, true }, } },
+    { { { ORA, true }, { STA, true }, { ORA, true }, }, { { ORA, true }, { STA, true }, } },
+    { { { ORA, true }, { INC, true }, { LDA, true }, }, { { INC, true }, { LDA, true }, } },
+    { { { ORA, true }, { INC, true }, { LAX, true }, }, { { INC, true }, { LAX, true }, } },
+    { { { ORA, true }, { DEC, true }, { LDA, true }, }, { { DEC, true }, { LDA, true }, } },
+    { { { ORA, true }, { DEC, true }, { LAX, true }, }, { { DEC, true }, { LAX, true }, } },
+    { { { ORA, true }, { ASL, true }, { LDA, true }, }, { { ASL, true }, { LDA, true }, } },
+    { { { ORA, true }, { ASL, true }, { LAX, true }, }, { { ASL, true }, { LAX, true }, } },
+    { { { ORA, true }, { LSR, true }, { LDA, true }, }, { { LSR, true }, { LDA, true }, } },
+    { { { ORA, true }, { LSR, true }, { LAX, true }, }, { { LSR, true }, { LAX, true }, } },
+    { { { ORA, true }, { ROL, true }, { LDA, true }, }, { { ROL, true }, { LDA, true }, } },
+    { { { ORA, true }, { ROL, true }, { LAX, true }, }, { { ROL, true }, { LAX, true }, } },
+    { { { ORA, true }, { ROR, true }, { LDA, true }, }, { { ROR, true }, { LDA, true }, } },
+    { { { ORA, true }, { ROR, true }, { LAX, true }, }, { { ROR, true }, { LAX, true }, } },
+    { { { ORA, true }, { AND, true }, {}, }, { { LDA, true }, {}, } },
+    { { { ORA, true }, { ORA, true }, {}, }, { { ORA, true }, {}, } },
+    { { { ORA, true }, { EOR, true }, { AND, true }, }, { { LDA, true }, { EOR, true }, } },
+    { { { ORA, true }, { CMP, true }, { SEC, false }, }, { { ORA, true }, { CMP, true }, } },
+    { { { ORA, true }, { CMP, true }, { LDA, true }, }, { { SEC, false }, { LDA, true }, } },
+    { { { ORA, true }, { CMP, true }, { LAX, true }, }, { { SEC, false }, { LAX, true }, } },
+    { { { ORA, true }, { CMP, true }, { AND, true }, }, { { SEC, false }, { LDA, true }, } },
+    { { { ORA, true }, { CMP, true }, { ORA, true }, }, { { SEC, false }, { ORA, true }, } },
+    { { { ORA, true }, { BIT, true }, { LDA, true }, }, { { LDA, true }, { BIT, true }, } },
+    { { { ORA, true }, { BIT, true }, { LAX, true }, }, { { LAX, true }, { BIT, true }, } },
+    { { { ORA, true }, { BIT, true }, { AND, true }, }, { { LDA, true }, { BIT, true }, } },
+    { { { ORA, true }, { BIT, true }, { ORA, true }, }, { { BIT, true }, { ORA, true }, } },
+    { { { ORA, true }, { SLO, true }, { LDA, true }, }, { { ASL, true }, { LDA, true }, } },
+    { { { ORA, true }, { SLO, true }, { LAX, true }, }, { { ASL, true }, { LAX, true }, } },
+    { { { ORA, true }, { SLO, true }, { AND, true }, }, { { ASL, true }, { LDA, true }, } },
+    { { { ORA, true }, { RLA, true }, { LDA, true }, }, { { ROL, true }, { LDA, true }, } },
+    { { { ORA, true }, { RLA, true }, { LAX, true }, }, { { ROL, true }, { LAX, true }, } },
+    { { { ORA, true }, { RLA, true }, { ORA, true }, }, { { ROL, true }, { LDA, true }, } },
+    { { { ORA, true }, { SRE, true }, { LDA, true }, }, { { LSR, true }, { LDA, true }, } },
+    { { { ORA, true }, { SRE, true }, { LAX, true }, }, { { LSR, true }, { LAX, true }, } },
+    { { { EOR, true }, { CLC, false }, { LDA, true }, }, { { CLC, false }, { LDA, true }, } },
+    { { { EOR, true }, { CLC, false }, { LAX, true }, }, { { CLC, false }, { LAX, true }, } },
+    { { { EOR, true }, { CLC, false }, { ORA, true }, }, { { CLC, false }, { ORA, true }, } },
+    { { { EOR, true }, { CLC, false }, { EOR, true }, }, { { ASL, false }, { ROR, false }, } },
+    { { { EOR, true }, { SEC, false }, { LDA, true }, }, { { SEC, false }, { LDA, true }, } },
+    { { { EOR, true }, { SEC, false }, { LAX, true }, }, { { SEC, false }, { LAX, true }, } },
+    { { { EOR, true }, { SEC, false }, { ORA, true }, }, { { SEC, false }, { ORA, true }, } },
+    { { { EOR, true }, { CLV, false }, { LDA, true }, }, { { CLV, false }, { LDA, true }, } },
+    { { { EOR, true }, { CLV, false }, { LAX, true }, }, { { CLV, false }, { LAX, true }, } },
+    { { { EOR, true }, { CLV, false }, { ORA, true }, }, { { CLV, false }, { ORA, true }, } },
+    { { { EOR, true }, { ASL, false }, { ROR, false }, }, { { CLC, false }, { EOR, true }, } },
+    { { { EOR, true }, { ASL, false }, { SLO, true }, }, { { ASL, false }, { SLO, true }, } },
+    { { { EOR, true }, { LSR, false }, { ROL, false }, }, { { CLC, false }, { EOR, true }, } },
+    { { { EOR, true }, { ROL, false }, { ROR, false }, }, { { EOR, true }, {}, } },
+    { { { EOR, true }, { ROL, false }, { SLO, true }, }, { { ROL, false }, { SLO, true }, } },
+    { { { EOR, true }, { ROR, false }, { ROL, false }, }, { { EOR, true }, {}, } },
+    { { { EOR, true }, { LDA, true }, {}, }, { { LDA, true }, {}, } },
+    { { { EOR, true }, { LDX, true }, { ORA, true }, }, { { LDX, true }, { ORA, true }, } },
+    { { { EOR, true }, { LDY, true }, { ORA, true }, }, { { LDY, true }, { ORA, true }, } },
+    { { { EOR, true }, { LAX, true }, {}, }, { { LAX, true }, {}, } },
+    { { { EOR, true }, { STA, true }, { LDA, true }, }, { { EOR, true }, { STA, true }, } },
+    { { { EOR, true }, { STA, true }, { AND, true }, }, { { EOR, true }, { STA, true }, } },
+    { { { EOR, true }, { STA, true }, { ORA, true }, }, { { EOR, true }, { STA, true }, } },
+    { { { EOR, true }, { INC, true }, { LDA, true }, }, { { INC, true }, { LDA, true }, } },
+    { { { EOR, true }, { INC, true }, { LAX, true }, }, { { INC, true }, { LAX, true }, } },
+    { { { EOR, true }, { DEC, true }, { LDA, true }, }, { { DEC, true }, { LDA, true }, } },
+    { { { EOR, true }, { DEC, true }, { LAX, true }, }, { { DEC, true }, { LAX, true }, } },
+    { { { EOR, true }, { ASL, true }, { LDA, true }, }, { { ASL, true }, { LDA, true }, } },
+    { { { EOR, true }, { ASL, true }, { LAX, true }, }, { { ASL, true }, { LAX, true }, } },
+    { { { EOR, true }, { LSR, true }, { LDA, true }, }, { { LSR, true }, { LDA, true }, } },
+    { { { EOR, true }, { LSR, true }, { LAX, true }, }, { { LSR, true }, { LAX, true }, } },
+    { { { EOR, true }, { ROL, true }, { LDA, true }, }, { { ROL, true }, { LDA, true }, } },
+    { { { EOR, true }, { ROL, true }, { LAX, true }, }, { { ROL, true }, { LAX, true }, } },
+    { { { EOR, true }, { ROR, true }, { LDA, true }, }, { { ROR, true }, { LDA, true }, } },
+    { { { EOR, true }, { ROR, true }, { LAX, true }, }, { { ROR, true }, { LAX, true }, } },
+    { { { EOR, true }, { AND, true }, { EOR, true }, }, { { AND, true }, {}, } },
+    { { { EOR, true }, { ORA, true }, {}, }, { { ORA, true }, {}, } },
+    { { { EOR, true }, { EOR, true }, {}, }, { { ROL, false }, { ROR, false }, } },
+    { { { EOR, true }, { BIT, true }, { LDA, true }, }, { { LDA, true }, { BIT, true }, } },
+    { { { EOR, true }, { BIT, true }, { LAX, true }, }, { { LAX, true }, { BIT, true }, } },
+    { { { EOR, true }, { BIT, true }, { ORA, true }, }, { { BIT, true }, { ORA, true }, } },
+    { { { EOR, true }, { SLO, true }, { LDA, true }, }, { { ASL, true }, { LDA, true }, } },
+    { { { EOR, true }, { SLO, true }, { LAX, true }, }, { { ASL, true }, { LAX, true }, } },
+    { { { EOR, true }, { SLO, true }, { AND, true }, }, { { ASL, true }, { LDA, true }, } },
+    { { { EOR, true }, { RLA, true }, { LDA, true }, }, { { ROL, true }, { LDA, true }, } },
+    { { { EOR, true }, { RLA, true }, { LAX, true }, }, { { ROL, true }, { LAX, true }, } },
+    { { { EOR, true }, { RLA, true }, { ORA, true }, }, { { ROL, true }, { LDA, true }, } },
+    { { { EOR, true }, { SRE, true }, { LDA, true }, }, { { LSR, true }, { LDA, true }, } },
+    { { { EOR, true }, { SRE, true }, { LAX, true }, }, { { LSR, true }, { LAX, true }, } },
+    { { { CMP, true }, { TAX, false }, { CLC, false }, }, { { TAX, false }, { CLC, false }, } },
+    { { { CMP, true }, { TAX, false }, { SEC, false }, }, { { TAX, false }, { SEC, false }, } },
+    { { { CMP, true }, { TAX, false }, { ASL, false }, }, { { TAX, false }, { ASL, false }, } },
+    { { { CMP, true }, { TAX, false }, { LSR, false }, }, { { TAX, false }, { LSR, false }, } },
+    { { { CMP, true }, { TAX, false }, { ASL, true }, }, { { TAX, false }, { ASL, true }, } },
+    { { { CMP, true }, { TAX, false }, { LSR, true }, }, { { TAX, false }, { LSR, true }, } },
+    { { { CMP, true }, { TAX, false }, { CMP, true }, }, { { TAX, false }, { CMP, true }, } },
+    { { { CMP, true }, { TAX, false }, { DCP, true }, }, { { TAX, false }, { DCP, true }, } },
+    { { { CMP, true }, { TAX, false }, { SLO, true }, }, { { TAX, false }, { SLO, true }, } },
+    { { { CMP, true }, { TAX, false }, { SRE, true }, }, { { TAX, false }, { SRE, true }, } },
+    { { { CMP, true }, { TAY, false }, { CLC, false }, }, { { TAY, false }, { CLC, false }, } },
+    { { { CMP, true }, { TAY, false }, { SEC, false }, }, { { TAY, false }, { SEC, false }, } },
+    { { { CMP, true }, { TAY, false }, { ASL, false }, }, { { TAY, false }, { ASL, false }, } },
+    { { { CMP, true }, { TAY, false }, { LSR, false }, }, { { TAY, false }, { LSR, false }, } },
+    { { { CMP, true }, { TAY, false }, { ASL, true }, }, { { TAY, false }, { ASL, true }, } },
+    { { { CMP, true }, { TAY, false }, { LSR, true }, }, { { TAY, false }, { LSR, true }, } },
+    { { { CMP, true }, { TAY, false }, { CMP, true }, }, { { TAY, false }, { CMP, true }, } },
+    { { { CMP, true }, { TAY, false }, { DCP, true }, }, { { TAY, false }, { DCP, true }, } },
+    { { { CMP, true }, { TAY, false }, { SLO, true }, }, { { TAY, false }, { SLO, true }, } },
+    { { { CMP, true }, { TAY, false }, { SRE, true }, }, { { TAY, false }, { SRE, true }, } },
+    { { { CMP, true }, { CLC, false }, { TAX, false }, }, { { TAX, false }, { CLC, false }, } },
+    { { { CMP, true }, { CLC, false }, { TAY, false }, }, { { TAY, false }, { CLC, false }, } },
+    { { { CMP, true }, { CLC, false }, { LDA, true }, }, { { CLC, false }, { LDA, true }, } },
+    { { { CMP, true }, { CLC, false }, { LDX, true }, }, { { CLC, false }, { LDX, true }, } },
+    { { { CMP, true }, { CLC, false }, { LDY, true }, }, { { CLC, false }, { LDY, true }, } },
+    { { { CMP, true }, { CLC, false }, { LAX, true }, }, { { CLC, false }, { LAX, true }, } },
+    { { { CMP, true }, { CLC, false }, { INC, true }, }, { { CLC, false }, { INC, true }, } },
+    { { { CMP, true }, { CLC, false }, { DEC, true }, }, { { CLC, false }, { DEC, true }, } },
+    { { { CMP, true }, { CLC, false }, { ADC, true }, }, { { CLC, false }, { ADC, true }, } },
+    { { { CMP, true }, { CLC, false }, { SBC, true }, }, { { CLC, false }, { SBC, true }, } },
+    { { { CMP, true }, { CLC, false }, { AND, true }, }, { { CLC, false }, { AND, true }, } },
+    { { { CMP, true }, { CLC, false }, { ORA, true }, }, { { CLC, false }, { ORA, true }, } },
+    { { { CMP, true }, { CLC, false }, { EOR, true }, }, { { CLC, false }, { EOR, true }, } },
+    { { { CMP, true }, { CLC, false }, { BIT, true }, }, { { CLC, false }, { BIT, true }, } },
+    { { { CMP, true }, { CLC, false }, { ISC, true }, }, { { CLC, false }, { ISC, true }, } },
+    { { { CMP, true }, { CLC, false }, { RLA, true }, }, { { CLC, false }, { RLA, true }, } },
+    { { { CMP, true }, { CLC, false }, { RRA, true }, }, { { CLC, false }, { RRA, true }, } },
+    { { { CMP, true }, { SEC, false }, { TAX, false }, }, { { TAX, false }, { SEC, false }, } },
+    { { { CMP, true }, { SEC, false }, { TAY, false }, }, { { TAY, false }, { SEC, false }, } },
+    { { { CMP, true }, { SEC, false }, { ROL, false }, }, { { SEC, false }, { ROL, false }, } },
+    { { { CMP, true }, { SEC, false }, { ROR, false }, }, { { SEC, false }, { ROR, false }, } },
+    { { { CMP, true }, { SEC, false }, { LDA, true }, }, { { SEC, false }, { LDA, true }, } },
+    { { { CMP, true }, { SEC, false }, { LDX, true }, }, { { SEC, false }, { LDX, true }, } },
+    { { { CMP, true }, { SEC, false }, { LDY, true }, }, { { SEC, false }, { LDY, true }, } },
+    { { { CMP, true }, { SEC, false }, { LAX, true }, }, { { SEC, false }, { LAX, true }, } },
+    { { { CMP, true }, { SEC, false }, { INC, true }, }, { { SEC, false }, { INC, true }, } },
+    { { { CMP, true }, { SEC, false }, { DEC, true }, }, { { SEC, false }, { DEC, true }, } },
+    { { { CMP, true }, { SEC, false }, { ROL, true }, }, { { SEC, false }, { ROL, true }, } },
+    { { { CMP, true }, { SEC, false }, { ROR, true }, }, { { SEC, false }, { ROR, true }, } },
+    { { { CMP, true }, { SEC, false }, { ADC, true }, }, { { SEC, false }, { ADC, true }, } },
+    { { { CMP, true }, { SEC, false }, { SBC, true }, }, { { SEC, false }, { SBC, true }, } },
+    { { { CMP, true }, { SEC, false }, { AND, true }, }, { { SEC, false }, { AND, true }, } },
+    { { { CMP, true }, { SEC, false }, { ORA, true }, }, { { SEC, false }, { ORA, true }, } },
+    { { { CMP, true }, { SEC, false }, { EOR, true }, }, { { SEC, false }, { EOR, true }, } },
+    { { { CMP, true }, { SEC, false }, { BIT, true }, }, { { SEC, false }, { BIT, true }, } },
+    { { { CMP, true }, { SEC, false }, { ISC, true }, }, { { SEC, false }, { ISC, true }, } },
+    { { { CMP, true }, { SEC, false }, { RLA, true }, }, { { SEC, false }, { RLA, true }, } },
+    { { { CMP, true }, { SEC, false }, { RRA, true }, }, { { SEC, false }, { RRA, true }, } },
+    { { { CMP, true }, { CLV, false }, { ASL, false }, }, { { CLV, false }, { ASL, false }, } },
+    { { { CMP, true }, { CLV, false }, { LSR, false }, }, { { CLV, false }, { LSR, false }, } },
+    { { { CMP, true }, { CLV, false }, { ASL, true }, }, { { CLV, false }, { ASL, true }, } },
+    { { { CMP, true }, { CLV, false }, { LSR, true }, }, { { CLV, false }, { LSR, true }, } },
+    { { { CMP, true }, { CLV, false }, { CMP, true }, }, { { CLV, false }, { CMP, true }, } },
+    { { { CMP, true }, { CLV, false }, { DCP, true }, }, { { CLV, false }, { DCP, true }, } },
+    { { { CMP, true }, { CLV, false }, { SLO, true }, }, { { CLV, false }, { SLO, true }, } },
+    { { { CMP, true }, { CLV, false }, { SRE, true }, }, { { CLV, false }, { SRE, true }, } },
+    { { { CMP, true }, { ASL, false }, {}, }, { { ASL, false }, {}, } },
+    { { { CMP, true }, { LSR, false }, {}, }, { { LSR, false }, {}, } },
+    { { { CMP, true }, { ROL, false }, { LDA, true }, }, { { ASL, false }, { LDA, true }, } },
+    { { { CMP, true }, { ROL, false }, { LAX, true }, }, { { ASL, false }, { LAX, true }, } },
+    { { { CMP, true }, { ROR, false }, { LDA, true }, }, { { LSR, false }, { LDA, true }, } },
+    { { { CMP, true }, { ROR, false }, { LAX, true }, }, { { LSR, false }, { LAX, true }, } },
+    { { { CMP, true }, { LDA, true }, { CLC, false }, }, { { CLC, false }, { LDA, true }, } },
+    { { { CMP, true }, { LDA, true }, { SEC, false }, }, { { SEC, false }, { LDA, true }, } },
+    { { { CMP, true }, { LDA, true }, { ASL, false }, }, { { LDA, true }, { ASL, false }, } },
+    { { { CMP, true }, { LDA, true }, { LSR, false }, }, { { LDA, true }, { LSR, false }, } },
+    { { { CMP, true }, { LDA, true }, { ASL, true }, }, { { LDA, true }, { ASL, true }, } },
+    { { { CMP, true }, { LDA, true }, { LSR, true }, }, { { LDA, true }, { LSR, true }, } },
+    { { { CMP, true }, { LDA, true }, { CMP, true }, }, { { LDA, true }, { CMP, true }, } },
+    { { { CMP, true }, { LDA, true }, { DCP, true }, }, { { LDA, true }, { DCP, true }, } },
+    { { { CMP, true }, { LDA, true }, { SLO, true }, }, { { LDA, true }, { SLO, true }, } },
+    { { { CMP, true }, { LDA, true }, { SRE, true }, }, { { LDA, true }, { SRE, true }, } },
+    { { { CMP, true }, { LDX, true }, { CLC, false }, }, { { CLC, false }, { LDX, true }, } },
+    { { { CMP, true }, { LDX, true }, { SEC, false }, }, { { SEC, false }, { LDX, true }, } },
+    { { { CMP, true }, { LDX, true }, { ASL, false }, }, { { LDX, true }, { ASL, false }, } },
+    { { { CMP, true }, { LDX, true }, { LSR, false }, }, { { LDX, true }, { LSR, false }, } },
+    { { { CMP, true }, { LDX, true }, { ASL, true }, }, { { LDX, true }, { ASL, true }, } },
+    { { { CMP, true }, { LDX, true }, { LSR, true }, }, { { LDX, true }, { LSR, true }, } },
+    { { { CMP, true }, { LDX, true }, { CMP, true }, }, { { LDX, true }, { CMP, true }, } },
+    { { { CMP, true }, { LDX, true }, { DCP, true }, }, { { LDX, true }, { DCP, true }, } },
+    { { { CMP, true }, { LDX, true }, { SLO, true }, }, { { LDX, true }, { SLO, true }, } },
+    { { { CMP, true }, { LDX, true }, { SRE, true }, }, { { LDX, true }, { SRE, true }, } },
+    { { { CMP, true }, { LDY, true }, { CLC, false }, }, { { CLC, false }, { LDY, true }, } },
+    { { { CMP, true }, { LDY, true }, { SEC, false }, }, { { SEC, false }, { LDY, true }, } },
+    { { { CMP, true }, { LDY, true }, { ASL, false }, }, { { LDY, true }, { ASL, false }, } },
+    { { { CMP, true }, { LDY, true }, { LSR, false }, }, { { LDY, true }, { LSR, false }, } },
+    { { { CMP, true }, { LDY, true }, { ASL, true }, }, { { LDY, true }, { ASL, true }, } },
+    { { { CMP, true }, { LDY, true }, { LSR, true }, }, { { LDY, true }, { LSR, true }, } },
+    { { { CMP, true }, { LDY, true }, { CMP, true }, }, { { LDY, true }, { CMP, true }, } },
+    { { { CMP, true }, { LDY, true }, { DCP, true }, }, { { LDY, true }, { DCP, true }, } },
+    { { { CMP, true }, { LDY, true }, { SLO, true }, }, { { LDY, true }, { SLO, true }, } },
+    { { { CMP, true }, { LDY, true }, { SRE, true }, }, { { LDY, true }, { SRE, true }, } },
+    { { { CMP, true }, { LAX, true }, { CLC, false }, }, { { CLC, false }, { LAX, true }, } },
+    { { { CMP, true }, { LAX, true }, { SEC, false }, }, { { SEC, false }, { LAX, true }, } },
+    { { { CMP, true }, { LAX, true }, { ASL, false }, }, { { LAX, true }, { ASL, false }, } },
+    { { { CMP, true }, { LAX, true }, { LSR, false }, }, { { LAX, true }, { LSR, false }, } },
+    { { { CMP, true }, { LAX, true }, { ASL, true }, }, { { LAX, true }, { ASL, true }, } },
+    { { { CMP, true }, { LAX, true }, { LSR, true }, }, { { LAX, true }, { LSR, true }, } },
+    { { { CMP, true }, { LAX, true }, { CMP, true }, }, { { LAX, true }, { CMP, true }, } },
+    { { { CMP, true }, { LAX, true }, { DCP, true }, }, { { LAX, true }, { DCP, true }, } },
+    { { { CMP, true }, { LAX, true }, { SLO, true }, }, { { LAX, true }, { SLO, true }, } },
+    { { { CMP, true }, { LAX, true }, { SRE, true }, }, { { LAX, true }, { SRE, true }, } },
+    { { { CMP, true }, { STA, true }, { ASL, false }, }, { { STA, true }, { ASL, false }, } },
+    { { { CMP, true }, { STA, true }, { LSR, false }, }, { { STA, true }, { LSR, false }, } },
+    { { { CMP, true }, { STA, true }, { ASL, true }, }, { { STA, true }, { ASL, true }, } },
+    { { { CMP, true }, { STA, true }, { LSR, true }, }, { { STA, true }, { LSR, true }, } },
+    { { { CMP, true }, { STA, true }, { CMP, true }, }, { { STA, true }, { CMP, true }, } },
+    { { { CMP, true }, { STA, true }, { DCP, true }, }, { { STA, true }, { DCP, true }, } },
+    { { { CMP, true }, { STA, true }, { SLO, true }, }, { { STA, true }, { SLO, true }, } },
+    { { { CMP, true }, { STA, true }, { SRE, true }, }, { { STA, true }, { SRE, true }, } },
+    { { { CMP, true }, { INC, true }, { CLC, false }, }, { { CLC, false }, { INC, true }, } },
+    { { { CMP, true }, { INC, true }, { SEC, false }, }, { { SEC, false }, { INC, true }, } },
+    { { { CMP, true }, { INC, true }, { ASL, false }, }, { { INC, true }, { ASL, false }, } },
+    { { { CMP, true }, { INC, true }, { LSR, false }, }, { { INC, true }, { LSR, false }, } },
+    { { { CMP, true }, { INC, true }, { ASL, true }, }, { { INC, true }, { ASL, true }, } },
+    { { { CMP, true }, { INC, true }, { LSR, true }, }, { { INC, true }, { LSR, true }, } },
+    { { { CMP, true }, { INC, true }, { CMP, true }, }, { { INC, true }, { CMP, true }, } },
+    { { { CMP, true }, { INC, true }, { SLO, true }, }, { { INC, true }, { SLO, true }, } },
+    { { { CMP, true }, { INC, true }, { SRE, true }, }, { { INC, true }, { SRE, true }, } },
+    { { { CMP, true }, { DEC, true }, { CLC, false }, }, { { CLC, false }, { DEC, true }, } },
+    { { { CMP, true }, { DEC, true }, { SEC, false }, }, { { SEC, false }, { DEC, true }, } },
+    { { { CMP, true }, { DEC, true }, { ASL, false }, }, { { DEC, true }, { ASL, false }, } },
+    { { { CMP, true }, { DEC, true }, { LSR, false }, }, { { DEC, true }, { LSR, false }, } },
+    { { { CMP, true }, { DEC, true }, { ASL, true }, }, { { DEC, true }, { ASL, true }, } },
+    { { { CMP, true }, { DEC, true }, { LSR, true }, }, { { DEC, true }, { LSR, true }, } },
+    { { { CMP, true }, { DEC, true }, { DCP, true }, }, { { DEC, true }, { DCP, true }, } },
+    { { { CMP, true }, { DEC, true }, { SLO, true }, }, { { DEC, true }, { SLO, true }, } },
+    { { { CMP, true }, { DEC, true }, { SRE, true }, }, { { DEC, true }, { SRE, true }, } },
+    { { { CMP, true }, { ASL, true }, {}, }, { { ASL, true }, {}, } },
+    { { { CMP, true }, { LSR, true }, {}, }, { { LSR, true }, {}, } },
+    { { { CMP, true }, { AND, true }, { CLC, false }, }, { { CLC, false }, { AND, true }, } },
+    { { { CMP, true }, { AND, true }, { SEC, false }, }, { { SEC, false }, { AND, true }, } },
+    { { { CMP, true }, { AND, true }, { ASL, false }, }, { { AND, true }, { ASL, false }, } },
+    { { { CMP, true }, { AND, true }, { LSR, false }, }, { { AND, true }, { LSR, false }, } },
+    { { { CMP, true }, { AND, true }, { ASL, true }, }, { { AND, true }, { ASL, true }, } },
+    { { { CMP, true }, { AND, true }, { LSR, true }, }, { { AND, true }, { LSR, true }, } },
+    { { { CMP, true }, { AND, true }, { CMP, true }, }, { { AND, true }, { CMP, true }, } },
+    { { { CMP, true }, { AND, true }, { DCP, true }, }, { { AND, true }, { DCP, true }, } },
+    { { { CMP, true }, { AND, true }, { SLO, true }, }, { { AND, true }, { SLO, true }, } },
+    { { { CMP, true }, { AND, true }, { SRE, true }, }, { { AND, true }, { SRE, true }, } },
+    { { { CMP, true }, { ORA, true }, { CLC, false }, }, { { CLC, false }, { ORA, true }, } },
+    { { { CMP, true }, { ORA, true }, { SEC, false }, }, { { SEC, false }, { ORA, true }, } },
+    { { { CMP, true }, { ORA, true }, { ASL, false }, }, { { ORA, true }, { ASL, false }, } },
+    { { { CMP, true }, { ORA, true }, { LSR, false }, }, { { ORA, true }, { LSR, false }, } },
+    { { { CMP, true }, { ORA, true }, { ASL, true }, }, { { ORA, true }, { ASL, true }, } },
+    { { { CMP, true }, { ORA, true }, { LSR, true }, }, { { ORA, true }, { LSR, true }, } },
+    { { { CMP, true }, { ORA, true }, { CMP, true }, }, { { ORA, true }, { CMP, true }, } },
+    { { { CMP, true }, { ORA, true }, { DCP, true }, }, { { ORA, true }, { DCP, true }, } },
+    { { { CMP, true }, { ORA, true }, { SLO, true }, }, { { ORA, true }, { SLO, true }, } },
+    { { { CMP, true }, { ORA, true }, { SRE, true }, }, { { ORA, true }, { SRE, true }, } },
+    { { { CMP, true }, { EOR, true }, { CLC, false }, }, { { CLC, false }, { EOR, true }, } },
+    { { { CMP, true }, { EOR, true }, { SEC, false }, }, { { SEC, false }, { EOR, true }, } },
+    { { { CMP, true }, { EOR, true }, { ASL, false }, }, { { EOR, true }, { ASL, false }, } },
+    { { { CMP, true }, { EOR, true }, { LSR, false }, }, { { EOR, true }, { LSR, false }, } },
+    { { { CMP, true }, { EOR, true }, { ASL, true }, }, { { EOR, true }, { ASL, true }, } },
+    { { { CMP, true }, { EOR, true }, { LSR, true }, }, { { EOR, true }, { LSR, true }, } },
+    { { { CMP, true }, { EOR, true }, { CMP, true }, }, { { EOR, true }, { CMP, true }, } },
+    { { { CMP, true }, { EOR, true }, { DCP, true }, }, { { EOR, true }, { DCP, true }, } },
+    { { { CMP, true }, { EOR, true }, { SLO, true }, }, { { EOR, true }, { SLO, true }, } },
+    { { { CMP, true }, { EOR, true }, { SRE, true }, }, { { EOR, true }, { SRE, true }, } },
+    { { { CMP, true }, { CMP, true }, {}, }, { { CMP, true }, {}, } },
+    { { { CMP, true }, { BIT, true }, { CLC, false }, }, { { CLC, false }, { BIT, true }, } },
+    { { { CMP, true }, { BIT, true }, { SEC, false }, }, { { SEC, false }, { BIT, true }, } },
+    { { { CMP, true }, { BIT, true }, { ASL, false }, }, { { BIT, true }, { ASL, false }, } },
+    { { { CMP, true }, { BIT, true }, { LSR, false }, }, { { BIT, true }, { LSR, false }, } },
+    { { { CMP, true }, { BIT, true }, { ASL, true }, }, { { BIT, true }, { ASL, true }, } },
+    { { { CMP, true }, { BIT, true }, { LSR, true }, }, { { BIT, true }, { LSR, true }, } },
+    { { { CMP, true }, { BIT, true }, { CMP, true }, }, { { BIT, true }, { CMP, true }, } },
+    { { { CMP, true }, { BIT, true }, { DCP, true }, }, { { BIT, true }, { DCP, true }, } },
+    { { { CMP, true }, { BIT, true }, { SLO, true }, }, { { BIT, true }, { SLO, true }, } },
+    { { { CMP, true }, { BIT, true }, { SRE, true }, }, { { BIT, true }, { SRE, true }, } },
+    { { { CMP, true }, { DCP, true }, {}, }, { { DCP, true }, {}, } },
+    { { { CMP, true }, { SLO, true }, {}, }, { { SLO, true }, {}, } },
+    { { { CMP, true }, { SRE, true }, {}, }, { { SRE, true }, {}, } },
+    { { { CPX, true }, { TXA, false }, { CLC, false }, }, { { TXA, false }, { CLC, false }, } },
+    { { { CPX, true }, { TXA, false }, { SEC, false }, }, { { TXA, false }, { SEC, false }, } },
+    { { { CPX, true }, { TXA, false }, { ASL, true }, }, { { TXA, false }, { ASL, true }, } },
+    { { { CPX, true }, { TXA, false }, { LSR, true }, }, { { TXA, false }, { LSR, true }, } },
+    { { { CPX, true }, { TXA, false }, { CPX, true }, }, { { TXA, false }, { CPX, true }, } },
+    { { { CPX, true }, { INX, false }, { CLC, false }, }, { { INX, false }, { CLC, false }, } },
+    { { { CPX, true }, { INX, false }, { SEC, false }, }, { { INX, false }, { SEC, false }, } },
+    { { { CPX, true }, { INX, false }, { ASL, true }, }, { { INX, false }, { ASL, true }, } },
+    { { { CPX, true }, { INX, false }, { LSR, true }, }, { { INX, false }, { LSR, true }, } },
+    { { { CPX, true }, { INX, false }, { CPX, true }, }, { { INX, false }, { CPX, true }, } },
+    { { { CPX, true }, { DEX, false }, { CLC, false }, }, { { DEX, false }, { CLC, false }, } },
+    { { { CPX, true }, { DEX, false }, { SEC, false }, }, { { DEX, false }, { SEC, false }, } },
+    { { { CPX, true }, { DEX, false }, { ASL, true }, }, { { DEX, false }, { ASL, true }, } },
+    { { { CPX, true }, { DEX, false }, { LSR, true }, }, { { DEX, false }, { LSR, true }, } },
+    { { { CPX, true }, { DEX, false }, { CPX, true }, }, { { DEX, false }, { CPX, true }, } },
+    { { { CPX, true }, { CLC, false }, { TXA, false }, }, { { TXA, false }, { CLC, false }, } },
+    { { { CPX, true }, { CLC, false }, { INX, false }, }, { { INX, false }, { CLC, false }, } },
+    { { { CPX, true }, { CLC, false }, { DEX, false }, }, { { DEX, false }, { CLC, false }, } },
+    { { { CPX, true }, { CLC, false }, { LDA, true }, }, { { CLC, false }, { LDA, true }, } },
+    { { { CPX, true }, { CLC, false }, { LDX, true }, }, { { CLC, false }, { LDX, true }, } },
+    { { { CPX, true }, { CLC, false }, { LDY, true }, }, { { CLC, false }, { LDY, true }, } },
+    { { { CPX, true }, { CLC, false }, { LAX, true }, }, { { CLC, false }, { LAX, true }, } },
+    { { { CPX, true }, { CLC, false }, { INC, true }, }, { { CLC, false }, { INC, true }, } },
+    { { { CPX, true }, { CLC, false }, { DEC, true }, }, { { CLC, false }, { DEC, true }, } },
+    { { { CPX, true }, { SEC, false }, { TXA, false }, }, { { TXA, false }, { SEC, false }, } },
+    { { { CPX, true }, { SEC, false }, { INX, false }, }, { { INX, false }, { SEC, false }, } },
+    { { { CPX, true }, { SEC, false }, { DEX, false }, }, { { DEX, false }, { SEC, false }, } },
+    { { { CPX, true }, { SEC, false }, { LDA, true }, }, { { SEC, false }, { LDA, true }, } },
+    { { { CPX, true }, { SEC, false }, { LDX, true }, }, { { SEC, false }, { LDX, true }, } },
+    { { { CPX, true }, { SEC, false }, { LDY, true }, }, { { SEC, false }, { LDY, true }, } },
+    { { { CPX, true }, { SEC, false }, { LAX, true }, }, { { SEC, false }, { LAX, true }, } },
+    { { { CPX, true }, { SEC, false }, { INC, true }, }, { { SEC, false }, { INC, true }, } },
+    { { { CPX, true }, { SEC, false }, { DEC, true }, }, { { SEC, false }, { DEC, true }, } },
+    { { { CPX, true }, { SEC, false }, { ROL, true }, }, { { SEC, false }, { ROL, true }, } },
+    { { { CPX, true }, { SEC, false }, { ROR, true }, }, { { SEC, false }, { ROR, true }, } },
+    { { { CPX, true }, { CLV, false }, { ASL, true }, }, { { CLV, false }, { ASL, true }, } },
+    { { { CPX, true }, { CLV, false }, { LSR, true }, }, { { CLV, false }, { LSR, true }, } },
+    { { { CPX, true }, { CLV, false }, { CPX, true }, }, { { CLV, false }, { CPX, true }, } },
+    { { { CPX, true }, { LDA, true }, { CLC, false }, }, { { CLC, false }, { LDA, true }, } },
+    { { { CPX, true }, { LDA, true }, { SEC, false }, }, { { SEC, false }, { LDA, true }, } },
+    { { { CPX, true }, { LDA, true }, { ASL, true }, }, { { LDA, true }, { ASL, true }, } },
+    { { { CPX, true }, { LDA, true }, { LSR, true }, }, { { LDA, true }, { LSR, true }, } },
+    { { { CPX, true }, { LDA, true }, { CPX, true }, }, { { LDA, true }, { CPX, true }, } },
+    { { { CPX, true }, { LDX, true }, { CLC, false }, }, { { CLC, false }, { LDX, true }, } },
+    { { { CPX, true }, { LDX, true }, { SEC, false }, }, { { SEC, false }, { LDX, true }, } },
+    { { { CPX, true }, { LDX, true }, { ASL, true }, }, { { LDX, true }, { ASL, true }, } },
+    { { { CPX, true }, { LDX, true }, { LSR, true }, }, { { LDX, true }, { LSR, true }, } },
+    { { { CPX, true }, { LDX, true }, { CPX, true }, }, { { LDX, true }, { CPX, true }, } },
+    { { { CPX, true }, { LDY, true }, { CLC, false }, }, { { CLC, false }, { LDY, true }, } },
+    { { { CPX, true }, { LDY, true }, { SEC, false }, }, { { SEC, false }, { LDY, true }, } },
+    { { { CPX, true }, { LDY, true }, { ASL, true }, }, { { LDY, true }, { ASL, true }, } },
+    { { { CPX, true }, { LDY, true }, { LSR, true }, }, { { LDY, true }, { LSR, true }, } },
+    { { { CPX, true }, { LDY, true }, { CPX, true }, }, { { LDY, true }, { CPX, true }, } },
+    { { { CPX, true }, { LAX, true }, { CLC, false }, }, { { CLC, false }, { LAX, true }, } },
+    { { { CPX, true }, { LAX, true }, { SEC, false }, }, { { SEC, false }, { LAX, true }, } },
+    { { { CPX, true }, { LAX, true }, { ASL, true }, }, { { LAX, true }, { ASL, true }, } },
+    { { { CPX, true }, { LAX, true }, { LSR, true }, }, { { LAX, true }, { LSR, true }, } },
+    { { { CPX, true }, { LAX, true }, { CPX, true }, }, { { LAX, true }, { CPX, true }, } },
+    { { { CPX, true }, { STX, true }, { ASL, true }, }, { { STX, true }, { ASL, true }, } },
+    { { { CPX, true }, { STX, true }, { LSR, true }, }, { { STX, true }, { LSR, true }, } },
+    { { { CPX, true }, { STX, true }, { CPX, true }, }, { { STX, true }, { CPX, true }, } },
+    { { { CPX, true }, { INC, true }, { CLC, false }, }, { { CLC, false }, { INC, true }, } },
+    { { { CPX, true }, { INC, true }, { SEC, false }, }, { { SEC, false }, { INC, true }, } },
+    { { { CPX, true }, { INC, true }, { ASL, true }, }, { { INC, true }, { ASL, true }, } },
+    { { { CPX, true }, { INC, true }, { LSR, true }, }, { { INC, true }, { LSR, true }, } },
+    { { { CPX, true }, { INC, true }, { CPX, true }, }, { { INC, true }, { CPX, true }, } },
+    { { { CPX, true }, { DEC, true }, { CLC, false }, }, { { CLC, false }, { DEC, true }, } },
+    { { { CPX, true }, { DEC, true }, { SEC, false }, }, { { SEC, false }, { DEC, true }, } },
+    { { { CPX, true }, { DEC, true }, { ASL, true }, }, { { DEC, true }, { ASL, true }, } },
+    { { { CPX, true }, { DEC, true }, { LSR, true }, }, { { DEC, true }, { LSR, true }, } },
+    { { { CPX, true }, { DEC, true }, { CPX, true }, }, { { DEC, true }, { CPX, true }, } },
+    { { { CPX, true }, { ASL, true }, {}, }, { { ASL, true }, {}, } },
+    { { { CPX, true }, { LSR, true }, {}, }, { { LSR, true }, {}, } },
+    { { { CPX, true }, { CPX, true }, {}, }, { { CPX, true }, {}, } },
+    { { { CPY, true }, { TYA, false }, { CLC, false }, }, { { TYA, false }, { CLC, false }, } },
+    { { { CPY, true }, { TYA, false }, { SEC, false }, }, { { TYA, false }, { SEC, false }, } },
+    { { { CPY, true }, { TYA, false }, { ASL, true }, }, { { TYA, false }, { ASL, true }, } },
+    { { { CPY, true }, { TYA, false }, { LSR, true }, }, { { TYA, false }, { LSR, true }, } },
+    { { { CPY, true }, { TYA, false }, { CPY, true }, }, { { TYA, false }, { CPY, true }, } },
+    { { { CPY, true }, { INY, false }, { CLC, false }, }, { { INY, false }, { CLC, false }, } },
+    { { { CPY, true }, { INY, false }, { SEC, false }, }, { { INY, false }, { SEC, false }, } },
+    { { { CPY, true }, { INY, false }, { ASL, true }, }, { { INY, false }, { ASL, true }, } },
+    { { { CPY, true }, { INY, false }, { LSR, true }, }, { { INY, false }, { LSR, true }, } },
+    { { { CPY, true }, { INY, false }, { CPY, true }, }, { { INY, false }, { CPY, true }, } },
+    { { { CPY, true }, { DEY, false }, { CLC, false }, }, { { DEY, false }, { CLC, false }, } },
+    { { { CPY, true }, { DEY, false }, { SEC, false }, }, { { DEY, false }, { SEC, false }, } },
+    { { { CPY, true }, { DEY, false }, { ASL, true }, }, { { DEY, false }, { ASL, true }, } },
+    { { { CPY, true }, { DEY, false }, { LSR, true }, }, { { DEY, false }, { LSR, true }, } },
+    { { { CPY, true }, { DEY, false }, { CPY, true }, }, { { DEY, false }, { CPY, true }, } },
+    { { { CPY, true }, { CLC, false }, { TYA, false }, }, { { TYA, false }, { CLC, false }, } },
+    { { { CPY, true }, { CLC, false }, { INY, false }, }, { { INY, false }, { CLC, false }, } },
+    { { { CPY, true }, { CLC, false }, { DEY, false }, }, { { DEY, false }, { CLC, false }, } },
+    { { { CPY, true }, { CLC, false }, { LDA, true }, }, { { CLC, false }, { LDA, true }, } },
+    { { { CPY, true }, { CLC, false }, { LDX, true }, }, { { CLC, false }, { LDX, true }, } },
+    { { { CPY, true }, { CLC, false }, { LDY, true }, }, { { CLC, false }, { LDY, true }, } },
+    { { { CPY, true }, { CLC, false }, { LAX, true }, }, { { CLC, false }, { LAX, true }, } },
+    { { { CPY, true }, { CLC, false }, { INC, true }, }, { { CLC, false }, { INC, true }, } },
+    { { { CPY, true }, { CLC, false }, { DEC, true }, }, { { CLC, false }, { DEC, true }, } },
+    { { { CPY, true }, { SEC, false }, { TYA, false }, }, { { TYA, false }, { SEC, false }, } },
+    { { { CPY, true }, { SEC, false }, { INY, false }, }, { { INY, false }, { SEC, false }, } },
+    { { { CPY, true }, { SEC, false }, { DEY, false }, }, { { DEY, false }, { SEC, false }, } },
+    { { { CPY, true }, { SEC, false }, { LDA, true }, }, { { SEC, false }, { LDA, true }, } },
+    { { { CPY, true }, { SEC, false }, { LDX, true }, }, { { SEC, false }, { LDX, true }, } },
+    { { { CPY, true }, { SEC, false }, { LDY, true }, }, { { SEC, false }, { LDY, true }, } },
+    { { { CPY, true }, { SEC, false }, { LAX, true }, }, { { SEC, false }, { LAX, true }, } },
+    { { { CPY, true }, { SEC, false }, { INC, true }, }, { { SEC, false }, { INC, true }, } },
+    { { { CPY, true }, { SEC, false }, { DEC, true }, }, { { SEC, false }, { DEC, true }, } },
+    { { { CPY, true }, { SEC, false }, { ROL, true }, }, { { SEC, false }, { ROL, true }, } },
+    { { { CPY, true }, { SEC, false }, { ROR, true }, }, { { SEC, false }, { ROR, true }, } },
+    { { { CPY, true }, { CLV, false }, { ASL, true }, }, { { CLV, false }, { ASL, true }, } },
+    { { { CPY, true }, { CLV, false }, { LSR, true }, }, { { CLV, false }, { LSR, true }, } },
+    { { { CPY, true }, { CLV, false }, { CPY, true }, }, { { CLV, false }, { CPY, true }, } },
+    { { { CPY, true }, { LDA, true }, { CLC, false }, }, { { CLC, false }, { LDA, true }, } },
+    { { { CPY, true }, { LDA, true }, { SEC, false }, }, { { SEC, false }, { LDA, true }, } },
+    { { { CPY, true }, { LDA, true }, { ASL, true }, }, { { LDA, true }, { ASL, true }, } },
+    { { { CPY, true }, { LDA, true }, { LSR, true }, }, { { LDA, true }, { LSR, true }, } },
+    { { { CPY, true }, { LDA, true }, { CPY, true }, }, { { LDA, true }, { CPY, true }, } },
+    { { { CPY, true }, { LDX, true }, { CLC, false }, }, { { CLC, false }, { LDX, true }, } },
+    { { { CPY, true }, { LDX, true }, { SEC, false }, }, { { SEC, false }, { LDX, true }, } },
+    { { { CPY, true }, { LDX, true }, { ASL, true }, }, { { LDX, true }, { ASL, true }, } },
+    { { { CPY, true }, { LDX, true }, { LSR, true }, }, { { LDX, true }, { LSR, true }, } },
+    { { { CPY, true }, { LDX, true }, { CPY, true }, }, { { LDX, true }, { CPY, true }, } },
+    { { { CPY, true }, { LDY, true }, { CLC, false }, }, { { CLC, false }, { LDY, true }, } },
+    { { { CPY, true }, { LDY, true }, { SEC, false }, }, { { SEC, false }, { LDY, true }, } },
+    { { { CPY, true }, { LDY, true }, { ASL, true }, }, { { LDY, true }, { ASL, true }, } },
+    { { { CPY, true }, { LDY, true }, { LSR, true }, }, { { LDY, true }, { LSR, true }, } },
+    { { { CPY, true }, { LDY, true }, { CPY, true }, }, { { LDY, true }, { CPY, true }, } },
+    { { { CPY, true }, { LAX, true }, { CLC, false }, }, { { CLC, false }, { LAX, true }, } },
+    { { { CPY, true }, { LAX, true }, { SEC, false }, }, { { SEC, false }, { LAX, true }, } },
+    { { { CPY, true }, { LAX, true }, { ASL, true }, }, { { LAX, true }, { ASL, true }, } },
+    { { { CPY, true }, { LAX, true }, { LSR, true }, }, { { LAX, true }, { LSR, true }, } },
+    { { { CPY, true }, { LAX, true }, { CPY, true }, }, { { LAX, true }, { CPY, true }, } },
+    { { { CPY, true }, { STY, true }, { ASL, true }, }, { { STY, true }, { ASL, true }, } },
+    { { { CPY, true }, { STY, true }, { LSR, true }, }, { { STY, true }, { LSR, true }, } },
+    { { { CPY, true }, { STY, true }, { CPY, true }, }, { { STY, true }, { CPY, true }, } },
+    { { { CPY, true }, { INC, true }, { CLC, false }, }, { { CLC, false }, { INC, true }, } },
+    { { { CPY, true }, { INC, true }, { SEC, false }, }, { { SEC, false }, { INC, true }, } },
+    { { { CPY, true }, { INC, true }, { ASL, true }, }, { { INC, true }, { ASL, true }, } },
+    { { { CPY, true }, { INC, true }, { LSR, true }, }, { { INC, true }, { LSR, true }, } },
+    { { { CPY, true }, { INC, true }, { CPY, true }, }, { { INC, true }, { CPY, true }, } },
+    { { { CPY, true }, { DEC, true }, { CLC, false }, }, { { CLC, false }, { DEC, true }, } },
+    { { { CPY, true }, { DEC, true }, { SEC, false }, }, { { SEC, false }, { DEC, true }, } },
+    { { { CPY, true }, { DEC, true }, { ASL, true }, }, { { DEC, true }, { ASL, true }, } },
+    { { { CPY, true }, { DEC, true }, { LSR, true }, }, { { DEC, true }, { LSR, true }, } },
+    { { { CPY, true }, { DEC, true }, { CPY, true }, }, { { DEC, true }, { CPY, true }, } },
+    { { { CPY, true }, { ASL, true }, {}, }, { { ASL, true }, {}, } },
+    { { { CPY, true }, { LSR, true }, {}, }, { { LSR, true }, {}, } },
+    { { { CPY, true }, { CPY, true }, {}, }, { { CPY, true }, {}, } },
+    { { { BIT, true }, { TAX, false }, { CLV, false }, }, { { TAX, false }, { CLV, false }, } },
+    { { { BIT, true }, { TAX, false }, { ADC, true }, }, { { TAX, false }, { ADC, true }, } },
+    { { { BIT, true }, { TAX, false }, { SBC, true }, }, { { TAX, false }, { SBC, true }, } },
+    { { { BIT, true }, { TAX, false }, { BIT, true }, }, { { TAX, false }, { BIT, true }, } },
+    { { { BIT, true }, { TAX, false }, { ISC, true }, }, { { TAX, false }, { ISC, true }, } },
+    { { { BIT, true }, { TAX, false }, { RRA, true }, }, { { TAX, false }, { RRA, true }, } },
+    { { { BIT, true }, { TAY, false }, { CLV, false }, }, { { TAY, false }, { CLV, false }, } },
+    { { { BIT, true }, { TAY, false }, { ADC, true }, }, { { TAY, false }, { ADC, true }, } },
+    { { { BIT, true }, { TAY, false }, { SBC, true }, }, { { TAY, false }, { SBC, true }, } },
+    { { { BIT, true }, { TAY, false }, { BIT, true }, }, { { TAY, false }, { BIT, true }, } },
+    { { { BIT, true }, { TAY, false }, { ISC, true }, }, { { TAY, false }, { ISC, true }, } },
+    { { { BIT, true }, { TAY, false }, { RRA, true }, }, { { TAY, false }, { RRA, true }, } },
+    { { { BIT, true }, { CLC, false }, { ADC, true }, }, { { CLC, false }, { ADC, true }, } },
+    { { { BIT, true }, { CLC, false }, { SBC, true }, }, { { CLC, false }, { SBC, true }, } },
+    { { { BIT, true }, { CLC, false }, { BIT, true }, }, { { CLC, false }, { BIT, true }, } },
+    { { { BIT, true }, { CLC, false }, { ISC, true }, }, { { CLC, false }, { ISC, true }, } },
+    { { { BIT, true }, { CLC, false }, { RRA, true }, }, { { CLC, false }, { RRA, true }, } },
+    { { { BIT, true }, { SEC, false }, { ADC, true }, }, { { SEC, false }, { ADC, true }, } },
+    { { { BIT, true }, { SEC, false }, { SBC, true }, }, { { SEC, false }, { SBC, true }, } },
+    { { { BIT, true }, { SEC, false }, { BIT, true }, }, { { SEC, false }, { BIT, true }, } },
+    { { { BIT, true }, { SEC, false }, { ISC, true }, }, { { SEC, false }, { ISC, true }, } },
+    { { { BIT, true }, { SEC, false }, { RRA, true }, }, { { SEC, false }, { RRA, true }, } },
+    { { { BIT, true }, { CLV, false }, { TAX, false }, }, { { TAX, false }, { CLV, false }, } },
+    { { { BIT, true }, { CLV, false }, { TAY, false }, }, { { TAY, false }, { CLV, false }, } },
+    { { { BIT, true }, { CLV, false }, { ASL, false }, }, { { CLV, false }, { ASL, false }, } },
+    { { { BIT, true }, { CLV, false }, { LSR, false }, }, { { CLV, false }, { LSR, false }, } },
+    { { { BIT, true }, { CLV, false }, { ROL, false }, }, { { CLV, false }, { ROL, false }, } },
+    { { { BIT, true }, { CLV, false }, { ROR, false }, }, { { CLV, false }, { ROR, false }, } },
+    { { { BIT, true }, { CLV, false }, { LDA, true }, }, { { CLV, false }, { LDA, true }, } },
+    { { { BIT, true }, { CLV, false }, { LDX, true }, }, { { CLV, false }, { LDX, true }, } },
+    { { { BIT, true }, { CLV, false }, { LDY, true }, }, { { CLV, false }, { LDY, true }, } },
+    { { { BIT, true }, { CLV, false }, { LAX, true }, }, { { CLV, false }, { LAX, true }, } },
+    { { { BIT, true }, { CLV, false }, { INC, true }, }, { { CLV, false }, { INC, true }, } },
+    { { { BIT, true }, { CLV, false }, { DEC, true }, }, { { CLV, false }, { DEC, true }, } },
+    { { { BIT, true }, { CLV, false }, { ASL, true }, }, { { CLV, false }, { ASL, true }, } },
+    { { { BIT, true }, { CLV, false }, { LSR, true }, }, { { CLV, false }, { LSR, true }, } },
+    { { { BIT, true }, { CLV, false }, { ROL, true }, }, { { CLV, false }, { ROL, true }, } },
+    { { { BIT, true }, { CLV, false }, { ROR, true }, }, { { CLV, false }, { ROR, true }, } },
+    { { { BIT, true }, { CLV, false }, { AND, true }, }, { { CLV, false }, { AND, true }, } },
+    { { { BIT, true }, { CLV, false }, { ORA, true }, }, { { CLV, false }, { ORA, true }, } },
+    { { { BIT, true }, { CLV, false }, { EOR, true }, }, { { CLV, false }, { EOR, true }, } },
+    { { { BIT, true }, { CLV, false }, { CMP, true }, }, { { CLV, false }, { CMP, true }, } },
+    { { { BIT, true }, { CLV, false }, { DCP, true }, }, { { CLV, false }, { DCP, true }, } },
+    { { { BIT, true }, { CLV, false }, { SLO, true }, }, { { CLV, false }, { SLO, true }, } },
+    { { { BIT, true }, { CLV, false }, { RLA, true }, }, { { CLV, false }, { RLA, true }, } },
+    { { { BIT, true }, { CLV, false }, { SRE, true }, }, { { CLV, false }, { SRE, true }, } },
+    { { { BIT, true }, { ASL, false }, { CLV, false }, }, { { CLV, false }, { ASL, false }, } },
+    { { { BIT, true }, { ASL, false }, { ADC, true }, }, { { ASL, false }, { ADC, true }, } },
+    { { { BIT, true }, { ASL, false }, { SBC, true }, }, { { ASL, false }, { SBC, true }, } },
+    { { { BIT, true }, { ASL, false }, { BIT, true }, }, { { ASL, false }, { BIT, true }, } },
+    { { { BIT, true }, { ASL, false }, { ISC, true }, }, { { ASL, false }, { ISC, true }, } },
+    { { { BIT, true }, { ASL, false }, { RRA, true }, }, { { ASL, false }, { RRA, true }, } },
+    { { { BIT, true }, { LSR, false }, { CLV, false }, }, { { CLV, false }, { LSR, false }, } },
+    { { { BIT, true }, { LSR, false }, { ADC, true }, }, { { LSR, false }, { ADC, true }, } },
+    { { { BIT, true }, { LSR, false }, { SBC, true }, }, { { LSR, false }, { SBC, true }, } },
+    { { { BIT, true }, { LSR, false }, { BIT, true }, }, { { LSR, false }, { BIT, true }, } },
+    { { { BIT, true }, { LSR, false }, { ISC, true }, }, { { LSR, false }, { ISC, true }, } },
+    { { { BIT, true }, { LSR, false }, { RRA, true }, }, { { LSR, false }, { RRA, true }, } },
+    { { { BIT, true }, { ROL, false }, { CLV, false }, }, { { CLV, false }, { ROL, false }, } },
+    { { { BIT, true }, { ROL, false }, { ADC, true }, }, { { ROL, false }, { ADC, true }, } },
+    { { { BIT, true }, { ROL, false }, { SBC, true }, }, { { ROL, false }, { SBC, true }, } },
+    { { { BIT, true }, { ROL, false }, { BIT, true }, }, { { ROL, false }, { BIT, true }, } },
+    { { { BIT, true }, { ROL, false }, { ISC, true }, }, { { ROL, false }, { ISC, true }, } },
+    { { { BIT, true }, { ROL, false }, { RRA, true }, }, { { ROL, false }, { RRA, true }, } },
+    { { { BIT, true }, { ROR, false }, { CLV, false }, }, { { CLV, false }, { ROR, false }, } },
+    { { { BIT, true }, { ROR, false }, { ADC, true }, }, { { ROR, false }, { ADC, true }, } },
+    { { { BIT, true }, { ROR, false }, { SBC, true }, }, { { ROR, false }, { SBC, true }, } },
+    { { { BIT, true }, { ROR, false }, { BIT, true }, }, { { ROR, false }, { BIT, true }, } },
+    { { { BIT, true }, { ROR, false }, { ISC, true }, }, { { ROR, false }, { ISC, true }, } },
+    { { { BIT, true }, { ROR, false }, { RRA, true }, }, { { ROR, false }, { RRA, true }, } },
+    { { { BIT, true }, { LDA, true }, { CLV, false }, }, { { CLV, false }, { LDA, true }, } },
+    { { { BIT, true }, { LDA, true }, { ADC, true }, }, { { LDA, true }, { ADC, true }, } },
+    { { { BIT, true }, { LDA, true }, { SBC, true }, }, { { LDA, true }, { SBC, true }, } },
+    { { { BIT, true }, { LDA, true }, { BIT, true }, }, { { LDA, true }, { BIT, true }, } },
+    { { { BIT, true }, { LDA, true }, { ISC, true }, }, { { LDA, true }, { ISC, true }, } },
+    { { { BIT, true }, { LDA, true }, { RRA, true }, }, { { LDA, true }, { RRA, true }, } },
+    { { { BIT, true }, { LDX, true }, { CLV, false }, }, { { CLV, false }, { LDX, true }, } },
+    { { { BIT, true }, { LDX, true }, { ADC, true }, }, { { LDX, true }, { ADC, true }, } },
+    { { { BIT, true }, { LDX, true }, { SBC, true }, }, { { LDX, true }, { SBC, true }, } },
+    { { { BIT, true }, { LDX, true }, { BIT, true }, }, { { LDX, true }, { BIT, true }, } },
+    { { { BIT, true }, { LDX, true }, { ISC, true }, }, { { LDX, true }, { ISC, true }, } },
+    { { { BIT, true }, { LDX, true }, { RRA, true }, }, { { LDX, true }, { RRA, true }, } },
+    { { { BIT, true }, { LDY, true }, { CLV, false }, }, { { CLV, false }, { LDY, true }, } },
+    { { { BIT, true }, { LDY, true }, { ADC, true }, }, { { LDY, true }, { ADC, true }, } },
+    { { { BIT, true }, { LDY, true }, { SBC, true }, }, { { LDY, true }, { SBC, true }, } },
+    { { { BIT, true }, { LDY, true }, { BIT, true }, }, { { LDY, true }, { BIT, true }, } },
+    { { { BIT, true }, { LDY, true }, { ISC, true }, }, { { LDY, true }, { ISC, true }, } },
+    { { { BIT, true }, { LDY, true }, { RRA, true }, }, { { LDY, true }, { RRA, true }, } },
+    { { { BIT, true }, { LAX, true }, { CLV, false }, }, { { CLV, false }, { LAX, true }, } },
+    { { { BIT, true }, { LAX, true }, { ADC, true }, }, { { LAX, true }, { ADC, true }, } },
+    { { { BIT, true }, { LAX, true }, { SBC, true }, }, { { LAX, true }, { SBC, true }, } },
+    { { { BIT, true }, { LAX, true }, { BIT, true }, }, { { LAX, true }, { BIT, true }, } },
+    { { { BIT, true }, { LAX, true }, { ISC, true }, }, { { LAX, true }, { ISC, true }, } },
+    { { { BIT, true }, { LAX, true }, { RRA, true }, }, { { LAX, true }, { RRA, true }, } },
+    { { { BIT, true }, { STA, true }, { ADC, true }, }, { { STA, true }, { ADC, true }, } },
+    { { { BIT, true }, { STA, true }, { SBC, true }, }, { { STA, true }, { SBC, true }, } },
+    { { { BIT, true }, { STA, true }, { BIT, true }, }, { { STA, true }, { BIT, true }, } },
+    { { { BIT, true }, { STA, true }, { ISC, true }, }, { { STA, true }, { ISC, true }, } },
+    { { { BIT, true }, { STA, true }, { RRA, true }, }, { { STA, true }, { RRA, true }, } },
+    { { { BIT, true }, { INC, true }, { CLV, false }, }, { { CLV, false }, { INC, true }, } },
+    { { { BIT, true }, { INC, true }, { ADC, true }, }, { { INC, true }, { ADC, true }, } },
+    { { { BIT, true }, { INC, true }, { BIT, true }, }, { { INC, true }, { BIT, true }, } },
+    { { { BIT, true }, { INC, true }, { ISC, true }, }, { { INC, true }, { ISC, true }, } },
+    { { { BIT, true }, { INC, true }, { RRA, true }, }, { { INC, true }, { RRA, true }, } },
+    { { { BIT, true }, { DEC, true }, { CLV, false }, }, { { CLV, false }, { DEC, true }, } },
+    { { { BIT, true }, { DEC, true }, { ADC, true }, }, { { DEC, true }, { ADC, true }, } },
+    { { { BIT, true }, { DEC, true }, { SBC, true }, }, { { DEC, true }, { SBC, true }, } },
+    { { { BIT, true }, { DEC, true }, { BIT, true }, }, { { DEC, true }, { BIT, true }, } },
+    { { { BIT, true }, { DEC, true }, { RRA, true }, }, { { DEC, true }, { RRA, true }, } },
+    { { { BIT, true }, { ASL, true }, { CLV, false }, }, { { CLV, false }, { ASL, true }, } },
+    { { { BIT, true }, { ASL, true }, { ADC, true }, }, { { ASL, true }, { ADC, true }, } },
+    { { { BIT, true }, { ASL, true }, { SBC, true }, }, { { ASL, true }, { SBC, true }, } },
+    { { { BIT, true }, { ASL, true }, { BIT, true }, }, { { ASL, true }, { BIT, true }, } },
+    { { { BIT, true }, { ASL, true }, { ISC, true }, }, { { ASL, true }, { ISC, true }, } },
+    { { { BIT, true }, { LSR, true }, { CLV, false }, }, { { CLV, false }, { LSR, true }, } },
+    { { { BIT, true }, { LSR, true }, { SBC, true }, }, { { LSR, true }, { SBC, true }, } },
+    { { { BIT, true }, { LSR, true }, { BIT, true }, }, { { LSR, true }, { BIT, true }, } },
+    { { { BIT, true }, { LSR, true }, { ISC, true }, }, { { LSR, true }, { ISC, true }, } },
+    { { { BIT, true }, { LSR, true }, { RRA, true }, }, { { LSR, true }, { RRA, true }, } },
+    { { { BIT, true }, { ROL, true }, { CLV, false }, }, { { CLV, false }, { ROL, true }, } },
+    { { { BIT, true }, { ROL, true }, { ADC, true }, }, { { ROL, true }, { ADC, true }, } },
+    { { { BIT, true }, { ROL, true }, { SBC, true }, }, { { ROL, true }, { SBC, true }, } },
+    { { { BIT, true }, { ROL, true }, { BIT, true }, }, { { ROL, true }, { BIT, true }, } },
+    { { { BIT, true }, { ROL, true }, { ISC, true }, }, { { ROL, true }, { ISC, true }, } },
+    { { { BIT, true }, { ROR, true }, { CLV, false }, }, { { CLV, false }, { ROR, true }, } },
+    { { { BIT, true }, { ROR, true }, { SBC, true }, }, { { ROR, true }, { SBC, true }, } },
+    { { { BIT, true }, { ROR, true }, { BIT, true }, }, { { ROR, true }, { BIT, true }, } },
+    { { { BIT, true }, { ROR, true }, { ISC, true }, }, { { ROR, true }, { ISC, true }, } },
+    { { { BIT, true }, { ROR, true }, { RRA, true }, }, { { ROR, true }, { RRA, true }, } },
+    { { { BIT, true }, { ADC, true }, {}, }, { { ADC, true }, {}, } },
+    { { { BIT, true }, { SBC, true }, {}, }, { { SBC, true }, {}, } },
+    { { { BIT, true }, { AND, true }, { CLV, false }, }, { { CLV, false }, { AND, true }, } },
+    { { { BIT, true }, { AND, true }, { ADC, true }, }, { { AND, true }, { ADC, true }, } },
+    { { { BIT, true }, { AND, true }, { SBC, true }, }, { { AND, true }, { SBC, true }, } },
+    { { { BIT, true }, { AND, true }, { BIT, true }, }, { { AND, true }, { BIT, true }, } },
+    { { { BIT, true }, { AND, true }, { ISC, true }, }, { { AND, true }, { ISC, true }, } },
+    { { { BIT, true }, { AND, true }, { RRA, true }, }, { { AND, true }, { RRA, true }, } },
+    { { { BIT, true }, { ORA, true }, { CLV, false }, }, { { CLV, false }, { ORA, true }, } },
+    { { { BIT, true }, { ORA, true }, { ADC, true }, }, { { ORA, true }, { ADC, true }, } },
+    { { { BIT, true }, { ORA, true }, { SBC, true }, }, { { ORA, true }, { SBC, true }, } },
+    { { { BIT, true }, { ORA, true }, { BIT, true }, }, { { ORA, true }, { BIT, true }, } },
+    { { { BIT, true }, { ORA, true }, { ISC, true }, }, { { ORA, true }, { ISC, true }, } },
+    { { { BIT, true }, { ORA, true }, { RRA, true }, }, { { ORA, true }, { RRA, true }, } },
+    { { { BIT, true }, { EOR, true }, { CLV, false }, }, { { CLV, false }, { EOR, true }, } },
+    { { { BIT, true }, { EOR, true }, { ADC, true }, }, { { EOR, true }, { ADC, true }, } },
+    { { { BIT, true }, { EOR, true }, { SBC, true }, }, { { EOR, true }, { SBC, true }, } },
+    { { { BIT, true }, { EOR, true }, { BIT, true }, }, { { EOR, true }, { BIT, true }, } },
+    { { { BIT, true }, { EOR, true }, { ISC, true }, }, { { EOR, true }, { ISC, true }, } },
+    { { { BIT, true }, { EOR, true }, { RRA, true }, }, { { EOR, true }, { RRA, true }, } },
+    { { { BIT, true }, { CMP, true }, { CLV, false }, }, { { CLV, false }, { CMP, true }, } },
+    { { { BIT, true }, { CMP, true }, { ADC, true }, }, { { CMP, true }, { ADC, true }, } },
+    { { { BIT, true }, { CMP, true }, { SBC, true }, }, { { CMP, true }, { SBC, true }, } },
+    { { { BIT, true }, { CMP, true }, { BIT, true }, }, { { CMP, true }, { BIT, true }, } },
+    { { { BIT, true }, { CMP, true }, { ISC, true }, }, { { CMP, true }, { ISC, true }, } },
+    { { { BIT, true }, { CMP, true }, { RRA, true }, }, { { CMP, true }, { RRA, true }, } },
+    { { { BIT, true }, { BIT, true }, {}, }, { { BIT, true }, {}, } },
+    { { { BIT, true }, { DCP, true }, { CLV, false }, }, { { CLV, false }, { DCP, true }, } },
+    { { { BIT, true }, { DCP, true }, { ADC, true }, }, { { DCP, true }, { ADC, true }, } },
+    { { { BIT, true }, { DCP, true }, { SBC, true }, }, { { DCP, true }, { SBC, true }, } },
+    { { { BIT, true }, { DCP, true }, { BIT, true }, }, { { DCP, true }, { BIT, true }, } },
+    { { { BIT, true }, { DCP, true }, { ISC, true }, }, { { DCP, true }, { ISC, true }, } },
+    { { { BIT, true }, { DCP, true }, { RRA, true }, }, { { DCP, true }, { RRA, true }, } },
+    { { { BIT, true }, { ISC, true }, {}, }, { { ISC, true }, {}, } },
+    { { { BIT, true }, { SLO, true }, { CLV, false }, }, { { CLV, false }, { SLO, true }, } },
+    { { { BIT, true }, { SLO, true }, { ADC, true }, }, { { SLO, true }, { ADC, true }, } },
+    { { { BIT, true }, { SLO, true }, { SBC, true }, }, { { SLO, true }, { SBC, true }, } },
+    { { { BIT, true }, { SLO, true }, { BIT, true }, }, { { SLO, true }, { BIT, true }, } },
+    { { { BIT, true }, { SLO, true }, { ISC, true }, }, { { SLO, true }, { ISC, true }, } },
+    { { { BIT, true }, { SLO, true }, { RRA, true }, }, { { SLO, true }, { RRA, true }, } },
+    { { { BIT, true }, { RLA, true }, { CLV, false }, }, { { CLV, false }, { RLA, true }, } },
+    { { { BIT, true }, { RLA, true }, { ADC, true }, }, { { RLA, true }, { ADC, true }, } },
+    { { { BIT, true }, { RLA, true }, { SBC, true }, }, { { RLA, true }, { SBC, true }, } },
+    { { { BIT, true }, { RLA, true }, { BIT, true }, }, { { RLA, true }, { BIT, true }, } },
+    { { { BIT, true }, { RLA, true }, { ISC, true }, }, { { RLA, true }, { ISC, true }, } },
+    { { { BIT, true }, { RLA, true }, { RRA, true }, }, { { RLA, true }, { RRA, true }, } },
+    { { { BIT, true }, { SRE, true }, { CLV, false }, }, { { CLV, false }, { SRE, true }, } },
+    { { { BIT, true }, { SRE, true }, { ADC, true }, }, { { SRE, true }, { ADC, true }, } },
+    { { { BIT, true }, { SRE, true }, { SBC, true }, }, { { SRE, true }, { SBC, true }, } },
+    { { { BIT, true }, { SRE, true }, { BIT, true }, }, { { SRE, true }, { BIT, true }, } },
+    { { { BIT, true }, { SRE, true }, { ISC, true }, }, { { SRE, true }, { ISC, true }, } },
+    { { { BIT, true }, { SRE, true }, { RRA, true }, }, { { SRE, true }, { RRA, true }, } },
+    { { { BIT, true }, { RRA, true }, {}, }, { { RRA, true }, {}, } },
+    { { { DCP, true }, { TAX, false }, { CMP, true }, }, { { TAX, false }, { DCP, true }, } },
+    { { { DCP, true }, { TAY, false }, { CMP, true }, }, { { TAY, false }, { DCP, true }, } },
+    { { { DCP, true }, { CLC, false }, { INC, true }, }, { { ASL, true }, { ROR, true }, } },
+    { { { DCP, true }, { CLC, false }, { ISC, true }, }, { { CLC, false }, { SBC, true }, } },
+    { { { DCP, true }, { SEC, false }, { ISC, true }, }, { { SEC, false }, { SBC, true }, } },
+    { { { DCP, true }, { CLV, false }, { CMP, true }, }, { { CLV, false }, { DCP, true }, } },
+    { { { DCP, true }, { ASL, false }, { STA, true }, }, { { ASL, false }, { STA, true }, } },
+    { { { DCP, true }, { ASL, false }, { CMP, true }, }, { { ASL, false }, { DCP, true }, } },
+    { { { DCP, true }, { ASL, false }, { ISC, true }, }, { { ASL, false }, { SBC, true }, } },
+    { { { DCP, true }, { LSR, false }, { STA, true }, }, { { LSR, false }, { STA, true }, } },
+    { { { DCP, true }, { LSR, false }, { CMP, true }, }, { { LSR, false }, { DCP, true }, } },
+    { { { DCP, true }, { LSR, false }, { ISC, true }, }, { { LSR, false }, { SBC, true }, } },
+    { { { DCP, true }, { STA, true }, { ASL, false }, }, { { STA, true }, { ASL, false }, } },
+    { { { DCP, true }, { STA, true }, { LSR, false }, }, { { STA, true }, { LSR, false }, } },
+    { { { DCP, true }, { STA, true }, { ASL, true }, }, { { STA, true }, { ASL, true }, } },
+    { { { DCP, true }, { STA, true }, { LSR, true }, }, { { STA, true }, { LSR, true }, } },
+    { { { DCP, true }, { STA, true }, { CMP, true }, }, { { STA, true }, { CMP, true }, } },
+    { { { DCP, true }, { STA, true }, { DCP, true }, }, { { STA, true }, { DCP, true }, } },
+    { { { DCP, true }, { STA, true }, { SLO, true }, }, { { STA, true }, { SLO, true }, } },
+    { { { DCP, true }, { STA, true }, { SRE, true }, }, { { STA, true }, { SRE, true }, } },
+    { { { DCP, true }, { INC, true }, { CLC, false }, }, { { ASL, true }, { ROR, true }, } },
+    { { { DCP, true }, { INC, true }, { ASL, false }, }, { { ASL, false }, {}, } },
+    { { { DCP, true }, { INC, true }, { LSR, false }, }, { { LSR, false }, {}, } },
+    { { { DCP, true }, { INC, true }, { ASL, true }, }, { { ASL, true }, {}, } },
+    { { { DCP, true }, { INC, true }, { LSR, true }, }, { { LSR, true }, {}, } },
+    { { { DCP, true }, { INC, true }, { CMP, true }, }, { { CMP, true }, {}, } },
+    { { { DCP, true }, { INC, true }, { SLO, true }, }, { { SLO, true }, {}, } },
+    { { { DCP, true }, { INC, true }, { SRE, true }, }, { { SRE, true }, {}, } },
+    { { { DCP, true }, { ASL, true }, { ROR, true }, }, { { CLC, false }, { DEC, true }, } },
+    { { { DCP, true }, { LSR, true }, { ROL, true }, }, { { CLC, false }, { DEC, true }, } },
+    { { { DCP, true }, { CMP, true }, {}, }, { { DCP, true }, {}, } },
+    { { { ISC, true }, { ASL, false }, { ROR, false }, }, { { ISC, true }, { CLC, false }, } },
+    { { { ISC, true }, { LSR, false }, { ROL, false }, }, { { ISC, true }, { CLC, false }, } },
+    { { { ISC, true }, { ROL, false }, { ROR, false }, }, { { ISC, true }, {}, } },
+    { { { ISC, true }, { ROR, false }, { ROL, false }, }, { { ISC, true }, {}, } },
+    { { { ISC, true }, { STA, true }, { LDA, true }, }, { { ISC, true }, { STA, true }, } },
+    { { { ISC, true }, { STA, true }, { AND, true }, }, { { ISC, true }, { STA, true }, } },
+    { { { ISC, true }, { STA, true }, { ORA, true }, }, { { ISC, true }, { STA, true }, } },
+    { { { SLO, true }, { TAX, false }, { ORA, true }, }, { { SLO, true }, { TAX, false }, } },
+    { { { SLO, true }, { TAY, false }, { ORA, true }, }, { { SLO, true }, { TAY, false }, } },
+    { { { SLO, true }, { CLC, false }, { ORA, true }, }, { { SLO, true }, { CLC, false }, } },
+    { { { SLO, true }, { SEC, false }, { ORA, true }, }, { { SLO, true }, { SEC, false }, } },
+    { { { SLO, true }, { CLV, false }, { ORA, true }, }, { { CLV, false }, { SLO, true }, } },
+    { { { SLO, true }, { ASL, false }, { ROR, false }, }, { { SLO, true }, { CLC, false }, } },
+    { { { SLO, true }, { LSR, false }, { ROL, false }, }, { { SLO, true }, { CLC, false }, } },
+    { { { SLO, true }, { ROL, false }, { ROR, false }, }, { { SLO, true }, {}, } },
+    { { { SLO, true }, { ROR, false }, { ROL, false }, }, { { SLO, true }, {}, } },
+    { { { SLO, true }, { LDX, true }, { AND, true }, }, { { ASL, true }, { LAX, true }, } },
+    { { { SLO, true }, { STA, true }, { LDA, true }, }, { { SLO, true }, { STA, true }, } },
+    { { { SLO, true }, { STA, true }, { AND, true }, }, { { SLO, true }, { STA, true }, } },
+    { { { SLO, true }, { STA, true }, { ORA, true }, }, { { SLO, true }, { STA, true }, } },
+    { { { SLO, true }, { LSR, true }, { CLC, false }, }, { { SLO, true }, { LSR, true }, } },
+    { { { SLO, true }, { LSR, true }, { SLO, true }, }, { { SLO, true }, { CLC, false }, } },
+    { { { SLO, true }, { ROR, true }, { CLC, false }, }, { { SLO, true }, { ROR, true }, } },
+    { { { SLO, true }, { ROR, true }, { LDA, true }, }, { { CLC, false }, { LDA, true }, } },
+    { { { SLO, true }, { ROR, true }, { LAX, true }, }, { { CLC, false }, { LAX, true }, } },
+    { { { SLO, true }, { ROR, true }, { SLO, true }, }, { { SLO, true }, {}, } },
+    { { { SLO, true }, { AND, true }, { TAX, false }, }, { { ASL, true }, { LAX, true }, } },
+    { { { SLO, true }, { AND, true }, { LDX, true }, }, { { ASL, true }, { LAX, true }, } },
+    { { { SLO, true }, { AND, true }, { STA, true }, }, { { ASL, true }, { LDA, true }, } },
+    { { { SLO, true }, { ORA, true }, {}, }, { { SLO, true }, {}, } },
+    { { { SLO, true }, { CMP, true }, { SEC, false }, }, { { SLO, true }, { CMP, true }, } },
+    { { { SLO, true }, { CMP, true }, { ORA, true }, }, { { SLO, true }, { SEC, false }, } },
+    { { { SLO, true }, { SRE, true }, { CLC, false }, }, { { SLO, true }, { SRE, true }, } },
+    { { { RLA, true }, { TAX, false }, { AND, true }, }, { { RLA, true }, { TAX, false }, } },
+    { { { RLA, true }, { TAY, false }, { AND, true }, }, { { RLA, true }, { TAY, false }, } },
+    { { { RLA, true }, { CLC, false }, { AND, true }, }, { { RLA, true }, { CLC, false }, } },
+    { { { RLA, true }, { SEC, false }, { AND, true }, }, { { RLA, true }, { SEC, false }, } },
+    { { { RLA, true }, { CLV, false }, { AND, true }, }, { { CLV, false }, { RLA, true }, } },
+    { { { RLA, true }, { ASL, false }, { ROR, false }, }, { { RLA, true }, { CLC, false }, } },
+    { { { RLA, true }, { LSR, false }, { ROL, false }, }, { { RLA, true }, { CLC, false }, } },
+    { { { RLA, true }, { ROL, false }, { ROR, false }, }, { { RLA, true }, {}, } },
+    { { { RLA, true }, { ROR, false }, { ROL, false }, }, { { RLA, true }, {}, } },
+    { { { RLA, true }, { LDX, true }, { ORA, true }, }, { { ROL, true }, { LAX, true }, } },
+    { { { RLA, true }, { STA, true }, { LDA, true }, }, { { RLA, true }, { STA, true }, } },
+    { { { RLA, true }, { STA, true }, { AND, true }, }, { { RLA, true }, { STA, true }, } },
+    { { { RLA, true }, { STA, true }, { ORA, true }, }, { { RLA, true }, { STA, true }, } },
+    { { { RLA, true }, { ROR, true }, { LDA, true }, }, { { LDA, true }, {}, } },
+    { { { RLA, true }, { ROR, true }, { LAX, true }, }, { { LAX, true }, {}, } },
+    { { { RLA, true }, { AND, true }, {}, }, { { RLA, true }, {}, } },
+    { { { RLA, true }, { ORA, true }, { TAX, false }, }, { { ROL, true }, { LAX, true }, } },
+    { { { RLA, true }, { ORA, true }, { LDX, true }, }, { { ROL, true }, { LAX, true }, } },
+    { { { RLA, true }, { ORA, true }, { STA, true }, }, { { ROL, true }, { LDA, true }, } },
+    { { { RLA, true }, { EOR, true }, { AND, true }, }, { { RLA, true }, { EOR, true }, } },
+    { { { SRE, true }, { ASL, false }, { ROR, false }, }, { { SRE, true }, { CLC, false }, } },
+    { { { SRE, true }, { LSR, false }, { ROL, false }, }, { { SRE, true }, { CLC, false }, } },
+    { { { SRE, true }, { ROL, false }, { ROR, false }, }, { { SRE, true }, {}, } },
+    { { { SRE, true }, { ROR, false }, { ROL, false }, }, { { SRE, true }, {}, } },
+    { { { SRE, true }, { STA, true }, { LDA, true }, }, { { SRE, true }, { STA, true }, } },
+    { { { SRE, true }, { STA, true }, { AND, true }, }, { { SRE, true }, { STA, true }, } },
+    { { { SRE, true }, { STA, true }, { ORA, true }, }, { { SRE, true }, { STA, true }, } },
+    { { { SRE, true }, { ASL, true }, { CLC, false }, }, { { SRE, true }, { ASL, true }, } },
+    { { { SRE, true }, { ROL, true }, { CLC, false }, }, { { SRE, true }, { ROL, true }, } },
+    { { { SRE, true }, { ROL, true }, { LDA, true }, }, { { CLC, false }, { LDA, true }, } },
+    { { { SRE, true }, { ROL, true }, { LAX, true }, }, { { CLC, false }, { LAX, true }, } },
+    { { { SRE, true }, { ROL, true }, { SRE, true }, }, { { SRE, true }, { EOR, true }, } },
+    { { { SRE, true }, { AND, true }, { EOR, true }, }, { { LSR, true }, { AND, true }, } },
+    { { { SRE, true }, { EOR, true }, { TAX, false }, }, { { LSR, true }, { TAX, false }, } },
+    { { { SRE, true }, { EOR, true }, { TAY, false }, }, { { LSR, true }, { TAY, false }, } },
+    { { { SRE, true }, { EOR, true }, { ASL, false }, }, { { LSR, true }, { ASL, false }, } },
+    { { { SRE, true }, { EOR, true }, { LSR, false }, }, { { LSR, true }, { LSR, false }, } },
+    { { { SRE, true }, { EOR, true }, { ROL, false }, }, { { LSR, true }, { ROL, false }, } },
+    { { { SRE, true }, { EOR, true }, { ROR, false }, }, { { LSR, true }, { ROR, false }, } },
+    { { { SRE, true }, { EOR, true }, { LDX, true }, }, { { LSR, true }, { LDX, true }, } },
+    { { { SRE, true }, { EOR, true }, { LDY, true }, }, { { LSR, true }, { LDY, true }, } },
+    { { { SRE, true }, { EOR, true }, { INC, true }, }, { { LSR, true }, { INC, true }, } },
+    { { { SRE, true }, { EOR, true }, { DEC, true }, }, { { LSR, true }, { DEC, true }, } },
+    { { { SRE, true }, { EOR, true }, { ASL, true }, }, { { LSR, true }, { ASL, true }, } },
+    { { { SRE, true }, { EOR, true }, { LSR, true }, }, { { LSR, true }, { LSR, true }, } },
+    { { { SRE, true }, { EOR, true }, { ROL, true }, }, { { ASL, true }, { ROR, true }, } },
+    { { { SRE, true }, { EOR, true }, { ROR, true }, }, { { LSR, true }, { ROR, true }, } },
+    { { { SRE, true }, { EOR, true }, { ADC, true }, }, { { CLC, false }, { RRA, true }, } },
+    { { { SRE, true }, { EOR, true }, { SBC, true }, }, { { LSR, true }, { SBC, true }, } },
+    { { { SRE, true }, { EOR, true }, { AND, true }, }, { { LSR, true }, { AND, true }, } },
+    { { { SRE, true }, { EOR, true }, { CMP, true }, }, { { LSR, true }, { CMP, true }, } },
+    { { { SRE, true }, { EOR, true }, { BIT, true }, }, { { LSR, true }, { BIT, true }, } },
+    { { { SRE, true }, { EOR, true }, { DCP, true }, }, { { LSR, true }, { DCP, true }, } },
+    { { { SRE, true }, { EOR, true }, { ISC, true }, }, { { LSR, true }, { ISC, true }, } },
+    { { { SRE, true }, { EOR, true }, { SLO, true }, }, { { LSR, true }, { SLO, true }, } },
+    { { { SRE, true }, { EOR, true }, { RLA, true }, }, { { CLC, false }, { AND, true }, } },
+    { { { SRE, true }, { EOR, true }, { SRE, true }, }, { { LSR, true }, { SRE, true }, } },
+    { { { SRE, true }, { EOR, true }, { RRA, true }, }, { { LSR, true }, { RRA, true }, } },
+    { { { SRE, true }, { SLO, true }, { CLC, false }, }, { { SRE, true }, { SLO, true }, } },
+    { { { SRE, true }, { RLA, true }, { CLC, false }, }, { { SRE, true }, { RLA, true }, } },
+    { { { SRE, true }, { RLA, true }, { LDA, true }, }, { { CLC, false }, { LDA, true }, } },
+    { { { SRE, true }, { RLA, true }, { LAX, true }, }, { { CLC, false }, { LAX, true }, } },
+    { { { SRE, true }, { RLA, true }, { ORA, true }, }, { { CLC, false }, { LDA, true }, } },
+    { { { RRA, true }, { ASL, false }, { ROR, false }, }, { { RRA, true }, { CLC, false }, } },
+    { { { RRA, true }, { LSR, false }, { ROL, false }, }, { { RRA, true }, { CLC, false }, } },
+    { { { RRA, true }, { ROL, false }, { ROR, false }, }, { { RRA, true }, {}, } },
+    { { { RRA, true }, { ROR, false }, { ROL, false }, }, { { RRA, true }, {}, } },
+    { { { RRA, true }, { STA, true }, { LDA, true }, }, { { RRA, true }, { STA, true }, } },
+    { { { RRA, true }, { STA, true }, { AND, true }, }, { { RRA, true }, { STA, true }, } },
+    { { { RRA, true }, { STA, true }, { ORA, true }, }, { { RRA, true }, { STA, true }, } },
+};
+extern unsigned const num_superopt_rules = 3825;
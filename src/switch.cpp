@@ -1,11 +1,162 @@
 #include "switch.hpp"
 
+#include <algorithm>
+
 #include <boost/container/static_vector.hpp>
+#include <boost/container/small_vector.hpp>
 
 #include "ir.hpp"
 
 namespace bc = ::boost::container;
 
+namespace // anon namespace
+{
+
+// Rough 6502 costs, used to pick how each switch is lowered.
+// A compare and branch is 'CMP #imm' followed by 'Bcc':
+constexpr unsigned TEST_BYTES = 4;
+constexpr unsigned TEST_CYCLES = 5;
+// A jump table (see ASM_X_SWITCH) is 'TAX', then the RTS trick,
+// plus a range check when there's a default case:
+constexpr unsigned TABLE_BYTES = 1 + 9;
+constexpr unsigned TABLE_CYCLES = 2 + 20;
+constexpr unsigned RANGE_CHECK_BYTES = 7;
+constexpr unsigned RANGE_CHECK_CYCLES = 8;
+// Cycles are what matter most, but bytes break ties:
+constexpr unsigned CYCLE_WEIGHT = 2;
+// Binary searches end with a linear search once this few cases remain:
+constexpr unsigned BSEARCH_LEAF = 3;
+
+struct switch_case_t
+{
+    std::uint8_t value;
+    unsigned output; // Which output of the switch's CFG node it leads to.
+
+    auto operator<=>(switch_case_t const& o) const { return value <=> o.value; }
+};
+
+using switch_cases_t = bc::small_vector<switch_case_t, 16>;
+
+// Counts the tests of a lowering, and how many get executed to reach each case.
+struct switch_estimate_t
+{
+    unsigned tests = 0;
+    unsigned depth_sum = 0;
+
+    unsigned score(unsigned num_cases) const
+    {
+        return (depth_sum * TEST_CYCLES * CYCLE_WEIGHT / num_cases) + (tests * TEST_BYTES);
+    }
+};
+
+// Full switches don't need to test their last case; it's all that remains.
+switch_estimate_t estimate_chain(unsigned size, bool full)
+{
+    switch_estimate_t est;
+    for(unsigned i = 0; i < size; ++i)
+    {
+        if(!(full && i + 1 == size))
+            est.tests += 1;
+        est.depth_sum += est.tests;
+    }
+    return est;
+}
+
+switch_estimate_t estimate_bsearch(unsigned size, bool full)
+{
+    if(size <= BSEARCH_LEAF)
+        return estimate_chain(size, full);
+
+    unsigned const half = size / 2;
+    switch_estimate_t const lo = estimate_bsearch(half, full);
+    switch_estimate_t const hi = estimate_bsearch(size - half, full);
+    return { lo.tests + hi.tests + 1, lo.depth_sum + hi.depth_sum + size };
+}
+
+// Replaces a switch with a tree of comparisons, either a linear chain
+// or a binary search depending on 'bsearch'.
+void switch_to_branches(ir_t& ir, cfg_ht switch_cfg, switch_cases_t cases, bool bsearch)
+{
+    ssa_ht const branch = switch_cfg->last_daisy();
+    assert(is_switch(branch->op()));
+    bool const full = branch->op() == SSA_switch_full;
+
+    if(bsearch)
+        std::sort(cases.begin(), cases.end());
+
+    // Nodes created here use an output of -1, as they don't have phis.
+    auto const link = [&](cfg_ht from, cfg_ht to, int output)
+    {
+        from->link_append_output(to, [&](ssa_ht phi)
+        {
+            assert(output >= 0);
+            return phi->input(switch_cfg->output_edge(output).index);
+        });
+    };
+
+    cfg_ht const entry = ir.emplace_cfg();
+    ssa_value_t condition = branch->input(0);
+    if(condition.type() != TYPE_U)
+        condition = entry->emplace_ssa(SSA_cast, TYPE_U, condition);
+
+    // Ends 'cfg' with an SSA_if, returning the CFG node taken on false.
+    auto const branch_if = [&](cfg_ht cfg, ssa_ht test, cfg_ht on_true, int on_true_output) -> cfg_ht
+    {
+        ssa_ht const if_ = cfg->emplace_ssa(SSA_if, TYPE_VOID, test);
+        if_->append_daisy();
+
+        cfg_ht const on_false = ir.emplace_cfg();
+        link(cfg, on_false, -1);
+        link(cfg, on_true, on_true_output);
+        return on_false;
+    };
+
+    auto const build = [&](auto const& self, cfg_ht cfg, unsigned begin, unsigned end) -> void
+    {
+        assert(begin < end);
+
+        if(!bsearch || end - begin <= BSEARCH_LEAF)
+        {
+            for(unsigned i = begin; i < end; ++i)
+            {
+                switch_case_t const& c = cases[i];
+
+                if(full && i + 1 == end)
+                {
+                    link(cfg, switch_cfg->output(c.output), c.output);
+                    return;
+                }
+
+                ssa_ht const eq = cfg->emplace_ssa(SSA_eq, TYPE_BOOL, condition, ssa_value_t(c.value, TYPE_U));
+                cfg = branch_if(cfg, eq, switch_cfg->output(c.output), c.output);
+            }
+
+            // Take the default case:
+            assert(!full);
+            link(cfg, switch_cfg->output(0), 0);
+            return;
+        }
+
+        unsigned const mid = begin + (end - begin) / 2;
+        ssa_ht const lt = cfg->emplace_ssa(SSA_lt, TYPE_BOOL, condition, ssa_value_t(cases[mid].value, TYPE_U));
+
+        cfg_ht const lo = ir.emplace_cfg();
+        cfg_ht const hi = branch_if(cfg, lt, lo, -1);
+
+        self(self, lo, begin, mid);
+        self(self, hi, mid, end);
+    };
+
+    build(build, entry, 0, cases.size());
+
+    // Replace the switch with a jump to 'entry':
+    branch->prune();
+    switch_cfg->link_clear_outputs();
+    link(switch_cfg, entry, -1);
+}
+
+} // end anon namespace
+
 bool switch_partial_to_full(ssa_node_t& switch_node)
 {
     assert(switch_node.op() == SSA_switch_partial);
@@ -37,7 +188,7 @@ bool switch_partial_to_full(ssa_node_t& switch_node)
     return true;
 }
 
-bool switch_partial_to_full(ir_t& ir)
+bool lower_switches(ir_t& ir)
 {
     bool updated = false;
 
@@ -94,22 +245,60 @@ bool switch_partial_to_full(ir_t& ir)
         return result;
     };
 
+    switch_cases_t case_list;
+
     for(cfg_ht cfg_it = ir.cfg_begin(); cfg_it; ++cfg_it)
     {
         ssa_ht const branch = cfg_it->last_daisy();
         
-        if(!branch || branch->op() != SSA_switch_partial)
+        if(!branch || !is_switch(branch->op()))
             continue;
 
+        bool const full = branch->op() == SSA_switch_full;
+        unsigned const first_case = ssa_switch_cases(branch->op());
+
         // Gather all cases into 'cases':
         static_bitset_t<256> cases = {};
+        case_list.clear();
         unsigned const input_size = branch->input_size();
         for(unsigned i = 1; i < input_size; ++i)
-            cases.set(std::uint8_t(branch->input(i).whole()));
+        {
+            std::uint8_t const value = branch->input(i).whole();
+            cases.set(value);
+            case_list.push_back({ value, first_case + i - 1 });
+        }
+
+        if(case_list.empty())
+            continue;
 
         // Calculate
         auto const rep = calc_rep(cases);
 
+        // Pick the cheapest lowering:
+        unsigned const num_cases = case_list.size();
+        unsigned table_score;
+        if(full)
+            table_score = (TABLE_CYCLES * CYCLE_WEIGHT) + TABLE_BYTES + (2 * cfg_it->output_size());
+        else
+        {
+            unsigned const entries = (rep.size + (1 << rep.rshift) - 1) >> rep.rshift;
+            table_score = ((TABLE_CYCLES + RANGE_CHECK_CYCLES + rep.rshift * TEST_CYCLES) * CYCLE_WEIGHT)
+                          + TABLE_BYTES + RANGE_CHECK_BYTES + (rep.rshift * TEST_BYTES) + (2 * entries);
+        }
+        unsigned const chain_score = estimate_chain(num_cases, full).score(num_cases);
+        unsigned const bsearch_score = estimate_bsearch(num_cases, full).score(num_cases);
+
+        if(chain_score <= table_score || bsearch_score <= table_score)
+        {
+            switch_to_branches(ir, cfg_it, case_list, bsearch_score < chain_score);
+            ir.assert_valid();
+            updated = true;
+            continue;
+        }
+
+        if(full)
+            continue; // Already a jump table.
+
         // Transform the branch.
 
         cfg_ht const default_cfg = cfg_it->output(0); // Where the 'default' case leads.
@@ -16,9 +16,10 @@ class ssa_node_t;
 // Return 'true' on success.
 bool switch_partial_to_full(ssa_node_t& switch_node);
 
-// Converts every SSA_switch_partial node to SSA_switch_full.
+// Lowers every switch, picking the cheapest of a linear compare chain,
+// a binary search, or a jump table (SSA_switch_full).
 // Return 'true' if any node updated.
-bool switch_partial_to_full(ir_t& ir);
+bool lower_switches(ir_t& ir);
 
 using switch_table_t = std::vector<locator_t>;
 
@@ -59,12 +59,14 @@ void parallelize(unsigned const num_threads, Fn const& fn, OnError const& on_err
         }, std::ref(exception_ptrs[i]));
     }
 
+    // Every thread must be joined before rethrowing,
+    // otherwise the remaining threads terminate the program.
     for(unsigned i = 0; i < num_threads; ++i)
-    {
         threads[i].join();
+
+    for(unsigned i = 0; i < num_threads; ++i)
         if(exception_ptrs[i])
             std::rethrow_exception(exception_ptrs[i]);
-    }
 #endif
 }
 